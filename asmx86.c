@@ -21,6 +21,30 @@
 #include <stddef.h>
 #include "asmx86.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FORMAT_SIMD_HEX
+#include <emmintrin.h>
+#if defined(__SSSE3__) || defined(__AVX__)
+#define FORMAT_SIMD_SHUFFLE
+#include <tmmintrin.h>
+#endif
+#endif
+
+#ifdef X86_DECODE_PROFILE
+#ifdef _MSC_VER
+#define PROFILE_THREAD_LOCAL __declspec(thread)
+#else
+#define PROFILE_THREAD_LOCAL __thread
+#endif
+#ifdef X86_DECODE_PROFILE_CYCLES
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+#endif
+
 #define DEC_FLAG_LOCK                   0x0020
 #define DEC_FLAG_REP                    0x0040
 #define DEC_FLAG_REP_COND               0x0080
@@ -38,6 +62,55 @@
 #define DEC_FLAG_REG_RM_FAR_SIZE        0x02
 #define DEC_FLAG_REG_RM_NO_SIZE         0x03
 
+#define ACCESS_NONE                     0
+#define ACCESS_READ                     1
+#define ACCESS_WRITE                    2
+#define ACCESS_READ_WRITE               3
+#define ACCESS_PARTIAL_WRITE            4
+
+#define ACCESS_FORM_SINGLE              0x01
+#define ACCESS_FORM_THREE               0x02
+#define ACCESS_FORM_BYTE                0x04
+#define ACCESS_FORM_VECTOR              0x08
+#define ACCESS_FORM_MEMORY              0x10
+
+#define ENCODING_SIZE_NONE              0
+#define ENCODING_SIZE_BYTE              1
+#define ENCODING_SIZE_VARIABLE          2
+#define ENCODING_SIZE_DWORD_QWORD       3
+#define ENCODING_SIZE_STACK             4
+#define ENCODING_SIZE_REX_W             5
+
+#define ENCODING_OPERAND_NONE           0
+#define ENCODING_OPERAND_REG            1
+#define ENCODING_OPERAND_RM_REG         2
+#define ENCODING_OPERAND_RM             3
+#define ENCODING_OPERAND_MEM            4
+#define ENCODING_OPERAND_OPCODE_REG     5
+#define ENCODING_OPERAND_VEC            6
+#define ENCODING_OPERAND_RM_VEC         7
+#define ENCODING_OPERAND_VEC_RM         8
+#define ENCODING_OPERAND_VVVV_VEC       9
+#define ENCODING_OPERAND_VVVV_REG       10
+#define ENCODING_OPERAND_ACC            11
+#define ENCODING_OPERAND_CL             12
+#define ENCODING_OPERAND_ONE            13
+#define ENCODING_OPERAND_IMM8           14
+#define ENCODING_OPERAND_UIMM8          15
+#define ENCODING_OPERAND_IMM16          16
+#define ENCODING_OPERAND_IMMZ           17
+#define ENCODING_OPERAND_IMMV           18
+#define ENCODING_OPERAND_REL8           19
+#define ENCODING_OPERAND_REL32          20
+#define ENCODING_OPERAND_MOFFS          21
+#define ENCODING_OPERAND_STRING         22
+
+#define ENCODING_MODRM_NONE             0
+#define ENCODING_MODRM_REG              1
+#define ENCODING_MODRM_DIGIT            8
+
+#define ENCODING_VEX_FIXED_LENGTH       0x08
+
 
 #ifdef __cplusplus
 namespace x86
@@ -70,12 +143,62 @@ namespace x86
 		RepPrefix rep;
 		bool using64, rex;
 		bool rexRM1, rexRM2, rexReg;
+		bool vexW, evex;
+		uint8_t vexL, vexReg;
+		uint8_t evexRegHigh, evexRMHigh;
 		int64_t* ripRelFixup;
 	};
 #ifndef __cplusplus
 	typedef struct DecodeState DecodeState;
 #endif
 
+	struct RegisterAccessEntry
+	{
+		uint16_t operands; // 3 bits of ACCESS_* for each operand
+		uint8_t form; // ACCESS_FORM_* flags that must all match for an alternate entry
+		uint8_t alternate; // Next alternate entry to check, most specific first
+		uint8_t writesMask; // Operation clears the opmask register as it completes
+		uint64_t read, written;
+	};
+#ifndef __cplusplus
+	typedef struct RegisterAccessEntry RegisterAccessEntry;
+#endif
+
+	struct FlagEffectsEntry
+	{
+		uint32_t read, written, cleared, set, undefined;
+		uint8_t form, alternate;
+		uint8_t count; // Shift or rotate, effects are for a count of one
+	};
+#ifndef __cplusplus
+	typedef struct FlagEffectsEntry FlagEffectsEntry;
+#endif
+
+	struct DispatchEntry
+	{
+		uint16_t base; // First dispatch id of the operation, used for shapes that are not listed
+		uint16_t shapes; // Offset of the 128 entry shape index table of the operation
+		uint8_t sized; // Number of operands whose size of 1, 2, 4 or 8 bytes selects one of four ids each
+	};
+#ifndef __cplusplus
+	typedef struct DispatchEntry DispatchEntry;
+#endif
+
+	struct EncodingEntry
+	{
+		uint8_t operands[4]; // ENCODING_OPERAND_* for each operand
+		uint8_t operandSizes[4]; // Required size in bytes, or zero for the operand size
+		uint8_t size; // ENCODING_SIZE_*, how the operand size is encoded
+		uint8_t prefix; // Mandatory 66, F2 or F3 prefix of legacy encodings
+		uint16_t vex; // __VEX_* encoding with ENCODING_VEX_FIXED_LENGTH, or zero for legacy encodings
+		uint8_t modrm; // ENCODING_MODRM_REG, or ENCODING_MODRM_DIGIT with the digit in the low bits
+		uint8_t opcodeLength;
+		uint8_t opcode[3];
+	};
+#ifndef __cplusplus
+	typedef struct EncodingEntry EncodingEntry;
+#endif
+
 #include "asmx86str.h"
 
 	typedef void (*DecodingFunction)(DecodeState* state);
@@ -111,6 +234,7 @@ namespace x86
 	static void DecodeGroup0F01(DecodeState* state);
 	static void DecodeGroup0FAE(DecodeState* state);
 	static void Decode0FB8(DecodeState* state);
+	static void DecodeBitScan(DecodeState* state);
 	static void DecodeRMSRegV(DecodeState* state);
 	static void DecodeRM8(DecodeState* state);
 	static void DecodeRMV(DecodeState* state);
@@ -150,6 +274,8 @@ namespace x86
 	static void DecodeMovNti(DecodeState* state);
 	static void DecodeCrc32(DecodeState* state);
 	static void DecodeArpl(DecodeState* state);
+	static void DecodeVEX(DecodeState* state);
+	static void DecodeEVEX(DecodeState* state);
 
 
 // Instruction encodings, first is flags and second is decoder function
@@ -218,6 +344,7 @@ namespace x86
 #define ENC_GROUP_0F01 0, DecodeGroup0F01
 #define ENC_GROUP_0FAE 0, DecodeGroup0FAE
 #define ENC_0FB8 0, Decode0FB8
+#define ENC_BITSCAN 0, DecodeBitScan
 #define ENC_RM_SREG_V 0, DecodeRMSRegV
 #define ENC_SREG_RM_V DEC_FLAG_FLIP_OPERANDS, DecodeRMSRegV
 #define ENC_RM_8 0, DecodeRM8
@@ -282,6 +409,8 @@ namespace x86
 #define ENC_CRC32_8 DEC_FLAG_BYTE, DecodeCrc32
 #define ENC_CRC32_V 0, DecodeCrc32
 #define ENC_ARPL 0, DecodeArpl
+#define ENC_VEX DEC_FLAG_REG_RM_FAR_SIZE, DecodeVEX
+#define ENC_EVEX DEC_FLAG_REG_RM_2X_SIZE, DecodeEVEX
 
 
 	struct InstructionEncoding
@@ -330,7 +459,7 @@ namespace x86
 		{PUSH, ENC_OP_REG_V_DEF64}, {PUSH, ENC_OP_REG_V_DEF64}, {PUSH, ENC_OP_REG_V_DEF64}, {PUSH, ENC_OP_REG_V_DEF64}, // 0x54
 		{POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, // 0x58
 		{POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, {POP, ENC_OP_REG_V_DEF64}, // 0x5c
-		{PUSHA, ENC_OP_SIZE_NO64}, {POPA, ENC_OP_SIZE_NO64}, {BOUND, ENC_REG_RM2X_V}, {ARPL, ENC_ARPL}, // 0x60
+		{PUSHA, ENC_OP_SIZE_NO64}, {POPA, ENC_OP_SIZE_NO64}, {BOUND, ENC_EVEX}, {ARPL, ENC_ARPL}, // 0x60
 		{INVALID, ENC_INVALID}, {INVALID, ENC_INVALID}, {INVALID, ENC_INVALID}, {INVALID, ENC_INVALID}, // 0x64
 		{PUSH, ENC_IMM_V_DEF64}, {IMUL, ENC_REG_RM_IMM_V}, {PUSH, ENC_IMMSX_V_DEF64}, {IMUL, ENC_REG_RM_IMMSX_V}, // 0x68
 		{INSB, ENC_EDI_DX_8_REP}, {INSW, ENC_EDI_DX_OP_SIZE_REP}, {OUTSB, ENC_DX_ESI_8_REP}, {OUTSW, ENC_DX_ESI_OP_SIZE_REP}, // 0x6c
@@ -355,7 +484,7 @@ namespace x86
 		{MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, // 0xb8
 		{MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, {MOV, ENC_OP_REG_IMM_V}, // 0xbc
 		{1, ENC_GROUP_RM_IMM_8}, {1, ENC_GROUP_RM_IMM8_V}, {RETN, ENC_IMM_16}, {RETN, ENC_NO_OPERANDS}, // 0xc0
-		{LES, ENC_REG_RM_F}, {LDS, ENC_REG_RM_F}, {2, ENC_GROUP_RM_IMM_8}, {2, ENC_GROUP_RM_IMM_V}, // 0xc4
+		{LES, ENC_VEX}, {LDS, ENC_VEX}, {2, ENC_GROUP_RM_IMM_8}, {2, ENC_GROUP_RM_IMM_V}, // 0xc4
 		{ENTER, ENC_IMM16_IMM8}, {LEAVE, ENC_NO_OPERANDS}, {RETF, ENC_IMM_16}, {RETF, ENC_NO_OPERANDS}, // 0xc8
 		{INT3, ENC_NO_OPERANDS}, {INT, ENC_IMM_8}, {INTO, ENC_NO_OPERANDS}, {IRET, ENC_NO_OPERANDS}, // 0xcc
 		{1, ENC_GROUP_RM_ONE_8}, {1, ENC_GROUP_RM_ONE_V}, {1, ENC_GROUP_RM_CL_8}, {1, ENC_GROUP_RM_CL_V}, // 0xd0
@@ -422,7 +551,7 @@ namespace x86
 		{CMPXCHG, ENC_RM_REG_8_LOCK}, {CMPXCHG, ENC_RM_REG_V_LOCK}, {LSS, ENC_REG_RM_F}, {BTR, ENC_RM_REG_V}, // 0xb0
 		{LFS, ENC_REG_RM_F}, {LGS, ENC_REG_RM_F}, {MOVZX, ENC_MOVSXZX_8}, {MOVZX, ENC_MOVSXZX_16}, // 0xb4
 		{POPCNT, ENC_0FB8}, {INVALID, ENC_INVALID}, {11, ENC_GROUP_RM_IMM8_V}, {BTC, ENC_RM_REG_V}, // 0xb8
-		{BSF, ENC_REG_RM_V}, {BSR, ENC_REG_RM_V}, {MOVSX, ENC_MOVSXZX_8}, {MOVSX, ENC_MOVSXZX_16}, // 0xbc
+		{BSF, ENC_BITSCAN}, {BSR, ENC_BITSCAN}, {MOVSX, ENC_MOVSXZX_8}, {MOVSX, ENC_MOVSXZX_16}, // 0xbc
 		{XADD, ENC_RM_REG_8}, {XADD, ENC_RM_REG_V_LOCK}, {26, ENC_SSE_TABLE_IMM_8}, {MOVNTI, ENC_MOVNTI}, // 0xc0
 		{27, ENC_PINSRW}, {28, ENC_SSE_TABLE_IMM_8_FLIP}, {29, ENC_SSE_TABLE_IMM_8}, {CMPXCH8B, ENC_CMPXCH8B}, // 0xc4
 		{BSWAP, ENC_OP_REG_V}, {BSWAP, ENC_OP_REG_V}, {BSWAP, ENC_OP_REG_V}, {BSWAP, ENC_OP_REG_V}, // 0xc8
@@ -648,7 +777,7 @@ namespace x86
 			{{MOVUPS, SSE_128, SSE_128}, {MOVUPD, SSE_128, SSE_128}, {MOVSD, SSE_128, SSE_64}, {MOVSS, SSE_128, SSE_32}}
 		},
 		{ // Entry 1
-			{{INVALID, 0, 0}, {MOVHLPS, SSE_128, SSE_128}, {MOVDDUP, SSE_128, SSE_128}, {MOVSLDUP, SSE_128, SSE_128}},
+			{{MOVHLPS, SSE_128, SSE_128}, {INVALID, 0, 0}, {MOVDDUP, SSE_128, SSE_128}, {MOVSLDUP, SSE_128, SSE_128}},
 			{{MOVLPS, SSE_128, SSE_64}, {MOVLPD, SSE_128, SSE_64}, {MOVDDUP, SSE_128, SSE_64}, {MOVSLDUP, SSE_128, SSE_128}}
 		},
 		{ // Entry 2
@@ -664,7 +793,7 @@ namespace x86
 			{{UNPCKHPS, SSE_128, SSE_128}, {UNPCKHPD, SSE_128, SSE_128}, {INVALID, 0, 0}, {INVALID, 0, 0}}
 		},
 		{ // Entry 5
-			{{INVALID, 0, 0}, {MOVLHPS, SSE_128, SSE_128}, {INVALID, 0, 0}, {MOVSHDUP, SSE_128, SSE_128}},
+			{{MOVLHPS, SSE_128, SSE_128}, {INVALID, 0, 0}, {INVALID, 0, 0}, {MOVSHDUP, SSE_128, SSE_128}},
 			{{MOVHPS, SSE_128, SSE_64}, {MOVHPD, SSE_128, SSE_64}, {INVALID, 0, 0}, {MOVSHDUP, SSE_128, SSE_128}}
 		},
 		{ // Entry 6
@@ -902,1842 +1031,9471 @@ namespace x86
 	};
 
 
-	typedef uint8_t RegDef;
-	static const RegDef reg8List[8] = {REG_AL, REG_CL, REG_DL, REG_BL, REG_AH, REG_CH, REG_DH, REG_BH};
-	static const RegDef reg8List64[16] = {REG_AL, REG_CL, REG_DL, REG_BL, REG_SPL, REG_BPL, REG_SIL, REG_DIL,
-		REG_R8B, REG_R9B, REG_R10B, REG_R11B, REG_R12B, REG_R13B, REG_R14B, REG_R15B};
-	static const RegDef reg16List[16] = {REG_AX, REG_CX, REG_DX, REG_BX, REG_SP, REG_BP, REG_SI, REG_DI,
-		REG_R8W, REG_R9W, REG_R10W, REG_R11W, REG_R12W, REG_R13W, REG_R14W, REG_R15W};
-	static const RegDef reg32List[16] = {REG_EAX, REG_ECX, REG_EDX, REG_EBX, REG_ESP, REG_EBP, REG_ESI, REG_EDI,
-		REG_R8D, REG_R9D, REG_R10D, REG_R11D, REG_R12D, REG_R13D, REG_R14D, REG_R15D};
-	static const RegDef reg64List[16] = {REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
-		REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15};
-	static const RegDef mmxRegList[16] = {REG_MM0, REG_MM1, REG_MM2, REG_MM3, REG_MM4, REG_MM5, REG_MM6, REG_MM7,
-		REG_MM0, REG_MM1, REG_MM2, REG_MM3, REG_MM4, REG_MM5, REG_MM6, REG_MM7};
-	static const RegDef xmmRegList[16] = {REG_XMM0, REG_XMM1, REG_XMM2, REG_XMM3, REG_XMM4, REG_XMM5, REG_XMM6, REG_XMM7,
-		REG_XMM8, REG_XMM9, REG_XMM10, REG_XMM11, REG_XMM12, REG_XMM13, REG_XMM14, REG_XMM15};
-	static const RegDef fpuRegList[16] = {REG_ST0, REG_ST1, REG_ST2, REG_ST3, REG_ST4, REG_ST5, REG_ST6, REG_ST7,
-		REG_ST0, REG_ST1, REG_ST2, REG_ST3, REG_ST4, REG_ST5, REG_ST6, REG_ST7};
+	enum VEXTableEncoding
+	{
+		VEX_RM,
+		VEX_MR,
+		VEX_RVM,
+		VEX_RMV,
+		VEX_MVR,
+		VEX_VM,
+		VEX_RMI,
+		VEX_MRI,
+		VEX_RVMI,
+		VEX_RVMR,
+		VEX_VMI,
+		VEX_M,
+		VEX_NO_OPERANDS,
+		VEX_GATHER,
+		VEX_SCATTER,
+		VEX_ENCODING_MASK = 0x0f,
+
+		VEX_INC_OPERATION_FOR_64 = 0x10,
+		VEX_L0 = 0x20,
+		VEX_L1 = 0x40,
+		EVEX_L2 = 0x80,
+		EVEX_BROADCAST = 0x100,
+		EVEX_ROUNDING = 0x200,
+		EVEX_SAE = 0x400,
+		EVEX_ELEMENT_DISP8 = 0x800
+	};
 
+	enum VEXTableOperandType
+	{
+		VEX_VEC,
+		VEX_128,
+		VEX_256,
+		VEX_HALF,
+		VEX_QUARTER,
+		VEX_EIGHTH,
+		VEX_DUP,
+		VEX_8,
+		VEX_16,
+		VEX_32,
+		VEX_64,
+		VEX_MASK,
+		VEX_GPR_32,
+		VEX_GPR_32_OR_64
+	};
 
-	struct RMDef
+	struct VEXTableOperationEntry
 	{
-		OperandType first;
-		OperandType second;
-		SegmentRegister segment;
+		uint16_t operation;
+		uint16_t encoding;
+		uint8_t regType;
+		uint8_t rmType;
 	};
+
 #ifndef __cplusplus
-	typedef struct RMDef RMDef;
+	typedef struct VEXTableOperationEntry VEXTableOperationEntry;
 #endif
 
-
-	static const RegDef* GetByteRegList(DecodeState* state)
-	{
-		if (state->rex)
-			return reg8List64;
-		return reg8List;
-	}
-
-
-	static const RegDef* GetRegListForOpSize(DecodeState* state)
-	{
-		switch (state->opSize)
-		{
-		case 2:
-			return reg16List;
-		case 4:
-			return reg32List;
-		case 8:
-			return reg64List;
-		default:
-			return NULL;
-		}
-	}
-
-
-	static const RegDef* GetRegListForFinalOpSize(DecodeState* state)
-	{
-		switch (state->finalOpSize)
-		{
-		case 1:
-			return GetByteRegList(state);
-		case 2:
-			return reg16List;
-		case 4:
-			return reg32List;
-		case 8:
-			return reg64List;
-		default:
-			return NULL;
-		}
-	}
-
-
-	static const RegDef* GetRegListForAddrSize(DecodeState* state)
-	{
-		switch (state->addrSize)
-		{
-		case 2:
-			return reg16List;
-		case 4:
-			return reg32List;
-		case 8:
-			return reg64List;
-		default:
-			return NULL;
-		}
-	}
-
-
-	static uint16_t GetFinalOpSize(DecodeState* state)
-	{
-		if (state->flags & DEC_FLAG_BYTE)
-			return 1;
-		return state->opSize;
-	}
-
-
-	static uint8_t Read8(DecodeState* state)
-	{
-		uint8_t val;
-
-		if (state->len < 1)
-		{
-			// Read past end of buffer, returning 0xcc from now on will guarantee exit
-			state->invalid = true;
-			state->insufficientLength = true;
-			state->len = 0;
-			return 0xcc;
-		}
-
-		val = *(state->opcode++);
-		state->len--;
-		return val;
-	}
-
-
-	static uint8_t Peek8(DecodeState* state)
-	{
-		uint8_t val;
-
-		if (state->len < 1)
-		{
-			// Read past end of buffer, returning 0xcc from now on will guarantee exit
-			state->invalid = true;
-			state->insufficientLength = true;
-			state->len = 0;
-			return 0xcc;
-		}
-
-		val = *state->opcode;
-		return val;
-	}
-
-
-	static uint16_t Read16(DecodeState* state)
-	{
-		uint16_t val;
-
-		if (state->len < 2)
-		{
-			// Read past end of buffer
-			state->invalid = true;
-			state->insufficientLength = true;
-			state->len = 0;
-			return 0;
-		}
-
-		val = *((uint16_t*)state->opcode);
-		state->opcode += 2;
-		state->len -= 2;
-		return val;
-	}
-
-
-	static uint32_t Read32(DecodeState* state)
-	{
-		uint32_t val;
-
-		if (state->len < 4)
-		{
-			// Read past end of buffer
-			state->invalid = true;
-			state->insufficientLength = true;
-			state->len = 0;
-			return 0;
-		}
-
-		val = *((uint32_t*)state->opcode);
-		state->opcode += 4;
-		state->len -= 4;
-		return val;
-	}
-
-
-	static uint64_t Read64(DecodeState* state)
-	{
-		uint64_t val;
-
-		if (state->len < 8)
-		{
-			// Read past end of buffer
-			state->invalid = true;
-			state->insufficientLength = true;
-			state->len = 0;
-			return 0;
-		}
-
-		val = *((uint64_t*)state->opcode);
-		state->opcode += 8;
-		state->len -= 8;
-		return val;
-	}
-
-
-	static int64_t ReadSigned8(DecodeState* state)
-	{
-		return (int64_t)(int8_t)Read8(state);
-	}
-
-
-	static int64_t ReadSigned16(DecodeState* state)
-	{
-		return (int64_t)(int16_t)Read16(state);
-	}
-
-
-	static int64_t ReadSigned32(DecodeState* state)
-	{
-		return (int64_t)(int32_t)Read32(state);
-	}
-
-
-	static int64_t ReadFinalOpSize(DecodeState* state)
+	struct VEXTableEntry
 	{
-		if (state->flags & DEC_FLAG_IMM_SX)
-			return ReadSigned8(state);
-		switch (state->finalOpSize)
-		{
-		case 1:
-			return Read8(state);
-		case 2:
-			return Read16(state);
-		case 4:
-			return Read32(state);
-		case 8:
-			return ReadSigned32(state);
-		}
-		return 0;
-	}
+		uint8_t opcode, w;
+		VEXTableOperationEntry regOps[4];
+		VEXTableOperationEntry memOps[4];
+	};
 
+#ifndef __cplusplus
+	typedef struct VEXTableEntry VEXTableEntry;
+#endif
 
-	static int64_t ReadAddrSize(DecodeState* state)
+	static const VEXTableEntry vex0FMap[] =
 	{
-		switch (state->addrSize)
+		{0x10, 0,
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_RVM, VEX_128, VEX_128}, {VMOVSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_RM, VEX_128, VEX_64}, {VMOVSS, VEX_RM, VEX_128, VEX_32}}
+		},
+		{0x10, 1,
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_RVM, VEX_128, VEX_128}, {VMOVSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_RM, VEX_128, VEX_64}, {VMOVSS, VEX_RM, VEX_128, VEX_32}}
+		},
+		{0x11, 0,
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_MVR, VEX_128, VEX_128}, {VMOVSS, VEX_MVR, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_MR, VEX_128, VEX_64}, {VMOVSS, VEX_MR, VEX_128, VEX_32}}
+		},
+		{0x11, 1,
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_MVR, VEX_128, VEX_128}, {VMOVSS, VEX_MVR, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVSD, VEX_MR, VEX_128, VEX_64}, {VMOVSS, VEX_MR, VEX_128, VEX_32}}
+		},
+		{0x12, 0,
+			{{VMOVHLPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {VMOVDDUP, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVLPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {VMOVLPD, VEX_RVM | VEX_L0, VEX_128, VEX_64},
+				{VMOVDDUP, VEX_RM, VEX_VEC, VEX_DUP}, {VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x12, 1,
+			{{VMOVHLPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {VMOVDDUP, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVLPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {VMOVLPD, VEX_RVM | VEX_L0, VEX_128, VEX_64},
+				{VMOVDDUP, VEX_RM, VEX_VEC, VEX_DUP}, {VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x13, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVLPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {VMOVLPD, VEX_MR | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x13, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVLPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {VMOVLPD, VEX_MR | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 0,
+			{{VUNPCKLPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKLPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKLPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKLPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x14, 1,
+			{{VUNPCKLPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKLPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKLPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKLPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x15, 0,
+			{{VUNPCKHPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKHPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKHPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKHPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x15, 1,
+			{{VUNPCKHPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKHPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKHPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VUNPCKHPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{VMOVLHPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVHPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {VMOVHPD, VEX_RVM | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x16, 1,
+			{{VMOVLHPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVHPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {VMOVHPD, VEX_RVM | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x17, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVHPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {VMOVHPD, VEX_MR | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVHPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {VMOVHPD, VEX_MR | VEX_L0, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 0,
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x28, 1,
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x29, 0,
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x29, 1,
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x2a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x2b, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVNTPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVNTPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2b, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVNTPS, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVNTPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2c, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2c, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2d, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2d, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2SI, VEX_RM, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2e, 0,
+			{{VUCOMISS, VEX_RM, VEX_128, VEX_128}, {VUCOMISD, VEX_RM, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUCOMISS, VEX_RM, VEX_128, VEX_32}, {VUCOMISD, VEX_RM, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2e, 1,
+			{{VUCOMISS, VEX_RM, VEX_128, VEX_128}, {VUCOMISD, VEX_RM, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUCOMISS, VEX_RM, VEX_128, VEX_32}, {VUCOMISD, VEX_RM, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2f, 0,
+			{{VCOMISS, VEX_RM, VEX_128, VEX_128}, {VCOMISD, VEX_RM, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VCOMISS, VEX_RM, VEX_128, VEX_32}, {VCOMISD, VEX_RM, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2f, 1,
+			{{VCOMISS, VEX_RM, VEX_128, VEX_128}, {VCOMISD, VEX_RM, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VCOMISS, VEX_RM, VEX_128, VEX_32}, {VCOMISD, VEX_RM, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x41, 0,
+			{{KANDW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KANDB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x41, 1,
+			{{KANDQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KANDD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x42, 0,
+			{{KANDNW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KANDNB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x42, 1,
+			{{KANDNQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KANDND, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x44, 0,
+			{{KNOTW, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KNOTB, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x44, 1,
+			{{KNOTQ, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KNOTD, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x45, 0,
+			{{KORW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KORB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x45, 1,
+			{{KORQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KORD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x46, 0,
+			{{KXNORW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KXNORB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x46, 1,
+			{{KXNORQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KXNORD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x47, 0,
+			{{KXORW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KXORB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x47, 1,
+			{{KXORQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KXORD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4a, 0,
+			{{KADDW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KADDB, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4a, 1,
+			{{KADDQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KADDD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4b, 0,
+			{{KUNPCKWD, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {KUNPCKBW, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4b, 1,
+			{{KUNPCKDQ, VEX_RVM | VEX_L1, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x50, 0,
+			{{VMOVMSKPS, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC}, {VMOVMSKPD, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x50, 1,
+			{{VMOVMSKPS, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC}, {VMOVMSKPD, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x51, 0,
+			{{VSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {VSQRTPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM, VEX_128, VEX_128}, {VSQRTSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {VSQRTPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM, VEX_128, VEX_64}, {VSQRTSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x51, 1,
+			{{VSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {VSQRTPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM, VEX_128, VEX_128}, {VSQRTSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {VSQRTPD, VEX_RM, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM, VEX_128, VEX_64}, {VSQRTSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x52, 0,
+			{{VRSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRSQRTSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VRSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRSQRTSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x52, 1,
+			{{VRSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRSQRTSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VRSQRTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRSQRTSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x53, 0,
+			{{VRCPPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRCPSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VRCPPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRCPSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x53, 1,
+			{{VRCPPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRCPSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VRCPPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VRCPSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x54, 0,
+			{{VANDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x54, 1,
+			{{VANDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x55, 0,
+			{{VANDNPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDNPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDNPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDNPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x55, 1,
+			{{VANDNPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDNPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDNPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VANDNPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 0,
+			{{VORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 1,
+			{{VORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 0,
+			{{VXORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VXORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VXORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VXORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 1,
+			{{VXORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VXORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VXORPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VXORPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x58, 0,
+			{{VADDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM, VEX_128, VEX_128}, {VADDSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VADDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM, VEX_128, VEX_64}, {VADDSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x58, 1,
+			{{VADDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM, VEX_128, VEX_128}, {VADDSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VADDPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM, VEX_128, VEX_64}, {VADDSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x59, 0,
+			{{VMULPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMULPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM, VEX_128, VEX_128}, {VMULSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMULPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMULPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM, VEX_128, VEX_64}, {VMULSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x59, 1,
+			{{VMULPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMULPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM, VEX_128, VEX_128}, {VMULSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMULPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMULPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM, VEX_128, VEX_64}, {VMULSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5a, 0,
+			{{VCVTPS2PD, VEX_RM, VEX_VEC, VEX_128}, {VCVTPD2PS, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM, VEX_128, VEX_128}, {VCVTSS2SD, VEX_RVM, VEX_128, VEX_128}},
+			{{VCVTPS2PD, VEX_RM, VEX_VEC, VEX_HALF}, {VCVTPD2PS, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM, VEX_128, VEX_64}, {VCVTSS2SD, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5a, 1,
+			{{VCVTPS2PD, VEX_RM, VEX_VEC, VEX_128}, {VCVTPD2PS, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM, VEX_128, VEX_128}, {VCVTSS2SD, VEX_RVM, VEX_128, VEX_128}},
+			{{VCVTPS2PD, VEX_RM, VEX_VEC, VEX_HALF}, {VCVTPD2PS, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM, VEX_128, VEX_64}, {VCVTSS2SD, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5b, 0,
+			{{VCVTDQ2PS, VEX_RM, VEX_VEC, VEX_VEC}, {VCVTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VCVTDQ2PS, VEX_RM, VEX_VEC, VEX_VEC}, {VCVTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x5b, 1,
+			{{VCVTDQ2PS, VEX_RM, VEX_VEC, VEX_VEC}, {VCVTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VCVTDQ2PS, VEX_RM, VEX_VEC, VEX_VEC}, {VCVTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x5c, 0,
+			{{VSUBPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VSUBPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM, VEX_128, VEX_128}, {VSUBSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VSUBPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VSUBPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM, VEX_128, VEX_64}, {VSUBSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5c, 1,
+			{{VSUBPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VSUBPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM, VEX_128, VEX_128}, {VSUBSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VSUBPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VSUBPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM, VEX_128, VEX_64}, {VSUBSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5d, 0,
+			{{VMINPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMINPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM, VEX_128, VEX_128}, {VMINSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMINPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMINPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM, VEX_128, VEX_64}, {VMINSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5d, 1,
+			{{VMINPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMINPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM, VEX_128, VEX_128}, {VMINSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMINPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMINPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM, VEX_128, VEX_64}, {VMINSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5e, 0,
+			{{VDIVPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VDIVPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM, VEX_128, VEX_128}, {VDIVSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VDIVPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VDIVPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM, VEX_128, VEX_64}, {VDIVSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5e, 1,
+			{{VDIVPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VDIVPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM, VEX_128, VEX_128}, {VDIVSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VDIVPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VDIVPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM, VEX_128, VEX_64}, {VDIVSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5f, 0,
+			{{VMAXPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMAXPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM, VEX_128, VEX_128}, {VMAXSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMAXPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMAXPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM, VEX_128, VEX_64}, {VMAXSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x5f, 1,
+			{{VMAXPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMAXPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM, VEX_128, VEX_128}, {VMAXSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMAXPS, VEX_RVM, VEX_VEC, VEX_VEC}, {VMAXPD, VEX_RVM, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM, VEX_128, VEX_64}, {VMAXSS, VEX_RVM, VEX_128, VEX_32}}
+		},
+		{0x60, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x60, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x61, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x61, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x62, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x62, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x63, 0,
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x63, 1,
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x64, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x64, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x65, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x65, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x66, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x66, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x67, 0,
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x67, 1,
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x68, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x68, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x69, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x69, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6a, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6a, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6b, 0,
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6b, 1,
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6c, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6c, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6d, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6d, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6e, 0,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6e, 1,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6f, 0,
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x6f, 1,
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x70, 0,
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}}
+		},
+		{0x70, 1,
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}}
+		},
+		{0x71, 0,
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x71, 1,
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x72, 0,
+			{{INVALID, 0, 0, 0}, {1, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x72, 1,
+			{{INVALID, 0, 0, 0}, {1, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x73, 0,
+			{{INVALID, 0, 0, 0}, {2, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x73, 1,
+			{{INVALID, 0, 0, 0}, {2, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x74, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x74, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x76, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x76, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x77, 0,
+			{{VZEROUPPER, VEX_NO_OPERANDS, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VZEROUPPER, VEX_NO_OPERANDS, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x77, 1,
+			{{VZEROUPPER, VEX_NO_OPERANDS, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VZEROUPPER, VEX_NO_OPERANDS, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7c, 0,
+			{{INVALID, 0, 0, 0}, {VHADDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHADDPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VHADDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHADDPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7c, 1,
+			{{INVALID, 0, 0, 0}, {VHADDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHADDPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VHADDPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHADDPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7d, 0,
+			{{INVALID, 0, 0, 0}, {VHSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VHSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7d, 1,
+			{{INVALID, 0, 0, 0}, {VHSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VHSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VHSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7e, 0,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_128}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_64}}
+		},
+		{0x7e, 1,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_128}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_64}}
+		},
+		{0x7f, 0,
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_MR, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_MR, VEX_VEC, VEX_VEC}}
+		},
+		{0x7f, 1,
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_MR, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VMOVDQU, VEX_MR, VEX_VEC, VEX_VEC}}
+		},
+		{0x90, 0,
+			{{KMOVW, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KMOVB, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{KMOVW, VEX_RM | VEX_L0, VEX_MASK, VEX_16}, {KMOVB, VEX_RM | VEX_L0, VEX_MASK, VEX_8}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x90, 1,
+			{{KMOVQ, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KMOVD, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{KMOVQ, VEX_RM | VEX_L0, VEX_MASK, VEX_64}, {KMOVD, VEX_RM | VEX_L0, VEX_MASK, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x91, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{KMOVW, VEX_MR | VEX_L0, VEX_MASK, VEX_16}, {KMOVB, VEX_MR | VEX_L0, VEX_MASK, VEX_8}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x91, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{KMOVQ, VEX_MR | VEX_L0, VEX_MASK, VEX_64}, {KMOVD, VEX_MR | VEX_L0, VEX_MASK, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x92, 0,
+			{{KMOVW, VEX_RM | VEX_L0, VEX_MASK, VEX_GPR_32}, {KMOVB, VEX_RM | VEX_L0, VEX_MASK, VEX_GPR_32},
+				{KMOVD, VEX_RM | VEX_L0, VEX_MASK, VEX_GPR_32}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x92, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{KMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_MASK, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 0,
+			{{KMOVW, VEX_RM | VEX_L0, VEX_GPR_32, VEX_MASK}, {KMOVB, VEX_RM | VEX_L0, VEX_GPR_32, VEX_MASK},
+				{KMOVD, VEX_RM | VEX_L0, VEX_GPR_32, VEX_MASK}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{KMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_GPR_32_OR_64, VEX_MASK}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 0,
+			{{KORTESTW, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KORTESTB, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 1,
+			{{KORTESTQ, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KORTESTD, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x99, 0,
+			{{KTESTW, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KTESTB, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x99, 1,
+			{{KTESTQ, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK}, {KTESTD, VEX_RM | VEX_L0, VEX_MASK, VEX_MASK},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xae, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{4, VEX_M | VEX_L0, 0, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xae, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{4, VEX_M | VEX_L0, 0, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc2, 0,
+			{{VCMPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VCMPPD, VEX_RVMI, VEX_VEC, VEX_VEC},
+				{VCMPSD, VEX_RVMI, VEX_128, VEX_128}, {VCMPSS, VEX_RVMI, VEX_128, VEX_128}},
+			{{VCMPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VCMPPD, VEX_RVMI, VEX_VEC, VEX_VEC},
+				{VCMPSD, VEX_RVMI, VEX_128, VEX_64}, {VCMPSS, VEX_RVMI, VEX_128, VEX_32}}
+		},
+		{0xc2, 1,
+			{{VCMPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VCMPPD, VEX_RVMI, VEX_VEC, VEX_VEC},
+				{VCMPSD, VEX_RVMI, VEX_128, VEX_128}, {VCMPSS, VEX_RVMI, VEX_128, VEX_128}},
+			{{VCMPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VCMPPD, VEX_RVMI, VEX_VEC, VEX_VEC},
+				{VCMPSD, VEX_RVMI, VEX_128, VEX_64}, {VCMPSS, VEX_RVMI, VEX_128, VEX_32}}
+		},
+		{0xc4, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc4, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc5, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_RMI | VEX_L0, VEX_GPR_32, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc5, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_RMI | VEX_L0, VEX_GPR_32, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc6, 0,
+			{{VSHUFPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VSHUFPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VSHUFPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VSHUFPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xc6, 1,
+			{{VSHUFPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VSHUFPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VSHUFPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {VSHUFPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xd0, 0,
+			{{INVALID, 0, 0, 0}, {VADDSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VADDSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xd0, 1,
+			{{INVALID, 0, 0, 0}, {VADDSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VADDSUBPD, VEX_RVM, VEX_VEC, VEX_VEC}, {VADDSUBPS, VEX_RVM, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xd1, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd1, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd2, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd2, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd3, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd3, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd4, 0,
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd4, 1,
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd5, 0,
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd5, 1,
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd6, 0,
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd6, 1,
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd7, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVMSKB, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd7, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVMSKB, VEX_RM, VEX_GPR_32_OR_64, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xda, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xda, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdb, 0,
+			{{INVALID, 0, 0, 0}, {VPAND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdb, 1,
+			{{INVALID, 0, 0, 0}, {VPAND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 0,
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 1,
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 0,
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 1,
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 0,
+			{{INVALID, 0, 0, 0}, {VPANDN, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDN, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 1,
+			{{INVALID, 0, 0, 0}, {VPANDN, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDN, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe0, 0,
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe0, 1,
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe1, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe1, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe2, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe2, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe3, 0,
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe3, 1,
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe4, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe4, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe5, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe5, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe6, 0,
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM, VEX_128, VEX_VEC}, {VCVTPD2DQ, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTDQ2PD, VEX_RM, VEX_VEC, VEX_128}},
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM, VEX_128, VEX_VEC}, {VCVTPD2DQ, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTDQ2PD, VEX_RM, VEX_VEC, VEX_HALF}}
+		},
+		{0xe6, 1,
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM, VEX_128, VEX_VEC}, {VCVTPD2DQ, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTDQ2PD, VEX_RM, VEX_VEC, VEX_128}},
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM, VEX_128, VEX_VEC}, {VCVTPD2DQ, VEX_RM, VEX_128, VEX_VEC},
+				{VCVTDQ2PD, VEX_RM, VEX_VEC, VEX_HALF}}
+		},
+		{0xe7, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQ, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe7, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQ, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xea, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xea, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xeb, 0,
+			{{INVALID, 0, 0, 0}, {VPOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xeb, 1,
+			{{INVALID, 0, 0, 0}, {VPOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xec, 0,
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xec, 1,
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xed, 0,
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xed, 1,
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xee, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xee, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xef, 0,
+			{{INVALID, 0, 0, 0}, {VPXOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPXOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xef, 1,
+			{{INVALID, 0, 0, 0}, {VPXOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPXOR, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf0, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VLDDQU, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}}
+		},
+		{0xf0, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VLDDQU, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}}
+		},
+		{0xf1, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf1, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf2, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf2, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf3, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf3, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf4, 0,
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf4, 1,
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf5, 0,
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf5, 1,
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf6, 0,
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf6, 1,
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf7, 0,
+			{{INVALID, 0, 0, 0}, {VMASKMOVDQU, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf7, 1,
+			{{INVALID, 0, 0, 0}, {VMASKMOVDQU, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfa, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfa, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfb, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfb, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfc, 0,
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfc, 1,
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfd, 0,
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfd, 1,
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfe, 0,
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfe, 1,
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		}
+	};
+
+
+	static const VEXTableEntry vex0F38Map[] =
+	{
+		{0x00, 0,
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x00, 1,
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x01, 0,
+			{{INVALID, 0, 0, 0}, {VPHADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x01, 1,
+			{{INVALID, 0, 0, 0}, {VPHADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x02, 0,
+			{{INVALID, 0, 0, 0}, {VPHADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x02, 1,
+			{{INVALID, 0, 0, 0}, {VPHADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x03, 0,
+			{{INVALID, 0, 0, 0}, {VPHADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x03, 1,
+			{{INVALID, 0, 0, 0}, {VPHADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x04, 0,
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x04, 1,
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x05, 0,
+			{{INVALID, 0, 0, 0}, {VPHSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x05, 1,
+			{{INVALID, 0, 0, 0}, {VPHSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x06, 0,
+			{{INVALID, 0, 0, 0}, {VPHSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x06, 1,
+			{{INVALID, 0, 0, 0}, {VPHSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x07, 0,
+			{{INVALID, 0, 0, 0}, {VPHSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x07, 1,
+			{{INVALID, 0, 0, 0}, {VPHSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x08, 0,
+			{{INVALID, 0, 0, 0}, {VPSIGNB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGNB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x08, 1,
+			{{INVALID, 0, 0, 0}, {VPSIGNB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGNB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x09, 0,
+			{{INVALID, 0, 0, 0}, {VPSIGNW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGNW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x09, 1,
+			{{INVALID, 0, 0, 0}, {VPSIGNW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGNW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0a, 0,
+			{{INVALID, 0, 0, 0}, {VPSIGND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0a, 1,
+			{{INVALID, 0, 0, 0}, {VPSIGND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSIGND, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0c, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0d, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0e, 0,
+			{{INVALID, 0, 0, 0}, {VTESTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VTESTPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0f, 0,
+			{{INVALID, 0, 0, 0}, {VTESTPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VTESTPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x13, 0,
+			{{INVALID, 0, 0, 0}, {VCVTPH2PS, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCVTPH2PS, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{INVALID, 0, 0, 0}, {VPERMPS, VEX_RVM | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMPS, VEX_RVM | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 0,
+			{{INVALID, 0, 0, 0}, {VPTEST, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPTEST, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 1,
+			{{INVALID, 0, 0, 0}, {VPTEST, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPTEST, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x18, 0,
+			{{INVALID, 0, 0, 0}, {VBROADCASTSS, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTSS, VEX_RM, VEX_VEC, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x19, 0,
+			{{INVALID, 0, 0, 0}, {VBROADCASTSD, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTSD, VEX_RM | VEX_L1, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF128, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1c, 0,
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1c, 1,
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1d, 0,
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1d, 1,
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1e, 0,
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1e, 1,
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x20, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x20, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x21, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x21, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x22, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x22, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x23, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x23, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x24, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x24, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x25, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x25, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 0,
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 1,
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x29, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x29, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2b, 0,
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2b, 1,
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2c, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMASKMOVPS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2d, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMASKMOVPD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2e, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMASKMOVPS, VEX_MVR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2f, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMASKMOVPD, VEX_MVR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x30, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x30, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x31, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x31, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x32, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x32, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x33, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x33, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x34, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x34, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x35, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x35, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x36, 0,
+			{{INVALID, 0, 0, 0}, {VPERMD, VEX_RVM | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMD, VEX_RVM | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x37, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x37, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x38, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x38, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x39, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x39, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3a, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3a, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3b, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3b, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3c, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3c, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3d, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3d, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3e, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3e, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3f, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3f, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x40, 0,
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x40, 1,
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x41, 0,
+			{{INVALID, 0, 0, 0}, {VPHMINPOSUW, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHMINPOSUW, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x41, 1,
+			{{INVALID, 0, 0, 0}, {VPHMINPOSUW, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPHMINPOSUW, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x45, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x45, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLVQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLVQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x46, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x47, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x47, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLVQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLVQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x58, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM, VEX_VEC, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x59, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTQ, VEX_RM, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x5a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI128, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x78, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTB, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTB, VEX_RM, VEX_VEC, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x79, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTW, VEX_RM, VEX_VEC, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x8c, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMASKMOVD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x8c, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMASKMOVQ, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x8e, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMASKMOVD, VEX_MVR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x8e, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMASKMOVQ, VEX_MVR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x90, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERDD, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x90, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERDQ, VEX_GATHER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x91, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERQD, VEX_GATHER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x91, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERQQ, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x92, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERDPS, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x92, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERDPD, VEX_GATHER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERQPS, VEX_GATHER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERQPD, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x96, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x96, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x97, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x97, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x99, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD132SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x99, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD132SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9a, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9a, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9b, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB132SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9b, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB132SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9c, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9c, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9d, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD132SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9d, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD132SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9e, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9e, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9f, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9f, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa6, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa6, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa7, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa7, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa8, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa8, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa9, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD213SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa9, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD213SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaa, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaa, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xab, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB213SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xab, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB213SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xac, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xac, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xad, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD213SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xad, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD213SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xae, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xae, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaf, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaf, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb6, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb6, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb7, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb7, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb8, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb8, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb9, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD231SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb9, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD231SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xba, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xba, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbb, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB231SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbb, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB231SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbc, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbc, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbd, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD231SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbd, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD231SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbe, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PS, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbe, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbf, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbf, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdb, 0,
+			{{INVALID, 0, 0, 0}, {VAESIMC, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESIMC, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdb, 1,
+			{{INVALID, 0, 0, 0}, {VAESIMC, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESIMC, VEX_RM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 0,
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 1,
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 0,
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 1,
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 0,
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 1,
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 0,
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 1,
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf2, 0,
+			{{ANDN, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{ANDN, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf2, 1,
+			{{ANDN, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{ANDN, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf3, 0,
+			{{3, VEX_VM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{3, VEX_VM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf3, 1,
+			{{3, VEX_VM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{3, VEX_VM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf5, 0,
+			{{BZHI, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0},
+				{PDEP, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{PEXT, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}},
+			{{BZHI, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0},
+				{PDEP, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{PEXT, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}}
+		},
+		{0xf5, 1,
+			{{BZHI, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0},
+				{PDEP, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{PEXT, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}},
+			{{BZHI, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}, {INVALID, 0, 0, 0},
+				{PDEP, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{PEXT, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}}
+		},
+		{0xf6, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {MULX, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {MULX, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf6, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {MULX, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {MULX, VEX_RVM | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf7, 0,
+			{{BEXTR, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHLX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHRX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SARX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}},
+			{{BEXTR, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHLX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHRX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SARX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}}
+		},
+		{0xf7, 1,
+			{{BEXTR, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHLX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHRX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SARX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}},
+			{{BEXTR, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHLX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SHRX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{SARX, VEX_RMV | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64}}
+		}
+	};
+
+
+	static const VEXTableEntry vex0F3AMap[] =
+	{
+		{0x00, 1,
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x01, 1,
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x02, 0,
+			{{INVALID, 0, 0, 0}, {VPBLENDD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x04, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x05, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x06, 0,
+			{{INVALID, 0, 0, 0}, {VPERM2F128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERM2F128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x08, 0,
+			{{INVALID, 0, 0, 0}, {VROUNDPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x08, 1,
+			{{INVALID, 0, 0, 0}, {VROUNDPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDPS, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x09, 0,
+			{{INVALID, 0, 0, 0}, {VROUNDPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x09, 1,
+			{{INVALID, 0, 0, 0}, {VROUNDPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDPD, VEX_RMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0a, 0,
+			{{INVALID, 0, 0, 0}, {VROUNDSS, VEX_RVMI, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDSS, VEX_RVMI, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0a, 1,
+			{{INVALID, 0, 0, 0}, {VROUNDSS, VEX_RVMI, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDSS, VEX_RVMI, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 0,
+			{{INVALID, 0, 0, 0}, {VROUNDSD, VEX_RVMI, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDSD, VEX_RVMI, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 1,
+			{{INVALID, 0, 0, 0}, {VROUNDSD, VEX_RVMI, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VROUNDSD, VEX_RVMI, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0c, 0,
+			{{INVALID, 0, 0, 0}, {VBLENDPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0c, 1,
+			{{INVALID, 0, 0, 0}, {VBLENDPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0d, 0,
+			{{INVALID, 0, 0, 0}, {VBLENDPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0d, 1,
+			{{INVALID, 0, 0, 0}, {VBLENDPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDPD, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0e, 0,
+			{{INVALID, 0, 0, 0}, {VPBLENDW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0e, 1,
+			{{INVALID, 0, 0, 0}, {VPBLENDW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0f, 0,
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0f, 1,
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x15, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x15, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x16, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x17, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x18, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTF128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTF128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x19, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTF128, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTF128, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1d, 0,
+			{{INVALID, 0, 0, 0}, {VCVTPS2PH, VEX_MRI, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCVTPS2PH, VEX_MRI, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x20, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x20, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x21, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x21, 1,
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x22, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x22, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x30, 0,
+			{{INVALID, 0, 0, 0}, {KSHIFTRB, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x30, 1,
+			{{INVALID, 0, 0, 0}, {KSHIFTRW, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x31, 0,
+			{{INVALID, 0, 0, 0}, {KSHIFTRD, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x31, 1,
+			{{INVALID, 0, 0, 0}, {KSHIFTRQ, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x32, 0,
+			{{INVALID, 0, 0, 0}, {KSHIFTLB, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x32, 1,
+			{{INVALID, 0, 0, 0}, {KSHIFTLW, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x33, 0,
+			{{INVALID, 0, 0, 0}, {KSHIFTLD, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x33, 1,
+			{{INVALID, 0, 0, 0}, {KSHIFTLQ, VEX_RMI | VEX_L0, VEX_MASK, VEX_MASK}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x38, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTI128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTI128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x39, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTI128, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTI128, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x40, 0,
+			{{INVALID, 0, 0, 0}, {VDPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x40, 1,
+			{{INVALID, 0, 0, 0}, {VDPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDPPS, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x41, 0,
+			{{INVALID, 0, 0, 0}, {VDPPD, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDPPD, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x41, 1,
+			{{INVALID, 0, 0, 0}, {VDPPD, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDPPD, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x42, 0,
+			{{INVALID, 0, 0, 0}, {VMPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x42, 1,
+			{{INVALID, 0, 0, 0}, {VMPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x44, 0,
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x44, 1,
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x46, 0,
+			{{INVALID, 0, 0, 0}, {VPERM2I128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERM2I128, VEX_RVMI | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4a, 0,
+			{{INVALID, 0, 0, 0}, {VBLENDVPS, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDVPS, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4b, 0,
+			{{INVALID, 0, 0, 0}, {VBLENDVPD, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDVPD, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4c, 0,
+			{{INVALID, 0, 0, 0}, {VPBLENDVB, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDVB, VEX_RVMR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x60, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPESTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPESTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x60, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPESTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPESTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x61, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPESTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPESTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x61, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPESTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPESTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x62, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPISTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPISTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x62, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPISTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPISTRM, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x63, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPISTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPISTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x63, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPISTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPISTRI, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdf, 0,
+			{{INVALID, 0, 0, 0}, {VAESKEYGENASSIST, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESKEYGENASSIST, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdf, 1,
+			{{INVALID, 0, 0, 0}, {VAESKEYGENASSIST, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESKEYGENASSIST, VEX_RMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf0, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {RORX, VEX_RMI | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {RORX, VEX_RMI | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf0, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {RORX, VEX_RMI | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {RORX, VEX_RMI | VEX_L0, VEX_GPR_32_OR_64, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}}
+		}
+	};
+
+	static const VEXTableEntry evex0FMap[] =
+	{
+		{0x10, 0,
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSS, VEX_RVM, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSS, VEX_RM, VEX_128, VEX_32}}
+		},
+		{0x10, 1,
+			{{INVALID, 0, 0, 0}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVSD, VEX_RVM, VEX_128, VEX_128},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVUPD, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVSD, VEX_RM, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x11, 0,
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSS, VEX_MVR, VEX_128, VEX_128}},
+			{{VMOVUPS, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSS, VEX_MR, VEX_128, VEX_32}}
+		},
+		{0x11, 1,
+			{{INVALID, 0, 0, 0}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVSD, VEX_MVR, VEX_128, VEX_128},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVUPD, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVSD, VEX_MR, VEX_128, VEX_64},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x12, 0,
+			{{VMOVHLPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVLPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSLDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x12, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VMOVDDUP, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVLPD, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {VMOVDDUP, VEX_RM, VEX_VEC, VEX_DUP},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x13, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVLPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x13, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVLPD, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 0,
+			{{VUNPCKLPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKLPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x14, 1,
+			{{INVALID, 0, 0, 0}, {VUNPCKLPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VUNPCKLPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x15, 0,
+			{{VUNPCKHPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUNPCKHPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x15, 1,
+			{{INVALID, 0, 0, 0}, {VUNPCKHPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VUNPCKHPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{VMOVLHPS, VEX_RVM | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{VMOVHPS, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMOVSHDUP, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x16, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVHPD, VEX_RVM | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVHPS, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVHPD, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 0,
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 1,
+			{{INVALID, 0, 0, 0}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVAPD, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x29, 0,
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVAPS, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x29, 1,
+			{{INVALID, 0, 0, 0}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVAPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x2a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSI2SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x2b, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VMOVNTPS, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2b, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTPD, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2c, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2c, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTTSD2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2SI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2d, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2d, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VCVTSD2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2SI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x2e, 0,
+			{{VUCOMISS, VEX_RM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VUCOMISS, VEX_RM | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2e, 1,
+			{{INVALID, 0, 0, 0}, {VUCOMISD, VEX_RM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VUCOMISD, VEX_RM | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2f, 0,
+			{{VCOMISS, VEX_RM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VCOMISS, VEX_RM | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2f, 1,
+			{{INVALID, 0, 0, 0}, {VCOMISD, VEX_RM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCOMISD, VEX_RM | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x51, 0,
+			{{VSQRTPS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VSQRTSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}},
+			{{VSQRTPS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VSQRTSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}}
+		},
+		{0x51, 1,
+			{{INVALID, 0, 0, 0}, {VSQRTPD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSQRTPD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VSQRTSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x54, 0,
+			{{VANDPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x54, 1,
+			{{INVALID, 0, 0, 0}, {VANDPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VANDPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x55, 0,
+			{{VANDNPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VANDNPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x55, 1,
+			{{INVALID, 0, 0, 0}, {VANDNPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VANDNPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 0,
+			{{VORPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VORPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 1,
+			{{INVALID, 0, 0, 0}, {VORPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VORPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 0,
+			{{VXORPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VXORPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 1,
+			{{INVALID, 0, 0, 0}, {VXORPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VXORPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x58, 0,
+			{{VADDPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VADDSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}},
+			{{VADDPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VADDSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}}
+		},
+		{0x58, 1,
+			{{INVALID, 0, 0, 0}, {VADDPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VADDPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VADDSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x59, 0,
+			{{VMULPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VMULSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}},
+			{{VMULPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VMULSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}}
+		},
+		{0x59, 1,
+			{{INVALID, 0, 0, 0}, {VMULPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMULPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VMULSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x5a, 0,
+			{{VCVTPS2PD, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCVTSS2SD, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}},
+			{{VCVTPS2PD, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCVTSS2SD, VEX_RVM | EVEX_SAE, VEX_128, VEX_32}}
+		},
+		{0x5a, 1,
+			{{INVALID, 0, 0, 0}, {VCVTPD2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCVTPD2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTSD2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x5b, 0,
+			{{VCVTDQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTPS2DQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}},
+			{{VCVTDQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTPS2DQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VCVTTPS2DQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}}
+		},
+		{0x5b, 1,
+			{{VCVTQQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{VCVTQQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x5c, 0,
+			{{VSUBPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VSUBSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}},
+			{{VSUBPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VSUBSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}}
+		},
+		{0x5c, 1,
+			{{INVALID, 0, 0, 0}, {VSUBPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSUBPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VSUBSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x5d, 0,
+			{{VMINPS, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMINSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}},
+			{{VMINPS, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMINSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_32}}
+		},
+		{0x5d, 1,
+			{{INVALID, 0, 0, 0}, {VMINPD, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMINPD, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VMINSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x5e, 0,
+			{{VDIVPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VDIVSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}},
+			{{VDIVPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}, {VDIVSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}}
+		},
+		{0x5e, 1,
+			{{INVALID, 0, 0, 0}, {VDIVPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDIVPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VDIVSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x5f, 0,
+			{{VMAXPS, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMAXSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}},
+			{{VMAXPS, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VMAXSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_32}}
+		},
+		{0x5f, 1,
+			{{INVALID, 0, 0, 0}, {VMAXPD, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMAXPD, VEX_RVM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VMAXSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0x60, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x60, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x61, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x61, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x62, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x63, 0,
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x63, 1,
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x64, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x64, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x65, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x65, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x66, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x67, 0,
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x67, 1,
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSWB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x68, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x68, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x69, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x69, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6a, 0,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x6b, 0,
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKSSDW, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x6c, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKLQDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x6d, 1,
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPUNPCKHQDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x6e, 0,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6e, 1,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_RM | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x6f, 0,
+			{{INVALID, 0, 0, 0}, {VMOVDQA32, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVDQU8, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVDQU32, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA32, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVDQU8, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVDQU32, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x6f, 1,
+			{{INVALID, 0, 0, 0}, {VMOVDQA64, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVDQU16, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVDQU64, VEX_RM, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA64, VEX_RM, VEX_VEC, VEX_VEC}, {VMOVDQU16, VEX_RM, VEX_VEC, VEX_VEC},
+				{VMOVDQU64, VEX_RM, VEX_VEC, VEX_VEC}}
+		},
+		{0x70, 0,
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC},
+				{VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPSHUFD, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC},
+				{VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC}, {VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}}
+		},
+		{0x70, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPSHUFLW, VEX_RMI, VEX_VEC, VEX_VEC},
+				{VPSHUFHW, VEX_RMI, VEX_VEC, VEX_VEC}}
+		},
+		{0x71, 0,
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x71, 1,
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {0, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x72, 0,
+			{{INVALID, 0, 0, 0}, {5, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {5, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x72, 1,
+			{{INVALID, 0, 0, 0}, {6, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {6, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x73, 0,
+			{{INVALID, 0, 0, 0}, {7, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {7, VEX_VMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x73, 1,
+			{{INVALID, 0, 0, 0}, {2, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {2, VEX_VMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x74, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x74, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x76, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x78, 0,
+			{{VCVTTPS2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTTPS2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF},
+				{VCVTTSD2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128}},
+			{{VCVTTPS2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTTPS2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF},
+				{VCVTTSD2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x78, 1,
+			{{VCVTTPD2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_HALF, VEX_VEC},
+				{VCVTTPD2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTTSD2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTTSS2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_128}},
+			{{VCVTTPD2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_HALF, VEX_VEC},
+				{VCVTTPD2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTTSD2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTTSS2USI, VEX_RM | EVEX_SAE, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x79, 0,
+			{{VCVTPS2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTPS2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_HALF},
+				{VCVTSD2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128}},
+			{{VCVTPS2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTPS2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_HALF},
+				{VCVTSD2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x79, 1,
+			{{VCVTPD2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTPD2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTSD2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128},
+				{VCVTSS2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_128}},
+			{{VCVTPD2UDQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTPD2UQQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTSD2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_64},
+				{VCVTSS2USI, VEX_RM | EVEX_ROUNDING, VEX_GPR_32_OR_64, VEX_32}}
+		},
+		{0x7a, 0,
+			{{INVALID, 0, 0, 0}, {VCVTTPS2QQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF},
+				{VCVTUDQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTUDQ2PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VCVTTPS2QQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_HALF},
+				{VCVTUDQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTUDQ2PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_HALF}}
+		},
+		{0x7a, 1,
+			{{INVALID, 0, 0, 0}, {VCVTTPD2QQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTUQQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTUQQ2PD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VCVTTPD2QQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{VCVTUQQ2PS, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTUQQ2PD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}}
+		},
+		{0x7b, 0,
+			{{INVALID, 0, 0, 0}, {VCVTPS2QQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_HALF},
+				{VCVTUSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTUSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {VCVTPS2QQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_HALF},
+				{VCVTUSI2SD, VEX_RVM, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTUSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x7b, 1,
+			{{INVALID, 0, 0, 0}, {VCVTPD2QQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTUSI2SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTUSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}},
+			{{INVALID, 0, 0, 0}, {VCVTPD2QQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{VCVTUSI2SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64},
+				{VCVTUSI2SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_GPR_32_OR_64}}
+		},
+		{0x7e, 0,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7e, 1,
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_128}},
+			{{INVALID, 0, 0, 0}, {VMOVD, VEX_MR | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {VMOVQ, VEX_RM | VEX_L0, VEX_128, VEX_64}}
+		},
+		{0x7f, 0,
+			{{INVALID, 0, 0, 0}, {VMOVDQA32, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVDQU8, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVDQU32, VEX_MR, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA32, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVDQU8, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVDQU32, VEX_MR, VEX_VEC, VEX_VEC}}
+		},
+		{0x7f, 1,
+			{{INVALID, 0, 0, 0}, {VMOVDQA64, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVDQU16, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVDQU64, VEX_MR, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VMOVDQA64, VEX_MR, VEX_VEC, VEX_VEC}, {VMOVDQU16, VEX_MR, VEX_VEC, VEX_VEC},
+				{VMOVDQU64, VEX_MR, VEX_VEC, VEX_VEC}}
+		},
+		{0xc2, 0,
+			{{VCMPPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCMPSS, VEX_RVMI | EVEX_SAE, VEX_MASK, VEX_128}},
+			{{VCMPPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCMPSS, VEX_RVMI | EVEX_SAE, VEX_MASK, VEX_32}}
+		},
+		{0xc2, 1,
+			{{INVALID, 0, 0, 0}, {VCMPPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_MASK, VEX_VEC},
+				{VCMPSD, VEX_RVMI | EVEX_SAE, VEX_MASK, VEX_128}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCMPPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_MASK, VEX_VEC},
+				{VCMPSD, VEX_RVMI | EVEX_SAE, VEX_MASK, VEX_64}, {INVALID, 0, 0, 0}}
+		},
+		{0xc4, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc4, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRW, VEX_RVMI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc5, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_RMI | VEX_L0, VEX_GPR_32, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc5, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_RMI | VEX_L0, VEX_GPR_32, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xc6, 0,
+			{{VSHUFPS, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{VSHUFPS, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xc6, 1,
+			{{INVALID, 0, 0, 0}, {VSHUFPD, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSHUFPD, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xd1, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd1, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd2, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd3, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd4, 1,
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xd5, 0,
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd5, 1,
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd6, 1,
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVQ, VEX_MR | VEX_L0, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xd9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xda, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xda, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdb, 0,
+			{{INVALID, 0, 0, 0}, {VPANDD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdb, 1,
+			{{INVALID, 0, 0, 0}, {VPANDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdc, 0,
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 1,
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 0,
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 1,
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDUSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 0,
+			{{INVALID, 0, 0, 0}, {VPANDND, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDND, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdf, 1,
+			{{INVALID, 0, 0, 0}, {VPANDNQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPANDNQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xe0, 0,
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe0, 1,
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe1, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe1, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe2, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe2, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe3, 0,
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe3, 1,
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPAVGW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe4, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe4, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe5, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe5, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe6, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCVTDQ2PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0},
+				{VCVTDQ2PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_HALF}}
+		},
+		{0xe6, 1,
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_HALF, VEX_VEC},
+				{VCVTPD2DQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTQQ2PD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VCVTTPD2DQ, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_HALF, VEX_VEC},
+				{VCVTPD2DQ, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_HALF, VEX_VEC},
+				{VCVTQQ2PD, VEX_RM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC}}
+		},
+		{0xe7, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQ, VEX_MR, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xe9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xea, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xea, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xeb, 0,
+			{{INVALID, 0, 0, 0}, {VPORD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPORD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xeb, 1,
+			{{INVALID, 0, 0, 0}, {VPORQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPORQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xec, 0,
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xec, 1,
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xed, 0,
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xed, 1,
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xee, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xee, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xef, 0,
+			{{INVALID, 0, 0, 0}, {VPXORD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPXORD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xef, 1,
+			{{INVALID, 0, 0, 0}, {VPXORQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPXORQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf1, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf1, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLW, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf2, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLD, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf3, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLQ, VEX_RVM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf4, 1,
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULUDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xf5, 0,
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf5, 1,
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDWD, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf6, 0,
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf6, 1,
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSADBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf8, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf8, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf9, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xf9, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfa, 0,
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xfb, 1,
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSUBQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xfc, 0,
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfc, 1,
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfd, 0,
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfd, 1,
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xfe, 0,
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPADDD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		}
+	};
+
+
+	static const VEXTableEntry evex0F38Map[] =
+	{
+		{0x00, 0,
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x00, 1,
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSHUFB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x04, 0,
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x04, 1,
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMADDUBSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 0,
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0b, 1,
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULHRSW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0c, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x0d, 1,
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x10, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSWB, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSWB, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x10, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x11, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSDB, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSDB, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x11, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x12, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSQB, VEX_MR, VEX_VEC, VEX_EIGHTH}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVUSQB, VEX_MR, VEX_VEC, VEX_EIGHTH}}
+		},
+		{0x12, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLVW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x13, 0,
+			{{INVALID, 0, 0, 0}, {VCVTPH2PS, VEX_RM | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVUSDW, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VCVTPH2PS, VEX_RM | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVUSDW, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x14, 0,
+			{{INVALID, 0, 0, 0}, {VPRORVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVUSQW, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {VPRORVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVUSQW, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x14, 1,
+			{{INVALID, 0, 0, 0}, {VPRORVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPRORVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x15, 0,
+			{{INVALID, 0, 0, 0}, {VPROLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVUSQD, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPROLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVUSQD, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x15, 1,
+			{{INVALID, 0, 0, 0}, {VPROLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPROLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{INVALID, 0, 0, 0}, {VPERMPS, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMPS, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x16, 1,
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x18, 0,
+			{{INVALID, 0, 0, 0}, {VBROADCASTSS, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTSS, VEX_RM, VEX_VEC, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x19, 0,
+			{{INVALID, 0, 0, 0}, {VBROADCASTF32X2, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF32X2, VEX_RM | VEX_L1, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x19, 1,
+			{{INVALID, 0, 0, 0}, {VBROADCASTSD, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTSD, VEX_RM | VEX_L1, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF32X4, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF64X2, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1b, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF32X8, VEX_RM | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1b, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTF64X4, VEX_RM | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1c, 0,
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1c, 1,
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSB, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1d, 0,
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1d, 1,
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSW, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x1e, 0,
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1f, 1,
+			{{INVALID, 0, 0, 0}, {VPABSQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPABSQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x20, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSWB, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSWB, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x20, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x21, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVSDB, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVSDB, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x21, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x22, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0},
+				{VPMOVSQB, VEX_MR, VEX_VEC, VEX_EIGHTH}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0},
+				{VPMOVSQB, VEX_MR, VEX_VEC, VEX_EIGHTH}}
+		},
+		{0x22, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x23, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSDW, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSDW, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x23, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x24, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVSQW, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVSQW, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x24, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x25, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSQD, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVSXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVSQD, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x26, 0,
+			{{INVALID, 0, 0, 0}, {VPTESTMB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMB, VEX_RVM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPTESTMB, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMB, VEX_RVM, VEX_MASK, VEX_VEC}}
+		},
+		{0x26, 1,
+			{{INVALID, 0, 0, 0}, {VPTESTMW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMW, VEX_RVM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPTESTMW, VEX_RVM, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMW, VEX_RVM, VEX_MASK, VEX_VEC}}
+		},
+		{0x27, 0,
+			{{INVALID, 0, 0, 0}, {VPTESTMD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPTESTMD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMD, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}}
+		},
+		{0x27, 1,
+			{{INVALID, 0, 0, 0}, {VPTESTMQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPTESTMQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPTESTNMQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}}
+		},
+		{0x28, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVM2B, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x28, 1,
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVM2W, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {VPMULDQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x29, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPMOVB2M, VEX_RM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x29, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVW2M, VEX_RM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPCMPEQQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VMOVNTDQA, VEX_RM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {VPBROADCASTMB2Q, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2b, 0,
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPACKUSDW, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2c, 0,
+			{{INVALID, 0, 0, 0}, {VSCALEFPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCALEFPS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2c, 1,
+			{{INVALID, 0, 0, 0}, {VSCALEFPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCALEFPD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x2d, 0,
+			{{INVALID, 0, 0, 0}, {VSCALEFSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCALEFSS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x2d, 1,
+			{{INVALID, 0, 0, 0}, {VSCALEFSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCALEFSD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x30, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVWB, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVWB, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x30, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBW, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x31, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVDB, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVDB, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x31, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBD, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x32, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0},
+				{VPMOVQB, VEX_MR, VEX_VEC, VEX_EIGHTH}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0},
+				{VPMOVQB, VEX_MR, VEX_VEC, VEX_EIGHTH}}
+		},
+		{0x32, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXBQ, VEX_RM, VEX_VEC, VEX_EIGHTH}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x33, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVDW, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVDW, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x33, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWD, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x34, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVQW, VEX_MR, VEX_VEC, VEX_QUARTER}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0},
+				{VPMOVQW, VEX_MR, VEX_VEC, VEX_QUARTER}}
+		},
+		{0x34, 1,
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXWQ, VEX_RM, VEX_VEC, VEX_QUARTER}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x35, 0,
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVQD, VEX_MR, VEX_VEC, VEX_HALF}},
+			{{INVALID, 0, 0, 0}, {VPMOVZXDQ, VEX_RM, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{VPMOVQD, VEX_MR, VEX_VEC, VEX_HALF}}
+		},
+		{0x36, 0,
+			{{INVALID, 0, 0, 0}, {VPERMD, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMD, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x36, 1,
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RVM | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x37, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPGTQ, VEX_RVM | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x38, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVM2D, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x38, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVM2Q, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {VPMINSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x39, 0,
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVD2M, VEX_RM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPMINSD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x39, 1,
+			{{INVALID, 0, 0, 0}, {VPMINSQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPMOVQ2M, VEX_RM, VEX_MASK, VEX_VEC}},
+			{{INVALID, 0, 0, 0}, {VPMINSQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3a, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{VPBROADCASTMW2D, VEX_RM, VEX_VEC, VEX_MASK}},
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3a, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3b, 0,
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3b, 1,
+			{{INVALID, 0, 0, 0}, {VPMINUQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMINUQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3c, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3c, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3d, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3d, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXSQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXSQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3e, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3e, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3f, 0,
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3f, 1,
+			{{INVALID, 0, 0, 0}, {VPMAXUQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMAXUQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x40, 0,
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x40, 1,
+			{{INVALID, 0, 0, 0}, {VPMULLQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPMULLQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x42, 0,
+			{{INVALID, 0, 0, 0}, {VGETEXPPS, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETEXPPS, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x42, 1,
+			{{INVALID, 0, 0, 0}, {VGETEXPPD, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETEXPPD, VEX_RM | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x43, 0,
+			{{INVALID, 0, 0, 0}, {VGETEXPSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETEXPSS, VEX_RVM | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x43, 1,
+			{{INVALID, 0, 0, 0}, {VGETEXPSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETEXPSD, VEX_RVM | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x44, 0,
+			{{INVALID, 0, 0, 0}, {VPLZCNTD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPLZCNTD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x44, 1,
+			{{INVALID, 0, 0, 0}, {VPLZCNTQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPLZCNTQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x45, 0,
+			{{INVALID, 0, 0, 0}, {VPSRLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x45, 1,
+			{{INVALID, 0, 0, 0}, {VPSRLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x46, 0,
+			{{INVALID, 0, 0, 0}, {VPSRAVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x46, 1,
+			{{INVALID, 0, 0, 0}, {VPSRAVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSRAVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x47, 0,
+			{{INVALID, 0, 0, 0}, {VPSLLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLVD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x47, 1,
+			{{INVALID, 0, 0, 0}, {VPSLLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSLLVQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4c, 0,
+			{{INVALID, 0, 0, 0}, {VRCP14PS, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRCP14PS, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4c, 1,
+			{{INVALID, 0, 0, 0}, {VRCP14PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRCP14PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4d, 0,
+			{{INVALID, 0, 0, 0}, {VRCP14SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRCP14SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4d, 1,
+			{{INVALID, 0, 0, 0}, {VRCP14SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRCP14SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4e, 0,
+			{{INVALID, 0, 0, 0}, {VRSQRT14PS, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRSQRT14PS, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4e, 1,
+			{{INVALID, 0, 0, 0}, {VRSQRT14PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRSQRT14PD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x4f, 0,
+			{{INVALID, 0, 0, 0}, {VRSQRT14SS, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRSQRT14SS, VEX_RVM, VEX_128, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x4f, 1,
+			{{INVALID, 0, 0, 0}, {VRSQRT14SD, VEX_RVM, VEX_128, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRSQRT14SD, VEX_RVM, VEX_128, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x58, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM, VEX_VEC, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x59, 0,
+			{{INVALID, 0, 0, 0}, {VBROADCASTI32X2, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI32X2, VEX_RM, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x59, 1,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTQ, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTQ, VEX_RM, VEX_VEC, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x5a, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI32X4, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x5a, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI64X2, VEX_RM | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x5b, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI32X8, VEX_RM | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x5b, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBROADCASTI64X4, VEX_RM | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x64, 0,
+			{{INVALID, 0, 0, 0}, {VPBLENDMD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDMD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x64, 1,
+			{{INVALID, 0, 0, 0}, {VPBLENDMQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDMQ, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x65, 0,
+			{{INVALID, 0, 0, 0}, {VBLENDMPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDMPS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x65, 1,
+			{{INVALID, 0, 0, 0}, {VBLENDMPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VBLENDMPD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x66, 0,
+			{{INVALID, 0, 0, 0}, {VPBLENDMB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDMB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x66, 1,
+			{{INVALID, 0, 0, 0}, {VPBLENDMW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBLENDMW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 0,
+			{{INVALID, 0, 0, 0}, {VPERMI2B, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2B, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x75, 1,
+			{{INVALID, 0, 0, 0}, {VPERMI2W, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2W, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x76, 0,
+			{{INVALID, 0, 0, 0}, {VPERMI2D, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2D, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x76, 1,
+			{{INVALID, 0, 0, 0}, {VPERMI2Q, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2Q, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x77, 0,
+			{{INVALID, 0, 0, 0}, {VPERMI2PS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2PS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x77, 1,
+			{{INVALID, 0, 0, 0}, {VPERMI2PD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMI2PD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x78, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTB, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTB, VEX_RM, VEX_VEC, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x79, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTW, VEX_RM, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPBROADCASTW, VEX_RM, VEX_VEC, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7a, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTB, VEX_RM, VEX_VEC, VEX_GPR_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7b, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTW, VEX_RM, VEX_VEC, VEX_GPR_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7c, 0,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM | VEX_INC_OPERATION_FOR_64, VEX_VEC, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7c, 1,
+			{{INVALID, 0, 0, 0}, {VPBROADCASTD, VEX_RM | VEX_INC_OPERATION_FOR_64, VEX_VEC, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7d, 0,
+			{{INVALID, 0, 0, 0}, {VPERMT2B, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2B, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7d, 1,
+			{{INVALID, 0, 0, 0}, {VPERMT2W, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2W, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x7e, 0,
+			{{INVALID, 0, 0, 0}, {VPERMT2D, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2D, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7e, 1,
+			{{INVALID, 0, 0, 0}, {VPERMT2Q, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2Q, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7f, 0,
+			{{INVALID, 0, 0, 0}, {VPERMT2PS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2PS, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x7f, 1,
+			{{INVALID, 0, 0, 0}, {VPERMT2PD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMT2PD, VEX_RVM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x88, 0,
+			{{INVALID, 0, 0, 0}, {VEXPANDPS, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXPANDPS, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x88, 1,
+			{{INVALID, 0, 0, 0}, {VEXPANDPD, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXPANDPD, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x89, 0,
+			{{INVALID, 0, 0, 0}, {VPEXPANDD, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXPANDD, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x89, 1,
+			{{INVALID, 0, 0, 0}, {VPEXPANDQ, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXPANDQ, VEX_RM | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x8a, 0,
+			{{INVALID, 0, 0, 0}, {VCOMPRESSPS, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCOMPRESSPS, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x8a, 1,
+			{{INVALID, 0, 0, 0}, {VCOMPRESSPD, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCOMPRESSPD, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x8b, 0,
+			{{INVALID, 0, 0, 0}, {VPCOMPRESSD, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCOMPRESSD, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x8b, 1,
+			{{INVALID, 0, 0, 0}, {VPCOMPRESSQ, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCOMPRESSQ, VEX_MR | EVEX_ELEMENT_DISP8, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x8d, 0,
+			{{INVALID, 0, 0, 0}, {VPERMB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMB, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x8d, 1,
+			{{INVALID, 0, 0, 0}, {VPERMW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMW, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x90, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERDD, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x90, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERDQ, VEX_GATHER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x91, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERQD, VEX_GATHER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x91, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPGATHERQQ, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x92, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERDPS, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x92, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERDPD, VEX_GATHER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERQPS, VEX_GATHER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x93, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGATHERQPD, VEX_GATHER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x96, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x96, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x97, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x97, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x98, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x99, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x99, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9a, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9a, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9b, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9b, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9c, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9c, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9d, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9d, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9e, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9e, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x9f, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x9f, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB132SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xa0, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSCATTERDD, VEX_SCATTER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa0, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSCATTERDQ, VEX_SCATTER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa1, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSCATTERQD, VEX_SCATTER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa1, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPSCATTERQQ, VEX_SCATTER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa2, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCATTERDPS, VEX_SCATTER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa2, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCATTERDPD, VEX_SCATTER, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa3, 0,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCATTERQPS, VEX_SCATTER, VEX_HALF, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa3, 1,
+			{{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSCATTERQPD, VEX_SCATTER, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa6, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa6, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa7, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa7, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa8, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa8, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xa9, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xa9, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xaa, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaa, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xab, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xab, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xac, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xac, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xad, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xad, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xae, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xae, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xaf, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xaf, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB213SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xb6, 0,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb6, 1,
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADDSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb7, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb7, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUBADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb8, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb8, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xb9, 0,
+			{{INVALID, 0, 0, 0}, {VFMADD231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xb9, 1,
+			{{INVALID, 0, 0, 0}, {VFMADD231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMADD231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xba, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xba, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbb, 0,
+			{{INVALID, 0, 0, 0}, {VFMSUB231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xbb, 1,
+			{{INVALID, 0, 0, 0}, {VFMSUB231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFMSUB231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xbc, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbc, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbd, 0,
+			{{INVALID, 0, 0, 0}, {VFNMADD231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xbd, 1,
+			{{INVALID, 0, 0, 0}, {VFNMADD231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMADD231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xbe, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PS, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbe, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231PD, VEX_RVM | EVEX_BROADCAST | EVEX_ROUNDING, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xbf, 0,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SS, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xbf, 1,
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFNMSUB231SD, VEX_RVM | EVEX_ROUNDING, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xc4, 0,
+			{{INVALID, 0, 0, 0}, {VPCONFLICTD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCONFLICTD, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xc4, 1,
+			{{INVALID, 0, 0, 0}, {VPCONFLICTQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCONFLICTQ, VEX_RM | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0xdc, 0,
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdc, 1,
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 0,
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdd, 1,
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESENCLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 0,
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xde, 1,
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDEC, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 0,
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0xdf, 1,
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VAESDECLAST, VEX_RVM, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		}
+	};
+
+
+	static const VEXTableEntry evex0F3AMap[] =
+	{
+		{0x00, 1,
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMQ, VEX_RMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x01, 1,
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMPD, VEX_RMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x03, 0,
+			{{INVALID, 0, 0, 0}, {VALIGND, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VALIGND, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x03, 1,
+			{{INVALID, 0, 0, 0}, {VALIGNQ, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VALIGNQ, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x04, 0,
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPS, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x05, 1,
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPERMILPD, VEX_RMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x08, 0,
+			{{INVALID, 0, 0, 0}, {VRNDSCALEPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRNDSCALEPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x09, 1,
+			{{INVALID, 0, 0, 0}, {VRNDSCALEPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRNDSCALEPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0a, 0,
+			{{INVALID, 0, 0, 0}, {VRNDSCALESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRNDSCALESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x0b, 1,
+			{{INVALID, 0, 0, 0}, {VRNDSCALESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRNDSCALESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x0f, 0,
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x0f, 1,
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPALIGNR, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x14, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRB, VEX_MRI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x15, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x15, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRW, VEX_MRI | VEX_L0, VEX_128, VEX_16}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x16, 0,
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x16, 1,
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPEXTRD, VEX_MRI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x17, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x17, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTPS, VEX_MRI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x18, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTF32X4, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTF32X4, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x18, 1,
+			{{INVALID, 0, 0, 0}, {VINSERTF64X2, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTF64X2, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x19, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTF32X4, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTF32X4, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x19, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTF64X2, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTF64X2, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1a, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTF32X8, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTF32X8, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1a, 1,
+			{{INVALID, 0, 0, 0}, {VINSERTF64X4, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTF64X4, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1b, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTF32X8, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTF32X8, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1b, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTF64X4, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTF64X4, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1d, 0,
+			{{INVALID, 0, 0, 0}, {VCVTPS2PH, VEX_MRI | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VCVTPS2PH, VEX_MRI | EVEX_SAE, VEX_VEC, VEX_HALF}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1e, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPUD, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPUD, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1e, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPUQ, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPUQ, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1f, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPD, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPD, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x1f, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPQ, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPQ, VEX_RVMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x20, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x20, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_GPR_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRB, VEX_RVMI | VEX_L0, VEX_128, VEX_8}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x21, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTPS, VEX_RVMI | VEX_L0, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x22, 0,
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x22, 1,
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPINSRD, VEX_RVMI | VEX_INC_OPERATION_FOR_64 | VEX_L0, VEX_128, VEX_GPR_32_OR_64},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x23, 0,
+			{{INVALID, 0, 0, 0}, {VSHUFF32X4, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSHUFF32X4, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x23, 1,
+			{{INVALID, 0, 0, 0}, {VSHUFF64X2, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSHUFF64X2, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x25, 0,
+			{{INVALID, 0, 0, 0}, {VPTERNLOGD, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPTERNLOGD, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x25, 1,
+			{{INVALID, 0, 0, 0}, {VPTERNLOGQ, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPTERNLOGQ, VEX_RVMI | EVEX_BROADCAST, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x26, 0,
+			{{INVALID, 0, 0, 0}, {VGETMANTPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETMANTPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x26, 1,
+			{{INVALID, 0, 0, 0}, {VGETMANTPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETMANTPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x27, 0,
+			{{INVALID, 0, 0, 0}, {VGETMANTSS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETMANTSS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x27, 1,
+			{{INVALID, 0, 0, 0}, {VGETMANTSD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VGETMANTSD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x38, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTI32X4, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTI32X4, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x38, 1,
+			{{INVALID, 0, 0, 0}, {VINSERTI64X2, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTI64X2, VEX_RVMI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x39, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTI32X4, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTI32X4, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x39, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTI64X2, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTI64X2, VEX_MRI | VEX_L1, VEX_VEC, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3a, 0,
+			{{INVALID, 0, 0, 0}, {VINSERTI32X8, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTI32X8, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3a, 1,
+			{{INVALID, 0, 0, 0}, {VINSERTI64X4, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VINSERTI64X4, VEX_RVMI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3b, 0,
+			{{INVALID, 0, 0, 0}, {VEXTRACTI32X8, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTI32X8, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3b, 1,
+			{{INVALID, 0, 0, 0}, {VEXTRACTI64X4, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VEXTRACTI64X4, VEX_MRI | EVEX_L2, VEX_VEC, VEX_256}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x3e, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPUB, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPUB, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3e, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPUW, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPUW, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3f, 0,
+			{{INVALID, 0, 0, 0}, {VPCMPB, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPB, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x3f, 1,
+			{{INVALID, 0, 0, 0}, {VPCMPW, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCMPW, VEX_RVMI, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x42, 0,
+			{{INVALID, 0, 0, 0}, {VDBPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VDBPSADBW, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x43, 0,
+			{{INVALID, 0, 0, 0}, {VSHUFI32X4, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSHUFI32X4, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x43, 1,
+			{{INVALID, 0, 0, 0}, {VSHUFI64X2, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VSHUFI64X2, VEX_RVMI | EVEX_BROADCAST | VEX_L1, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x44, 0,
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x44, 1,
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VPCLMULQDQ, VEX_RVMI, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x50, 0,
+			{{INVALID, 0, 0, 0}, {VRANGEPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRANGEPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x50, 1,
+			{{INVALID, 0, 0, 0}, {VRANGEPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRANGEPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x51, 0,
+			{{INVALID, 0, 0, 0}, {VRANGESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRANGESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x51, 1,
+			{{INVALID, 0, 0, 0}, {VRANGESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VRANGESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x54, 0,
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMPS, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x54, 1,
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMPD, VEX_RVMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC},
+				{INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x55, 0,
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMSS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMSS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x55, 1,
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMSD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFIXUPIMMSD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 0,
+			{{INVALID, 0, 0, 0}, {VREDUCEPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VREDUCEPS, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x56, 1,
+			{{INVALID, 0, 0, 0}, {VREDUCEPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VREDUCEPD, VEX_RMI | EVEX_BROADCAST | EVEX_SAE, VEX_VEC, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 0,
+			{{INVALID, 0, 0, 0}, {VREDUCESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VREDUCESS, VEX_RVMI | EVEX_SAE, VEX_128, VEX_32}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x57, 1,
+			{{INVALID, 0, 0, 0}, {VREDUCESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_128}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VREDUCESD, VEX_RVMI | EVEX_SAE, VEX_128, VEX_64}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x66, 0,
+			{{INVALID, 0, 0, 0}, {VFPCLASSPS, VEX_RMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFPCLASSPS, VEX_RMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x66, 1,
+			{{INVALID, 0, 0, 0}, {VFPCLASSPD, VEX_RMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFPCLASSPD, VEX_RMI | EVEX_BROADCAST, VEX_MASK, VEX_VEC}, {INVALID, 0, 0, 0},
+				{INVALID, 0, 0, 0}}
+		},
+		{0x67, 0,
+			{{INVALID, 0, 0, 0}, {VFPCLASSSS, VEX_RMI, VEX_MASK, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFPCLASSSS, VEX_RMI, VEX_MASK, VEX_32}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		},
+		{0x67, 1,
+			{{INVALID, 0, 0, 0}, {VFPCLASSSD, VEX_RMI, VEX_MASK, VEX_128}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}},
+			{{INVALID, 0, 0, 0}, {VFPCLASSSD, VEX_RMI, VEX_MASK, VEX_64}, {INVALID, 0, 0, 0}, {INVALID, 0, 0, 0}}
+		}
+	};
+
+	static const uint16_t vexGroupOperations[8][8] =
+	{
+		{INVALID, INVALID, VPSRLW, INVALID, VPSRAW, INVALID, VPSLLW, INVALID}, // Group 0 (0F 71)
+		{INVALID, INVALID, VPSRLD, INVALID, VPSRAD, INVALID, VPSLLD, INVALID}, // Group 1 (0F 72)
+		{INVALID, INVALID, VPSRLQ, VPSRLDQ, INVALID, INVALID, VPSLLQ, VPSLLDQ}, // Group 2 (0F 73)
+		{INVALID, BLSR, BLSMSK, BLSI, INVALID, INVALID, INVALID, INVALID}, // Group 3 (0F38 F3)
+		{INVALID, INVALID, VLDMXCSR, VSTMXCSR, INVALID, INVALID, INVALID, INVALID}, // Group 4 (0F AE)
+		{VPRORD, VPROLD, VPSRLD, INVALID, VPSRAD, INVALID, VPSLLD, INVALID}, // Group 5 (EVEX 0F 72 W0)
+		{VPRORQ, VPROLQ, INVALID, INVALID, VPSRAQ, INVALID, INVALID, INVALID}, // Group 6 (EVEX 0F 72 W1)
+		{INVALID, INVALID, INVALID, VPSRLDQ, INVALID, INVALID, INVALID, VPSLLDQ} // Group 7 (EVEX 0F 73 W0)
+	};
+
+
+	// VEX prefix pp field (none, 66, F3, F2) to the prefix column order used by the SSE and VEX tables
+	static const uint8_t vexPrefixColumn[4] = {0, 1, 3, 2};
+
+
+	typedef uint16_t RegDef;
+	static const RegDef reg8List[8] = {REG_AL, REG_CL, REG_DL, REG_BL, REG_AH, REG_CH, REG_DH, REG_BH};
+	static const RegDef reg8List64[16] = {REG_AL, REG_CL, REG_DL, REG_BL, REG_SPL, REG_BPL, REG_SIL, REG_DIL,
+		REG_R8B, REG_R9B, REG_R10B, REG_R11B, REG_R12B, REG_R13B, REG_R14B, REG_R15B};
+	static const RegDef reg16List[16] = {REG_AX, REG_CX, REG_DX, REG_BX, REG_SP, REG_BP, REG_SI, REG_DI,
+		REG_R8W, REG_R9W, REG_R10W, REG_R11W, REG_R12W, REG_R13W, REG_R14W, REG_R15W};
+	static const RegDef reg32List[16] = {REG_EAX, REG_ECX, REG_EDX, REG_EBX, REG_ESP, REG_EBP, REG_ESI, REG_EDI,
+		REG_R8D, REG_R9D, REG_R10D, REG_R11D, REG_R12D, REG_R13D, REG_R14D, REG_R15D};
+	static const RegDef reg64List[16] = {REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+		REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15};
+	static const RegDef mmxRegList[16] = {REG_MM0, REG_MM1, REG_MM2, REG_MM3, REG_MM4, REG_MM5, REG_MM6, REG_MM7,
+		REG_MM0, REG_MM1, REG_MM2, REG_MM3, REG_MM4, REG_MM5, REG_MM6, REG_MM7};
+	static const RegDef xmmRegList[32] = {REG_XMM0, REG_XMM1, REG_XMM2, REG_XMM3, REG_XMM4, REG_XMM5, REG_XMM6, REG_XMM7,
+		REG_XMM8, REG_XMM9, REG_XMM10, REG_XMM11, REG_XMM12, REG_XMM13, REG_XMM14, REG_XMM15,
+		REG_XMM16, REG_XMM17, REG_XMM18, REG_XMM19, REG_XMM20, REG_XMM21, REG_XMM22, REG_XMM23,
+		REG_XMM24, REG_XMM25, REG_XMM26, REG_XMM27, REG_XMM28, REG_XMM29, REG_XMM30, REG_XMM31};
+	static const RegDef ymmRegList[32] = {REG_YMM0, REG_YMM1, REG_YMM2, REG_YMM3, REG_YMM4, REG_YMM5, REG_YMM6, REG_YMM7,
+		REG_YMM8, REG_YMM9, REG_YMM10, REG_YMM11, REG_YMM12, REG_YMM13, REG_YMM14, REG_YMM15,
+		REG_YMM16, REG_YMM17, REG_YMM18, REG_YMM19, REG_YMM20, REG_YMM21, REG_YMM22, REG_YMM23,
+		REG_YMM24, REG_YMM25, REG_YMM26, REG_YMM27, REG_YMM28, REG_YMM29, REG_YMM30, REG_YMM31};
+	static const RegDef zmmRegList[32] = {REG_ZMM0, REG_ZMM1, REG_ZMM2, REG_ZMM3, REG_ZMM4, REG_ZMM5, REG_ZMM6, REG_ZMM7,
+		REG_ZMM8, REG_ZMM9, REG_ZMM10, REG_ZMM11, REG_ZMM12, REG_ZMM13, REG_ZMM14, REG_ZMM15,
+		REG_ZMM16, REG_ZMM17, REG_ZMM18, REG_ZMM19, REG_ZMM20, REG_ZMM21, REG_ZMM22, REG_ZMM23,
+		REG_ZMM24, REG_ZMM25, REG_ZMM26, REG_ZMM27, REG_ZMM28, REG_ZMM29, REG_ZMM30, REG_ZMM31};
+	static const RegDef kRegList[16] = {REG_K0, REG_K1, REG_K2, REG_K3, REG_K4, REG_K5, REG_K6, REG_K7,
+		REG_K0, REG_K1, REG_K2, REG_K3, REG_K4, REG_K5, REG_K6, REG_K7};
+	static const RegDef fpuRegList[16] = {REG_ST0, REG_ST1, REG_ST2, REG_ST3, REG_ST4, REG_ST5, REG_ST6, REG_ST7,
+		REG_ST0, REG_ST1, REG_ST2, REG_ST3, REG_ST4, REG_ST5, REG_ST6, REG_ST7};
+
+
+	struct RMDef
+	{
+		OperandType first;
+		OperandType second;
+		SegmentRegister segment;
+	};
+#ifndef __cplusplus
+	typedef struct RMDef RMDef;
+#endif
+
+
+	static const RegDef* GetByteRegList(DecodeState* state)
+	{
+		if (state->rex)
+			return reg8List64;
+		return reg8List;
+	}
+
+
+	static const RegDef* GetRegListForOpSize(DecodeState* state)
+	{
+		switch (state->opSize)
+		{
+		case 2:
+			return reg16List;
+		case 4:
+			return reg32List;
+		case 8:
+			return reg64List;
+		default:
+			return NULL;
+		}
+	}
+
+
+	static const RegDef* GetRegListForFinalOpSize(DecodeState* state)
+	{
+		switch (state->finalOpSize)
+		{
+		case 1:
+			return GetByteRegList(state);
+		case 2:
+			return reg16List;
+		case 4:
+			return reg32List;
+		case 8:
+			return reg64List;
+		default:
+			return NULL;
+		}
+	}
+
+
+	static const RegDef* GetRegListForAddrSize(DecodeState* state)
+	{
+		switch (state->addrSize)
+		{
+		case 2:
+			return reg16List;
+		case 4:
+			return reg32List;
+		case 8:
+			return reg64List;
+		default:
+			return NULL;
+		}
+	}
+
+
+	static uint16_t GetFinalOpSize(DecodeState* state)
+	{
+		if (state->flags & DEC_FLAG_BYTE)
+			return 1;
+		return state->opSize;
+	}
+
+
+	static uint8_t Read8(DecodeState* state)
+	{
+		uint8_t val;
+
+		if (state->len < 1)
+		{
+			// Read past end of buffer, returning 0xcc from now on will guarantee exit
+			state->invalid = true;
+			state->insufficientLength = true;
+			state->len = 0;
+			return 0xcc;
+		}
+
+		val = *(state->opcode++);
+		state->len--;
+		return val;
+	}
+
+
+	static uint8_t Peek8(DecodeState* state)
+	{
+		uint8_t val;
+
+		if (state->len < 1)
+		{
+			// Read past end of buffer, returning 0xcc from now on will guarantee exit
+			state->invalid = true;
+			state->insufficientLength = true;
+			state->len = 0;
+			return 0xcc;
+		}
+
+		val = *state->opcode;
+		return val;
+	}
+
+
+	static uint16_t Read16(DecodeState* state)
+	{
+		uint16_t val;
+
+		if (state->len < 2)
+		{
+			// Read past end of buffer
+			state->invalid = true;
+			state->insufficientLength = true;
+			state->len = 0;
+			return 0;
+		}
+
+		val = *((uint16_t*)state->opcode);
+		state->opcode += 2;
+		state->len -= 2;
+		return val;
+	}
+
+
+	static uint32_t Read32(DecodeState* state)
+	{
+		uint32_t val;
+
+		if (state->len < 4)
+		{
+			// Read past end of buffer
+			state->invalid = true;
+			state->insufficientLength = true;
+			state->len = 0;
+			return 0;
+		}
+
+		val = *((uint32_t*)state->opcode);
+		state->opcode += 4;
+		state->len -= 4;
+		return val;
+	}
+
+
+	static uint64_t Read64(DecodeState* state)
+	{
+		uint64_t val;
+
+		if (state->len < 8)
+		{
+			// Read past end of buffer
+			state->invalid = true;
+			state->insufficientLength = true;
+			state->len = 0;
+			return 0;
+		}
+
+		val = *((uint64_t*)state->opcode);
+		state->opcode += 8;
+		state->len -= 8;
+		return val;
+	}
+
+
+	static int64_t ReadSigned8(DecodeState* state)
+	{
+		return (int64_t)(int8_t)Read8(state);
+	}
+
+
+	static int64_t ReadSigned16(DecodeState* state)
+	{
+		return (int64_t)(int16_t)Read16(state);
+	}
+
+
+	static int64_t ReadSigned32(DecodeState* state)
+	{
+		return (int64_t)(int32_t)Read32(state);
+	}
+
+
+	static int64_t ReadFinalOpSize(DecodeState* state)
+	{
+		if (state->flags & DEC_FLAG_IMM_SX)
+			return ReadSigned8(state);
+		switch (state->finalOpSize)
+		{
+		case 1:
+			return Read8(state);
+		case 2:
+			return Read16(state);
+		case 4:
+			return Read32(state);
+		case 8:
+			return ReadSigned32(state);
+		}
+		return 0;
+	}
+
+
+	static int64_t ReadAddrSize(DecodeState* state)
+	{
+		switch (state->addrSize)
+		{
+		case 2:
+			return Read16(state);
+		case 4:
+			return Read32(state);
+		case 8:
+			return (int64_t)Read64(state);
+		}
+		return 0;
+	}
+
+
+	static int64_t ReadSignedFinalOpSize(DecodeState* state)
+	{
+		switch (state->finalOpSize)
+		{
+		case 1:
+			return ReadSigned8(state);
+		case 2:
+			return ReadSigned16(state);
+		case 4:
+		case 8:
+			return ReadSigned32(state);
+		}
+		return 0;
+	}
+
+
+	static void UpdateOperationForAddrSize(DecodeState* state)
+	{
+		if (state->addrSize == 4)
+			state->result->operation = (InstructionOperation)(state->result->operation + 1);
+		else if (state->addrSize == 8)
+			state->result->operation = (InstructionOperation)(state->result->operation + 2);
+	}
+
+
+#ifdef X86_DECODE_PROFILE
+	// Decode profile counters, kept for each thread so that decoding doesn't need locks.  The first counters
+	// are the decode steps, followed by one for each decoding function in profileHandlers.
+#define PROFILE_PROCESS_PREFIXES		0
+#define PROFILE_PROCESS_ENCODING		1
+#define PROFILE_PROCESS_SPARSE_OPCODE	2
+#define PROFILE_FIRST_HANDLER			3
+#define PROFILE_HANDLER_CACHE_SIZE		256
+
+	struct ProfileHandler
+	{
+		DecodingFunction func;
+		const char* name;
+	};
+#ifndef __cplusplus
+	typedef struct ProfileHandler ProfileHandler;
+#endif
+
+	struct ProfileCounter
+	{
+		uint64_t calls, bytes, cycles;
+	};
+#ifndef __cplusplus
+	typedef struct ProfileCounter ProfileCounter;
+#endif
+
+#define PROFILE_HANDLER(func) {func, #func}
+	static const ProfileHandler profileHandlers[] =
+	{
+		PROFILE_HANDLER(InvalidDecode), PROFILE_HANDLER(DecodeTwoByte), PROFILE_HANDLER(DecodeFpu),
+		PROFILE_HANDLER(DecodeNoOperands), PROFILE_HANDLER(DecodeRegRM), PROFILE_HANDLER(DecodeRegRMImm),
+		PROFILE_HANDLER(DecodeRMRegImm8), PROFILE_HANDLER(DecodeRMRegCL), PROFILE_HANDLER(DecodeEaxImm),
+		PROFILE_HANDLER(DecodePushPopSeg), PROFILE_HANDLER(DecodeOpReg), PROFILE_HANDLER(DecodeEaxOpReg),
+		PROFILE_HANDLER(DecodeOpRegImm), PROFILE_HANDLER(DecodeNop), PROFILE_HANDLER(DecodeImm),
+		PROFILE_HANDLER(DecodeImm16Imm8), PROFILE_HANDLER(DecodeEdiDx), PROFILE_HANDLER(DecodeDxEsi),
+		PROFILE_HANDLER(DecodeRelImm), PROFILE_HANDLER(DecodeRelImmAddrSize), PROFILE_HANDLER(DecodeGroupRM),
+		PROFILE_HANDLER(DecodeGroupRMImm), PROFILE_HANDLER(DecodeGroupRMImm8V), PROFILE_HANDLER(DecodeGroupRMOne),
+		PROFILE_HANDLER(DecodeGroupRMCl), PROFILE_HANDLER(DecodeGroupF6F7), PROFILE_HANDLER(DecodeGroupFF),
+		PROFILE_HANDLER(DecodeGroup0F00), PROFILE_HANDLER(DecodeGroup0F01), PROFILE_HANDLER(DecodeGroup0FAE),
+		PROFILE_HANDLER(Decode0FB8), PROFILE_HANDLER(DecodeBitScan), PROFILE_HANDLER(DecodeRMSRegV),
+		PROFILE_HANDLER(DecodeRM8), PROFILE_HANDLER(DecodeRMV), PROFILE_HANDLER(DecodeFarImm),
+		PROFILE_HANDLER(DecodeEaxAddr), PROFILE_HANDLER(DecodeEdiEsi), PROFILE_HANDLER(DecodeEdiEax),
+		PROFILE_HANDLER(DecodeEaxEsi), PROFILE_HANDLER(DecodeAlEbxAl), PROFILE_HANDLER(DecodeEaxImm8),
+		PROFILE_HANDLER(DecodeEaxDx), PROFILE_HANDLER(Decode3DNow), PROFILE_HANDLER(DecodeSSETable),
+		PROFILE_HANDLER(DecodeSSETableImm8), PROFILE_HANDLER(DecodeSSETableMem8), PROFILE_HANDLER(DecodeSSE),
+		PROFILE_HANDLER(DecodeSSESingle), PROFILE_HANDLER(DecodeSSEPacked), PROFILE_HANDLER(DecodeMMX),
+		PROFILE_HANDLER(DecodeMMXSSEOnly), PROFILE_HANDLER(DecodeMMXGroup), PROFILE_HANDLER(DecodePinsrw),
+		PROFILE_HANDLER(DecodeRegCR), PROFILE_HANDLER(DecodeMovSXZX8), PROFILE_HANDLER(DecodeMovSXZX16),
+		PROFILE_HANDLER(DecodeMem16), PROFILE_HANDLER(DecodeMem32), PROFILE_HANDLER(DecodeMem64),
+		PROFILE_HANDLER(DecodeMem80), PROFILE_HANDLER(DecodeMemFloatEnv), PROFILE_HANDLER(DecodeMemFloatSave),
+		PROFILE_HANDLER(DecodeFPUReg), PROFILE_HANDLER(DecodeFPURegST0), PROFILE_HANDLER(DecodeRegGroupNoOperands),
+		PROFILE_HANDLER(DecodeRegGroupAX), PROFILE_HANDLER(DecodeCmpXch8B), PROFILE_HANDLER(DecodeMovNti),
+		PROFILE_HANDLER(DecodeCrc32), PROFILE_HANDLER(DecodeArpl), PROFILE_HANDLER(DecodeVEX),
+		PROFILE_HANDLER(DecodeEVEX)
+	};
+
+	static const char* const profileStepNames[PROFILE_FIRST_HANDLER] =
+		{"ProcessPrefixes", "ProcessEncoding", "ProcessSparseOpcode"};
+
+#define PROFILE_HANDLER_COUNT (sizeof(profileHandlers) / sizeof(ProfileHandler))
+#define PROFILE_COUNTER_COUNT (PROFILE_FIRST_HANDLER + PROFILE_HANDLER_COUNT)
+
+	static PROFILE_THREAD_LOCAL ProfileCounter profileCounters[PROFILE_COUNTER_COUNT];
+
+	// Direct-mapped cache of the counter index of recently called decoding functions
+	static PROFILE_THREAD_LOCAL DecodingFunction profileCacheFunc[PROFILE_HANDLER_CACHE_SIZE];
+	static PROFILE_THREAD_LOCAL uint8_t profileCacheIndex[PROFILE_HANDLER_CACHE_SIZE];
+
+
+	static ProfileCounter* GetHandlerCounter(DecodingFunction func)
+	{
+		size_t slot = ((size_t)func >> 4) & (PROFILE_HANDLER_CACHE_SIZE - 1);
+		size_t i;
+
+		if (profileCacheFunc[slot] == func)
+			return &profileCounters[profileCacheIndex[slot]];
+		for (i = 0; i < PROFILE_HANDLER_COUNT; i++)
+		{
+			if (profileHandlers[i].func == func)
+			{
+				profileCacheFunc[slot] = func;
+				profileCacheIndex[slot] = (uint8_t)(PROFILE_FIRST_HANDLER + i);
+				return &profileCounters[PROFILE_FIRST_HANDLER + i];
+			}
+		}
+		return NULL;
+	}
+
+
+	static __inline uint64_t ProfileTimestamp(void)
+	{
+#ifdef X86_DECODE_PROFILE_CYCLES
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+
+
+	static __inline void ProfileRecord(ProfileCounter* counter, const uint8_t* start, const DecodeState* state,
+		uint64_t timestamp)
+	{
+		uint64_t cycles = ProfileTimestamp() - timestamp;
+		if (!counter)
+			return;
+		counter->calls++;
+		counter->bytes += (uint64_t)(state->opcode - start);
+		counter->cycles += cycles;
+	}
+
+	// Counters include nested calls, such as the handler of the second opcode byte called from DecodeTwoByte
+#define PROFILE_BEGIN(state, counter) \
+	ProfileCounter* profileCounter = (counter); \
+	const uint8_t* profileStart = (state)->opcode; \
+	uint64_t profileTimestamp = ProfileTimestamp()
+#define PROFILE_END(state) ProfileRecord(profileCounter, profileStart, (state), profileTimestamp)
+#else
+#define PROFILE_BEGIN(state, counter)
+#define PROFILE_END(state)
+#endif
+
+
+	static __inline void CallDecodingFunction(DecodeState* state, DecodingFunction func)
+	{
+		PROFILE_BEGIN(state, GetHandlerCounter(func));
+		func(state);
+		PROFILE_END(state);
+	}
+
+
+	static void ProcessEncoding(DecodeState* state, const InstructionEncoding* encoding)
+	{
+		PROFILE_BEGIN(state, &profileCounters[PROFILE_PROCESS_ENCODING]);
+		state->result->operation = (InstructionOperation)encoding->operation;
+
+		state->flags = encoding->flags;
+		if (state->using64 && (state->flags & DEC_FLAG_INVALID_IN_64BIT))
+		{
+			state->invalid = true;
+			PROFILE_END(state);
+			return;
+		}
+		if (state->using64 && (state->flags & DEC_FLAG_DEFAULT_TO_64BIT))
+			state->opSize = state->opPrefix ? 4 : 8;
+		state->finalOpSize = GetFinalOpSize(state);
+
+		if (state->flags & DEC_FLAG_FLIP_OPERANDS)
+		{
+			state->operand0 = &state->result->operands[1];
+			state->operand1 = &state->result->operands[0];
+		}
+		else
+		{
+			state->operand0 = &state->result->operands[0];
+			state->operand1 = &state->result->operands[1];
+		}
+
+		if (state->flags & DEC_FLAG_FORCE_16BIT)
+			state->finalOpSize = 2;
+
+		if (state->flags & DEC_FLAG_OPERATION_OP_SIZE)
+		{
+			if (state->finalOpSize == 4)
+				state->result->operation = (InstructionOperation)(state->result->operation + 1);
+			else if (state->finalOpSize == 8)
+				state->result->operation = (InstructionOperation)(state->result->operation + 2);
+		}
+
+		if (state->flags & DEC_FLAG_REP)
+		{
+			if (state->rep != REP_PREFIX_NONE)
+				state->result->flags |= X86_FLAG_REP;
+		}
+		else if (state->flags & DEC_FLAG_REP_COND)
+		{
+			if (state->rep == REP_PREFIX_REPNE)
+				state->result->flags |= X86_FLAG_REPNE;
+			else if (state->rep == REP_PREFIX_REPE)
+				state->result->flags |= X86_FLAG_REPE;
+		}
+
+		CallDecodingFunction(state, encoding->func);
+
+		if (state->result->operation == INVALID)
+			state->invalid = true;
+
+		if (state->result->flags & X86_FLAG_LOCK)
+		{
+			// Ensure instruction allows lock and it has proper semantics
+			if (!(state->flags & DEC_FLAG_LOCK))
+				state->invalid = true;
+			else if (state->result->operation == CMP)
+				state->invalid = true;
+			else if ((state->result->operands[0].operand != MEM) && (state->result->operands[1].operand != MEM))
+				state->invalid = true;
+		}
+		PROFILE_END(state);
+	}
+
+
+	static void ProcessOpcode(DecodeState* state, const InstructionEncoding* map, uint8_t opcode)
+	{
+		ProcessEncoding(state, &map[opcode]);
+	}
+
+
+	static void ProcessSparseOpcode(DecodeState* state, const SparseInstructionEncoding* map, size_t mapSize, uint8_t opcode)
+	{
+		int i, min, max;
+		PROFILE_BEGIN(state, &profileCounters[PROFILE_PROCESS_SPARSE_OPCODE]);
+		state->result->operation = INVALID;
+		for (min = 0, max = (int)mapSize - 1, i = (min + max) / 2;
+			min <= max; i = (min + max) / 2)
+		{
+			if (opcode > map[i].opcode)
+				min = i + 1;
+			else if (opcode < map[i].opcode)
+				max = i - 1;
+			else
+			{
+				ProcessEncoding(state, &map[i].encoding);
+				break;
+			}
+		}
+		PROFILE_END(state);
+	}
+
+
+	static SegmentRegister GetFinalSegment(DecodeState* state, SegmentRegister seg)
+	{
+		return (state->result->segment == SEG_DEFAULT) ? seg : state->result->segment;
+	}
+
+
+	static void SetMemOperand(DecodeState* state, InstructionOperand* oper, const RMDef* def, int64_t immed)
+	{
+		oper->operand = MEM;
+		oper->components[0] = def->first;
+		oper->components[1] = def->second;
+		oper->immediate = immed;
+		oper->segment = GetFinalSegment(state, def->segment);
+	}
+
+
+	static void DecodeRM(DecodeState* state, InstructionOperand* rmOper, const RegDef* regList, uint16_t rmSize, uint8_t* regOper)
+	{
+		uint8_t rmByte = Read8(state);
+		uint8_t mod = rmByte >> 6;
+		uint8_t rm = rmByte & 7;
+		InstructionOperand temp;
+
+		if (regOper)
+			*regOper = (rmByte >> 3) & 7;
+
+		if (!rmOper)
+			rmOper = &temp;
+
+		rmOper->size = rmSize;
+		if (state->addrSize == 2)
+		{
+			static const RMDef rm16Components[9] = {{REG_BX, REG_SI, SEG_DS}, {REG_BX, REG_DI, SEG_DS},
+				{REG_BP, REG_SI, SEG_SS}, {REG_BP, REG_DI, SEG_SS}, {REG_SI, NONE, SEG_DS},
+				{REG_DI, NONE, SEG_DS}, {REG_BP, NONE, SEG_SS}, {REG_BX, NONE, SEG_DS},
+				{NONE, NONE, SEG_DS}};
+			switch (mod)
+			{
+			case 0:
+				if (rm == 6)
+				{
+					rm = 8;
+					SetMemOperand(state, rmOper, &rm16Components[rm], Read16(state));
+				}
+				else
+					SetMemOperand(state, rmOper, &rm16Components[rm], 0);
+				break;
+			case 1:
+				SetMemOperand(state, rmOper, &rm16Components[rm], ReadSigned8(state));
+				break;
+			case 2:
+				SetMemOperand(state, rmOper, &rm16Components[rm], ReadSigned16(state));
+				break;
+			case 3:
+				rmOper->operand = (OperandType)regList[rm];
+				break;
+			}
+			if (rmOper->components[0] == NONE)
+				rmOper->immediate &= 0xffff;
+		}
+		else
+		{
+			const RegDef* addrRegList = GetRegListForAddrSize(state);
+			uint8_t rmReg1Offset = state->rexRM1 ? 8 : 0;
+			uint8_t rmReg2Offset = state->rexRM2 ? 8 : 0;
+			SegmentRegister seg = SEG_DEFAULT;
+			rmOper->operand = MEM;
+			if ((mod != 3) && (rm == 4))
+			{
+				// SIB byte present
+				uint8_t sibByte = Read8(state);
+				uint8_t base = sibByte & 7;
+				uint8_t index = (sibByte >> 3) & 7;
+				rmOper->scale = 1 << (sibByte >> 6);
+				if ((mod != 0) || (base != 5))
+					rmOper->components[0] = (OperandType)addrRegList[base + rmReg1Offset];
+				if ((index + rmReg2Offset) != 4)
+					rmOper->components[1] = (OperandType)addrRegList[index + rmReg2Offset];
+				switch (mod)
+				{
+				case 0:
+					if (base == 5)
+						rmOper->immediate = ReadSigned32(state);
+					break;
+				case 1:
+					rmOper->immediate = ReadSigned8(state);
+					break;
+				case 2:
+					rmOper->immediate = ReadSigned32(state);
+					break;
+				}
+				if ((rmOper->components[0] != NONE) && (((base + rmReg1Offset) == 4) || ((base + rmReg1Offset) == 5)))
+					seg = SEG_SS;
+				else
+					seg = SEG_DS;
+			}
+			else
+			{
+				switch (mod)
+				{
+				case 0:
+					if (rm == 5)
+					{
+						if (state->addrSize == 8)
+							state->result->ripRelOffset = (uint8_t)(state->opcode - state->opcodeStart);
+						rmOper->immediate = ReadSigned32(state);
+						if (state->addrSize == 8)
+						{
+							state->ripRelFixup = &rmOper->immediate;
+							rmOper->relative = true;
+						}
+					}
+					else
+						rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
+					seg = SEG_DS;
+					break;
+				case 1:
+					rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
+					rmOper->immediate = ReadSigned8(state);
+					seg = ((rm + rmReg1Offset) == 5) ? SEG_SS : SEG_DS;
+					break;
+				case 2:
+					rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
+					rmOper->immediate = ReadSigned32(state);
+					seg = ((rm + rmReg1Offset) == 5) ? SEG_SS : SEG_DS;
+					break;
+				case 3:
+					rmOper->operand = (OperandType)regList[rm + rmReg1Offset];
+					break;
+				}
+			}
+			if (seg != SEG_DEFAULT)
+				rmOper->segment = GetFinalSegment(state, seg);
+			if ((rmOper->operand == MEM) && (state->addrSize == 4) && (rmOper->components[0] == NONE) &&
+				(rmOper->components[1] == NONE))
+				rmOper->immediate &= 0xffffffff;
+		}
+	}
+
+
+	static void DecodeRMReg(DecodeState* state, InstructionOperand* rmOper, const RegDef* rmRegList, uint16_t rmSize,
+		InstructionOperand* regOper, const RegDef* regList, uint16_t regSize)
+	{
+		uint8_t reg;
+		DecodeRM(state, rmOper, rmRegList, rmSize, &reg);
+		if (regOper)
+		{
+			uint8_t regOffset = state->rexReg ? 8 : 0;
+			regOper->size = regSize;
+			regOper->operand = (OperandType)regList[reg + regOffset];
+		}
+	}
+
+
+	static void SetOperandToEsEdi(DecodeState* state, InstructionOperand* oper, uint16_t size)
+	{
+		const RegDef* addrRegList = GetRegListForAddrSize(state);
+		oper->operand = MEM;
+		oper->components[0] = (OperandType)addrRegList[7];
+		oper->size = size;
+		oper->segment = SEG_ES;
+	}
+
+
+	static void SetOperandToDsEsi(DecodeState* state, InstructionOperand* oper, uint16_t size)
+	{
+		const RegDef* addrRegList = GetRegListForAddrSize(state);
+		oper->operand = MEM;
+		oper->components[0] = (OperandType)addrRegList[6];
+		oper->size = size;
+		oper->segment = GetFinalSegment(state, SEG_DS);
+	}
+
+
+	static void SetOperandToImmAddr(DecodeState* state, InstructionOperand* oper)
+	{
+		oper->operand = MEM;
+		oper->immediate = ReadAddrSize(state);
+		oper->segment = GetFinalSegment(state, SEG_DS);
+		oper->size = state->finalOpSize;
+	}
+
+
+	static void SetOperandToEaxFinalOpSize(DecodeState* state, InstructionOperand* oper)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		oper->operand = (OperandType)regList[0];
+		oper->size = state->finalOpSize;
+	}
+
+
+	static void SetOperandToOpReg(DecodeState* state, InstructionOperand* oper)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		uint8_t regOffset = state->rexRM1 ? 8 : 0;
+		oper->operand = (OperandType)regList[(state->opcode[-1] & 7) + regOffset];
+		oper->size = state->finalOpSize;
+	}
+
+
+	static void SetOperandToImm(DecodeState* state, InstructionOperand* oper)
+	{
+		oper->operand = IMM;
+		oper->size = state->finalOpSize;
+		oper->immediate = ReadFinalOpSize(state);
+	}
+
+
+	static void SetOperandToImm8(DecodeState* state, InstructionOperand* oper)
+	{
+		oper->operand = IMM;
+		oper->size = 1;
+		oper->immediate = Read8(state);
+	}
+
+
+	static void SetOperandToImm16(DecodeState* state, InstructionOperand* oper)
+	{
+		oper->operand = IMM;
+		oper->size = 2;
+		oper->immediate = Read16(state);
+	}
+
+
+	static uint8_t DecodeSSEPrefix(DecodeState* state)
+	{
+		if (state->opPrefix)
+		{
+			state->opPrefix = false;
+			return 1;
+		}
+		else if (state->rep == REP_PREFIX_REPNE)
+		{
+			state->rep = REP_PREFIX_NONE;
+			return 2;
+		}
+		else if (state->rep == REP_PREFIX_REPE)
+		{
+			state->rep = REP_PREFIX_NONE;
+			return 3;
+		}
+		return 0;
+	}
+
+
+	static uint16_t GetSizeForSSEType(uint8_t type)
+	{
+		if (type == 2)
+			return 8;
+		if (type == 3)
+			return 4;
+		return 16;
+	}
+
+
+	static InstructionOperand* GetOperandForSSEEntryType(DecodeState* state, uint16_t type, uint8_t operandIndex)
+	{
+		if (type == SSE_128_FLIP || type == SSE_64_FLIP) {
+			operandIndex = 1 - operandIndex;
+		}
+		if (operandIndex == 0)
+			return state->operand0;
+		return state->operand1;
+	}
+
+
+	static const RegDef* GetRegListForSSEEntryType(DecodeState* state, uint16_t type)
+	{
+		switch (type)
+		{
+		case MMX_32:
+		case MMX_64:
+			return mmxRegList;
+		case GPR_32_OR_64:
+			return (state->opSize == 8) ? reg64List : reg32List;
+		default:
+			return xmmRegList;
+		}
+	}
+
+
+	static uint16_t GetSizeForSSEEntryType(DecodeState* state, uint16_t type)
+	{
+		switch (type)
+		{
+		case SSE_16:
+			return 2;
+		case SSE_32:
+		case MMX_32:
+			return 4;
+		case SSE_64:
+		case MMX_64:
+		case SSE_64_FLIP:
+			return 8;
+		case GPR_32_OR_64:
+			return (state->opSize == 8) ? 8 : 4;
+		default:
+			return 16;
+		}
+	}
+
+
+	static void UpdateOperationForSSEEntryType(DecodeState* state, uint16_t type)
+	{
+		if ((type == GPR_32_OR_64) && (state->opSize == 8))
+			state->result->operation = (InstructionOperation)((int)state->result->operation + 1);
+	}
+
+
+	static const RegDef* GetRegListForVEXEntryType(DecodeState* state, uint8_t type)
+	{
+		switch (type)
+		{
+		case VEX_VEC:
+			if (state->vexL == 2)
+				return zmmRegList;
+			return state->vexL ? ymmRegList : xmmRegList;
+		case VEX_256:
+			return ymmRegList;
+		case VEX_HALF:
+			return (state->vexL == 2) ? ymmRegList : xmmRegList;
+		case VEX_MASK:
+			return kRegList;
+		case VEX_GPR_32:
+			return reg32List;
+		case VEX_GPR_32_OR_64:
+			return (state->opSize == 8) ? reg64List : reg32List;
+		default:
+			return xmmRegList;
+		}
+	}
+
+
+	static uint16_t GetSizeForVEXEntryType(DecodeState* state, uint8_t type)
+	{
+		switch (type)
+		{
+		case VEX_VEC:
+			return 16 << state->vexL;
+		case VEX_256:
+			return 32;
+		case VEX_HALF:
+			return 8 << state->vexL;
+		case VEX_QUARTER:
+			return 4 << state->vexL;
+		case VEX_EIGHTH:
+			return 2 << state->vexL;
+		case VEX_DUP:
+			return state->vexL ? (16 << state->vexL) : 8;
+		case VEX_8:
+			return 1;
+		case VEX_16:
+			return 2;
+		case VEX_32:
+		case VEX_GPR_32:
+			return 4;
+		case VEX_64:
+		case VEX_MASK:
+			return 8;
+		case VEX_GPR_32_OR_64:
+			return (state->opSize == 8) ? 8 : 4;
+		default:
+			return 16;
+		}
+	}
+
+
+	static void SetOperandToVEXReg(DecodeState* state, InstructionOperand* oper, uint8_t type)
+	{
+		oper->operand = (OperandType)GetRegListForVEXEntryType(state, type)[state->vexReg];
+		oper->size = GetSizeForVEXEntryType(state, type);
+	}
+
+
+	static void AddEVEXRegisterHigh(InstructionOperand* oper, uint8_t high)
+	{
+		// The vector register ranges are contiguous, so the upper 16 registers of a class follow the lower 16
+		if ((oper->operand >= REG_XMM0) && (oper->operand <= REG_ZMM31))
+			oper->operand = (OperandType)((int)oper->operand + high);
+	}
+
+
+	static void InvalidDecode(DecodeState* state)
+	{
+		state->invalid = true;
+	}
+
+
+	static void DecodeTwoByte(DecodeState* state)
+	{
+		uint8_t opcode = Read8(state);
+		if (opcode == 0x38)
+			ProcessSparseOpcode(state, threeByte0F38Map, sizeof(threeByte0F38Map) / sizeof(SparseInstructionEncoding), Read8(state));
+		else if (opcode == 0x3a)
+		{
+			ProcessSparseOpcode(state, threeByte0F3AMap, sizeof(threeByte0F3AMap) / sizeof(SparseInstructionEncoding), Read8(state));
+			SetOperandToImm8(state, &state->result->operands[2]);
+		}
+		else
+			ProcessOpcode(state, twoByteOpcodeMap, opcode);
+	}
+
+
+	static void DecodeFpu(DecodeState* state)
+	{
+		uint8_t modRM = Peek8(state);
+		uint8_t reg = (modRM >> 3) & 7;
+		uint8_t op = (uint8_t)state->result->operation;
+
+		const InstructionEncoding* map;
+		if ((modRM & 0xc0) == 0xc0)
+			map = fpuRegOpcodeMap[op];
+		else
+			map = fpuMemOpcodeMap[op];
+		ProcessEncoding(state, &map[reg]);
+	}
+
+
+	static void DecodeNoOperands(DecodeState* state)
+	{
+	}
+
+
+	static void DecodeRegRM(DecodeState* state)
+	{
+		uint16_t size = state->finalOpSize;
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		switch (state->flags & DEC_FLAG_REG_RM_SIZE_MASK)
+		{
+		case 0:
+			break;
+		case DEC_FLAG_REG_RM_2X_SIZE:
+			size *= 2;
+			break;
+		case DEC_FLAG_REG_RM_FAR_SIZE:
+			size += 2;
+			break;
+		case DEC_FLAG_REG_RM_NO_SIZE:
+			size = 0;
+			break;
+		}
+
+		DecodeRMReg(state, state->operand1, regList, size, state->operand0, regList, state->finalOpSize);
+
+		if ((size != state->finalOpSize) && (state->operand1->operand != MEM))
+			state->invalid = true;
+	}
+
+
+	static void DecodeRegRMImm(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		DecodeRMReg(state, state->operand1, regList, state->finalOpSize, state->operand0, regList, state->finalOpSize);
+		SetOperandToImm(state, &state->result->operands[2]);
+	}
+
+
+	static void DecodeRMRegImm8(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		DecodeRMReg(state, state->operand0, regList, state->finalOpSize, state->operand1, regList, state->finalOpSize);
+		SetOperandToImm8(state, &state->result->operands[2]);
+	}
+
+
+	static void DecodeRMRegCL(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		DecodeRMReg(state, state->operand0, regList, state->finalOpSize, state->operand1, regList, state->finalOpSize);
+		state->result->operands[2].operand = REG_CL;
+		state->result->operands[2].size = 1;
+	}
+
+
+	static void DecodeEaxImm(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		SetOperandToImm(state, state->operand1);
+	}
+
+
+	static void DecodePushPopSeg(DecodeState* state)
+	{
+		int8_t offset = 0;
+		if (state->opcode[-1] >= 0xa0) // FS/GS
+			offset = -16;
+		state->operand0->operand = (OperandType)(REG_ES + (state->opcode[-1] >> 3) + offset);
+		state->operand0->size = state->opSize;
+	}
+
+
+	static void DecodeOpReg(DecodeState* state)
+	{
+		SetOperandToOpReg(state, state->operand0);
+	}
+
+
+	static void DecodeEaxOpReg(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		SetOperandToOpReg(state, state->operand1);
+	}
+
+
+	static void DecodeOpRegImm(DecodeState* state)
+	{
+		SetOperandToOpReg(state, state->operand0);
+		state->operand1->operand = IMM;
+		state->operand1->size = state->finalOpSize;
+		state->operand1->immediate = (state->finalOpSize == 8) ? Read64(state) : ReadFinalOpSize(state);
+	}
+
+
+	static void DecodeNop(DecodeState* state)
+	{
+		if (state->rexRM1)
+		{
+			state->result->operation = XCHG;
+			DecodeEaxOpReg(state);
+		}
+		else if (state->rep == REP_PREFIX_REPE)
+			state->result->operation = PAUSE;
+	}
+
+
+	static void DecodeImm(DecodeState* state)
+	{
+		SetOperandToImm(state, state->operand0);
+	}
+
+
+	static void DecodeImm16Imm8(DecodeState* state)
+	{
+		SetOperandToImm16(state, state->operand0);
+		SetOperandToImm8(state, state->operand1);
+	}
+
+
+	static void DecodeEdiDx(DecodeState* state)
+	{
+		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
+		state->operand1->operand = REG_DX;
+		state->operand1->size = 2;
+	}
+
+
+	static void DecodeDxEsi(DecodeState* state)
+	{
+		state->operand0->operand = REG_DX;
+		state->operand0->size = 2;
+		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+	}
+
+
+	static void DecodeRelImm(DecodeState* state)
+	{
+		state->operand0->operand = IMM;
+		state->operand0->size = state->opSize;
+		state->operand0->immediate = ReadSignedFinalOpSize(state);
+		state->operand0->immediate += state->addr + (state->opcode - state->opcodeStart);
+		state->operand0->relative = true;
+	}
+
+
+	static void DecodeRelImmAddrSize(DecodeState* state)
+	{
+		DecodeRelImm(state);
+		UpdateOperationForAddrSize(state);
+	}
+
+
+	static void DecodeGroupRM(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForFinalOpSize(state);
+		uint8_t regField;
+		DecodeRM(state, state->operand0, regList, state->finalOpSize, &regField);
+		state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation][regField];
+	}
+
+
+	static void DecodeGroupRMImm(DecodeState* state)
+	{
+		DecodeGroupRM(state);
+		SetOperandToImm(state, state->operand1);
+	}
+
+
+	static void DecodeGroupRMImm8V(DecodeState* state)
+	{
+		DecodeGroupRM(state);
+		SetOperandToImm8(state, state->operand1);
+	}
+
+
+	static void DecodeGroupRMOne(DecodeState* state)
+	{
+		DecodeGroupRM(state);
+		state->operand1->operand = IMM;
+		state->operand1->size = 1;
+		state->operand1->immediate = 1;
+	}
+
+
+	static void DecodeGroupRMCl(DecodeState* state)
+	{
+		DecodeGroupRM(state);
+		state->operand1->operand = REG_CL;
+		state->operand1->size = 1;
+	}
+
+
+	static void DecodeGroupF6F7(DecodeState* state)
+	{
+		DecodeGroupRM(state);
+		if (state->result->operation == TEST)
+			SetOperandToImm(state, state->operand1);
+		// Check for valid locking semantics
+		if ((state->result->flags & X86_FLAG_LOCK) && (state->result->operation != NOT) && (state->result->operation != NEG))
+			state->invalid = true;
+	}
+
+
+	static void DecodeGroupFF(DecodeState* state)
+	{
+		if (state->using64)
+		{
+			// Default to 64-bit for jumps and calls
+			uint8_t rm = Peek8(state);
+			uint8_t regField = (rm >> 3) & 7;
+			if ((regField >= 2) && (regField <= 5))
+				state->finalOpSize = state->opSize = state->opPrefix ? 4 : 8;
+			else if (regField == 6)
+				state->finalOpSize = state->opSize = 8; // Prefix doesn't matter for 64 bit push
+		}
+		DecodeGroupRM(state);
+		// Check for valid far jump/call semantics
+		if ((state->result->operation == CALLF) || (state->result->operation == JMPF))
+		{
+			if (state->operand0->operand != MEM)
+				state->invalid = true;
+			state->operand0->size += 2;
+		}
+		// Check for valid locking semantics
+		if ((state->result->flags & X86_FLAG_LOCK) && (state->result->operation != INC) && (state->result->operation != DEC))
+			state->invalid = true;
+	}
+
+
+	static void DecodeGroup0F00(DecodeState* state)
+	{
+		uint8_t rm = Peek8(state);
+		uint8_t regField = (rm >> 3) & 7;
+		if (regField >= 2)
+			state->opSize = 2;
+		DecodeGroupRM(state);
+	}
+
+
+	static void DecodeGroup0F01(DecodeState* state)
+	{
+		uint8_t rm = Peek8(state);
+		uint8_t modField = (rm >> 6) & 3;
+		uint8_t regField = (rm >> 3) & 7;
+		uint8_t rmField = rm & 7;
+
+		if ((modField == 3) && (regField != 4) && (regField != 6))
 		{
-		case 2:
-			return Read16(state);
-		case 4:
-		case 8:
-			return Read32(state);
+			state->result->operation = (InstructionOperation)group0F01RegOperations[regField][rmField];
+			Read8(state);
+			return;
 		}
-		return 0;
+
+		if (regField < 4)
+			state->opSize = state->using64 ? 10 : 6;
+		else if (regField != 7)
+			state->opSize = 2;
+		else
+			state->opSize = 1;
+		DecodeGroupRM(state);
 	}
 
 
-	static int64_t ReadSignedFinalOpSize(DecodeState* state)
+	static void DecodeGroup0FAE(DecodeState* state)
 	{
-		switch (state->finalOpSize)
+		uint8_t rm = Peek8(state);
+		uint8_t modField = (rm >> 6) & 3;
+		uint8_t regField = (rm >> 3) & 7;
+
+		if (((rm & 0xf8) == 0xe8) || ((rm & 0xf8) == 0xf8) || ((rm & 0xf8) == 0xf0))
 		{
-		case 1:
-			return ReadSigned8(state);
-		case 2:
-			return ReadSigned16(state);
-		case 4:
-		case 8:
-			return ReadSigned32(state);
+			state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation + 1][regField];
+			Read8(state);
+			return;
 		}
-		return 0;
+
+		if (modField == 3)
+		{
+			state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation + 1][regField];
+			return;
+		}
+
+		if ((regField & 2) == 0)
+			state->opSize = 512;
+		else if ((regField & 6) == 2)
+			state->opSize = 4;
+		else
+			state->opSize = 1;
+		DecodeGroupRM(state);
+	}
+
+
+	static void Decode0FB8(DecodeState* state)
+	{
+		if (state->rep != REP_PREFIX_REPE)
+		{
+			if (state->using64)
+				state->opSize = state->opPrefix ? 4 : 8;
+			state->finalOpSize = GetFinalOpSize(state);
+			DecodeRelImm(state);
+			return;
+		}
+
+		DecodeRegRM(state);
+	}
+
+
+	static void DecodeBitScan(DecodeState* state)
+	{
+		// A REPE prefix selects TZCNT and LZCNT, which differ from BSF and BSR for a source of zero
+		if (state->rep == REP_PREFIX_REPE)
+			state->result->operation = (state->result->operation == BSF) ? TZCNT : LZCNT;
+		DecodeRegRM(state);
+	}
+
+
+	static void DecodeRMSRegV(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForOpSize(state);
+		uint8_t regField;
+		DecodeRM(state, state->operand0, regList, state->opSize, &regField);
+		if (regField >= 6)
+			state->invalid = true;
+		state->operand1->operand = (OperandType)(REG_ES + regField);
+		state->operand1->size = 2;
+		if (state->result->operands[0].operand == REG_CS)
+			state->invalid = true;
+	}
+
+
+	static void DecodeRM8(DecodeState* state)
+	{
+		const RegDef* regList = GetByteRegList(state);
+		DecodeRM(state, state->operand0, regList, 1, NULL);
+	}
+
+
+	static void DecodeRMV(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForOpSize(state);
+		DecodeRM(state, state->operand0, regList, state->opSize, NULL);
+	}
+
+
+	static void DecodeFarImm(DecodeState* state)
+	{
+		SetOperandToImm(state, state->operand1);
+		SetOperandToImm16(state, state->operand0);
+	}
+
+
+	static void DecodeEaxAddr(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		SetOperandToImmAddr(state, state->operand1);
+	}
+
+
+	static void DecodeEdiEsi(DecodeState* state)
+	{
+		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
+		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+	}
+
+
+	static void DecodeEdiEax(DecodeState* state)
+	{
+		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
+		SetOperandToEaxFinalOpSize(state, state->operand1);
+	}
+
+
+	static void DecodeEaxEsi(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+	}
+
+
+	static void DecodeAlEbxAl(DecodeState* state)
+	{
+		const RegDef* regList = GetRegListForAddrSize(state);
+		state->operand0->operand = REG_AL;
+		state->operand0->size = 1;
+		state->operand1->operand = MEM;
+		state->operand1->components[0] = (OperandType)regList[3];
+		state->operand1->components[1] = REG_AL;
+		state->operand1->size = 1;
+		state->operand1->segment = GetFinalSegment(state, SEG_DS);
+	}
+
+
+	static void DecodeEaxImm8(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		SetOperandToImm8(state, state->operand1);
+	}
+
+
+	static void DecodeEaxDx(DecodeState* state)
+	{
+		SetOperandToEaxFinalOpSize(state, state->operand0);
+		state->operand1->operand = REG_DX;
+		state->operand1->size = 2;
+	}
+
+
+	static void Decode3DNow(DecodeState* state)
+	{
+		uint8_t op;
+		int i, min, max;
+		DecodeRMReg(state, state->operand1, mmxRegList, 8, state->operand0, mmxRegList, 8);
+		op = Read8(state);
+		state->result->operation = INVALID;
+		for (min = 0, max = (int)(sizeof(sparse3DNowOpcodes) / sizeof(SparseOpEntry)) - 1, i = (min + max) / 2;
+			min <= max; i = (min + max) / 2)
+		{
+			if (op > sparse3DNowOpcodes[i].opcode)
+				min = i + 1;
+			else if (op < sparse3DNowOpcodes[i].opcode)
+				max = i - 1;
+			else
+			{
+				state->result->operation = (InstructionOperation)sparse3DNowOpcodes[i].operation;
+				break;
+			}
+		}
+	}
+
+
+	static void DecodeSSETable(DecodeState* state)
+	{
+		uint8_t type = DecodeSSEPrefix(state);
+		uint8_t rm = Peek8(state);
+		uint8_t modField = (rm >> 6) & 3;
+
+		const SSETableEntry* entry = &sseTable[(int)state->result->operation];
+		const SSETableOperationEntry* opEntry;
+
+		if (modField == 3)
+			opEntry = &entry->regOps[type];
+		else
+			opEntry = &entry->memOps[type];
+
+		state->result->operation = (InstructionOperation)opEntry->operation;
+		DecodeRMReg(state, GetOperandForSSEEntryType(state, opEntry->rmType, 1), GetRegListForSSEEntryType(state, opEntry->rmType),
+			GetSizeForSSEEntryType(state, opEntry->rmType), GetOperandForSSEEntryType(state, opEntry->regType, 0),
+			GetRegListForSSEEntryType(state, opEntry->regType), GetSizeForSSEEntryType(state, opEntry->regType));
+
+		if (state->flags & DEC_FLAG_INC_OPERATION_FOR_64)
+		{
+			UpdateOperationForSSEEntryType(state, opEntry->regType);
+			UpdateOperationForSSEEntryType(state, opEntry->rmType);
+		}
+	}
+
+
+	static void DecodeSSETableImm8(DecodeState* state)
+	{
+		DecodeSSETable(state);
+		SetOperandToImm8(state, &state->result->operands[2]);
+	}
+
+
+	static void DecodeSSETableMem8(DecodeState* state)
+	{
+		DecodeSSETable(state);
+		if (state->operand0->operand == MEM)
+			state->operand0->size = 1;
+		if (state->operand1->operand == MEM)
+			state->operand1->size = 1;
 	}
 
 
-	static void UpdateOperationForAddrSize(DecodeState* state)
-	{
-		if (state->addrSize == 4)
-			state->result->operation = (InstructionOperation)(state->result->operation + 1);
-		else if (state->addrSize == 8)
-			state->result->operation = (InstructionOperation)(state->result->operation + 2);
+	static void DecodeSSE(DecodeState* state)
+	{
+		uint8_t type = DecodeSSEPrefix(state);
+		uint8_t rm = Peek8(state);
+		uint8_t modField = (rm >> 6) & 3;
+		uint16_t size;
+
+		state->result->operation = (InstructionOperation)((int)state->result->operation + type);
+		if (modField == 3)
+			size = 16;
+		else
+			size = GetSizeForSSEType(type);
+		DecodeRMReg(state, state->operand1, xmmRegList, size, state->operand0, xmmRegList, 16);
 	}
 
 
-	static void ProcessEncoding(DecodeState* state, const InstructionEncoding* encoding)
+	static void DecodeSSESingle(DecodeState* state)
 	{
-		state->result->operation = (InstructionOperation)encoding->operation;
+		uint8_t type = DecodeSSEPrefix(state);
 
-		state->flags = encoding->flags;
-		if (state->using64 && (state->flags & DEC_FLAG_INVALID_IN_64BIT))
+		if ((type == 1) || (type == 2))
 		{
 			state->invalid = true;
 			return;
 		}
-		if (state->using64 && (state->flags & DEC_FLAG_DEFAULT_TO_64BIT))
-			state->opSize = state->opPrefix ? 4 : 8;
-		state->finalOpSize = GetFinalOpSize(state);
 
-		if (state->flags & DEC_FLAG_FLIP_OPERANDS)
-		{
-			state->operand0 = &state->result->operands[1];
-			state->operand1 = &state->result->operands[0];
-		}
-		else
-		{
-			state->operand0 = &state->result->operands[0];
-			state->operand1 = &state->result->operands[1];
-		}
+		state->result->operation = (InstructionOperation)((int)state->result->operation + (type & 1));
+		DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+	}
 
-		if (state->flags & DEC_FLAG_FORCE_16BIT)
-			state->finalOpSize = 2;
 
-		if (state->flags & DEC_FLAG_OPERATION_OP_SIZE)
-		{
-			if (state->finalOpSize == 4)
-				state->result->operation = (InstructionOperation)(state->result->operation + 1);
-			else if (state->finalOpSize == 8)
-				state->result->operation = (InstructionOperation)(state->result->operation + 2);
-		}
+	static void DecodeSSEPacked(DecodeState* state)
+	{
+		uint8_t type = DecodeSSEPrefix(state);
 
-		if (state->flags & DEC_FLAG_REP)
-		{
-			if (state->rep != REP_PREFIX_NONE)
-				state->result->flags |= X86_FLAG_REP;
-		}
-		else if (state->flags & DEC_FLAG_REP_COND)
+		if ((type == 2) || (type == 3))
 		{
-			if (state->rep == REP_PREFIX_REPNE)
-				state->result->flags |= X86_FLAG_REPNE;
-			else if (state->rep == REP_PREFIX_REPE)
-				state->result->flags |= X86_FLAG_REPE;
+			state->invalid = true;
+			return;
 		}
 
-		encoding->func(state);
+		state->result->operation = (InstructionOperation)((int)state->result->operation + (type & 1));
+		DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+	}
 
-		if (state->result->operation == INVALID)
-			state->invalid = true;
 
-		if (state->result->flags & X86_FLAG_LOCK)
-		{
-			// Ensure instruction allows lock and it has proper semantics
-			if (!(state->flags & DEC_FLAG_LOCK))
-				state->invalid = true;
-			else if (state->result->operation == CMP)
-				state->invalid = true;
-			else if ((state->result->operands[0].operand != MEM) && (state->result->operands[1].operand != MEM))
-				state->invalid = true;
-		}
+	static void DecodeMMX(DecodeState* state)
+	{
+		if (state->opPrefix)
+			DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+		else
+			DecodeRMReg(state, state->operand1, mmxRegList, 8, state->operand0, mmxRegList, 8);
 	}
 
 
-	static void ProcessOpcode(DecodeState* state, const InstructionEncoding* map, uint8_t opcode)
+	static void DecodeMMXSSEOnly(DecodeState* state)
 	{
-		ProcessEncoding(state, &map[opcode]);
+		if (state->opPrefix)
+			DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+		else
+			state->invalid = true;
 	}
 
 
-	static void ProcessSparseOpcode(DecodeState* state, const SparseInstructionEncoding* map, size_t mapSize, uint8_t opcode)
+	static void DecodeMMXGroup(DecodeState* state)
 	{
-		int i, min, max;
-		state->result->operation = INVALID;
-		for (min = 0, max = (int)mapSize - 1, i = (min + max) / 2;
-			min <= max; i = (min + max) / 2)
+		uint8_t regField;
+		if (state->opPrefix)
 		{
-			if (opcode > map[i].opcode)
-				min = i + 1;
-			else if (opcode < map[i].opcode)
-				max = i - 1;
-			else
-			{
-				ProcessEncoding(state, &map[i].encoding);
-				break;
-			}
+			DecodeRM(state, state->operand0, xmmRegList, 16, &regField);
+			state->result->operation = (InstructionOperation)mmxGroupOperations[(int)state->result->operation][regField][1];
+		}
+		else
+		{
+			DecodeRM(state, state->operand0, mmxRegList, 8, &regField);
+			state->result->operation = (InstructionOperation)mmxGroupOperations[(int)state->result->operation][regField][0];
 		}
+		SetOperandToImm8(state, state->operand1);
 	}
 
 
-	static SegmentRegister GetFinalSegment(DecodeState* state, SegmentRegister seg)
+	static void DecodePinsrw(DecodeState* state)
 	{
-		return (state->result->segment == SEG_DEFAULT) ? seg : state->result->segment;
+		DecodeSSETableImm8(state);
+		if (state->operand1->operand == MEM)
+			state->operand1->size = 2;
 	}
 
 
-	static void SetMemOperand(DecodeState* state, InstructionOperand* oper, const RMDef* def, int64_t immed)
+	static void DecodeRegCR(DecodeState* state)
 	{
-		oper->operand = MEM;
-		oper->components[0] = def->first;
-		oper->components[1] = def->second;
-		oper->immediate = immed;
-		oper->segment = GetFinalSegment(state, def->segment);
+		const RegDef* regList;
+		uint8_t reg;
+		if (state->opSize == 2)
+			state->opSize = 4;
+		regList = GetRegListForOpSize(state);
+		reg = Read8(state);
+		if (state->result->flags & X86_FLAG_LOCK)
+		{
+			state->result->flags &= ~X86_FLAG_LOCK;
+			state->rexReg = true;
+		}
+		state->operand0->operand = regList[(reg & 7) + (state->rexRM1 ? 8 : 0)];
+		state->operand0->size = state->opSize;
+		state->operand1->operand = (OperandType)((int)state->result->operation + ((reg >> 3) & 7) +
+			(state->rexReg ? 8 : 0));
+		state->operand1->size = state->opSize;
+		state->result->operation = MOV;
 	}
 
 
-	static void DecodeRM(DecodeState* state, InstructionOperand* rmOper, const RegDef* regList, uint16_t rmSize, uint8_t* regOper)
+	static void DecodeMovSXZX8(DecodeState* state)
 	{
-		uint8_t rmByte = Read8(state);
-		uint8_t mod = rmByte >> 6;
-		uint8_t rm = rmByte & 7;
-		InstructionOperand temp;
-
-		if (regOper)
-			*regOper = (rmByte >> 3) & 7;
-
-		if (!rmOper)
-			rmOper = &temp;
-
-		rmOper->size = rmSize;
-		if (state->addrSize == 2)
-		{
-			static const RMDef rm16Components[9] = {{REG_BX, REG_SI, SEG_DS}, {REG_BX, REG_DI, SEG_DS},
-				{REG_BP, REG_SI, SEG_SS}, {REG_BP, REG_DI, SEG_SS}, {REG_SI, NONE, SEG_DS},
-				{REG_DI, NONE, SEG_DS}, {REG_BP, NONE, SEG_SS}, {REG_BX, NONE, SEG_DS},
-				{NONE, NONE, SEG_DS}};
-			switch (mod)
-			{
-			case 0:
-				if (rm == 6)
-				{
-					rm = 8;
-					SetMemOperand(state, rmOper, &rm16Components[rm], Read16(state));
-				}
-				else
-					SetMemOperand(state, rmOper, &rm16Components[rm], 0);
-				break;
-			case 1:
-				SetMemOperand(state, rmOper, &rm16Components[rm], ReadSigned8(state));
-				break;
-			case 2:
-				SetMemOperand(state, rmOper, &rm16Components[rm], ReadSigned16(state));
-				break;
-			case 3:
-				rmOper->operand = (OperandType)regList[rm];
-				break;
-			}
-			if (rmOper->components[0] == NONE)
-				rmOper->immediate &= 0xffff;
-		}
-		else
-		{
-			const RegDef* addrRegList = GetRegListForAddrSize(state);
-			uint8_t rmReg1Offset = state->rexRM1 ? 8 : 0;
-			uint8_t rmReg2Offset = state->rexRM2 ? 8 : 0;
-			SegmentRegister seg = SEG_DEFAULT;
-			rmOper->operand = MEM;
-			if ((mod != 3) && (rm == 4))
-			{
-				// SIB byte present
-				uint8_t sibByte = Read8(state);
-				uint8_t base = sibByte & 7;
-				uint8_t index = (sibByte >> 3) & 7;
-				rmOper->scale = 1 << (sibByte >> 6);
-				if ((mod != 0) || (base != 5))
-					rmOper->components[0] = (OperandType)addrRegList[base + rmReg1Offset];
-				if ((index + rmReg2Offset) != 4)
-					rmOper->components[1] = (OperandType)addrRegList[index + rmReg2Offset];
-				switch (mod)
-				{
-				case 0:
-					if (base == 5)
-						rmOper->immediate = ReadSigned32(state);
-					break;
-				case 1:
-					rmOper->immediate = ReadSigned8(state);
-					break;
-				case 2:
-					rmOper->immediate = ReadSigned32(state);
-					break;
-				}
-				if (((base + rmReg1Offset) == 4) || ((base + rmReg1Offset) == 5))
-					seg = SEG_SS;
-				else
-					seg = SEG_DS;
-			}
-			else
-			{
-				switch (mod)
-				{
-				case 0:
-					if (rm == 5)
-					{
-						rmOper->immediate = ReadSigned32(state);
-						if (state->addrSize == 8)
-						{
-							state->ripRelFixup = &rmOper->immediate;
-							rmOper->relative = true;
-						}
-					}
-					else
-						rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
-					seg = SEG_DS;
-					break;
-				case 1:
-					rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
-					rmOper->immediate = ReadSigned8(state);
-					seg = (rm == 5) ? SEG_SS : SEG_DS;
-					break;
-				case 2:
-					rmOper->components[0] = (OperandType)addrRegList[rm + rmReg1Offset];
-					rmOper->immediate = ReadSigned32(state);
-					seg = (rm == 5) ? SEG_SS : SEG_DS;
-					break;
-				case 3:
-					rmOper->operand = (OperandType)regList[rm + rmReg1Offset];
-					break;
-				}
-			}
-			if (seg != SEG_DEFAULT)
-				rmOper->segment = GetFinalSegment(state, seg);
-		}
+		DecodeRMReg(state, state->operand1, GetByteRegList(state), 1, state->operand0, GetRegListForOpSize(state), state->opSize);
 	}
 
 
-	static void DecodeRMReg(DecodeState* state, InstructionOperand* rmOper, const RegDef* rmRegList, uint16_t rmSize,
-		InstructionOperand* regOper, const RegDef* regList, uint16_t regSize)
+	static void DecodeMovSXZX16(DecodeState* state)
 	{
-		uint8_t reg;
-		DecodeRM(state, rmOper, rmRegList, rmSize, &reg);
-		if (regOper)
-		{
-			uint8_t regOffset = state->rexReg ? 8 : 0;
-			regOper->size = regSize;
-			regOper->operand = (OperandType)regList[reg + regOffset];
-		}
+		DecodeRMReg(state, state->operand1, reg16List, 2, state->operand0, GetRegListForOpSize(state), state->opSize);
 	}
 
 
-	static void SetOperandToEsEdi(DecodeState* state, InstructionOperand* oper, uint16_t size)
+	static void DecodeMem16(DecodeState* state)
 	{
-		const RegDef* addrRegList = GetRegListForAddrSize(state);
-		oper->operand = MEM;
-		oper->components[0] = (OperandType)addrRegList[7];
-		oper->size = size;
-		oper->segment = SEG_ES;
+		DecodeRM(state, state->operand0, reg32List, 2, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToDsEsi(DecodeState* state, InstructionOperand* oper, uint16_t size)
+	static void DecodeMem32(DecodeState* state)
 	{
-		const RegDef* addrRegList = GetRegListForAddrSize(state);
-		oper->operand = MEM;
-		oper->components[0] = (OperandType)addrRegList[6];
-		oper->size = size;
-		oper->segment = GetFinalSegment(state, SEG_DS);
+		DecodeRM(state, state->operand0, reg32List, 4, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToImmAddr(DecodeState* state, InstructionOperand* oper)
+	static void DecodeMem64(DecodeState* state)
 	{
-		oper->operand = MEM;
-		oper->immediate = ReadAddrSize(state);
-		oper->segment = GetFinalSegment(state, SEG_DS);
-		oper->size = state->finalOpSize;
+		DecodeRM(state, state->operand0, reg32List, 8, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToEaxFinalOpSize(DecodeState* state, InstructionOperand* oper)
+	static void DecodeMem80(DecodeState* state)
 	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		oper->operand = (OperandType)regList[0];
-		oper->size = state->finalOpSize;
+		DecodeRM(state, state->operand0, reg32List, 10, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToOpReg(DecodeState* state, InstructionOperand* oper)
+	static void DecodeMemFloatEnv(DecodeState* state)
 	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		uint8_t regOffset = state->rexRM1 ? 8 : 0;
-		oper->operand = (OperandType)regList[(state->opcode[-1] & 7) + regOffset];
-		oper->size = state->finalOpSize;
+		DecodeRM(state, state->operand0, reg32List, (state->opSize == 2) ? 14 : 28, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToImm(DecodeState* state, InstructionOperand* oper)
+	static void DecodeMemFloatSave(DecodeState* state)
 	{
-		oper->operand = IMM;
-		oper->size = state->finalOpSize;
-		oper->immediate = ReadFinalOpSize(state);
+		DecodeRM(state, state->operand0, reg32List, (state->opSize == 2) ? 94 : 108, NULL);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static void SetOperandToImm8(DecodeState* state, InstructionOperand* oper)
+	static void DecodeFPUReg(DecodeState* state)
 	{
-		oper->operand = IMM;
-		oper->size = 1;
-		oper->immediate = Read8(state);
+		DecodeRM(state, state->operand0, fpuRegList, 10, NULL);
 	}
 
 
-	static void SetOperandToImm16(DecodeState* state, InstructionOperand* oper)
+	static void DecodeFPURegST0(DecodeState* state)
 	{
-		oper->operand = IMM;
-		oper->size = 2;
-		oper->immediate = Read16(state);
+		DecodeFPUReg(state);
+		state->operand1->operand = REG_ST0;
+		state->operand1->size = 10;
 	}
 
 
-	static uint8_t DecodeSSEPrefix(DecodeState* state)
+	static void DecodeRegGroupNoOperands(DecodeState* state)
 	{
-		if (state->opPrefix)
+		uint8_t rmByte = Read8(state);
+		state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation][rmByte & 7];
+	}
+
+
+	static void DecodeRegGroupAX(DecodeState* state)
+	{
+		DecodeRegGroupNoOperands(state);
+		state->operand0->operand = REG_AX;
+		state->operand0->size = 2;
+	}
+
+
+	static void DecodeCmpXch8B(DecodeState* state)
+	{
+		uint8_t rm = Peek8(state);
+		uint8_t regField = (rm >> 3) & 7;
+
+		if (regField == 1)
 		{
-			state->opPrefix = false;
-			return 1;
+			if (state->opSize == 2)
+				state->opSize = 4;
+			else if (state->opSize == 8)
+				state->result->operation = CMPXCH16B;
+			DecodeRM(state, state->operand0, GetRegListForOpSize(state), state->opSize * 2, NULL);
 		}
-		else if (state->rep == REP_PREFIX_REPNE)
+		else if ((regField >= 3) && (regField <= 5))
 		{
-			state->rep = REP_PREFIX_NONE;
-			return 2;
+			// Compacted and supervisor state save area, sized like XSAVE.  REX.W selects the 64-bit forms,
+			// which save the 64-bit x87 instruction and data pointers.
+			if (regField == 3)
+				state->result->operation = XRSTORS;
+			else if (regField == 4)
+				state->result->operation = XSAVEC;
+			else
+				state->result->operation = XSAVES;
+			if (state->opSize == 8)
+				state->result->operation = (InstructionOperation)(state->result->operation + 3);
+			DecodeRM(state, state->operand0, reg64List, 512, NULL);
 		}
-		else if (state->rep == REP_PREFIX_REPE)
+		else if (regField == 6)
 		{
-			state->rep = REP_PREFIX_NONE;
-			return 3;
+			if (state->opPrefix)
+				state->result->operation = VMCLEAR;
+			else if (state->rep == REP_PREFIX_REPE)
+				state->result->operation = VMXON;
+			else
+				state->result->operation = VMPTRLD;
+			DecodeRM(state, state->operand0, reg64List, 8, NULL);
 		}
-		return 0;
+		else if (regField == 7)
+		{
+			state->result->operation = VMPTRST;
+			DecodeRM(state, state->operand0, reg64List, 8, NULL);
+		}
+		else
+			state->invalid = true;
+
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static uint16_t GetSizeForSSEType(uint8_t type)
+	static void DecodeMovNti(DecodeState* state)
 	{
-		if (type == 2)
-			return 8;
-		if (type == 3)
-			return 4;
-		return 16;
+		if (state->opSize == 2)
+			state->opSize = 4;
+		DecodeRMReg(state, state->operand0, GetRegListForOpSize(state), state->opSize, state->operand1, GetRegListForOpSize(state), state->opSize);
+		if (state->operand0->operand != MEM)
+			state->invalid = true;
 	}
 
 
-	static InstructionOperand* GetOperandForSSEEntryType(DecodeState* state, uint16_t type, uint8_t operandIndex)
+	static void DecodeMovbe(DecodeState* state)
 	{
-		if (type == SSE_128_FLIP || type == SSE_64_FLIP) {
-			operandIndex = 1 - operandIndex;
+		// Without an F2 prefix the CRC32 opcodes are MOVBE, which only has a memory form
+		const RegDef* regList = GetRegListForOpSize(state);
+		state->result->operation = MOVBE;
+		state->finalOpSize = state->opSize;
+		if (state->flags & DEC_FLAG_BYTE)
+			DecodeRMReg(state, state->operand1, regList, state->opSize, state->operand0, regList, state->opSize);
+		else
+			DecodeRMReg(state, state->operand0, regList, state->opSize, state->operand1, regList, state->opSize);
+		if ((state->result->operands[0].operand != MEM) && (state->result->operands[1].operand != MEM))
+			state->invalid = true;
+	}
+
+
+	static void DecodeCrc32(DecodeState* state)
+	{
+		const RegDef* srcRegList = GetRegListForFinalOpSize(state);
+		if (state->rep != REP_PREFIX_REPNE)
+		{
+			DecodeMovbe(state);
+			return;
 		}
-		if (operandIndex == 0)
-			return state->operand0;
-		return state->operand1;
+		const RegDef* destRegList = (state->opSize == 8) ? reg64List : reg32List;
+		uint16_t destSize = (state->opSize == 8) ? 8 : 4;
+		DecodeRMReg(state, state->operand1, srcRegList, state->finalOpSize, state->operand0, destRegList, destSize);
 	}
 
 
-	static const RegDef* GetRegListForSSEEntryType(DecodeState* state, uint16_t type)
+	static void DecodeArpl(DecodeState* state)
 	{
-		switch (type)
+		if (state->using64)
 		{
-		case MMX_32:
-		case MMX_64:
-			return mmxRegList;
-		case GPR_32_OR_64:
-			return (state->opSize == 8) ? reg64List : reg32List;
-		default:
-			return xmmRegList;
+			// In 64-bit ARPL is repurposed to MOVSXD
+			const RegDef* regList = GetRegListForFinalOpSize(state);
+			state->result->operation = MOVSXD;
+			DecodeRMReg(state, state->operand1, reg32List, 4, state->operand0, regList, state->finalOpSize);
+		}
+		else
+		{
+			// ARPL instruction
+			state->operand0 = &state->result->operands[1];
+			state->operand1 = &state->result->operands[0];
+			state->finalOpSize = 2;
+			DecodeRegRM(state);
 		}
 	}
 
 
-	static uint16_t GetSizeForSSEEntryType(DecodeState* state, uint16_t type)
-	{
-		switch (type)
+	static const VEXTableEntry* FindVEXTableEntry(const VEXTableEntry* map, size_t mapSize, uint8_t opcode, bool w)
+	{
+		// Tables are sorted by opcode and then by W
+		uint16_t key = (uint16_t)((opcode << 1) | (w ? 1 : 0));
+		int i, min, max;
+		for (min = 0, max = (int)mapSize - 1, i = (min + max) / 2;
+			min <= max; i = (min + max) / 2)
+		{
+			uint16_t entryKey = (uint16_t)((map[i].opcode << 1) | map[i].w);
+			if (key > entryKey)
+				min = i + 1;
+			else if (key < entryKey)
+				max = i - 1;
+			else
+				return &map[i];
+		}
+		return NULL;
+	}
+
+
+	static const VEXTableOperationEntry* GetVEXOperationEntry(DecodeState* state, const VEXTableEntry* entry, uint8_t pp)
+	{
+		// Instructions without operands (VZEROUPPER/VZEROALL) have no ModRM byte to select the entry with
+		uint8_t column = vexPrefixColumn[pp];
+		if (((entry->regOps[column].encoding & VEX_ENCODING_MASK) == VEX_NO_OPERANDS) || ((Peek8(state) & 0xc0) == 0xc0))
+			return &entry->regOps[column];
+		return &entry->memOps[column];
+	}
+
+
+	static void DecodeVEXRMReg(DecodeState* state, InstructionOperand* rmOper, const RegDef* rmList, uint16_t rmSize,
+		InstructionOperand* regOper, const RegDef* regList, uint16_t regSize)
+	{
+		DecodeRMReg(state, rmOper, rmList, rmSize, regOper, regList, regSize);
+		AddEVEXRegisterHigh(regOper, state->evexRegHigh);
+		AddEVEXRegisterHigh(rmOper, state->evexRMHigh);
+	}
+
+
+	static void DecodeVEXOperands(DecodeState* state, const VEXTableOperationEntry* opEntry)
+	{
+		InstructionOperand* operands = state->result->operands;
+		InstructionOperand* indexOper;
+		const RegDef* regList;
+		const RegDef* rmList;
+		const uint8_t* sib;
+		uint16_t regSize, rmSize;
+		uint8_t vvvvType, reg, imm, i;
+
+		state->result->operation = (InstructionOperation)opEntry->operation;
+		if (((opEntry->encoding & VEX_L0) && (state->vexL != 0)) || ((opEntry->encoding & VEX_L1) && (state->vexL == 0)) ||
+			((opEntry->encoding & EVEX_L2) && (state->vexL != 2)))
+		{
+			state->invalid = true;
+			return;
+		}
+		if ((opEntry->encoding & VEX_INC_OPERATION_FOR_64) && (state->opSize == 8))
+			state->result->operation = (InstructionOperation)((int)state->result->operation + 1);
+
+		regList = GetRegListForVEXEntryType(state, opEntry->regType);
+		regSize = GetSizeForVEXEntryType(state, opEntry->regType);
+		rmList = GetRegListForVEXEntryType(state, opEntry->rmType);
+		rmSize = GetSizeForVEXEntryType(state, opEntry->rmType);
+
+		// Operations writing an opmask register take the type of the vvvv source from the r/m operand
+		vvvvType = (opEntry->regType == VEX_MASK) ? opEntry->rmType : opEntry->regType;
+
+		switch (opEntry->encoding & VEX_ENCODING_MASK)
+		{
+		case VEX_RM:
+			DecodeVEXRMReg(state, &operands[1], rmList, rmSize, &operands[0], regList, regSize);
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_MR:
+			DecodeVEXRMReg(state, &operands[0], rmList, rmSize, &operands[1], regList, regSize);
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_RVM:
+			DecodeVEXRMReg(state, &operands[2], rmList, rmSize, &operands[0], regList, regSize);
+			SetOperandToVEXReg(state, &operands[1], vvvvType);
+			break;
+		case VEX_RMV:
+			DecodeVEXRMReg(state, &operands[1], rmList, rmSize, &operands[0], regList, regSize);
+			SetOperandToVEXReg(state, &operands[2], opEntry->regType);
+			break;
+		case VEX_MVR:
+			DecodeVEXRMReg(state, &operands[0], rmList, rmSize, &operands[2], regList, regSize);
+			SetOperandToVEXReg(state, &operands[1], opEntry->regType);
+			break;
+		case VEX_VM:
+			DecodeRM(state, &operands[1], rmList, rmSize, &reg);
+			state->result->operation = (InstructionOperation)vexGroupOperations[opEntry->operation][reg];
+			SetOperandToVEXReg(state, &operands[0], opEntry->regType);
+			break;
+		case VEX_RMI:
+			DecodeVEXRMReg(state, &operands[1], rmList, rmSize, &operands[0], regList, regSize);
+			SetOperandToImm8(state, &operands[2]);
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_MRI:
+			DecodeVEXRMReg(state, &operands[0], rmList, rmSize, &operands[1], regList, regSize);
+			SetOperandToImm8(state, &operands[2]);
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_RVMI:
+			DecodeVEXRMReg(state, &operands[2], rmList, rmSize, &operands[0], regList, regSize);
+			SetOperandToVEXReg(state, &operands[1], vvvvType);
+			SetOperandToImm8(state, &operands[3]);
+			break;
+		case VEX_RVMR:
+			// Fourth operand is a register encoded in the upper bits of the immediate byte
+			DecodeVEXRMReg(state, &operands[2], rmList, rmSize, &operands[0], regList, regSize);
+			SetOperandToVEXReg(state, &operands[1], opEntry->regType);
+			imm = Read8(state);
+			operands[3].operand = (OperandType)regList[(imm >> 4) & (state->using64 ? 15 : 7)];
+			operands[3].size = regSize;
+			break;
+		case VEX_VMI:
+			DecodeRM(state, &operands[1], rmList, rmSize, &reg);
+			AddEVEXRegisterHigh(&operands[1], state->evexRMHigh);
+			state->result->operation = (InstructionOperation)vexGroupOperations[opEntry->operation][reg];
+			SetOperandToVEXReg(state, &operands[0], opEntry->regType);
+			SetOperandToImm8(state, &operands[2]);
+			break;
+		case VEX_M:
+			DecodeRM(state, &operands[0], rmList, rmSize, &reg);
+			state->result->operation = (InstructionOperation)vexGroupOperations[opEntry->operation][reg];
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_NO_OPERANDS:
+			// L selects between the two operations
+			if (state->vexL)
+				state->result->operation = (InstructionOperation)((int)state->result->operation + 1);
+			if (state->vexReg != 0)
+				state->invalid = true;
+			break;
+		case VEX_GATHER:
+		case VEX_SCATTER:
+			// Vector SIB addressing, a SIB byte is required and its index field selects a vector register
+			if ((state->addrSize == 2) || ((Peek8(state) & 7) != 4))
+			{
+				state->invalid = true;
+				break;
+			}
+			sib = state->opcode + 1;
+			if ((opEntry->encoding & VEX_ENCODING_MASK) == VEX_GATHER)
+			{
+				DecodeVEXRMReg(state, &operands[1], rmList, state->vexW ? 8 : 4, &operands[0], regList, regSize);
+				indexOper = &operands[1];
+			}
+			else
+			{
+				DecodeVEXRMReg(state, &operands[0], rmList, state->vexW ? 8 : 4, &operands[1], regList, regSize);
+				indexOper = &operands[0];
+			}
+			if (state->invalid)
+				break;
+
+			// EVEX forms take the mask from the opmask field and use V' as the upper bit of the index register
+			indexOper->components[1] = (OperandType)rmList[((*sib >> 3) & 7) + (state->rexRM2 ? 8 : 0) +
+				(state->vexReg & 16)];
+			if (!state->evex)
+				SetOperandToVEXReg(state, &operands[2], opEntry->regType);
+			else if (state->vexReg & 15)
+				state->invalid = true;
+			break;
+		}
+
+		// Register operands are reported at the width of the register, which is wider than the data for the
+		// half width vector types
+		for (i = 0; i < 4; i++)
 		{
-		case SSE_16:
-			return 2;
-		case SSE_32:
-		case MMX_32:
-			return 4;
-		case SSE_64:
-		case MMX_64:
-		case SSE_64_FLIP:
-			return 8;
-		case GPR_32_OR_64:
-			return (state->opSize == 8) ? 8 : 4;
-		default:
-			return 16;
+			if ((operands[i].operand >= REG_XMM0) && (operands[i].operand <= REG_XMM31))
+				operands[i].size = 16;
+			else if ((operands[i].operand >= REG_YMM0) && (operands[i].operand <= REG_YMM31))
+				operands[i].size = 32;
+			else if ((operands[i].operand >= REG_ZMM0) && (operands[i].operand <= REG_ZMM31))
+				operands[i].size = 64;
 		}
 	}
 
 
-	static void UpdateOperationForSSEEntryType(DecodeState* state, uint16_t type)
+	static void DecodeVEX(DecodeState* state)
 	{
-		if ((type == GPR_32_OR_64) && (state->opSize == 8))
-			state->result->operation = (InstructionOperation)((int)state->result->operation + 1);
-	}
+		const VEXTableEntry* entry;
+		uint8_t vex, map;
 
+		if ((!state->using64) && ((Peek8(state) & 0xc0) != 0xc0))
+		{
+			// Outside of 64-bit mode this is only a VEX prefix if the next byte would have been a register
+			// operand, which is not valid for LES or LDS
+			DecodeRegRM(state);
+			return;
+		}
 
-	static void InvalidDecode(DecodeState* state)
-	{
-		state->invalid = true;
-	}
-
+		// VEX cannot be combined with operand size, repeat, lock, or REX prefixes
+		if (state->opPrefix || (state->rep != REP_PREFIX_NONE) || state->rex || (state->result->flags & X86_FLAG_LOCK))
+		{
+			state->invalid = true;
+			return;
+		}
 
-	static void DecodeTwoByte(DecodeState* state)
-	{
-		uint8_t opcode = Read8(state);
-		if (opcode == 0x38)
-			ProcessSparseOpcode(state, threeByte0F38Map, sizeof(threeByte0F38Map) / sizeof(SparseInstructionEncoding), Read8(state));
-		else if (opcode == 0x3a)
+		vex = Read8(state);
+		if (state->result->operation == LES)
 		{
-			ProcessSparseOpcode(state, threeByte0F3AMap, sizeof(threeByte0F3AMap) / sizeof(SparseInstructionEncoding), Read8(state));
-			SetOperandToImm8(state, &state->result->operands[2]);
+			// Three byte form, the register extension bits are stored inverted
+			if (state->using64)
+			{
+				state->rexReg = (vex & 0x80) == 0;
+				state->rexRM2 = (vex & 0x40) == 0;
+				state->rexRM1 = (vex & 0x20) == 0;
+			}
+			map = vex & 0x1f;
+			vex = Read8(state);
+			state->vexW = (vex & 0x80) != 0;
 		}
 		else
-			ProcessOpcode(state, twoByteOpcodeMap, opcode);
+		{
+			// Two byte form always uses the 0F map with W clear
+			if (state->using64)
+				state->rexReg = (vex & 0x80) == 0;
+			map = 1;
+			state->vexW = false;
+		}
+		state->vexReg = ((vex >> 3) ^ 15) & (state->using64 ? 15 : 7);
+		state->vexL = (vex >> 2) & 1;
+		state->evex = false;
+		state->evexRegHigh = 0;
+		state->evexRMHigh = 0;
+		if (state->using64 && state->vexW)
+			state->opSize = 8;
+
+		switch (map)
+		{
+		case 1:
+			entry = FindVEXTableEntry(vex0FMap, sizeof(vex0FMap) / sizeof(VEXTableEntry), Read8(state), state->vexW);
+			break;
+		case 2:
+			entry = FindVEXTableEntry(vex0F38Map, sizeof(vex0F38Map) / sizeof(VEXTableEntry), Read8(state),
+				state->vexW);
+			break;
+		case 3:
+			entry = FindVEXTableEntry(vex0F3AMap, sizeof(vex0F3AMap) / sizeof(VEXTableEntry), Read8(state),
+				state->vexW);
+			break;
+		default:
+			entry = NULL;
+			break;
+		}
+		if (!entry)
+		{
+			state->result->operation = INVALID;
+			return;
+		}
+
+		DecodeVEXOperands(state, GetVEXOperationEntry(state, entry, vex & 3));
 	}
 
 
-	static void DecodeFpu(DecodeState* state)
+	static void DecodeEVEX(DecodeState* state)
 	{
-		uint8_t modRM = Peek8(state);
-		uint8_t reg = (modRM >> 3) & 7;
-		uint8_t op = (uint8_t)state->result->operation;
+		InstructionOperand* operands = state->result->operands;
+		const VEXTableEntry* entry;
+		const VEXTableOperationEntry* opEntry;
+		uint8_t evex0, evex1, evex2, mod, elementSize, i;
 
-		const InstructionEncoding* map;
-		if ((modRM & 0xc0) == 0xc0)
-			map = fpuRegOpcodeMap[op];
-		else
-			map = fpuMemOpcodeMap[op];
-		ProcessEncoding(state, &map[reg]);
-	}
+		if ((!state->using64) && ((Peek8(state) & 0xc0) != 0xc0))
+		{
+			// Outside of 64-bit mode this is only an EVEX prefix if the next byte would have been a register
+			// operand, which is not valid for BOUND
+			DecodeRegRM(state);
+			return;
+		}
 
+		// EVEX cannot be combined with operand size, repeat, lock, or REX prefixes
+		if (state->opPrefix || (state->rep != REP_PREFIX_NONE) || state->rex || (state->result->flags & X86_FLAG_LOCK))
+		{
+			state->invalid = true;
+			return;
+		}
 
-	static void DecodeNoOperands(DecodeState* state)
-	{
-	}
+		evex0 = Read8(state);
+		evex1 = Read8(state);
+		evex2 = Read8(state);
+		if ((evex0 & 0x0c) || ((evex1 & 4) == 0))
+		{
+			// Reserved bits
+			state->invalid = true;
+			return;
+		}
 
+		// The register extension bits are stored inverted.  R' and X extend register operands to the upper
+		// 16 vector registers, and V' does the same for vvvv and the vector index of a VSIB operand.
+		if (state->using64)
+		{
+			state->rexReg = (evex0 & 0x80) == 0;
+			state->rexRM2 = (evex0 & 0x40) == 0;
+			state->rexRM1 = (evex0 & 0x20) == 0;
+			state->evexRegHigh = (evex0 & 0x10) ? 0 : 16;
+			state->evexRMHigh = (evex0 & 0x40) ? 0 : 16;
+			state->vexReg = (((evex1 >> 3) ^ 15) & 15) | ((evex2 & 8) ? 0 : 16);
+		}
+		else
+		{
+			state->evexRegHigh = 0;
+			state->evexRMHigh = 0;
+			state->vexReg = ((evex1 >> 3) ^ 15) & 7;
+		}
+		state->vexW = (evex1 & 0x80) != 0;
+		state->vexL = (evex2 >> 5) & 3;
+		state->evex = true;
+		if (state->using64 && state->vexW)
+			state->opSize = 8;
 
-	static void DecodeRegRM(DecodeState* state)
-	{
-		uint16_t size = state->finalOpSize;
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		switch (state->flags & DEC_FLAG_REG_RM_SIZE_MASK)
+		switch (evex0 & 3)
 		{
-		case 0:
+		case 1:
+			entry = FindVEXTableEntry(evex0FMap, sizeof(evex0FMap) / sizeof(VEXTableEntry), Read8(state), state->vexW);
 			break;
-		case DEC_FLAG_REG_RM_2X_SIZE:
-			size *= 2;
+		case 2:
+			entry = FindVEXTableEntry(evex0F38Map, sizeof(evex0F38Map) / sizeof(VEXTableEntry), Read8(state),
+				state->vexW);
 			break;
-		case DEC_FLAG_REG_RM_FAR_SIZE:
-			size += 2;
+		case 3:
+			entry = FindVEXTableEntry(evex0F3AMap, sizeof(evex0F3AMap) / sizeof(VEXTableEntry), Read8(state),
+				state->vexW);
 			break;
-		case DEC_FLAG_REG_RM_NO_SIZE:
-			size = 0;
+		default:
+			entry = NULL;
 			break;
 		}
+		if (!entry)
+		{
+			state->result->operation = INVALID;
+			return;
+		}
 
-		DecodeRMReg(state, state->operand1, regList, size, state->operand0, regList, state->finalOpSize);
+		opEntry = GetVEXOperationEntry(state, entry, evex1 & 3);
+		mod = Peek8(state) >> 6;
+		if ((evex2 & 0x10) && (mod == 3))
+		{
+			// With register operands the b bit selects embedded rounding or suppression of all exceptions,
+			// and the L'L field holds the rounding mode with the vector length fixed at 512 bits
+			if (opEntry->encoding & EVEX_ROUNDING)
+				state->result->rounding = (RoundingMode)(ROUND_NEAREST + state->vexL);
+			else if ((opEntry->encoding & EVEX_SAE) == 0)
+			{
+				state->invalid = true;
+				return;
+			}
+			state->result->flags |= X86_FLAG_SAE;
+			state->vexL = 2;
+		}
+		else if ((state->vexL == 3) || ((evex2 & 0x10) && ((opEntry->encoding & EVEX_BROADCAST) == 0)))
+		{
+			// A vector length of 3 is reserved, memory operands keep it even when broadcasting
+			state->invalid = true;
+			return;
+		}
 
-		if ((size != state->finalOpSize) && (state->operand1->operand != MEM))
+		DecodeVEXOperands(state, opEntry);
+		if (state->invalid)
+			return;
+
+		if (evex2 & 7)
+			state->result->mask = (OperandType)kRegList[evex2 & 7];
+		else if (((opEntry->encoding & VEX_ENCODING_MASK) == VEX_GATHER) ||
+			((opEntry->encoding & VEX_ENCODING_MASK) == VEX_SCATTER))
+		{
+			// Gathers and scatters require a mask, it tracks the elements that have completed
 			state->invalid = true;
-	}
+			return;
+		}
+		if (evex2 & 0x80)
+		{
+			// Zeroing masking is only defined when writing a vector register
+			if ((operands[0].operand == MEM) || ((operands[0].operand >= REG_K0) && (operands[0].operand <= REG_K7)) ||
+				((opEntry->encoding & VEX_ENCODING_MASK) == VEX_GATHER))
+			{
+				state->invalid = true;
+				return;
+			}
+			state->result->flags |= X86_FLAG_ZEROING;
+		}
 
+		for (i = 0; i < 4; i++)
+		{
+			if (operands[i].operand != MEM)
+				continue;
 
-	static void DecodeRegRMImm(DecodeState* state)
-	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		DecodeRMReg(state, state->operand1, regList, state->finalOpSize, state->operand0, regList, state->finalOpSize);
-		SetOperandToImm(state, &state->result->operands[2]);
+			elementSize = state->vexW ? 8 : 4;
+			if (evex2 & 0x10)
+			{
+				// Embedded broadcast of a single element across the vector
+				state->result->broadcast = (uint8_t)(operands[i].size / elementSize);
+				operands[i].size = elementSize;
+			}
+
+			// Compressed displacement, an 8-bit displacement is scaled by the size of the memory access (a
+			// single element for compress and expand, which access a variable number of elements)
+			if (mod == 1)
+				operands[i].immediate *= (opEntry->encoding & EVEX_ELEMENT_DISP8) ? elementSize : operands[i].size;
+			break;
+		}
 	}
 
 
-	static void DecodeRMRegImm8(DecodeState* state)
+	static void ProcessPrefixes(DecodeState* state)
 	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		DecodeRMReg(state, state->operand0, regList, state->finalOpSize, state->operand1, regList, state->finalOpSize);
-		SetOperandToImm8(state, &state->result->operands[2]);
-	}
+		uint8_t rex = 0;
+		bool addrPrefix = false;
+		PROFILE_BEGIN(state, &profileCounters[PROFILE_PROCESS_PREFIXES]);
+
+		while (!state->invalid)
+		{
+			uint8_t prefix = Read8(state);
+			if ((prefix >= 0x26) && (prefix <= 0x3e) && ((prefix & 7) == 6))
+			{
+				// Segment prefix
+				state->result->segment = (SegmentRegister)(SEG_ES + ((prefix >> 3) - 4));
+			}
+			else if ((prefix == 0x64) || (prefix == 0x65))
+			{
+				// FS/GS prefix
+				state->result->segment = (SegmentRegister)(SEG_ES + (prefix - 0x60));
+			}
+			else if (prefix == 0x66)
+			{
+				state->opPrefix = true;
+				state->result->flags |= X86_FLAG_OPSIZE;
+			}
+			else if (prefix == 0x67)
+			{
+				addrPrefix = true;
+				state->result->flags |= X86_FLAG_ADDRSIZE;
+			}
+			else if (prefix == 0xf0)
+				state->result->flags |= X86_FLAG_LOCK;
+			else if (prefix == 0xf2)
+				state->rep = REP_PREFIX_REPNE;
+			else if (prefix == 0xf3)
+				state->rep = REP_PREFIX_REPE;
+			else if (state->using64 && (prefix >= 0x40) && (prefix <= 0x4f))
+			{
+				// REX prefix
+				rex = prefix;
+				continue;
+			}
+			else
+			{
+				// Not a prefix, continue instruction processing
+				state->opcode--;
+				state->len++;
+				break;
+			}
 
+			// Force ignore REX unless it is the last prefix
+			rex = 0;
+		}
 
-	static void DecodeRMRegCL(DecodeState* state)
-	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		DecodeRMReg(state, state->operand0, regList, state->finalOpSize, state->operand1, regList, state->finalOpSize);
-		state->result->operands[2].operand = REG_CL;
-		state->result->operands[2].size = 1;
+		if (state->opPrefix)
+			state->opSize = (state->opSize == 2) ? 4 : 2;
+		if (addrPrefix)
+			state->addrSize = (state->addrSize == 4) ? 2 : 4;
+
+		if (rex)
+		{
+			// REX prefix found before opcode
+			state->rex = true;
+			state->rexRM1 = (rex & 1) != 0;
+			state->rexRM2 = (rex & 2) != 0;
+			state->rexReg = (rex & 4) != 0;
+			if (rex & 8)
+				state->opSize = 8;
+		}
+		PROFILE_END(state);
 	}
 
 
-	static void DecodeEaxImm(DecodeState* state)
+	static void ClearOperand(InstructionOperand* oper)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		SetOperandToImm(state, state->operand1);
+		oper->operand = NONE;
+		oper->components[0] = NONE;
+		oper->components[1] = NONE;
+		oper->scale = 1;
+		oper->immediate = 0;
+		oper->relative = false;
 	}
 
 
-	static void DecodePushPopSeg(DecodeState* state)
+	static void InitDisassemble(DecodeState* state)
 	{
-		int8_t offset = 0;
-		if (state->opcode[-1] >= 0xa0) // FS/GS
-			offset = -16;
-		state->operand0->operand = (OperandType)(REG_ES + (state->opcode[-1] >> 3) + offset);
-		state->operand0->size = state->opSize;
+		ClearOperand(&state->result->operands[0]);
+		ClearOperand(&state->result->operands[1]);
+		ClearOperand(&state->result->operands[2]);
+		ClearOperand(&state->result->operands[3]);
+		state->result->operation = INVALID;
+		state->result->flags = 0;
+		state->result->segment = SEG_DEFAULT;
+		state->result->mask = NONE;
+		state->result->rounding = ROUND_DEFAULT;
+		state->result->broadcast = 0;
+		state->result->mode = (uint8_t)(state->addrSize * 8);
+		state->result->ripRelOffset = 0;
+		state->invalid = false;
+		state->insufficientLength = false;
+		state->opPrefix = false;
+		state->rep = REP_PREFIX_NONE;
+		state->ripRelFixup = NULL;
+		state->rex = false;
+		state->rexReg = false;
+		state->rexRM1 = false;
+		state->rexRM2 = false;
+		state->origLen = state->len;
 	}
 
 
-	static void DecodeOpReg(DecodeState* state)
+	static uint16_t GetDispatchSizeIndex(uint16_t size)
 	{
-		SetOperandToOpReg(state, state->operand0);
+		return ((size >> 1) - (size >> 3)) & 3; // 1, 2, 4, 8 to 0, 1, 2, 3
 	}
 
 
-	static void DecodeEaxOpReg(DecodeState* state)
+	static uint16_t LookupDispatchId(InstructionOperation operation, uint8_t shape, uint16_t size)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		SetOperandToOpReg(state, state->operand1);
+		const DispatchEntry* entry = &dispatchTable[operation];
+		uint16_t index = dispatchShapeIndex[entry->shapes + (shape & 0x7f)];
+		switch (entry->sized)
+		{
+		case 1:
+			return entry->base + (index << 2) + GetDispatchSizeIndex(size & 0xff);
+		case 2:
+			return entry->base + (index << 4) + (GetDispatchSizeIndex(size & 0xff) << 2) +
+				GetDispatchSizeIndex(size >> 8);
+		default:
+			return entry->base + index;
+		}
 	}
 
 
-	static void DecodeOpRegImm(DecodeState* state)
+	static bool IsVectorRegister(OperandType reg)
 	{
-		SetOperandToOpReg(state, state->operand0);
-		state->operand1->operand = IMM;
-		state->operand1->size = state->finalOpSize;
-		state->operand1->immediate = (state->opSize == 8) ? Read64(state) : ReadFinalOpSize(state);
+		return (reg >= REG_XMM0) && (reg <= REG_ZMM31);
 	}
 
 
-	static void DecodeNop(DecodeState* state)
+#ifndef X86_NO_DISPATCH_ID
+	static uint8_t GetOperandKind(OperandType operand)
 	{
-		if (state->rexRM1)
-		{
-			state->result->operation = XCHG;
-			DecodeEaxOpReg(state);
-		}
+		// NONE, IMM and MEM have the values of their operand kinds
+		return (operand > MEM) ? X86_OPERAND_KIND_REG : (uint8_t)operand;
 	}
 
 
-	static void DecodeImm(DecodeState* state)
+	static uint16_t GetInstructionDispatchId(const Instruction* instr)
 	{
-		SetOperandToImm(state, state->operand0);
+		uint8_t shape = X86_DISPATCH_SHAPE(GetOperandKind(instr->operands[0].operand),
+			GetOperandKind(instr->operands[1].operand), GetOperandKind(instr->operands[2].operand));
+		if (IsVectorRegister(instr->operands[0].operand) || IsVectorRegister(instr->operands[1].operand))
+			shape |= X86_DISPATCH_VECTOR;
+		return LookupDispatchId(instr->operation, shape,
+			X86_DISPATCH_SIZES(instr->operands[0].size, instr->operands[1].size));
 	}
+#endif
 
 
-	static void DecodeImm16Imm8(DecodeState* state)
+	static void FinishDisassemble(DecodeState* state)
 	{
-		SetOperandToImm16(state, state->operand0);
-		SetOperandToImm8(state, state->operand1);
+		state->result->length = state->opcode - state->opcodeStart;
+		if (state->ripRelFixup)
+			*state->ripRelFixup += state->addr + state->result->length;
+		if (state->insufficientLength && (state->origLen < 15))
+			state->result->flags |= X86_FLAG_INSUFFICIENT_LENGTH;
+#ifdef X86_NO_DISPATCH_ID
+		state->result->dispatchId = 0;
+#else
+		state->result->dispatchId = state->invalid ? 0 : GetInstructionDispatchId(state->result);
+#endif
 	}
 
 
-	static void DecodeEdiDx(DecodeState* state)
+	bool Disassemble16(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
 	{
-		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
-		state->operand1->operand = REG_DX;
-		state->operand1->size = 2;
+		DecodeState state;
+		state.result = result;
+		state.opcodeStart = opcode;
+		state.opcode = opcode;
+		state.addr = addr;
+		state.len = (maxLen > 15) ? 15 : maxLen;
+		state.addrSize = 2;
+		state.opSize = 2;
+		state.using64 = false;
+		InitDisassemble(&state);
+
+		ProcessPrefixes(&state);
+		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
+		FinishDisassemble(&state);
+		return !state.invalid;
 	}
 
 
-	static void DecodeDxEsi(DecodeState* state)
+	bool Disassemble32(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
 	{
-		state->operand0->operand = REG_DX;
-		state->operand0->size = 2;
-		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+		DecodeState state;
+		state.result = result;
+		state.opcodeStart = opcode;
+		state.opcode = opcode;
+		state.addr = addr;
+		state.len = (maxLen > 15) ? 15 : maxLen;
+		state.addrSize = 4;
+		state.opSize = 4;
+		state.using64 = false;
+		InitDisassemble(&state);
+
+		ProcessPrefixes(&state);
+		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
+		FinishDisassemble(&state);
+		return !state.invalid;
 	}
 
 
-	static void DecodeRelImm(DecodeState* state)
+	bool Disassemble64(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
 	{
-		state->operand0->operand = IMM;
-		state->operand0->size = state->opSize;
-		state->operand0->immediate = ReadSignedFinalOpSize(state);
-		state->operand0->immediate += state->addr + (state->opcode - state->opcodeStart);
+		DecodeState state;
+		state.result = result;
+		state.opcodeStart = opcode;
+		state.opcode = opcode;
+		state.addr = addr;
+		state.len = (maxLen > 15) ? 15 : maxLen;
+		state.addrSize = 8;
+		state.opSize = 4;
+		state.using64 = true;
+		InitDisassemble(&state);
+
+		ProcessPrefixes(&state);
+		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
+		FinishDisassemble(&state);
+		return !state.invalid;
 	}
 
 
-	static void DecodeRelImmAddrSize(DecodeState* state)
+	// Longest text of a single format field, not counting padding.  The operands are the longest, with four
+	// memory operands of up to 50 characters each, plus separators, a mask, zeroing and rounding.
+#define FORMAT_MAX_FIELD_LENGTH 256
+
+	// Names are copied with their maximum length and hex numbers are stored 16 digits at a time, and the
+	// output then advances by their actual length, so a field can write this far past its end
+#define FORMAT_FIELD_SLACK STRING_MAX_LENGTH
+
+	// Longest text of the other fields, the address is at most 16 digits, the bytes are at most 15 bytes in
+	// hex, and the mnemonic can have REPNE and LOCK prefixes
+#define FORMAT_MAX_ADDRESS_LENGTH 16
+#define FORMAT_MAX_BYTES_LENGTH 30
+#define FORMAT_MAX_OPERATION_LENGTH (11 + STRING_MAX_LENGTH)
+
+	// Formatters for compiled format strings
+#define FORMAT_TEMPLATE_GENERIC 0
+#define FORMAT_TEMPLATE_OPERATION_OPERANDS 1 // "%i %o"
+
+#if !defined(FORMAT_SIMD_HEX) || defined(FORMAT_SIMD_SHUFFLE)
+	static const char hexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+#endif
+
+
+	// The field writers below don't check the size of the output buffer.  FormatInstructionString only
+	// calls them when there is room for the longest possible field, and otherwise formats into a temporary
+	// buffer and copies as much as fits.
+	static __inline char* WriteText(char* out, const char* str, size_t len)
 	{
-		DecodeRelImm(state);
-		UpdateOperationForAddrSize(state);
+		size_t i;
+		for (i = 0; i < len; i++)
+			out[i] = str[i];
+		return out + len;
 	}
 
 
-	static void DecodeGroupRM(DecodeState* state)
+	static __inline char* WriteOperationName(char* out, InstructionOperation operation)
 	{
-		const RegDef* regList = GetRegListForFinalOpSize(state);
-		uint8_t regField;
-		DecodeRM(state, state->operand0, regList, state->finalOpSize, &regField);
-		state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation][regField];
+		WriteText(out, &stringBlob[operationStringOffset[operation]], STRING_MAX_LENGTH);
+		return out + operationStringLength[operation];
 	}
 
 
-	static void DecodeGroupRMImm(DecodeState* state)
+	static __inline char* WriteOperandName(char* out, OperandType type)
 	{
-		DecodeGroupRM(state);
-		SetOperandToImm(state, state->operand1);
+		WriteText(out, &stringBlob[operandStringOffset[type]], STRING_MAX_LENGTH);
+		return out + operandStringLength[type];
 	}
 
 
-	static void DecodeGroupRMImm8V(DecodeState* state)
+#ifdef FORMAT_SIMD_HEX
+	// Converts the bytes in the low half of a vector to 16 hex digits, high nibble first
+	static __inline __m128i ExpandHex(__m128i bytes)
 	{
-		DecodeGroupRM(state);
-		SetOperandToImm8(state, state->operand1);
+		__m128i mask = _mm_set1_epi8(0xf);
+		__m128i nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask),
+			_mm_and_si128(bytes, mask));
+#ifdef FORMAT_SIMD_SHUFFLE
+		return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)hexDigits), nibbles);
+#else
+		__m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+		return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+#endif
 	}
 
 
-	static void DecodeGroupRMOne(DecodeState* state)
+	// Writes 16 digits and advances by width, the value is shifted so that its low digits come first
+	static char* WriteHex(char* out, uint64_t val, uint32_t width, bool prefix)
 	{
-		DecodeGroupRM(state);
-		state->operand1->operand = IMM;
-		state->operand1->size = 1;
-		state->operand1->immediate = 1;
+		__m128i bytes;
+		if (prefix)
+		{
+			*(out++) = '0';
+			*(out++) = 'x';
+		}
+		if (width == 0)
+			return out;
+		if (width > 16)
+			width = 16;
+		val <<= (16 - width) * 4;
+		bytes = _mm_loadl_epi64((const __m128i*)&val);
+#ifdef FORMAT_SIMD_SHUFFLE
+		bytes = _mm_shuffle_epi8(bytes, _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 6, 7));
+#else
+		bytes = _mm_shufflelo_epi16(bytes, _MM_SHUFFLE(0, 1, 2, 3));
+		bytes = _mm_or_si128(_mm_slli_epi16(bytes, 8), _mm_srli_epi16(bytes, 8));
+#endif
+		_mm_storeu_si128((__m128i*)out, ExpandHex(bytes));
+		return out + width;
 	}
 
 
-	static void DecodeGroupRMCl(DecodeState* state)
+	// Writes the bytes 8 at a time, 16 digits per store
+	static char* WriteHexBytes(char* out, const uint8_t* data, size_t len)
 	{
-		DecodeGroupRM(state);
-		state->operand1->operand = REG_CL;
-		state->operand1->size = 1;
+		uint8_t buf[16];
+		size_t i;
+		for (i = 0; i < len; i++)
+			buf[i] = data[i];
+		for (; i < 16; i++)
+			buf[i] = 0;
+		_mm_storeu_si128((__m128i*)out, ExpandHex(_mm_loadl_epi64((const __m128i*)buf)));
+		if (len > 8)
+			_mm_storeu_si128((__m128i*)(out + 16), ExpandHex(_mm_loadl_epi64((const __m128i*)&buf[8])));
+		return out + (len * 2);
+	}
+#else
+	static char* WriteHex(char* out, uint64_t val, uint32_t width, bool prefix)
+	{
+		int32_t i;
+		if (prefix)
+		{
+			*(out++) = '0';
+			*(out++) = 'x';
+		}
+		if (width > 16)
+			width = 16;
+		for (i = (width - 1); i >= 0; i--, val >>= 4)
+			out[i] = hexDigits[val & 0xf];
+		return out + width;
 	}
 
 
-	static void DecodeGroupF6F7(DecodeState* state)
+	static char* WriteHexBytes(char* out, const uint8_t* data, size_t len)
 	{
-		DecodeGroupRM(state);
-		if (state->result->operation == TEST)
-			SetOperandToImm(state, state->operand1);
-		// Check for valid locking semantics
-		if ((state->result->flags & X86_FLAG_LOCK) && (state->result->operation != NOT) && (state->result->operation != NEG))
-			state->invalid = true;
+		size_t i;
+		for (i = 0; i < len; i++)
+		{
+			*(out++) = hexDigits[data[i] >> 4];
+			*(out++) = hexDigits[data[i] & 0xf];
+		}
+		return out;
 	}
+#endif
 
 
-	static void DecodeGroupFF(DecodeState* state)
+	static char* WriteSize(char* out, uint16_t size)
 	{
-		if (state->using64)
+		switch (size)
 		{
-			// Default to 64-bit for jumps and calls
-			uint8_t rm = Peek8(state);
-			uint8_t regField = (rm >> 3) & 7;
-			if ((regField >= 2) && (regField <= 5))
-				state->finalOpSize = state->opSize = state->opPrefix ? 4 : 8;
-			else if (regField == 6)
-				state->finalOpSize = state->opSize = 8; // Prefix doesn't matter for 64 bit push
+		case 1:
+			return WriteText(out, "byte ", 5);
+		case 2:
+			return WriteText(out, "word ", 5);
+		case 4:
+			return WriteText(out, "dword ", 6);
+		case 6:
+			return WriteText(out, "fword ", 6);
+		case 8:
+			return WriteText(out, "qword ", 6);
+		case 10:
+			return WriteText(out, "tword ", 6);
+		case 16:
+			return WriteText(out, "oword ", 6);
+		case 32:
+			return WriteText(out, "yword ", 6);
+		case 64:
+			return WriteText(out, "zword ", 6);
+		default:
+			return out;
 		}
-		DecodeGroupRM(state);
-		// Check for valid far jump/call semantics
-		if ((state->result->operation == CALLF) || (state->result->operation == JMPF))
+	}
+
+
+	static char* WriteOperand(char* out, OperandType type, uint8_t scale, bool plus)
+	{
+		if (plus)
+			*(out++) = '+';
+		out = WriteOperandName(out, type);
+		if (scale != 1)
 		{
-			if (state->operand0->operand != MEM)
-				state->invalid = true;
-			state->operand0->size += 2;
+			*(out++) = '*';
+			*(out++) = (char)(scale + '0');
 		}
-		// Check for valid locking semantics
-		if ((state->result->flags & X86_FLAG_LOCK) && (state->result->operation != INC) && (state->result->operation != DEC))
-			state->invalid = true;
+		return out;
 	}
 
 
-	static void DecodeGroup0F00(DecodeState* state)
+	static char* WriteRounding(char* out, const Instruction* instr)
 	{
-		uint8_t rm = Peek8(state);
-		uint8_t regField = (rm >> 3) & 7;
-		if (regField >= 2)
-			state->opSize = 2;
-		DecodeGroupRM(state);
+		static const char roundingString[5][9] = {"{sae}", "{rn-sae}", "{rd-sae}", "{ru-sae}", "{rz-sae}"};
+		static const uint8_t roundingStringLength[5] = {5, 8, 8, 8, 8};
+		*(out++) = ',';
+		*(out++) = ' ';
+		return WriteText(out, roundingString[instr->rounding], roundingStringLength[instr->rounding]);
 	}
 
 
-	static void DecodeGroup0F01(DecodeState* state)
+	static const SymbolCacheEntry* LookupSymbol(Symbolizer* sym, uint64_t addr)
 	{
-		uint8_t rm = Peek8(state);
-		uint8_t modField = (rm >> 6) & 3;
-		uint8_t regField = (rm >> 3) & 7;
-		uint8_t rmField = rm & 7;
+		SymbolCacheEntry* entry = &sym->cache[(size_t)((addr * 0x9e3779b97f4a7c15ULL) >> 32) &
+			(X86_SYMBOL_CACHE_SIZE - 1)];
+		size_t len;
 
-		if ((modField == 3) && (regField != 4) && (regField != 6))
+		if (entry->valid && (entry->addr == addr))
+			return entry;
+
+		entry->addr = addr;
+		entry->offset = 0;
+		entry->name = sym->resolve(addr, &entry->offset, sym->ctx);
+		entry->valid = true;
+		len = 0;
+		if (entry->name)
 		{
-			state->result->operation = (InstructionOperation)group0F01RegOperations[regField][rmField];
-			Read8(state);
-			return;
+			while ((len < X86_SYMBOL_MAX_LENGTH) && entry->name[len])
+				len++;
 		}
-
-		if (regField < 4)
-			state->opSize = state->using64 ? 10 : 6;
-		else if (regField != 7)
-			state->opSize = 2;
-		else
-			state->opSize = 1;
-		DecodeGroupRM(state);
+		entry->nameLength = (uint8_t)len;
+		return entry;
 	}
 
 
-	static void DecodeGroup0FAE(DecodeState* state)
+	// Writes an address as a symbol and offset, or in hex if it has no symbol.  Names are cut off at
+	// X86_SYMBOL_MAX_LENGTH characters so that the operands still fit in FORMAT_MAX_FIELD_LENGTH, as an
+	// instruction has at most one branch target or RIP-relative operand.
+	static char* WriteSymbol(char* out, Symbolizer* sym, uint64_t addr, uint32_t width)
 	{
-		uint8_t rm = Peek8(state);
-		uint8_t modField = (rm >> 6) & 3;
-		uint8_t regField = (rm >> 3) & 7;
+		const SymbolCacheEntry* entry = LookupSymbol(sym, addr);
+		uint64_t offset = entry->offset;
+		uint32_t digits = 1;
 
-		if (((rm & 0xf8) == 0xe8) || ((rm & 0xf8) == 0xf8) || ((rm & 0xf8) == 0xf0))
+		if (!entry->name)
+			return WriteHex(out, addr, width, true);
+		out = WriteText(out, entry->name, entry->nameLength);
+		if (offset != 0)
 		{
-			state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation + 1][regField];
-			Read8(state);
-			return;
+			while ((digits < 16) && (offset >> (digits * 4)))
+				digits++;
+			*(out++) = '+';
+			out = WriteHex(out, offset, digits, true);
 		}
+		return out;
+	}
 
-		if (modField == 3)
+
+	static char* WriteMemoryOperand(char* out, const Instruction* instr, const InstructionOperand* operand,
+		Symbolizer* sym)
+	{
+		bool plus = false;
+		int64_t disp = operand->immediate;
+
+		out = WriteSize(out, operand->size);
+		if ((instr->segment != SEG_DEFAULT) || (operand->segment == SEG_ES))
 		{
-			state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation + 1][regField];
-			return;
+			out = WriteOperand(out, (OperandType)(operand->segment + REG_ES), 1, false);
+			*(out++) = ':';
 		}
-
-		if ((regField & 2) == 0)
-			state->opSize = 512;
-		else if ((regField & 6) == 2)
-			state->opSize = 4;
-		else
-			state->opSize = 1;
-		DecodeGroupRM(state);
+		*(out++) = '[';
+		if (operand->components[0] != NONE)
+		{
+			out = WriteOperand(out, operand->components[0], 1, false);
+			plus = true;
+		}
+		if (operand->components[1] != NONE)
+		{
+			out = WriteOperand(out, operand->components[1], operand->scale, plus);
+			plus = true;
+		}
+		if (sym && operand->relative)
+			out = WriteSymbol(out, sym, (uint64_t)disp, 8);
+		else if ((disp != 0) || ((operand->components[0] == NONE) && (operand->components[1] == NONE)))
+		{
+			if (plus && (disp >= -0x80) && (disp < 0))
+			{
+				*(out++) = '-';
+				out = WriteHex(out, (uint64_t)-disp, 2, true);
+			}
+			else if (plus && (disp > 0) && (disp <= 0x7f))
+			{
+				*(out++) = '+';
+				out = WriteHex(out, (uint64_t)disp, 2, true);
+			}
+			else if (!plus && (instr->mode == 64))
+			{
+				// Absolute addresses, such as the moffs operand of MOV, are 64 bits in 64-bit mode
+				out = WriteHex(out, (uint64_t)disp, 16, true);
+			}
+			else
+			{
+				if (plus)
+					*(out++) = '+';
+				out = WriteHex(out, (uint64_t)disp, 8, true);
+			}
+		}
+		*(out++) = ']';
+		if (instr->broadcast)
+		{
+			out = WriteText(out, "{1to", 4);
+			if (instr->broadcast >= 10)
+				*(out++) = (char)('0' + (instr->broadcast / 10));
+			*(out++) = (char)('0' + (instr->broadcast % 10));
+			*(out++) = '}';
+		}
+		return out;
 	}
 
 
-	static void Decode0FB8(DecodeState* state)
+	static char* WriteOperation(char* out, const Instruction* instr)
 	{
-		if (state->rep != REP_PREFIX_REPE)
+		if (instr->flags & X86_FLAG_ANY_REP)
 		{
-			if (state->using64)
-				state->opSize = state->opPrefix ? 4 : 8;
-			state->finalOpSize = GetFinalOpSize(state);
-			DecodeRelImm(state);
-			return;
+			out = WriteText(out, "rep", 3);
+			if (instr->flags & X86_FLAG_REPNE)
+				*(out++) = 'n';
+			if (instr->flags & (X86_FLAG_REPNE | X86_FLAG_REPE))
+				*(out++) = 'e';
+			*(out++) = ' ';
 		}
-
-		DecodeRegRM(state);
+		if (instr->flags & X86_FLAG_LOCK)
+			out = WriteText(out, "lock ", 5);
+		return WriteOperationName(out, instr->operation);
 	}
 
 
-	static void DecodeRMSRegV(DecodeState* state)
+	static char* WriteOperands(char* out, const Instruction* instr, Symbolizer* sym)
 	{
-		const RegDef* regList = GetRegListForOpSize(state);
-		uint8_t regField;
-		DecodeRM(state, state->operand0, regList, state->opSize, &regField);
-		if (regField >= 6)
-			state->invalid = true;
-		state->operand1->operand = (OperandType)(REG_ES + regField);
-		state->operand1->size = 2;
-		if (state->result->operands[0].operand == REG_CS)
-			state->invalid = true;
+		uint32_t i;
+		bool sae = (instr->flags & X86_FLAG_SAE) != 0;
+		for (i = 0; i < 4; i++)
+		{
+			if (instr->operands[i].operand == NONE)
+				break;
+			if (sae && (instr->operands[i].operand == IMM))
+			{
+				// Rounding and exception suppression are written before any immediate operand
+				out = WriteRounding(out, instr);
+				sae = false;
+			}
+			if (i != 0)
+			{
+				*(out++) = ',';
+				*(out++) = ' ';
+			}
+			if ((instr->operands[i].operand == IMM) && sym && instr->operands[i].relative)
+				out = WriteSymbol(out, sym, instr->operands[i].immediate, instr->operands[i].size * 2);
+			else if (instr->operands[i].operand == IMM)
+				out = WriteHex(out, instr->operands[i].immediate, instr->operands[i].size * 2, true);
+			else if (instr->operands[i].operand == MEM)
+				out = WriteMemoryOperand(out, instr, &instr->operands[i], sym);
+			else
+				out = WriteOperand(out, instr->operands[i].operand, 1, false);
+			if ((i == 0) && (instr->mask != NONE))
+			{
+				*(out++) = '{';
+				out = WriteOperandName(out, instr->mask);
+				*(out++) = '}';
+			}
+			if ((i == 0) && (instr->flags & X86_FLAG_ZEROING))
+				out = WriteText(out, "{z}", 3);
+		}
+		if (sae)
+			out = WriteRounding(out, instr);
+		return out;
 	}
 
 
-	static void DecodeRM8(DecodeState* state)
+	// Copies text to the output buffer, truncating it to leave room for the terminator
+	static char* WriteChecked(char* out, size_t* outMaxLen, const char* str, size_t len)
 	{
-		const RegDef* regList = GetByteRegList(state);
-		DecodeRM(state, state->operand0, regList, 1, NULL);
+		if (*outMaxLen <= len)
+			len = (*outMaxLen > 0) ? (*outMaxLen - 1) : 0;
+		*outMaxLen -= len;
+		return WriteText(out, str, len);
 	}
 
 
-	static void DecodeRMV(DecodeState* state)
+	static char* WritePadding(char* out, size_t* outMaxLen, size_t len)
 	{
-		const RegDef* regList = GetRegListForOpSize(state);
-		DecodeRM(state, state->operand0, regList, state->opSize, NULL);
+		size_t i;
+		if (*outMaxLen <= len)
+			len = (*outMaxLen > 0) ? (*outMaxLen - 1) : 0;
+		*outMaxLen -= len;
+		for (i = 0; i < len; i++)
+			out[i] = ' ';
+		return out + len;
 	}
 
 
-	static void DecodeFarImm(DecodeState* state)
+	// Writes a field without padding, returns the end of the text
+	static __inline char* WriteField(char* out, char field, uint32_t width, const uint8_t* opcode, uint64_t addr,
+		const Instruction* instr, Symbolizer* sym)
 	{
-		SetOperandToImm(state, state->operand1);
-		SetOperandToImm16(state, state->operand0);
+		switch (field)
+		{
+		case 'a':
+			return WriteHex(out, addr, (width == 0) ? (sizeof(void*) * 2) : width, false);
+		case 'b':
+			return WriteHexBytes(out, opcode, instr->length);
+		case 'i':
+			return WriteOperation(out, instr);
+		default:
+			return WriteOperands(out, instr, sym);
+		}
 	}
 
 
-	static void DecodeEaxAddr(DecodeState* state)
+	static __inline size_t GetFieldPadding(char field, uint32_t width, size_t len, const Instruction* instr)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		SetOperandToImmAddr(state, state->operand1);
+		if ((field == 'b') && (instr->length < width))
+			return (width - instr->length) * 2;
+		if ((field == 'i') && (len < width))
+			return width - len;
+		return 0;
 	}
 
 
-	static void DecodeEdiEsi(DecodeState* state)
+	// Writes a field and its padding, checking the size of the output buffer.  Only fields that may not fit
+	// take the slow path through the temporary buffer.
+	static __inline char* WriteFieldChecked(char* out, size_t* outMaxLen, char field, uint32_t width,
+		const uint8_t* opcode, uint64_t addr, const Instruction* instr, Symbolizer* sym)
 	{
-		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
-		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+		char temp[FORMAT_MAX_FIELD_LENGTH + FORMAT_FIELD_SLACK];
+		size_t len;
+
+		if (*outMaxLen > (FORMAT_MAX_FIELD_LENGTH + FORMAT_FIELD_SLACK))
+		{
+			len = (size_t)(WriteField(out, field, width, opcode, addr, instr, sym) - out);
+			out += len;
+			*outMaxLen -= len;
+		}
+		else
+		{
+			len = (size_t)(WriteField(temp, field, width, opcode, addr, instr, sym) - temp);
+			out = WriteChecked(out, outMaxLen, temp, len);
+		}
+		return WritePadding(out, outMaxLen, GetFieldPadding(field, width, len, instr));
 	}
 
 
-	static void DecodeEdiEax(DecodeState* state)
+	static size_t FormatInstruction(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, const Instruction* instr, Symbolizer* sym)
 	{
-		SetOperandToEsEdi(state, state->operand0, state->finalOpSize);
-		SetOperandToEaxFinalOpSize(state, state->operand1);
+		char* start = out;
+		const char* text;
+		uint32_t width;
+		size_t len;
+
+		while (*fmt)
+		{
+			if (*fmt != '%')
+			{
+				// Copy literal text up to the next field in one step
+				for (text = fmt; (*fmt) && (*fmt != '%'); fmt++)
+					;
+				out = WriteChecked(out, &outMaxLen, text, (size_t)(fmt - text));
+				continue;
+			}
+
+			width = 0;
+			for (fmt++; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+				width = (width * 10) + (*fmt - '0');
+			if (!*fmt)
+				break;
+			if ((*fmt == 'a') || (*fmt == 'b') || (*fmt == 'i') || (*fmt == 'o'))
+				out = WriteFieldChecked(out, &outMaxLen, *fmt, width, opcode, addr, instr, sym);
+			else
+				out = WriteChecked(out, &outMaxLen, fmt, 1);
+			fmt++;
+		}
+
+		len = out - start;
+		if (outMaxLen > 0)
+			*(out++) = 0;
+		return len;
 	}
 
 
-	static void DecodeEaxEsi(DecodeState* state)
+	size_t FormatInstructionString(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, const Instruction* instr)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		SetOperandToDsEsi(state, state->operand1, state->finalOpSize);
+		return FormatInstruction(out, outMaxLen, fmt, opcode, addr, instr, NULL);
 	}
 
 
-	static void DecodeAlEbxAl(DecodeState* state)
+	void InitSymbolizer(Symbolizer* sym, SymbolResolver resolve, void* ctx)
 	{
-		const RegDef* regList = GetRegListForAddrSize(state);
-		state->operand0->operand = REG_AL;
-		state->operand0->size = 1;
-		state->operand1->operand = MEM;
-		state->operand1->components[0] = (OperandType)regList[3];
-		state->operand1->components[1] = REG_AL;
-		state->operand1->size = 1;
-		state->operand1->segment = GetFinalSegment(state, SEG_DS);
+		sym->resolve = resolve;
+		sym->ctx = ctx;
+		FlushSymbolizer(sym);
 	}
 
 
-	static void DecodeEaxImm8(DecodeState* state)
+	void FlushSymbolizer(Symbolizer* sym)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		SetOperandToImm8(state, state->operand1);
+		size_t i;
+		for (i = 0; i < X86_SYMBOL_CACHE_SIZE; i++)
+			sym->cache[i].valid = false;
 	}
 
 
-	static void DecodeEaxDx(DecodeState* state)
+	size_t FormatInstructionSymbolized(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, const Instruction* instr, Symbolizer* sym)
 	{
-		SetOperandToEaxFinalOpSize(state, state->operand0);
-		state->operand1->operand = REG_DX;
-		state->operand1->size = 2;
+		return FormatInstruction(out, outMaxLen, fmt, opcode, addr, instr, sym);
 	}
 
 
-	static void Decode3DNow(DecodeState* state)
+	static size_t GetFieldMaxLength(char field, uint32_t width)
 	{
-		uint8_t op;
-		int i, min, max;
-		DecodeRMReg(state, state->operand1, mmxRegList, 8, state->operand0, mmxRegList, 8);
-		op = Read8(state);
-		state->result->operation = INVALID;
-		for (min = 0, max = (int)(sizeof(sparse3DNowOpcodes) / sizeof(SparseOpEntry)) - 1, i = (min + max) / 2;
-			min <= max; i = (min + max) / 2)
+		switch (field)
 		{
-			if (op > sparse3DNowOpcodes[i].opcode)
-				min = i + 1;
-			else if (op < sparse3DNowOpcodes[i].opcode)
-				max = i - 1;
-			else
-			{
-				state->result->operation = (InstructionOperation)sparse3DNowOpcodes[i].operation;
-				break;
-			}
+		case 'a':
+			return FORMAT_MAX_ADDRESS_LENGTH;
+		case 'b':
+			return ((width * 2) > FORMAT_MAX_BYTES_LENGTH) ? (width * 2) : FORMAT_MAX_BYTES_LENGTH;
+		case 'i':
+			return (width > FORMAT_MAX_OPERATION_LENGTH) ? width : FORMAT_MAX_OPERATION_LENGTH;
+		default:
+			return FORMAT_MAX_FIELD_LENGTH;
 		}
 	}
 
 
-	static void DecodeSSETable(DecodeState* state)
+	bool CompileFormat(const char* fmt, FormatTemplate* tmpl)
 	{
-		uint8_t type = DecodeSSEPrefix(state);
-		uint8_t rm = Peek8(state);
-		uint8_t modField = (rm >> 6) & 3;
-
-		const SSETableEntry* entry = &sseTable[(int)state->result->operation];
-		const SSETableOperationEntry* opEntry;
-
-		if (modField == 3)
-			opEntry = &entry->regOps[type];
-		else
-			opEntry = &entry->memOps[type];
-
-		state->result->operation = (InstructionOperation)opEntry->operation;
-		DecodeRMReg(state, GetOperandForSSEEntryType(state, opEntry->rmType, 1), GetRegListForSSEEntryType(state, opEntry->rmType),
-			GetSizeForSSEEntryType(state, opEntry->rmType), GetOperandForSSEEntryType(state, opEntry->regType, 0),
-			GetRegListForSSEEntryType(state, opEntry->regType), GetSizeForSSEEntryType(state, opEntry->regType));
+		FormatField* field = NULL;
+		size_t textLen = 0;
+		uint32_t width;
+		char ch;
 
-		if (state->flags & DEC_FLAG_INC_OPERATION_FOR_64)
+		tmpl->maxLength = FORMAT_FIELD_SLACK;
+		tmpl->fieldCount = 0;
+		tmpl->kind = FORMAT_TEMPLATE_GENERIC;
+		tmpl->symbolizer = NULL;
+		while (*fmt)
 		{
-			UpdateOperationForSSEEntryType(state, opEntry->regType);
-			UpdateOperationForSSEEntryType(state, opEntry->rmType);
+			ch = *(fmt++);
+			if (ch == '%')
+			{
+				width = 0;
+				for (; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+				{
+					width = (width * 10) + (*fmt - '0');
+					if (width > 0xffff)
+						return false;
+				}
+				if (!*fmt)
+					break;
+				ch = *(fmt++);
+				if ((ch == 'a') || (ch == 'b') || (ch == 'i') || (ch == 'o'))
+				{
+					if (tmpl->fieldCount >= X86_FORMAT_MAX_FIELDS)
+						return false;
+					field = &tmpl->fields[tmpl->fieldCount++];
+					field->type = ch;
+					field->textOffset = 0;
+					field->textLength = 0;
+					field->width = width;
+					tmpl->maxLength += GetFieldMaxLength(ch, width);
+					continue;
+				}
+			}
+
+			// Literal text, appended to the previous field if it is also text
+			if (textLen >= X86_FORMAT_MAX_TEXT)
+				return false;
+			if ((!field) || (field->type != 0))
+			{
+				if (tmpl->fieldCount >= X86_FORMAT_MAX_FIELDS)
+					return false;
+				field = &tmpl->fields[tmpl->fieldCount++];
+				field->type = 0;
+				field->textOffset = (uint8_t)textLen;
+				field->textLength = 0;
+				field->width = 0;
+			}
+			tmpl->text[textLen++] = ch;
+			field->textLength++;
+			tmpl->maxLength++;
 		}
+
+		if ((tmpl->fieldCount == 3) && (tmpl->fields[0].type == 'i') && (tmpl->fields[0].width == 0) &&
+			(tmpl->fields[1].type == 0) && (tmpl->fields[1].textLength == 1) && (tmpl->text[0] == ' ') &&
+			(tmpl->fields[2].type == 'o'))
+			tmpl->kind = FORMAT_TEMPLATE_OPERATION_OPERANDS;
+		return true;
 	}
 
 
-	static void DecodeSSETableImm8(DecodeState* state)
+	// Formats an instruction with a compiled format without checking the size of the output buffer, which
+	// must have room for tmpl->maxLength characters.  Returns the end of the text, which is not terminated.
+	static __inline char* WriteTemplate(char* out, const FormatTemplate* tmpl, const uint8_t* opcode, uint64_t addr,
+		const Instruction* instr)
 	{
-		DecodeSSETable(state);
-		SetOperandToImm8(state, &state->result->operands[2]);
-	}
+		const FormatField* field = tmpl->fields;
+		const FormatField* end = &tmpl->fields[tmpl->fieldCount];
+		size_t room = tmpl->maxLength + 1;
+		char* fieldStart;
+		size_t len;
 
+		if (tmpl->kind == FORMAT_TEMPLATE_OPERATION_OPERANDS)
+		{
+			out = WriteOperation(out, instr);
+			*(out++) = ' ';
+			return WriteOperands(out, instr, tmpl->symbolizer);
+		}
 
-	static void DecodeSSETableMem8(DecodeState* state)
-	{
-		DecodeSSETable(state);
-		if (state->operand0->operand == MEM)
-			state->operand0->size = 1;
-		if (state->operand1->operand == MEM)
-			state->operand1->size = 1;
+		for (; field < end; field++)
+		{
+			if (field->type == 0)
+			{
+				out = WriteText(out, &tmpl->text[field->textOffset], field->textLength);
+				continue;
+			}
+			fieldStart = out;
+			out = WriteField(out, field->type, field->width, opcode, addr, instr, tmpl->symbolizer);
+			len = GetFieldPadding(field->type, field->width, (size_t)(out - fieldStart), instr);
+			out = WritePadding(out, &room, len);
+		}
+		return out;
 	}
 
 
-	static void DecodeSSE(DecodeState* state)
+	size_t FormatInstructionCompiled(char* out, size_t outMaxLen, const FormatTemplate* tmpl,
+		const uint8_t* opcode, uint64_t addr, const Instruction* instr)
 	{
-		uint8_t type = DecodeSSEPrefix(state);
-		uint8_t rm = Peek8(state);
-		uint8_t modField = (rm >> 6) & 3;
-		uint16_t size;
+		const FormatField* field = tmpl->fields;
+		const FormatField* end = &tmpl->fields[tmpl->fieldCount];
+		char* start = out;
+		size_t len;
 
-		state->result->operation = (InstructionOperation)((int)state->result->operation + type);
-		if (modField == 3)
-			size = 16;
-		else
-			size = GetSizeForSSEType(type);
-		DecodeRMReg(state, state->operand1, xmmRegList, size, state->operand0, xmmRegList, 16);
+		if (outMaxLen > tmpl->maxLength)
+		{
+			// The longest possible output fits, so nothing needs to be checked
+			out = WriteTemplate(out, tmpl, opcode, addr, instr);
+			*out = 0;
+			return (size_t)(out - start);
+		}
+
+		for (; field < end; field++)
+		{
+			if (field->type == 0)
+				out = WriteChecked(out, &outMaxLen, &tmpl->text[field->textOffset], field->textLength);
+			else
+				out = WriteFieldChecked(out, &outMaxLen, field->type, field->width, opcode, addr, instr,
+					tmpl->symbolizer);
+		}
+		len = out - start;
+		if (outMaxLen > 0)
+			*(out++) = 0;
+		return len;
 	}
 
 
-	static void DecodeSSESingle(DecodeState* state)
+	size_t FormatInstructionsBatch(char* out, size_t outMaxLen, const FormatTemplate* tmpl, const uint8_t* opcode,
+		uint64_t addr, const Instruction* instrs, size_t count, uint32_t* lineOffsets)
 	{
-		uint8_t type = DecodeSSEPrefix(state);
+		char* start = out;
+		size_t offset = 0;
+		size_t i, len;
 
-		if ((type == 1) || (type == 2))
+		// Line offsets are 32 bits
+		if (outMaxLen > 0xffffffff)
+			outMaxLen = 0xffffffff;
+
+		for (i = 0; i < count; i++)
 		{
-			state->invalid = true;
-			return;
+			if (lineOffsets)
+				lineOffsets[i] = (uint32_t)(out - start);
+			len = outMaxLen - (size_t)(out - start);
+			if (len > (tmpl->maxLength + 1))
+				out = WriteTemplate(out, tmpl, &opcode[offset], addr + offset, &instrs[i]);
+			else
+			{
+				// Near the end of the buffer, stop at the first line that doesn't fit along with its newline
+				// and the terminator
+				len = FormatInstructionCompiled(out, len, tmpl, &opcode[offset], addr + offset, &instrs[i]);
+				if ((size_t)(out - start) + len + 2 > outMaxLen)
+					break;
+				out += len;
+			}
+			*(out++) = '\n';
+			offset += instrs[i].length;
 		}
 
-		state->result->operation = (InstructionOperation)((int)state->result->operation + (type & 1));
-		DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+		if (lineOffsets)
+			lineOffsets[i] = (uint32_t)(out - start);
+		if (outMaxLen > (size_t)(out - start))
+			*out = 0;
+		return i;
 	}
 
 
-	static void DecodeSSEPacked(DecodeState* state)
-	{
-		uint8_t type = DecodeSSEPrefix(state);
+	// Longest JSON record, the instruction fields take under 200 characters and each operand under 160
+#define FORMAT_MAX_JSON_LENGTH 1024
 
-		if ((type == 2) || (type == 3))
+	static char* WriteDecimal(char* out, uint64_t val)
+	{
+		char digits[20];
+		size_t i = 0;
+		do
 		{
-			state->invalid = true;
-			return;
-		}
-
-		state->result->operation = (InstructionOperation)((int)state->result->operation + (type & 1));
-		DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
+			digits[i++] = (char)('0' + (val % 10));
+			val /= 10;
+		} while (val);
+		while (i > 0)
+			*(out++) = digits[--i];
+		return out;
 	}
 
 
-	static void DecodeMMX(DecodeState* state)
+	// Writes a hex number with as few digits as possible, quoted so that JSON readers don't round it
+	static char* WriteJsonHex(char* out, int64_t val, bool isSigned)
 	{
-		if (state->opPrefix)
-			DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
-		else
-			DecodeRMReg(state, state->operand1, mmxRegList, 8, state->operand0, mmxRegList, 8);
+		uint64_t abs = (uint64_t)val;
+		uint32_t digits = 1;
+		*(out++) = '"';
+		if (isSigned && (val < 0))
+		{
+			*(out++) = '-';
+			abs = (uint64_t)0 - abs;
+		}
+		while ((digits < 16) && (abs >> (digits * 4)))
+			digits++;
+		out = WriteHex(out, abs, digits, true);
+		*(out++) = '"';
+		return out;
 	}
 
 
-	static void DecodeMMXSSEOnly(DecodeState* state)
+	static char* WriteJsonName(char* out, OperandType type)
 	{
-		if (state->opPrefix)
-			DecodeRMReg(state, state->operand1, xmmRegList, 16, state->operand0, xmmRegList, 16);
-		else
-			state->invalid = true;
+		if (type == NONE)
+			return WriteText(out, "null", 4);
+		*(out++) = '"';
+		out = WriteOperandName(out, type);
+		*(out++) = '"';
+		return out;
 	}
 
 
-	static void DecodeMMXGroup(DecodeState* state)
+	static char* WriteJsonOperand(char* out, const Instruction* instr, const InstructionOperand* operand)
 	{
-		uint8_t regField;
-		if (state->opPrefix)
+		bool isAddress = operand->relative;
+		out = WriteText(out, "{\"operand\":", 11);
+		if (operand->operand == IMM)
+			out = WriteText(out, "\"imm\"", 5);
+		else if (operand->operand == MEM)
+			out = WriteText(out, "\"mem\"", 5);
+		else
+			out = WriteJsonName(out, operand->operand);
+		out = WriteText(out, ",\"size\":", 8);
+		out = WriteDecimal(out, operand->size);
+
+		if (operand->operand == MEM)
 		{
-			DecodeRM(state, state->operand0, xmmRegList, 16, &regField);
-			state->result->operation = (InstructionOperation)mmxGroupOperations[(int)state->result->operation][regField][1];
+			out = WriteText(out, ",\"segment\":", 11);
+			out = WriteJsonName(out, (OperandType)(operand->segment + REG_ES));
+			out = WriteText(out, ",\"components\":[", 15);
+			out = WriteJsonName(out, operand->components[0]);
+			*(out++) = ',';
+			out = WriteJsonName(out, operand->components[1]);
+			out = WriteText(out, "],\"scale\":", 10);
+			out = WriteDecimal(out, operand->scale);
+			if ((instr->mode == 64) && (operand->components[0] == NONE) && (operand->components[1] == NONE))
+				isAddress = true;
 		}
-		else
+		if ((operand->operand == IMM) || (operand->operand == MEM))
 		{
-			DecodeRM(state, state->operand0, mmxRegList, 8, &regField);
-			state->result->operation = (InstructionOperation)mmxGroupOperations[(int)state->result->operation][regField][0];
+			// Relative operands and absolute 64-bit memory operands hold addresses, which are written unsigned
+			out = WriteText(out, ",\"immediate\":", 13);
+			out = WriteJsonHex(out, operand->immediate, !isAddress);
+			if (operand->relative)
+				out = WriteText(out, ",\"relative\":true", 16);
 		}
-		SetOperandToImm8(state, state->operand1);
+		*(out++) = '}';
+		return out;
 	}
 
 
-	static void DecodePinsrw(DecodeState* state)
-	{
-		DecodeSSETableImm8(state);
-		if (state->operand1->operand == MEM)
-			state->operand1->size = 2;
-	}
-
+	static char* WriteJson(char* out, const uint8_t* opcode, uint64_t addr, const Instruction* instr)
+	{
+		static const char roundingString[5][7] = {"sae", "rn-sae", "rd-sae", "ru-sae", "rz-sae"};
+		static const uint8_t roundingStringLength[5] = {3, 6, 6, 6, 6};
+		size_t i;
+
+		out = WriteText(out, "{\"addr\":", 8);
+		out = WriteJsonHex(out, (int64_t)addr, false);
+		out = WriteText(out, ",\"length\":", 10);
+		out = WriteDecimal(out, (uint32_t)instr->length);
+		out = WriteText(out, ",\"mode\":", 8);
+		out = WriteDecimal(out, instr->mode);
+		out = WriteText(out, ",\"bytes\":\"", 10);
+		out = WriteHexBytes(out, opcode, instr->length);
+		out = WriteText(out, "\",\"mnemonic\":\"", 14);
+		out = WriteOperationName(out, instr->operation);
+		out = WriteText(out, "\",\"flags\":", 10);
+		out = WriteDecimal(out, instr->flags);
+		if (instr->mask != NONE)
+		{
+			out = WriteText(out, ",\"mask\":", 8);
+			out = WriteJsonName(out, instr->mask);
+		}
+		if (instr->flags & X86_FLAG_SAE)
+		{
+			out = WriteText(out, ",\"rounding\":\"", 13);
+			out = WriteText(out, roundingString[instr->rounding], roundingStringLength[instr->rounding]);
+			*(out++) = '"';
+		}
+		if (instr->broadcast)
+		{
+			out = WriteText(out, ",\"broadcast\":", 13);
+			out = WriteDecimal(out, instr->broadcast);
+		}
 
-	static void DecodeRegCR(DecodeState* state)
-	{
-		const RegDef* regList;
-		uint8_t reg;
-		if (state->opSize == 2)
-			state->opSize = 4;
-		regList = GetRegListForOpSize(state);
-		reg = Read8(state);
-		if (state->result->flags & X86_FLAG_LOCK)
+		out = WriteText(out, ",\"operands\":[", 13);
+		for (i = 0; (i < 4) && (instr->operands[i].operand != NONE); i++)
 		{
-			state->result->flags &= ~X86_FLAG_LOCK;
-			state->rexReg = true;
+			if (i != 0)
+				*(out++) = ',';
+			out = WriteJsonOperand(out, instr, &instr->operands[i]);
 		}
-		state->operand0->operand = regList[(reg & 7) + (state->rexRM1 ? 8 : 0)];
-		state->operand0->size = state->opSize;
-		state->operand1->operand = (OperandType)((int)state->result->operation + ((reg >> 3) & 7) +
-			(state->rexReg ? 8 : 0));
-		state->operand1->size = state->opSize;
-		state->result->operation = MOV;
+		return WriteText(out, "]}\n", 3);
 	}
 
 
-	static void DecodeMovSXZX8(DecodeState* state)
+	size_t FormatInstructionJson(char* out, size_t outMaxLen, const uint8_t* opcode, uint64_t addr,
+		const Instruction* instr)
 	{
-		DecodeRMReg(state, state->operand1, GetByteRegList(state), 1, state->operand0, GetRegListForOpSize(state), state->opSize);
-	}
+		char temp[FORMAT_MAX_JSON_LENGTH + FORMAT_FIELD_SLACK];
+		size_t len;
 
+		if (outMaxLen > (FORMAT_MAX_JSON_LENGTH + FORMAT_FIELD_SLACK))
+		{
+			len = (size_t)(WriteJson(out, opcode, addr, instr) - out);
+			out[len] = 0;
+			return len;
+		}
 
-	static void DecodeMovSXZX16(DecodeState* state)
-	{
-		DecodeRMReg(state, state->operand1, reg16List, 2, state->operand0, GetRegListForOpSize(state), state->opSize);
+		// Records are never truncated, so format into a temporary buffer and copy only if it all fits
+		len = (size_t)(WriteJson(temp, opcode, addr, instr) - temp);
+		if (len >= outMaxLen)
+			return 0;
+		WriteText(out, temp, len);
+		out[len] = 0;
+		return len;
 	}
 
 
-	static void DecodeMem16(DecodeState* state)
-	{
-		DecodeRM(state, state->operand0, reg32List, 2, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+	void GetInstructionRecord(InstructionRecord* record, const uint8_t* opcode, uint64_t addr,
+		const Instruction* instr)
+	{
+		InstructionRecordOperand* operand;
+		size_t i;
+
+		record->addr = addr;
+		record->flags = instr->flags;
+		record->operation = (uint16_t)instr->operation;
+		record->length = (uint8_t)instr->length;
+		record->mode = instr->mode;
+		for (i = 0; i < 15; i++)
+			record->bytes[i] = (i < instr->length) ? opcode[i] : 0;
+		record->segment = (uint8_t)instr->segment;
+		record->mask = (uint16_t)instr->mask;
+		record->rounding = (uint8_t)instr->rounding;
+		record->broadcast = instr->broadcast;
+		record->reserved[0] = 0;
+		record->reserved[1] = 0;
+		record->reserved[2] = 0;
+		record->reserved[3] = 0;
+
+		for (i = 0; i < 4; i++)
+		{
+			operand = &record->operands[i];
+			operand->immediate = instr->operands[i].immediate;
+			operand->operand = (uint16_t)instr->operands[i].operand;
+			operand->components[0] = (uint16_t)instr->operands[i].components[0];
+			operand->components[1] = (uint16_t)instr->operands[i].components[1];
+			operand->size = instr->operands[i].size;
+			operand->scale = instr->operands[i].scale;
+			operand->segment = (uint8_t)instr->operands[i].segment;
+			operand->relative = instr->operands[i].relative ? 1 : 0;
+			operand->reserved[0] = 0;
+			operand->reserved[1] = 0;
+			operand->reserved[2] = 0;
+			operand->reserved[3] = 0;
+			operand->reserved[4] = 0;
+		}
 	}
 
 
-	static void DecodeMem32(DecodeState* state)
+	size_t DisassembleToString16(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, size_t maxLen, Instruction* instr)
 	{
-		DecodeRM(state, state->operand0, reg32List, 4, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		if (!Disassemble16(opcode, addr, maxLen, instr))
+			return 0;
+		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
 	}
 
 
-	static void DecodeMem64(DecodeState* state)
+	size_t DisassembleToString32(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, size_t maxLen, Instruction* instr)
 	{
-		DecodeRM(state, state->operand0, reg32List, 8, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		if (!Disassemble32(opcode, addr, maxLen, instr))
+			return 0;
+		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
 	}
 
 
-	static void DecodeMem80(DecodeState* state)
+	size_t DisassembleToString64(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+		uint64_t addr, size_t maxLen, Instruction* instr)
 	{
-		DecodeRM(state, state->operand0, reg32List, 10, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		if (!Disassemble64(opcode, addr, maxLen, instr))
+			return 0;
+		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
 	}
 
 
-	static void DecodeMemFloatEnv(DecodeState* state)
+	uint64_t GetRegisterMask(OperandType reg)
 	{
-		DecodeRM(state, state->operand0, reg32List, (state->opSize == 2) ? 14 : 28, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		return operandRegisterMask[reg];
 	}
 
 
-	static void DecodeMemFloatSave(DecodeState* state)
-	{
-		DecodeRM(state, state->operand0, reg32List, (state->opSize == 2) ? 94 : 108, NULL);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+	static uint8_t GetAccessForm(const Instruction* instr)
+	{
+		// A few operations have effects that depend on the form of the instruction, such as the one operand
+		// form of IMUL or the SSE form of MOVSD
+		uint8_t form = 0;
+		if (instr->operands[1].operand == NONE)
+			form |= ACCESS_FORM_SINGLE;
+		if (instr->operands[2].operand != NONE)
+			form |= ACCESS_FORM_THREE;
+		if (instr->operands[0].size == 1)
+			form |= ACCESS_FORM_BYTE;
+		if (IsVectorRegister(instr->operands[0].operand) || IsVectorRegister(instr->operands[1].operand))
+			form |= ACCESS_FORM_VECTOR;
+		if (instr->operands[1].operand == MEM)
+			form |= ACCESS_FORM_MEMORY;
+		return form;
 	}
 
 
-	static void DecodeFPUReg(DecodeState* state)
+	static const RegisterAccessEntry* GetRegisterAccessEntry(const Instruction* instr)
 	{
-		DecodeRM(state, state->operand0, fpuRegList, 10, NULL);
+		const RegisterAccessEntry* entry = &registerAccessTable[registerAccessIndex[instr->operation]];
+		const RegisterAccessEntry* alternate;
+		uint8_t form;
+
+		if (entry->alternate == 0)
+			return entry;
+
+		form = GetAccessForm(instr);
+		for (alternate = &registerAccessTable[entry->alternate]; ;
+			alternate = &registerAccessTable[alternate->alternate])
+		{
+			if ((form & alternate->form) == alternate->form)
+				return alternate;
+			if (alternate->alternate == 0)
+				break;
+		}
+		return entry;
 	}
 
 
-	static void DecodeFPURegST0(DecodeState* state)
+	static uint8_t GetOperandAccessForEntry(const Instruction* instr, const RegisterAccessEntry* entry,
+		size_t operand)
 	{
-		DecodeFPUReg(state);
-		state->operand1->operand = REG_ST0;
-		state->operand1->size = 10;
+		const InstructionOperand* op = &instr->operands[operand];
+		uint8_t access;
+
+		if (op->operand == NONE)
+			return 0;
+
+		switch ((entry->operands >> (operand * 3)) & 7)
+		{
+		case ACCESS_READ:
+			access = X86_ACCESS_READ;
+			break;
+		case ACCESS_WRITE:
+			access = X86_ACCESS_WRITE;
+			break;
+		case ACCESS_READ_WRITE:
+			access = X86_ACCESS_READ | X86_ACCESS_WRITE;
+			break;
+		case ACCESS_PARTIAL_WRITE:
+			access = (op->operand == MEM) ? X86_ACCESS_WRITE : (X86_ACCESS_READ | X86_ACCESS_WRITE);
+			break;
+		default:
+			return 0;
+		}
+
+		if ((access & X86_ACCESS_WRITE) && (op->operand != MEM))
+		{
+			// Writes to 8-bit and 16-bit general purpose registers preserve the rest of the register
+			if ((op->size < 4) && (op->operand >= REG_AL) && (op->operand <= REG_R15W))
+				access |= X86_ACCESS_READ;
+
+			// Merge masking preserves the destination elements that are not selected by the mask
+			if ((operand == 0) && (instr->mask != NONE) && !(instr->flags & X86_FLAG_ZEROING))
+				access |= X86_ACCESS_READ;
+		}
+		return access;
 	}
 
 
-	static void DecodeRegGroupNoOperands(DecodeState* state)
+	uint8_t GetOperandAccess(const Instruction* instr, size_t operand)
 	{
-		uint8_t rmByte = Read8(state);
-		state->result->operation = (InstructionOperation)groupOperations[(int)state->result->operation][rmByte & 7];
+		if (operand >= 4)
+			return 0;
+		return GetOperandAccessForEntry(instr, GetRegisterAccessEntry(instr), operand);
 	}
 
 
-	static void DecodeRegGroupAX(DecodeState* state)
+	void GetRegisterAccess(const Instruction* instr, uint64_t* read, uint64_t* written)
 	{
-		DecodeRegGroupNoOperands(state);
-		state->operand0->operand = REG_AX;
-		state->operand0->size = 2;
+		const RegisterAccessEntry* entry = GetRegisterAccessEntry(instr);
+		uint64_t readMask = entry->read;
+		uint64_t writtenMask = entry->written;
+		uint64_t regMask;
+		uint8_t access;
+		size_t i;
+
+		for (i = 0; i < 4; i++)
+		{
+			const InstructionOperand* op = &instr->operands[i];
+			if (op->operand == NONE)
+				continue;
+			if (op->operand == MEM)
+			{
+				// Address registers are always read, even if the memory itself is not accessed
+				readMask |= operandRegisterMask[op->components[0]] | operandRegisterMask[op->components[1]];
+				continue;
+			}
+
+			regMask = operandRegisterMask[op->operand];
+			access = GetOperandAccessForEntry(instr, entry, i);
+			if (access & X86_ACCESS_READ)
+				readMask |= regMask;
+			if (access & X86_ACCESS_WRITE)
+				writtenMask |= regMask;
+		}
+
+		// Repeated string instructions count down in RCX
+		if (instr->flags & X86_FLAG_ANY_REP)
+		{
+			readMask |= X86_REGMASK_GPR(1);
+			writtenMask |= X86_REGMASK_GPR(1);
+		}
+
+		if (instr->mask != NONE)
+		{
+			readMask |= operandRegisterMask[instr->mask];
+			if (entry->writesMask)
+				writtenMask |= operandRegisterMask[instr->mask];
+		}
+
+		*read = readMask;
+		*written = writtenMask;
 	}
 
 
-	static void DecodeCmpXch8B(DecodeState* state)
+	static const FlagEffectsEntry* GetFlagEffectsEntry(const Instruction* instr)
 	{
-		uint8_t rm = Peek8(state);
-		uint8_t regField = (rm >> 3) & 7;
+		const FlagEffectsEntry* entry = &flagEffectsTable[flagEffectsIndex[instr->operation]];
+		const FlagEffectsEntry* alternate;
+		uint8_t form;
 
-		if (regField == 1)
+		if (entry->alternate == 0)
+			return entry;
+
+		form = GetAccessForm(instr);
+		for (alternate = &flagEffectsTable[entry->alternate]; ; alternate = &flagEffectsTable[alternate->alternate])
 		{
-			if (state->opSize == 2)
-				state->opSize = 4;
-			else if (state->opSize == 8)
-				state->result->operation = CMPXCH16B;
-			DecodeRM(state, state->operand0, GetRegListForOpSize(state), state->opSize * 2, NULL);
+			if ((form & alternate->form) == alternate->form)
+				return alternate;
+			if (alternate->alternate == 0)
+				break;
 		}
-		else if (regField == 6)
+		return entry;
+	}
+
+
+	FlagEffects GetFlagEffects(const Instruction* instr)
+	{
+		const FlagEffectsEntry* entry = GetFlagEffectsEntry(instr);
+		const InstructionOperand* count;
+		FlagEffects result;
+		int64_t countValue;
+		size_t i;
+
+		result.read = entry->read;
+		result.written = entry->written;
+		result.cleared = entry->cleared;
+		result.set = entry->set;
+		result.undefined = entry->undefined;
+
+		if (entry->count)
 		{
-			if (state->opPrefix)
-				state->result->operation = VMCLEAR;
-			else if (state->rep == REP_PREFIX_REPE)
-				state->result->operation = VMXON;
+			// Shifts and rotates leave the flags alone for a count of zero, and only define OF for a count
+			// of one.  The count is the last operand.
+			for (i = 1; (i < 3) && (instr->operands[i + 1].operand != NONE); i++)
+				;
+			count = &instr->operands[i];
+			if (count->operand == IMM)
+			{
+				countValue = count->immediate & ((instr->operands[0].size == 8) ? 0x3f : 0x1f);
+				if (countValue == 0)
+				{
+					result.read = 0;
+					result.written = 0;
+					result.cleared = 0;
+					result.set = 0;
+					result.undefined = 0;
+					return result;
+				}
+				if (countValue != 1)
+				{
+					result.written &= ~X86_EFLAG_OF;
+					result.undefined |= X86_EFLAG_OF;
+				}
+			}
 			else
-				state->result->operation = VMPTRLD;
-			DecodeRM(state, state->operand0, reg64List, 8, NULL);
-		}
-		else if (regField == 7)
-		{
-			state->result->operation = VMPTRST;
-			DecodeRM(state, state->operand0, reg64List, 8, NULL);
+			{
+				// Count in a register, any of the flags may be preserved
+				result.read |= result.written | result.undefined;
+				result.written &= ~X86_EFLAG_OF;
+				result.undefined |= X86_EFLAG_OF;
+			}
 		}
-		else
-			state->invalid = true;
 
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		// Conditional repeat prefixes test ZF after each iteration
+		if (instr->flags & (X86_FLAG_REPE | X86_FLAG_REPNE))
+			result.read |= X86_EFLAG_ZF;
+		return result;
 	}
 
 
-	static void DecodeMovNti(DecodeState* state)
+	static uint8_t GetAddressSize(const Instruction* instr)
 	{
-		if (state->opSize == 2)
-			state->opSize = 4;
-		DecodeRMReg(state, state->operand0, GetRegListForOpSize(state), state->opSize, state->operand1, GetRegListForOpSize(state), state->opSize);
-		if (state->operand0->operand != MEM)
-			state->invalid = true;
+		if (instr->mode == 64)
+			return (instr->flags & X86_FLAG_ADDRSIZE) ? 4 : 8;
+		if (instr->mode == 32)
+			return (instr->flags & X86_FLAG_ADDRSIZE) ? 2 : 4;
+		return (instr->flags & X86_FLAG_ADDRSIZE) ? 4 : 2;
 	}
 
 
-	static void DecodeCrc32(DecodeState* state)
+	static uint16_t GetStackOperandSize(const Instruction* instr)
 	{
-		const RegDef* srcRegList = GetRegListForFinalOpSize(state);
-		const RegDef* destRegList = (state->opSize == 8) ? reg64List : reg32List;
-		uint16_t destSize = (state->opSize == 8) ? 8 : 4;
-		DecodeRMReg(state, state->operand1, srcRegList, state->finalOpSize, state->operand0, destRegList, destSize);
+		if (instr->mode == 64)
+			return (instr->flags & X86_FLAG_OPSIZE) ? 2 : 8;
+		if (instr->mode == 32)
+			return (instr->flags & X86_FLAG_OPSIZE) ? 2 : 4;
+		return (instr->flags & X86_FLAG_OPSIZE) ? 4 : 2;
 	}
 
 
-	static void DecodeArpl(DecodeState* state)
+	static bool IsOperandSize16(const Instruction* instr)
 	{
-		if (state->using64)
-		{
-			// In 64-bit ARPL is repurposed to MOVSXD
-			const RegDef* regList = GetRegListForFinalOpSize(state);
-			state->result->operation = MOVSXD;
-			DecodeRMReg(state, state->operand1, reg32List, 4, state->operand0, regList, state->finalOpSize);
-		}
-		else
-		{
-			// ARPL instruction
-			state->operand0 = &state->result->operands[1];
-			state->operand1 = &state->result->operands[0];
-			state->finalOpSize = 2;
-			DecodeRegRM(state);
-		}
+		return (instr->mode == 16) != ((instr->flags & X86_FLAG_OPSIZE) != 0);
 	}
 
 
-	static void ProcessPrefixes(DecodeState* state)
+	static OperandType GetSizedRegister(uint8_t size, OperandType reg16, OperandType reg32, OperandType reg64)
 	{
-		uint8_t rex = 0;
-		bool addrPrefix = false;
+		if (size == 8)
+			return reg64;
+		if (size == 4)
+			return reg32;
+		return reg16;
+	}
 
-		while (!state->invalid)
+
+	static void SetImplicitAccess(MemAccess* access, OperandType reg, SegmentRegister seg, int64_t offset,
+		uint16_t size, uint8_t type)
+	{
+		ClearOperand(&access->operand);
+		access->operand.operand = MEM;
+		access->operand.components[0] = reg;
+		access->operand.immediate = offset;
+		access->operand.size = size;
+		access->operand.segment = seg;
+		access->access = type;
+	}
+
+
+	size_t GetMemoryAccesses(const Instruction* instr, MemAccess out[4])
+	{
+		OperandType sp = GetSizedRegister(instr->mode / 8, REG_SP, REG_ESP, REG_RSP);
+		uint16_t size, level;
+		size_t count = 0;
+		uint8_t access;
+		size_t i;
+
+		for (i = 0; i < 4; i++)
 		{
-			uint8_t prefix = Read8(state);
-			if ((prefix >= 0x26) && (prefix <= 0x3e) && ((prefix & 7) == 6))
-			{
-				// Segment prefix
-				state->result->segment = (SegmentRegister)(SEG_ES + ((prefix >> 3) - 4));
-			}
-			else if ((prefix == 0x64) || (prefix == 0x65))
-			{
-				// FS/GS prefix
-				state->result->segment = (SegmentRegister)(SEG_ES + (prefix - 0x60));
-			}
-			else if (prefix == 0x66)
-			{
-				state->opPrefix = true;
-				state->result->flags |= X86_FLAG_OPSIZE;
-			}
-			else if (prefix == 0x67)
-			{
-				addrPrefix = true;
-				state->result->flags |= X86_FLAG_ADDRSIZE;
-			}
-			else if (prefix == 0xf0)
-				state->result->flags |= X86_FLAG_LOCK;
-			else if (prefix == 0xf2)
-				state->rep = REP_PREFIX_REPNE;
-			else if (prefix == 0xf3)
-				state->rep = REP_PREFIX_REPE;
-			else if (state->using64 && (prefix >= 0x40) && (prefix <= 0x4f))
-			{
-				// REX prefix
-				rex = prefix;
+			if (instr->operands[i].operand != MEM)
 				continue;
-			}
+			access = GetOperandAccess(instr, i);
+			if (access == 0)
+				continue;
+			out[count].operand = instr->operands[i];
+			out[count].access = access;
+			count++;
+		}
+
+		switch (instr->operation)
+		{
+		case PUSH:
+		case POP:
+			// Segment registers are pushed and popped using the full stack operand size
+			size = instr->operands[0].size;
+			if ((instr->operands[0].operand >= REG_ES) && (instr->operands[0].operand <= REG_GS))
+				size = GetStackOperandSize(instr);
+			if (instr->operation == PUSH)
+				SetImplicitAccess(&out[count++], sp, SEG_SS, -(int64_t)size, size, X86_ACCESS_WRITE);
 			else
+				SetImplicitAccess(&out[count++], sp, SEG_SS, 0, size, X86_ACCESS_READ);
+			break;
+		case CALL:
+			size = instr->operands[0].size;
+			SetImplicitAccess(&out[count++], sp, SEG_SS, -(int64_t)size, size, X86_ACCESS_WRITE);
+			break;
+		case RETN:
+			SetImplicitAccess(&out[count++], sp, SEG_SS, 0, GetStackOperandSize(instr), X86_ACCESS_READ);
+			break;
+		case PUSHF:
+		case PUSHFD:
+		case PUSHFQ:
+			size = (uint16_t)(2 << (instr->operation - PUSHF));
+			SetImplicitAccess(&out[count++], sp, SEG_SS, -(int64_t)size, size, X86_ACCESS_WRITE);
+			break;
+		case POPF:
+		case POPFD:
+		case POPFQ:
+			size = (uint16_t)(2 << (instr->operation - POPF));
+			SetImplicitAccess(&out[count++], sp, SEG_SS, 0, size, X86_ACCESS_READ);
+			break;
+		case PUSHA:
+		case PUSHAD:
+			size = (instr->operation == PUSHA) ? 16 : 32;
+			SetImplicitAccess(&out[count++], sp, SEG_SS, -(int64_t)size, size, X86_ACCESS_WRITE);
+			break;
+		case POPA:
+		case POPAD:
+			size = (instr->operation == POPA) ? 16 : 32;
+			SetImplicitAccess(&out[count++], sp, SEG_SS, 0, size, X86_ACCESS_READ);
+			break;
+		case ENTER:
+			// The frame pointer is pushed.  A nesting level above zero then copies level - 1 frame pointers from
+			// the old frame and pushes the new frame pointer, so all of the writes are one block below the stack.
+			size = GetStackOperandSize(instr);
+			level = (uint16_t)(instr->operands[1].immediate & 31);
+			if (level > 1)
 			{
-				// Not a prefix, continue instruction processing
-				state->opcode--;
-				state->len++;
-				break;
+				SetImplicitAccess(&out[count++], GetSizedRegister(instr->mode / 8, REG_BP, REG_EBP, REG_RBP), SEG_SS,
+					-(int64_t)(size * (level - 1)), (uint16_t)(size * (level - 1)), X86_ACCESS_READ);
 			}
+			if (level != 0)
+				size = (uint16_t)(size * (level + 1));
+			SetImplicitAccess(&out[count++], sp, SEG_SS, -(int64_t)size, size, X86_ACCESS_WRITE);
+			break;
+		case LEAVE:
+			SetImplicitAccess(&out[count++], GetSizedRegister(instr->mode / 8, REG_BP, REG_EBP, REG_RBP), SEG_SS,
+				0, GetStackOperandSize(instr), X86_ACCESS_READ);
+			break;
+		case MASKMOVQ:
+		case MASKMOVDQU:
+		case VMASKMOVDQU:
+			SetImplicitAccess(&out[count++], GetSizedRegister(GetAddressSize(instr), REG_DI, REG_EDI, REG_RDI),
+				(instr->segment == SEG_DEFAULT) ? SEG_DS : instr->segment, 0, instr->operands[0].size,
+				X86_ACCESS_WRITE);
+			break;
 
-			// Force ignore REX unless it is the last prefix
-			rex = 0;
-		}
-
-		if (state->opPrefix)
-			state->opSize = (state->opSize == 2) ? 4 : 2;
-		if (addrPrefix)
-			state->addrSize = (state->addrSize == 4) ? 2 : 4;
-
-		if (rex)
-		{
-			// REX prefix found before opcode
-			state->rex = true;
-			state->rexRM1 = (rex & 1) != 0;
-			state->rexRM2 = (rex & 2) != 0;
-			state->rexReg = (rex & 4) != 0;
-			if (rex & 8)
-				state->opSize = 8;
+		// The decoder gives save areas and descriptor table operands the operand size, for display, rather
+		// than the size of the memory they cover
+		case FXSAVE:
+		case FXRSTOR:
+			if (count != 0)
+				out[0].operand.size = 512;
+			break;
+		case FSAVE:
+		case FRSTOR:
+			if (count != 0)
+				out[0].operand.size = IsOperandSize16(instr) ? 94 : 108;
+			break;
+		case FSTENV:
+		case FLDENV:
+			if (count != 0)
+				out[0].operand.size = IsOperandSize16(instr) ? 14 : 28;
+			break;
+		case SGDT:
+		case SIDT:
+		case LGDT:
+		case LIDT:
+			if (count != 0)
+				out[0].operand.size = (instr->mode == 64) ? 10 : 6;
+			break;
+		case XSAVE:
+		case XRSTOR:
+		case XSAVEC:
+		case XSAVES:
+		case XRSTORS:
+		case XSAVEC64:
+		case XSAVES64:
+		case XRSTORS64:
+			// The size of an XSAVE area depends on the features enabled in XCR0
+			if (count != 0)
+				out[0].operand.size = 0;
+			break;
+		default:
+			break;
 		}
+
+		return count;
 	}
 
 
-	static void ClearOperand(InstructionOperand* oper)
+	int GetRipRelativeOperand(const Instruction* instr)
 	{
-		oper->operand = NONE;
-		oper->components[0] = NONE;
-		oper->components[1] = NONE;
-		oper->scale = 1;
-		oper->immediate = 0;
-		oper->relative = false;
+		int i;
+		if (instr->ripRelOffset == 0)
+			return -1;
+		for (i = 0; i < 3; i++)
+		{
+			if ((instr->operands[i].operand == MEM) && instr->operands[i].relative)
+				return i;
+		}
+		return -1;
 	}
 
 
-	static void InitDisassemble(DecodeState* state)
+	uint16_t GetDispatchId(InstructionOperation operation, uint8_t shape, uint16_t size)
 	{
-		ClearOperand(&state->result->operands[0]);
-		ClearOperand(&state->result->operands[1]);
-		ClearOperand(&state->result->operands[2]);
-		state->result->operation = INVALID;
-		state->result->flags = 0;
-		state->result->segment = SEG_DEFAULT;
-		state->invalid = false;
-		state->insufficientLength = false;
-		state->opPrefix = false;
-		state->rep = REP_PREFIX_NONE;
-		state->ripRelFixup = NULL;
-		state->rex = false;
-		state->rexReg = false;
-		state->rexRM1 = false;
-		state->rexRM2 = false;
-		state->origLen = state->len;
+		return LookupDispatchId(operation, shape, size);
 	}
 
 
-	static void FinishDisassemble(DecodeState* state)
+	uint16_t GetDispatchIdCount(void)
 	{
-		state->result->length = state->opcode - state->opcodeStart;
-		if (state->ripRelFixup)
-			*state->ripRelFixup += state->addr + state->result->length;
-		if (state->insufficientLength && (state->origLen < 15))
-			state->result->flags |= X86_FLAG_INSUFFICIENT_LENGTH;
+		return DISPATCH_ID_COUNT;
 	}
 
 
-	bool Disassemble16(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
+	static bool IsEncodableRegister(OperandType reg)
 	{
-		DecodeState state;
-		state.result = result;
-		state.opcodeStart = opcode;
-		state.opcode = opcode;
-		state.addr = addr;
-		state.len = (maxLen > 15) ? 15 : maxLen;
-		state.addrSize = 2;
-		state.opSize = 2;
-		state.using64 = false;
-		InitDisassemble(&state);
-
-		ProcessPrefixes(&state);
-		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
-		FinishDisassemble(&state);
-		return !state.invalid;
+		return (reg >= REG_AL) && (reg <= REG_R15);
 	}
 
 
-	bool Disassemble32(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
+	static bool IsEncodableVectorRegister(OperandType reg, bool vex)
 	{
-		DecodeState state;
-		state.result = result;
-		state.opcodeStart = opcode;
-		state.opcode = opcode;
-		state.addr = addr;
-		state.len = (maxLen > 15) ? 15 : maxLen;
-		state.addrSize = 4;
-		state.opSize = 4;
-		state.using64 = false;
-		InitDisassemble(&state);
+		if ((reg >= REG_XMM0) && (reg <= REG_XMM15))
+			return true;
+		return vex && (reg >= REG_YMM0) && (reg <= REG_YMM15);
+	}
 
-		ProcessPrefixes(&state);
-		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
-		FinishDisassemble(&state);
-		return !state.invalid;
+
+	// Register number for encoding, using the convention of the code generator where numbers of 8 and above
+	// require a REX prefix, see __reg8_64bit
+	static uint8_t GetEncodingRegister(OperandType reg)
+	{
+		if (reg <= REG_R15B)
+			return __reg8_64bit(reg);
+		if (reg <= REG_R15W)
+			return __reg16_64bit(reg);
+		if (reg <= REG_R15D)
+			return __reg32_64bit(reg);
+		if (reg <= REG_R15)
+			return __reg64_64bit(reg);
+		return __vec_64bit(reg);
 	}
 
 
-	bool Disassemble64(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result)
+	static int64_t SignExtendImmediate(int64_t value, uint16_t size)
 	{
-		DecodeState state;
-		state.result = result;
-		state.opcodeStart = opcode;
-		state.opcode = opcode;
-		state.addr = addr;
-		state.len = (maxLen > 15) ? 15 : maxLen;
-		state.addrSize = 8;
-		state.opSize = 4;
-		state.using64 = true;
-		InitDisassemble(&state);
+		switch (size)
+		{
+		case 1:
+			return (int8_t)value;
+		case 2:
+			return (int16_t)value;
+		case 4:
+			return (int32_t)value;
+		default:
+			return value;
+		}
+	}
 
-		ProcessPrefixes(&state);
-		ProcessOpcode(&state, mainOpcodeMap, Read8(&state));
-		FinishDisassemble(&state);
-		return !state.invalid;
+
+	static size_t WriteImmediate(uint8_t* out, uint64_t value, size_t size)
+	{
+		size_t i;
+		for (i = 0; i < size; i++)
+			out[i] = (uint8_t)(value >> (i * 8));
+		return size;
 	}
 
 
-	static void WriteChar(char** out, size_t* outMaxLen, char ch)
+	static bool IsValidEncodingImmediate(const InstructionOperand* operand, uint8_t kind, uint16_t size)
 	{
-		if (*outMaxLen > 1)
+		int64_t value = SignExtendImmediate(operand->immediate, size);
+		if (operand->operand != IMM)
+			return false;
+		switch (kind)
 		{
-			*((*out)++) = ch;
-			(*outMaxLen)--;
+		case ENCODING_OPERAND_ONE:
+			return operand->immediate == 1;
+		case ENCODING_OPERAND_IMM8:
+			return (value >= -0x80) && (value <= 0x7f);
+		case ENCODING_OPERAND_UIMM8:
+			return (operand->immediate >= -0x80) && (operand->immediate <= 0xff);
+		case ENCODING_OPERAND_IMM16:
+			return (operand->immediate >= -0x8000) && (operand->immediate <= 0xffff);
+		case ENCODING_OPERAND_IMMZ:
+			return (value >= -0x80000000LL) && (value <= 0x7fffffffLL);
+		default:
+			return true;
 		}
 	}
 
 
-	static void WriteString(char** out, size_t* outMaxLen, const char* str)
+	// Resolves the address registers of a memory operand to their 64-bit registers and checks that the
+	// displacement can be encoded
+	static bool GetEncodingAddress(const Instruction* instr, const InstructionOperand* operand, OperandType* base,
+		OperandType* index, int32_t* disp)
 	{
-		for (; *str; str++)
-			WriteChar(out, outMaxLen, *str);
+		bool addrSize = (instr->flags & X86_FLAG_ADDRSIZE) != 0;
+		OperandType components[2];
+		size_t i;
+
+		if (operand->relative)
+		{
+			// The displacement is computed once the length of the instruction is known
+			*base = REG_RIP;
+			*index = NONE;
+			*disp = 0;
+			return !addrSize;
+		}
+
+		for (i = 0; i < 2; i++)
+		{
+			components[i] = operand->components[i];
+			if (components[i] == NONE)
+				continue;
+			if ((components[i] < REG_EAX) || (components[i] > REG_R15))
+				return false;
+			if ((RegisterWidth(components[i]) == 4) != addrSize)
+				return false;
+			components[i] = RegisterBase(components[i]);
+		}
+		if ((components[1] == REG_RSP) || ((components[1] != NONE) && (operand->scale != 1) &&
+			(operand->scale != 2) && (operand->scale != 4) && (operand->scale != 8)))
+			return false;
+
+		// Displacements of 32-bit addresses are truncated to the address size
+		if (addrSize ? ((operand->immediate < -0x80000000LL) || (operand->immediate > 0xffffffffLL)) :
+			((operand->immediate < -0x80000000LL) || (operand->immediate > 0x7fffffffLL)))
+			return false;
+
+		*base = components[0];
+		*index = components[1];
+		*disp = (int32_t)operand->immediate;
+		return true;
 	}
 
 
-	static void WriteHex(char** out, size_t* outMaxLen, uint64_t val, uint32_t width, bool prefix)
+	// Encodes an instruction using a single table entry, returns zero if the entry can't represent the instruction
+	static size_t EncodeInstructionEntry(const Instruction* instr, const EncodingEntry* entry, uint64_t newAddr,
+		uint8_t* out)
 	{
-		char temp[17];
-		int32_t i;
-		if (prefix)
-			WriteString(out, outMaxLen, "0x");
-		if (width > 16)
-			width = 16;
-		for (i = (width - 1); i >= 0; i--, val >>= 4)
+		const InstructionOperand* operand;
+		const InstructionOperand* mem = NULL;
+		uint16_t size = instr->operands[0].size;
+		uint16_t vex;
+		OperandType base = NONE, index = NONE;
+		int32_t disp = 0;
+		uint8_t reg = 0, rm = 0, vvvv = 0, opcodeReg = 0, rex = 0, num, regField, kind;
+		bool needRex = false, highByte = false, vectorLength = false, sized, rexW;
+		size_t len = 0, dispOffset = 0, immSize, i;
+		int64_t rel;
+
+		switch (entry->size)
+		{
+		case ENCODING_SIZE_BYTE:
+			if (size != 1)
+				return 0;
+			break;
+		case ENCODING_SIZE_VARIABLE:
+			if ((size != 2) && (size != 4) && (size != 8))
+				return 0;
+			break;
+		case ENCODING_SIZE_DWORD_QWORD:
+			if ((size != 4) && (size != 8))
+				return 0;
+			break;
+		case ENCODING_SIZE_STACK:
+			if ((size != 2) && (size != 8))
+				return 0;
+			break;
+		default:
+			break;
+		}
+		sized = (entry->size != ENCODING_SIZE_NONE) && (entry->size != ENCODING_SIZE_REX_W);
+		rexW = (entry->size == ENCODING_SIZE_REX_W) || ((size == 8) && ((entry->size == ENCODING_SIZE_VARIABLE) ||
+			(entry->size == ENCODING_SIZE_DWORD_QWORD)));
+
+		for (i = 0; i < 4; i++)
+		{
+			operand = &instr->operands[i];
+			kind = entry->operands[i];
+			if (((kind == ENCODING_OPERAND_RM) || (kind == ENCODING_OPERAND_MEM) || (kind == ENCODING_OPERAND_VEC_RM)) &&
+				(operand->operand == MEM))
+			{
+				if (entry->operandSizes[i] ? (operand->size != entry->operandSizes[i]) :
+					(sized && (kind == ENCODING_OPERAND_RM) && (operand->size != size)))
+					return 0;
+				if (!GetEncodingAddress(instr, operand, &base, &index, &disp))
+					return 0;
+				mem = operand;
+				continue;
+			}
+
+			// Register form of operands that can also be memory
+			if (kind == ENCODING_OPERAND_RM)
+				kind = ENCODING_OPERAND_RM_REG;
+			else if (kind == ENCODING_OPERAND_VEC_RM)
+				kind = ENCODING_OPERAND_RM_VEC;
+
+			switch (kind)
+			{
+			case ENCODING_OPERAND_NONE:
+				if (operand->operand != NONE)
+					return 0;
+				continue;
+			case ENCODING_OPERAND_REG:
+			case ENCODING_OPERAND_RM_REG:
+			case ENCODING_OPERAND_OPCODE_REG:
+			case ENCODING_OPERAND_VVVV_REG:
+			case ENCODING_OPERAND_ACC:
+				if (!IsEncodableRegister(operand->operand))
+					return 0;
+				if (entry->operandSizes[i] ? (operand->size != entry->operandSizes[i]) : (sized && (operand->size != size)))
+					return 0;
+				if ((operand->operand >= REG_AH) && (operand->operand <= REG_BH))
+					highByte = true;
+				num = GetEncodingRegister(operand->operand);
+				if (num >= 8)
+					needRex = true;
+				if (kind == ENCODING_OPERAND_REG)
+					reg = num;
+				else if (kind == ENCODING_OPERAND_RM_REG)
+					rm = num;
+				else if (kind == ENCODING_OPERAND_OPCODE_REG)
+					opcodeReg = num;
+				else if (kind == ENCODING_OPERAND_VVVV_REG)
+					vvvv = (uint8_t)(RegisterBase(operand->operand) - REG_RAX);
+				else if (num != 0)
+					return 0; // Not the accumulator
+				continue;
+			case ENCODING_OPERAND_VEC:
+			case ENCODING_OPERAND_RM_VEC:
+			case ENCODING_OPERAND_VVVV_VEC:
+				if (!IsEncodableVectorRegister(operand->operand, entry->vex != 0))
+					return 0;
+				if (operand->operand >= REG_YMM0)
+					vectorLength = true;
+				num = GetEncodingRegister(operand->operand);
+				if (kind == ENCODING_OPERAND_VEC)
+					reg = num;
+				else if (kind == ENCODING_OPERAND_RM_VEC)
+					rm = num;
+				else
+					vvvv = num;
+				if ((num >= 8) && (kind != ENCODING_OPERAND_VVVV_VEC))
+					needRex = true;
+				continue;
+			case ENCODING_OPERAND_CL:
+				if (operand->operand != REG_CL)
+					return 0;
+				continue;
+			case ENCODING_OPERAND_ONE:
+			case ENCODING_OPERAND_IMM8:
+			case ENCODING_OPERAND_UIMM8:
+			case ENCODING_OPERAND_IMM16:
+			case ENCODING_OPERAND_IMMZ:
+			case ENCODING_OPERAND_IMMV:
+				if (!IsValidEncodingImmediate(operand, entry->operands[i], size))
+					return 0;
+				continue;
+			case ENCODING_OPERAND_REL8:
+			case ENCODING_OPERAND_REL32:
+				// Branches with an operand size prefix truncate the target, which can't be relocated
+				if ((operand->operand != IMM) || (operand->size != 8))
+					return 0;
+				continue;
+			case ENCODING_OPERAND_MOFFS:
+				if ((operand->operand != MEM) || operand->relative || (operand->components[0] != NONE) ||
+					(operand->components[1] != NONE) || (instr->flags & X86_FLAG_ADDRSIZE))
+					return 0;
+				continue;
+			case ENCODING_OPERAND_STRING:
+				if (operand->operand != MEM)
+					return 0;
+				continue;
+			default:
+				return 0;
+			}
+		}
+
+		// Prefixes, the REX prefix must immediately precede the opcode
+		if (instr->flags & X86_FLAG_LOCK)
+			out[len++] = 0xf0;
+		if (instr->flags & X86_FLAG_REPNE)
+			out[len++] = 0xf2;
+		else if (instr->flags & (X86_FLAG_REP | X86_FLAG_REPE))
+			out[len++] = 0xf3;
+		if (instr->segment != SEG_DEFAULT)
+		{
+			__segprefix(&out[len], 1, (OperandType)(REG_ES + instr->segment));
+			len++;
+		}
+		if (instr->flags & X86_FLAG_ADDRSIZE)
+			out[len++] = 0x67;
+		if ((size == 2) && ((entry->size == ENCODING_SIZE_VARIABLE) || (entry->size == ENCODING_SIZE_STACK)))
+			out[len++] = 0x66;
+
+		rex = __REX_REG(reg) | __REX_RM(rm) | __REX_OPCODE(opcodeReg);
+		if ((base != NONE) && (base != REG_RIP))
+		{
+			rex |= __REX_RM(base - REG_RAX);
+			needRex = needRex || (base >= REG_R8);
+		}
+		if (index != NONE)
+		{
+			rex |= __REX_INDEX(index - REG_RAX);
+			needRex = needRex || (index >= REG_R8);
+		}
+
+		if (entry->vex)
 		{
-			char digit = (char)(val & 0xf);
-			if (digit < 10)
-				temp[i] = digit + '0';
+			vex = entry->vex & ~ENCODING_VEX_FIXED_LENGTH;
+			if (rexW)
+				vex |= __VEX_W;
+			if (vectorLength && (!(entry->vex & ENCODING_VEX_FIXED_LENGTH)))
+				vex |= __VEX_256;
+			len += __vex_prefix(&out[len], 1, vex, rex, vvvv);
+		}
+		else
+		{
+			if (entry->prefix)
+				out[len++] = entry->prefix;
+			if (rexW)
+				rex |= __REX_64;
+			if (needRex || rex)
+			{
+				// AH, CH, DH and BH can't be encoded with a REX prefix
+				if (highByte)
+					return 0;
+				out[len++] = __REX(rex);
+			}
+		}
+
+		for (i = 0; i < entry->opcodeLength; i++)
+			out[len++] = entry->opcode[i];
+		if ((entry->operands[0] == ENCODING_OPERAND_OPCODE_REG) || (entry->operands[1] == ENCODING_OPERAND_OPCODE_REG))
+		{
+			// Opcode 90 without REX.B is NOP, not an exchange with the accumulator
+			if ((entry->opcode[entry->opcodeLength - 1] == 0x90) && (opcodeReg == 0))
+				return 0;
+			out[len - 1] |= opcodeReg & 7;
+		}
+
+		if (entry->modrm != ENCODING_MODRM_NONE)
+		{
+			regField = (entry->modrm == ENCODING_MODRM_REG) ? reg : (entry->modrm & 7);
+			if (!mem)
+				out[len++] = 0xc0 | ((regField & 7) << 3) | (rm & 7);
+			else if ((base == NONE) && (index == NONE))
+				len += __modrm64_emit_index(&out[len], NULL, NULL, 1, regField, X86_MEM_INDEX(NONE, NONE, 1, disp));
 			else
-				temp[i] = digit + 'a' - 10;
+			{
+				len += __modrm64_emit(&out[len], NULL, NULL, 1, regField, X86_MEM_INDEX(base, index,
+					(index == NONE) ? 1 : mem->scale, disp), 0);
+				if (base == REG_RIP)
+					dispOffset = len - 4;
+			}
+		}
+
+		for (i = 0; i < 4; i++)
+		{
+			operand = &instr->operands[i];
+			switch (entry->operands[i])
+			{
+			case ENCODING_OPERAND_IMM8:
+			case ENCODING_OPERAND_UIMM8:
+				out[len++] = (uint8_t)operand->immediate;
+				break;
+			case ENCODING_OPERAND_IMM16:
+				len += WriteImmediate(&out[len], (uint64_t)operand->immediate, 2);
+				break;
+			case ENCODING_OPERAND_IMMZ:
+				immSize = (size > 4) ? 4 : size;
+				len += WriteImmediate(&out[len], (uint64_t)operand->immediate, immSize);
+				break;
+			case ENCODING_OPERAND_IMMV:
+				len += WriteImmediate(&out[len], (uint64_t)operand->immediate, size);
+				break;
+			case ENCODING_OPERAND_MOFFS:
+				len += WriteImmediate(&out[len], (uint64_t)operand->immediate, 8);
+				break;
+			case ENCODING_OPERAND_REL8:
+				rel = (int64_t)((uint64_t)operand->immediate - (newAddr + len + 1));
+				if ((rel < -0x80) || (rel > 0x7f))
+					return 0;
+				out[len++] = (uint8_t)rel;
+				break;
+			case ENCODING_OPERAND_REL32:
+				rel = (int64_t)((uint64_t)operand->immediate - (newAddr + len + 4));
+				if ((rel < -0x80000000LL) || (rel > 0x7fffffffLL))
+					return 0;
+				len += WriteImmediate(&out[len], (uint64_t)rel, 4);
+				break;
+			default:
+				break;
+			}
+		}
+
+		// RIP relative displacements are relative to the end of the instruction
+		if (dispOffset != 0)
+		{
+			rel = (int64_t)((uint64_t)mem->immediate - (newAddr + len));
+			if ((rel < -0x80000000LL) || (rel > 0x7fffffffLL))
+				return 0;
+			WriteImmediate(&out[dispOffset], (uint64_t)rel, 4);
 		}
-		temp[width] = 0;
-		WriteString(out, outMaxLen, temp);
+		return len;
 	}
 
 
-	static const char* GetSizeString(uint16_t size)
+	size_t EncodeInstruction64(const Instruction* instr, uint64_t newAddr, uint8_t* out)
 	{
-		switch (size)
+		uint8_t buf[32];
+		size_t best = 0, len, i, j;
+
+		// EVEX features have no legacy or VEX encoding
+		if ((instr->mode != 64) || (instr->mask != NONE) || (instr->rounding != ROUND_DEFAULT) || instr->broadcast ||
+			(instr->flags & (X86_FLAG_ZEROING | X86_FLAG_SAE)))
+			return 0;
+
+		// Every encoding of the operation is tried and the shortest is used
+		for (i = encodingIndex[instr->operation]; i < encodingIndex[instr->operation + 1]; i++)
 		{
-		case 1:
-			return "byte ";
-		case 2:
-			return "word ";
-		case 4:
-			return "dword ";
-		case 6:
-			return "fword ";
-		case 8:
-			return "qword ";
-		case 10:
-			return "tword ";
-		case 16:
-			return "oword ";
-		default:
-			return "";
+			len = EncodeInstructionEntry(instr, &encodingTable[i], newAddr, buf);
+			if ((len == 0) || (len > 15) || ((best != 0) && (len >= best)))
+				continue;
+			for (j = 0; j < len; j++)
+				out[j] = buf[j];
+			best = len;
 		}
+		return best;
 	}
 
 
-	static void WriteOperand(char** out, size_t* outMaxLen, OperandType type, uint8_t scale, bool plus)
+	void ResetDecodeProfile(void)
 	{
-		if (plus)
-			WriteString(out, outMaxLen, "+");
-		WriteString(out, outMaxLen, operandString[type]);
-		if (scale != 1)
+#ifdef X86_DECODE_PROFILE
+		size_t i;
+		for (i = 0; i < PROFILE_COUNTER_COUNT; i++)
 		{
-			WriteChar(out, outMaxLen, '*');
-			WriteChar(out, outMaxLen, scale + '0');
+			profileCounters[i].calls = 0;
+			profileCounters[i].bytes = 0;
+			profileCounters[i].cycles = 0;
 		}
+#endif
 	}
 
 
-	size_t FormatInstructionString(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
-		uint64_t addr, const Instruction* instr)
+	bool MergeDecodeProfile(DecodeProfile* profile)
 	{
-		char* start = out;
-		size_t len;
-		for (; *fmt; fmt++)
+#ifdef X86_DECODE_PROFILE
+		DecodeProfileCounter* counter;
+		const char* name;
+		size_t i, j;
+
+		for (i = 0; i < PROFILE_COUNTER_COUNT; i++)
 		{
-			if (*fmt == '%')
+			if (profileCounters[i].calls == 0)
+				continue;
+			name = (i < PROFILE_FIRST_HANDLER) ? profileStepNames[i] : profileHandlers[i - PROFILE_FIRST_HANDLER].name;
+
+			// Names come from the same tables in every thread, so they can be compared by address
+			for (j = 0; j < profile->count; j++)
 			{
-				uint32_t width = 0;
-				for (fmt++; *fmt; fmt++)
-				{
-					if (*fmt == 'a')
-					{
-						if (width == 0)
-							width = sizeof(void*) * 2;
-						WriteHex(&out, &outMaxLen, addr, width, false);
-						break;
-					}
-					else if (*fmt == 'b')
-					{
-						size_t i;
-						for (i = 0; i < instr->length; i++)
-							WriteHex(&out, &outMaxLen, opcode[i], 2, false);
-						for (; i < width; i++)
-							WriteString(&out, &outMaxLen, "  ");
-						break;
-					}
-					else if (*fmt == 'i')
-					{
-						char* operationStart = out;
-						if (instr->flags & X86_FLAG_ANY_REP)
-						{
-							WriteString(&out, &outMaxLen, "rep");
-							if (instr->flags & X86_FLAG_REPNE)
-								WriteChar(&out, &outMaxLen, 'n');
-							if (instr->flags & (X86_FLAG_REPNE | X86_FLAG_REPE))
-								WriteChar(&out, &outMaxLen, 'e');
-							WriteChar(&out, &outMaxLen, ' ');
-						}
-						if (instr->flags & X86_FLAG_LOCK)
-							WriteString(&out, &outMaxLen, "lock ");
-						WriteString(&out, &outMaxLen, operationString[instr->operation]);
-						for (; ((size_t)(out - operationStart) < (size_t)width) && (outMaxLen > 1); )
-							WriteChar(&out, &outMaxLen, ' ');
-						break;
-					}
-					else if (*fmt == 'o')
-					{
-						uint32_t i;
-						for (i = 0; i < 3; i++)
-						{
-							if (instr->operands[i].operand == NONE)
-								break;
-							if (i != 0)
-								WriteString(&out, &outMaxLen, ", ");
-							if (instr->operands[i].operand == IMM)
-								WriteHex(&out, &outMaxLen, instr->operands[i].immediate, instr->operands[i].size * 2, true);
-							else if (instr->operands[i].operand == MEM)
-							{
-								bool plus = false;
-								WriteString(&out, &outMaxLen, GetSizeString(instr->operands[i].size));
-								if ((instr->segment != SEG_DEFAULT) || (instr->operands[i].segment == SEG_ES))
-								{
-									WriteOperand(&out, &outMaxLen, (OperandType)(instr->operands[i].segment + REG_ES), 1, false);
-									WriteChar(&out, &outMaxLen, ':');
-								}
-								WriteChar(&out, &outMaxLen, '[');
-								if (instr->operands[i].components[0] != NONE)
-								{
-									WriteOperand(&out, &outMaxLen, instr->operands[i].components[0], 1, false);
-									plus = true;
-								}
-								if (instr->operands[i].components[1] != NONE)
-								{
-									WriteOperand(&out, &outMaxLen, instr->operands[i].components[1], instr->operands[i].scale, plus);
-									plus = true;
-								}
-								if ((instr->operands[i].immediate != 0) || ((instr->operands[i].components[0] == NONE) &&
-									(instr->operands[i].components[1] == NONE)))
-								{
-									if (plus && ((int64_t)instr->operands[i].immediate >= -0x80) &&
-										((int64_t)instr->operands[i].immediate < 0))
-									{
-										WriteChar(&out, &outMaxLen, '-');
-										WriteHex(&out, &outMaxLen, -(int64_t)instr->operands[i].immediate, 2, true);
-									}
-									else if (plus && ((int64_t)instr->operands[i].immediate > 0) &&
-										((int64_t)instr->operands[i].immediate <= 0x7f))
-									{
-										WriteChar(&out, &outMaxLen, '+');
-										WriteHex(&out, &outMaxLen, instr->operands[i].immediate, 2, true);
-									}
-									else
-									{
-										if (plus)
-											WriteChar(&out, &outMaxLen, '+');
-										WriteHex(&out, &outMaxLen, instr->operands[i].immediate, 8, true);
-									}
-								}
-								WriteChar(&out, &outMaxLen, ']');
-							}
-							else
-								WriteOperand(&out, &outMaxLen, instr->operands[i].operand, 1, false);
-						}
-						break;
-					}
-					else if ((*fmt >= '0') && (*fmt <= '9'))
-						width = (width * 10) + (*fmt - '0');
-					else
-					{
-						WriteChar(&out, &outMaxLen, *fmt);
-						break;
-					}
-				}
+				if (profile->counters[j].name == name)
+					break;
+			}
+			if (j == profile->count)
+			{
+				if (profile->count >= X86_DECODE_PROFILE_MAX_COUNTERS)
+					continue;
+				counter = &profile->counters[profile->count++];
+				counter->name = name;
+				counter->calls = 0;
+				counter->bytes = 0;
+				counter->cycles = 0;
 			}
 			else
-				WriteChar(&out, &outMaxLen, *fmt);
+			{
+				counter = &profile->counters[j];
+			}
+
+			counter->calls += profileCounters[i].calls;
+			counter->bytes += profileCounters[i].bytes;
+			counter->cycles += profileCounters[i].cycles;
 		}
-		len = out - start;
-		if (outMaxLen > 0)
-			*(out++) = 0;
-		return len;
+		return true;
+#else
+		(void)profile;
+		return false;
+#endif
 	}
 
 
-	size_t DisassembleToString16(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
-		uint64_t addr, size_t maxLen, Instruction* instr)
+	static bool IsHigherProfileCost(const DecodeProfileCounter* a, const DecodeProfileCounter* b)
 	{
-		if (!Disassemble16(opcode, addr, maxLen, instr))
-			return 0;
-		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
+		if (a->cycles != b->cycles)
+			return a->cycles > b->cycles;
+		return a->calls > b->calls;
 	}
 
 
-	size_t DisassembleToString32(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
-		uint64_t addr, size_t maxLen, Instruction* instr)
+	void SortDecodeProfile(DecodeProfile* profile)
 	{
-		if (!Disassemble32(opcode, addr, maxLen, instr))
-			return 0;
-		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
+		DecodeProfileCounter counter;
+		size_t i, j;
+
+		// Insertion sort, there are fewer than a hundred counters
+		for (i = 1; i < profile->count; i++)
+		{
+			counter = profile->counters[i];
+			for (j = i; (j > 0) && IsHigherProfileCost(&counter, &profile->counters[j - 1]); j--)
+				profile->counters[j] = profile->counters[j - 1];
+			profile->counters[j] = counter;
+		}
 	}
 
 
-	size_t DisassembleToString64(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
-		uint64_t addr, size_t maxLen, Instruction* instr)
+	// Longest line of the profile report, a name padded to PROFILE_NAME_WIDTH characters and three 20 digit
+	// counters with their labels
+#define PROFILE_NAME_WIDTH 24
+#define PROFILE_MAX_LINE_LENGTH 128
+
+	static char* WriteProfileLine(char* out, const DecodeProfileCounter* counter)
 	{
-		if (!Disassemble64(opcode, addr, maxLen, instr))
+		size_t len = 0;
+		while (counter->name[len] && (len < PROFILE_NAME_WIDTH))
+			len++;
+		out = WriteText(out, counter->name, len);
+		for (; len < PROFILE_NAME_WIDTH; len++)
+			*(out++) = ' ';
+
+		out = WriteText(out, " calls ", 7);
+		out = WriteDecimal(out, counter->calls);
+		out = WriteText(out, " bytes ", 7);
+		out = WriteDecimal(out, counter->bytes);
+		if (counter->cycles)
+		{
+			out = WriteText(out, " cycles ", 8);
+			out = WriteDecimal(out, counter->cycles);
+		}
+		*(out++) = '\n';
+		return out;
+	}
+
+
+	size_t FormatDecodeProfile(char* out, size_t outMaxLen, const DecodeProfile* profile)
+	{
+		char line[PROFILE_MAX_LINE_LENGTH];
+		size_t len = 0, lineLen, i;
+
+		if (outMaxLen == 0)
 			return 0;
-		return FormatInstructionString(out, outMaxLen, fmt, opcode, addr, instr);
+
+		// Whole lines are written, so that a report cut short by the buffer size is still readable
+		for (i = 0; i < profile->count; i++)
+		{
+			lineLen = (size_t)(WriteProfileLine(line, &profile->counters[i]) - line);
+			if ((len + lineLen) >= outMaxLen)
+				break;
+			WriteText(out + len, line, lineLen);
+			len += lineLen;
+		}
+		out[len] = 0;
+		return len;
 	}
 #ifdef __cplusplus
 }
@@ -51,11 +51,81 @@
 #define X86_FLAG_REPE		8
 #define X86_FLAG_OPSIZE		16
 #define X86_FLAG_ADDRSIZE	32
+#define X86_FLAG_ZEROING	64
+#define X86_FLAG_SAE		128
 
 #define X86_FLAG_INSUFFICIENT_LENGTH	0x80000000
 
 #define X86_FLAG_ANY_REP	(X86_FLAG_REP | X86_FLAG_REPE | X86_FLAG_REPNE)
 
+#define X86_ACCESS_READ		1
+#define X86_ACCESS_WRITE	2
+
+// Register bitmasks, general purpose registers are indexed in encoding order (RAX, RCX, RDX, RBX, ...) and
+// all sizes of a register share a bit
+#define X86_REGMASK_GPR(n)		((uint64_t)1 << (n))
+#define X86_REGMASK_VECTOR(n)	((uint64_t)1 << (16 + (n)))
+#define X86_REGMASK_X87			((uint64_t)1 << 48)
+#define X86_REGMASK_FLAGS		((uint64_t)1 << 49)
+#define X86_REGMASK_OPMASK(n)	((uint64_t)1 << (56 + (n)))
+
+// Bits of the flags register, in their architectural positions
+#define X86_EFLAG_CF	0x0001
+#define X86_EFLAG_PF	0x0004
+#define X86_EFLAG_AF	0x0010
+#define X86_EFLAG_ZF	0x0040
+#define X86_EFLAG_SF	0x0080
+#define X86_EFLAG_TF	0x0100
+#define X86_EFLAG_IF	0x0200
+#define X86_EFLAG_DF	0x0400
+#define X86_EFLAG_OF	0x0800
+#define X86_EFLAG_AC	0x40000
+
+#define X86_EFLAG_STATUS	(X86_EFLAG_CF | X86_EFLAG_PF | X86_EFLAG_AF | X86_EFLAG_ZF | X86_EFLAG_SF | X86_EFLAG_OF)
+
+// Operation attributes, see opattr.txt for their meaning
+#define X86_ATTR_BRANCH			0x0001
+#define X86_ATTR_CONDITIONAL	0x0002
+#define X86_ATTR_CALL			0x0004
+#define X86_ATTR_RETURN			0x0008
+#define X86_ATTR_READS_MEMORY	0x0010 // Not counting explicit memory operands
+#define X86_ATTR_WRITES_MEMORY	0x0020 // Not counting explicit memory operands
+#define X86_ATTR_PRIVILEGED		0x0040
+#define X86_ATTR_SERIALIZING	0x0080
+#define X86_ATTR_X87			0x0100
+#define X86_ATTR_MMX			0x0200
+#define X86_ATTR_SSE			0x0400
+#define X86_ATTR_AVX			0x0800
+#define X86_ATTR_STRING			0x1000
+
+// Layout of the register file used by ComputeEffectiveAddress, the general purpose registers are in encoding
+// order (RAX, RCX, RDX, RBX, ...) and are followed by the base addresses of the segment registers
+#define X86_REGFILE_GPR(n)				(n)
+#define X86_REGFILE_SEGMENT_BASE(seg)	(16 + (seg))
+#define X86_REGFILE_SIZE				22
+
+// Operand kinds and shapes for dispatch ids, a shape holds the kinds of the first three operands, with
+// X86_DISPATCH_VECTOR added when the first or second operand is a vector register.  The size of a dispatch id
+// is the size of the first operand, or X86_DISPATCH_SIZES of the first two operands for MOVZX and MOVSX.
+#define X86_OPERAND_KIND_NONE	0
+#define X86_OPERAND_KIND_IMM	1
+#define X86_OPERAND_KIND_MEM	2
+#define X86_OPERAND_KIND_REG	3
+#define X86_DISPATCH_SHAPE(a, b, c)	((a) | ((b) << 2) | ((c) << 4))
+#define X86_DISPATCH_VECTOR			0x40
+#define X86_DISPATCH_SIZES(a, b)	((a) | ((b) << 8))
+
+// Limits of format strings compiled with CompileFormat
+#define X86_FORMAT_MAX_FIELDS	16
+#define X86_FORMAT_MAX_TEXT		64
+
+// Symbolizer cache size, which must be a power of two, and longest symbol name written by the formatter
+#define X86_SYMBOL_CACHE_SIZE	64
+#define X86_SYMBOL_MAX_LENGTH	64
+
+// Most counters in a DecodeProfile, there is one for each decode step and decoding function
+#define X86_DECODE_PROFILE_MAX_COUNTERS	96
+
 
 #ifdef __cplusplus
 namespace asmx86
@@ -151,7 +221,76 @@ namespace asmx86
 		SGDT, SIDT, SLDT, SHUFPD, SHUFPS, SMSW, STR, SWAPGS,
 		UCOMISD, UCOMISS, UNPCKHPD, UNPCKHPS, UNPCKLPD, UNPCKLPS, VERR, VERW,
 		VMCALL, VMCLEAR, VMLAUNCH, VMPTRLD, VMPTRST, VMRESUME, VMXOFF, VMXON, XGETBV, XSETBV,
-		CLAC, STAC, ENCLS, VMFUNC, XEND, XTEXT, ENCLU, RDTSCP
+		CLAC, STAC, ENCLS, VMFUNC, XEND, XTEXT, ENCLU, RDTSCP, LZCNT, TZCNT, MOVBE,
+		XRSTORS, XSAVEC, XSAVES, XRSTORS64, XSAVEC64, XSAVES64,
+
+		// VEX encoded operations (pairs selected by VEX.L or operand size must be adjacent)
+		VMOVUPS, VMOVUPD, VMOVSD, VMOVSS, VMOVHLPS, VMOVLPS, VMOVLPD, VMOVDDUP, VMOVSLDUP, VUNPCKLPS, VUNPCKLPD,
+		VUNPCKHPS, VUNPCKHPD, VMOVLHPS, VMOVHPS, VMOVHPD, VMOVSHDUP, VMOVAPS, VMOVAPD, VCVTSI2SD, VCVTSI2SS,
+		VMOVNTPS, VMOVNTPD, VCVTTSD2SI, VCVTTSS2SI, VCVTSD2SI, VCVTSS2SI, VUCOMISS, VUCOMISD, VCOMISS, VCOMISD,
+		VMOVMSKPS, VMOVMSKPD, VSQRTPS, VSQRTPD, VSQRTSD, VSQRTSS, VRSQRTPS, VRSQRTSS, VRCPPS, VRCPSS, VANDPS, VANDPD,
+		VANDNPS, VANDNPD, VORPS, VORPD, VXORPS, VXORPD, VADDPS, VADDPD, VADDSD, VADDSS, VMULPS, VMULPD, VMULSD,
+		VMULSS, VCVTPS2PD, VCVTPD2PS, VCVTSD2SS, VCVTSS2SD, VCVTDQ2PS, VCVTPS2DQ, VCVTTPS2DQ, VSUBPS, VSUBPD, VSUBSD,
+		VSUBSS, VMINPS, VMINPD, VMINSD, VMINSS, VDIVPS, VDIVPD, VDIVSD, VDIVSS, VMAXPS, VMAXPD, VMAXSD, VMAXSS,
+		VPUNPCKLBW, VPUNPCKLWD, VPUNPCKLDQ, VPACKSSWB, VPCMPGTB, VPCMPGTW, VPCMPGTD, VPACKUSWB, VPUNPCKHBW,
+		VPUNPCKHWD, VPUNPCKHDQ, VPACKSSDW, VPUNPCKLQDQ, VPUNPCKHQDQ, VMOVD, VMOVQ, VMOVDQA, VMOVDQU, VPSHUFD,
+		VPSHUFLW, VPSHUFHW, VPCMPEQB, VPCMPEQW, VPCMPEQD, VZEROUPPER, VZEROALL, VHADDPD, VHADDPS, VHSUBPD, VHSUBPS,
+		VCMPPS, VCMPPD, VCMPSD, VCMPSS, VPINSRW, VPEXTRW, VSHUFPS, VSHUFPD, VADDSUBPD, VADDSUBPS, VPMOVMSKB,
+		VCVTTPD2DQ, VCVTPD2DQ, VCVTDQ2PD, VMOVNTDQ, VLDDQU, VMASKMOVDQU, VPSRLW, VPSRLD, VPSRLQ, VPSRAW, VPSRAD,
+		VPSLLW, VPSLLD, VPSLLQ, VPADDQ, VPMULLW, VPSUBUSB, VPSUBUSW, VPMINUB, VPAND, VPADDUSB, VPADDUSW, VPMAXUB,
+		VPANDN, VPAVGB, VPAVGW, VPMULHUW, VPMULHW, VPSUBSB, VPSUBSW, VPMINSW, VPOR, VPADDSB, VPADDSW, VPMAXSW, VPXOR,
+		VPMULUDQ, VPMADDWD, VPSADBW, VPSUBB, VPSUBW, VPSUBD, VPSUBQ, VPADDB, VPADDW, VPADDD, VPSHUFB, VPHADDW,
+		VPHADDD, VPHADDSW, VPMADDUBSW, VPHSUBW, VPHSUBD, VPHSUBSW, VPSIGNB, VPSIGNW, VPSIGND, VPMULHRSW, VPERMILPS,
+		VPERMILPD, VTESTPS, VTESTPD, VCVTPH2PS, VPERMPS, VPTEST, VBROADCASTSS, VBROADCASTSD, VBROADCASTF128, VPABSB,
+		VPABSW, VPABSD, VPMOVSXBW, VPMOVSXBD, VPMOVSXBQ, VPMOVSXWD, VPMOVSXWQ, VPMOVSXDQ, VPMOVZXBW, VPMOVZXBD,
+		VPMOVZXBQ, VPMOVZXWD, VPMOVZXWQ, VPMOVZXDQ, VPMULDQ, VPCMPEQQ, VMOVNTDQA, VPACKUSDW, VMASKMOVPS, VMASKMOVPD,
+		VPERMD, VPCMPGTQ, VPMINSB, VPMINSD, VPMINUW, VPMINUD, VPMAXSB, VPMAXSD, VPMAXUW, VPMAXUD, VPMULLD,
+		VPHMINPOSUW, VPSRLVD, VPSRLVQ, VPSRAVD, VPSLLVD, VPSLLVQ, VPBROADCASTD, VPBROADCASTQ, VBROADCASTI128,
+		VPBROADCASTB, VPBROADCASTW, VPMASKMOVD, VPMASKMOVQ, VPGATHERDD, VPGATHERDQ, VPGATHERQD, VPGATHERQQ,
+		VGATHERDPS, VGATHERDPD, VGATHERQPS, VGATHERQPD, VFMADDSUB132PS, VFMADDSUB132PD, VFMSUBADD132PS,
+		VFMSUBADD132PD, VFMADD132PS, VFMADD132PD, VFMADD132SS, VFMADD132SD, VFMSUB132PS, VFMSUB132PD, VFMSUB132SS,
+		VFMSUB132SD, VFNMADD132PS, VFNMADD132PD, VFNMADD132SS, VFNMADD132SD, VFNMSUB132PS, VFNMSUB132PD,
+		VFNMSUB132SS, VFNMSUB132SD, VFMADDSUB213PS, VFMADDSUB213PD, VFMSUBADD213PS, VFMSUBADD213PD, VFMADD213PS,
+		VFMADD213PD, VFMADD213SS, VFMADD213SD, VFMSUB213PS, VFMSUB213PD, VFMSUB213SS, VFMSUB213SD, VFNMADD213PS,
+		VFNMADD213PD, VFNMADD213SS, VFNMADD213SD, VFNMSUB213PS, VFNMSUB213PD, VFNMSUB213SS, VFNMSUB213SD,
+		VFMADDSUB231PS, VFMADDSUB231PD, VFMSUBADD231PS, VFMSUBADD231PD, VFMADD231PS, VFMADD231PD, VFMADD231SS,
+		VFMADD231SD, VFMSUB231PS, VFMSUB231PD, VFMSUB231SS, VFMSUB231SD, VFNMADD231PS, VFNMADD231PD, VFNMADD231SS,
+		VFNMADD231SD, VFNMSUB231PS, VFNMSUB231PD, VFNMSUB231SS, VFNMSUB231SD, VAESIMC, VAESENC, VAESENCLAST, VAESDEC,
+		VAESDECLAST, ANDN, BZHI, PDEP, PEXT, MULX, BEXTR, SHLX, SHRX, SARX, VPERMQ, VPERMPD, VPBLENDD, VPERM2F128,
+		VROUNDPS, VROUNDPD, VROUNDSS, VROUNDSD, VBLENDPS, VBLENDPD, VPBLENDW, VPALIGNR, VPEXTRB, VPEXTRD, VPEXTRQ,
+		VEXTRACTPS, VINSERTF128, VEXTRACTF128, VCVTPS2PH, VPINSRB, VINSERTPS, VPINSRD, VPINSRQ, VINSERTI128,
+		VEXTRACTI128, VDPPS, VDPPD, VMPSADBW, VPCLMULQDQ, VPERM2I128, VBLENDVPS, VBLENDVPD, VPBLENDVB, VPCMPESTRM,
+		VPCMPESTRI, VPCMPISTRM, VPCMPISTRI, VAESKEYGENASSIST, RORX, VPSRLDQ, VPSLLDQ, BLSI, BLSMSK, BLSR,
+		VLDMXCSR, VSTMXCSR,
+
+		// Opmask and EVEX encoded operations
+		KANDW, KANDQ, KANDB, KANDD, KANDNW, KANDNQ, KANDNB, KANDND, KORW, KORQ, KORB, KORD, KXNORW, KXNORQ, KXNORB,
+		KXNORD, KXORW, KXORQ, KXORB, KXORD, KADDW, KADDQ, KADDB, KADDD, KNOTW, KNOTQ, KNOTB, KNOTD, KUNPCKWD, KUNPCKDQ,
+		KUNPCKBW, KMOVW, KMOVB, KMOVD, KMOVQ, KORTESTW, KORTESTQ, KORTESTB, KORTESTD, KTESTW, KTESTQ, KTESTB, KTESTD,
+		KSHIFTRB, KSHIFTRW, KSHIFTRD, KSHIFTRQ, KSHIFTLB, KSHIFTLW, KSHIFTLD, KSHIFTLQ, VCVTQQ2PS, VMOVDQA32, VMOVDQA64,
+		VMOVDQU32, VMOVDQU64, VMOVDQU8, VMOVDQU16, VCVTTPS2UDQ, VCVTTPD2UDQ, VCVTTPS2UQQ, VCVTTPD2UQQ, VCVTTSS2USI,
+		VCVTTSD2USI, VCVTPS2UDQ, VCVTPD2UDQ, VCVTPS2UQQ, VCVTPD2UQQ, VCVTSS2USI, VCVTSD2USI, VCVTTPS2QQ, VCVTTPD2QQ,
+		VCVTUDQ2PD, VCVTUQQ2PD, VCVTUDQ2PS, VCVTUQQ2PS, VCVTPS2QQ, VCVTPD2QQ, VCVTUSI2SS, VCVTUSI2SD, VPSRAQ, VCVTQQ2PD,
+		VPANDD, VPANDQ, VPANDND, VPANDNQ, VPORD, VPORQ, VPXORD, VPXORQ, VPSRLVW, VPSRAVW, VPSLLVW, VPRORVD, VPRORVQ,
+		VPROLVD, VPROLVQ, VPMOVUSWB, VPMOVUSDB, VPMOVUSQB, VPMOVUSDW, VPMOVUSQW, VPMOVUSQD, VPMOVSWB, VPMOVSDB,
+		VPMOVSQB, VPMOVSDW, VPMOVSQW, VPMOVSQD, VPMOVWB, VPMOVDB, VPMOVQB, VPMOVDW, VPMOVQW, VPMOVQD, VBROADCASTF32X2,
+		VBROADCASTF32X4, VBROADCASTF64X2, VBROADCASTF32X8, VBROADCASTF64X4, VPABSQ, VPTESTMB, VPTESTMW, VPTESTNMB,
+		VPTESTNMW, VPTESTMD, VPTESTMQ, VPTESTNMD, VPTESTNMQ, VPMOVM2B, VPMOVM2W, VPMOVB2M, VPMOVW2M, VPBROADCASTMB2Q,
+		VSCALEFPS, VSCALEFPD, VSCALEFSS, VSCALEFSD, VPMOVM2D, VPMOVM2Q, VPMOVD2M, VPMOVQ2M, VPBROADCASTMW2D, VPMINSQ,
+		VPMINUQ, VPMAXSQ, VPMAXUQ, VPMULLQ, VGETEXPPS, VGETEXPPD, VGETEXPSS, VGETEXPSD, VPLZCNTD, VPLZCNTQ, VPSRAVQ,
+		VRCP14PS, VRCP14PD, VRCP14SS, VRCP14SD, VRSQRT14PS, VRSQRT14PD, VRSQRT14SS, VRSQRT14SD, VBROADCASTI32X2,
+		VBROADCASTI32X4, VBROADCASTI64X2, VBROADCASTI32X8, VBROADCASTI64X4, VPBLENDMD, VPBLENDMQ, VBLENDMPS, VBLENDMPD,
+		VPBLENDMB, VPBLENDMW, VPERMI2B, VPERMI2W, VPERMI2D, VPERMI2Q, VPERMI2PS, VPERMI2PD, VPERMT2B, VPERMT2W,
+		VPERMT2D, VPERMT2Q, VPERMT2PS, VPERMT2PD, VEXPANDPS, VEXPANDPD, VPEXPANDD, VPEXPANDQ, VCOMPRESSPS, VCOMPRESSPD,
+		VPCOMPRESSD, VPCOMPRESSQ, VPERMB, VPERMW, VPSCATTERDD, VPSCATTERDQ, VPSCATTERQD, VPSCATTERQQ, VSCATTERDPS,
+		VSCATTERDPD, VSCATTERQPS, VSCATTERQPD, VPCONFLICTD, VPCONFLICTQ, VALIGND, VALIGNQ, VRNDSCALEPS, VRNDSCALEPD,
+		VRNDSCALESS, VRNDSCALESD, VINSERTF32X4, VINSERTF64X2, VEXTRACTF32X4, VEXTRACTF64X2, VINSERTF32X8, VINSERTF64X4,
+		VEXTRACTF32X8, VEXTRACTF64X4, VINSERTI32X4, VINSERTI64X2, VEXTRACTI32X4, VEXTRACTI64X2, VINSERTI32X8,
+		VINSERTI64X4, VEXTRACTI32X8, VEXTRACTI64X4, VPCMPUD, VPCMPUQ, VPCMPD, VPCMPQ, VSHUFF32X4, VSHUFF64X2,
+		VPTERNLOGD, VPTERNLOGQ, VGETMANTPS, VGETMANTPD, VGETMANTSS, VGETMANTSD, VPCMPUB, VPCMPUW, VPCMPB, VPCMPW,
+		VDBPSADBW, VSHUFI32X4, VSHUFI64X2, VRANGEPS, VRANGEPD, VRANGESS, VRANGESD, VFIXUPIMMPS, VFIXUPIMMPD,
+		VFIXUPIMMSS, VFIXUPIMMSD, VREDUCEPS, VREDUCEPD, VREDUCESS, VREDUCESD, VFPCLASSPS, VFPCLASSPD, VFPCLASSSS,
+		VFPCLASSSD, VPRORD, VPROLD, VPRORQ, VPROLQ
 	};
 #ifndef __cplusplus
 	typedef enum InstructionOperation InstructionOperation;
@@ -168,6 +307,15 @@ namespace asmx86
 #endif
 
 
+	enum RoundingMode
+	{
+		ROUND_DEFAULT = 0, ROUND_NEAREST, ROUND_DOWN, ROUND_UP, ROUND_ZERO
+	};
+#ifndef __cplusplus
+	typedef enum RoundingMode RoundingMode;
+#endif
+
+
 #ifdef X86_ALT_OPERAND_NAMES
 #define __X86_OPER(n) X86_ ## n
 #else
@@ -190,6 +338,17 @@ namespace asmx86
 		__X86_OPER(REG_MM0), __X86_OPER(REG_MM1), __X86_OPER(REG_MM2), __X86_OPER(REG_MM3), __X86_OPER(REG_MM4), __X86_OPER(REG_MM5), __X86_OPER(REG_MM6), __X86_OPER(REG_MM7),
 		__X86_OPER(REG_XMM0), __X86_OPER(REG_XMM1), __X86_OPER(REG_XMM2), __X86_OPER(REG_XMM3), __X86_OPER(REG_XMM4), __X86_OPER(REG_XMM5), __X86_OPER(REG_XMM6), __X86_OPER(REG_XMM7),
 		__X86_OPER(REG_XMM8), __X86_OPER(REG_XMM9), __X86_OPER(REG_XMM10), __X86_OPER(REG_XMM11), __X86_OPER(REG_XMM12), __X86_OPER(REG_XMM13), __X86_OPER(REG_XMM14), __X86_OPER(REG_XMM15),
+		__X86_OPER(REG_XMM16), __X86_OPER(REG_XMM17), __X86_OPER(REG_XMM18), __X86_OPER(REG_XMM19), __X86_OPER(REG_XMM20), __X86_OPER(REG_XMM21), __X86_OPER(REG_XMM22), __X86_OPER(REG_XMM23),
+		__X86_OPER(REG_XMM24), __X86_OPER(REG_XMM25), __X86_OPER(REG_XMM26), __X86_OPER(REG_XMM27), __X86_OPER(REG_XMM28), __X86_OPER(REG_XMM29), __X86_OPER(REG_XMM30), __X86_OPER(REG_XMM31),
+		__X86_OPER(REG_YMM0), __X86_OPER(REG_YMM1), __X86_OPER(REG_YMM2), __X86_OPER(REG_YMM3), __X86_OPER(REG_YMM4), __X86_OPER(REG_YMM5), __X86_OPER(REG_YMM6), __X86_OPER(REG_YMM7),
+		__X86_OPER(REG_YMM8), __X86_OPER(REG_YMM9), __X86_OPER(REG_YMM10), __X86_OPER(REG_YMM11), __X86_OPER(REG_YMM12), __X86_OPER(REG_YMM13), __X86_OPER(REG_YMM14), __X86_OPER(REG_YMM15),
+		__X86_OPER(REG_YMM16), __X86_OPER(REG_YMM17), __X86_OPER(REG_YMM18), __X86_OPER(REG_YMM19), __X86_OPER(REG_YMM20), __X86_OPER(REG_YMM21), __X86_OPER(REG_YMM22), __X86_OPER(REG_YMM23),
+		__X86_OPER(REG_YMM24), __X86_OPER(REG_YMM25), __X86_OPER(REG_YMM26), __X86_OPER(REG_YMM27), __X86_OPER(REG_YMM28), __X86_OPER(REG_YMM29), __X86_OPER(REG_YMM30), __X86_OPER(REG_YMM31),
+		__X86_OPER(REG_ZMM0), __X86_OPER(REG_ZMM1), __X86_OPER(REG_ZMM2), __X86_OPER(REG_ZMM3), __X86_OPER(REG_ZMM4), __X86_OPER(REG_ZMM5), __X86_OPER(REG_ZMM6), __X86_OPER(REG_ZMM7),
+		__X86_OPER(REG_ZMM8), __X86_OPER(REG_ZMM9), __X86_OPER(REG_ZMM10), __X86_OPER(REG_ZMM11), __X86_OPER(REG_ZMM12), __X86_OPER(REG_ZMM13), __X86_OPER(REG_ZMM14), __X86_OPER(REG_ZMM15),
+		__X86_OPER(REG_ZMM16), __X86_OPER(REG_ZMM17), __X86_OPER(REG_ZMM18), __X86_OPER(REG_ZMM19), __X86_OPER(REG_ZMM20), __X86_OPER(REG_ZMM21), __X86_OPER(REG_ZMM22), __X86_OPER(REG_ZMM23),
+		__X86_OPER(REG_ZMM24), __X86_OPER(REG_ZMM25), __X86_OPER(REG_ZMM26), __X86_OPER(REG_ZMM27), __X86_OPER(REG_ZMM28), __X86_OPER(REG_ZMM29), __X86_OPER(REG_ZMM30), __X86_OPER(REG_ZMM31),
+		__X86_OPER(REG_K0), __X86_OPER(REG_K1), __X86_OPER(REG_K2), __X86_OPER(REG_K3), __X86_OPER(REG_K4), __X86_OPER(REG_K5), __X86_OPER(REG_K6), __X86_OPER(REG_K7),
 		__X86_OPER(REG_CR0), __X86_OPER(REG_CR1), __X86_OPER(REG_CR2), __X86_OPER(REG_CR3), __X86_OPER(REG_CR4), __X86_OPER(REG_CR5), __X86_OPER(REG_CR6), __X86_OPER(REG_CR7),
 		__X86_OPER(REG_CR8), __X86_OPER(REG_CR9), __X86_OPER(REG_CR10), __X86_OPER(REG_CR11), __X86_OPER(REG_CR12), __X86_OPER(REG_CR13), __X86_OPER(REG_CR14), __X86_OPER(REG_CR15),
 		__X86_OPER(REG_DR0), __X86_OPER(REG_DR1), __X86_OPER(REG_DR2), __X86_OPER(REG_DR3), __X86_OPER(REG_DR4), __X86_OPER(REG_DR5), __X86_OPER(REG_DR6), __X86_OPER(REG_DR7),
@@ -222,9 +381,15 @@ namespace asmx86
 	struct Instruction
 	{
 		InstructionOperation operation;
-		InstructionOperand operands[3];
+		InstructionOperand operands[4];
 		uint32_t flags;
 		SegmentRegister segment;
+		OperandType mask;
+		RoundingMode rounding;
+		uint8_t broadcast;
+		uint8_t mode; // 16, 32 or 64, the processor mode the instruction was decoded for
+		uint16_t dispatchId; // Dense id of the operation, operand shape and size, see GetDispatchId
+		uint8_t ripRelOffset; // Offset of the 32-bit displacement of a RIP-relative operand, zero if there is none
 		size_t length;
 	};
 #ifndef __cplusplus
@@ -232,6 +397,166 @@ namespace asmx86
 #endif
 
 
+	// Location of a register within its full size register.  The 8-bit, 16-bit and 32-bit general purpose
+	// registers are part of the 64-bit register, and XMM and YMM registers are part of the ZMM register.
+	struct RegisterInfo
+	{
+		uint16_t base;
+		uint8_t offset;
+		uint8_t width;
+	};
+#ifndef __cplusplus
+	typedef struct RegisterInfo RegisterInfo;
+#endif
+
+
+	struct FlagEffects
+	{
+		uint32_t read;
+		uint32_t written; // Computed from the result
+		uint32_t cleared;
+		uint32_t set;
+		uint32_t undefined;
+	};
+#ifndef __cplusplus
+	typedef struct FlagEffects FlagEffects;
+#endif
+
+
+	// A memory access made by an instruction.  The operand is either an explicit memory operand or an implicit
+	// one, such as the top of the stack.  The size of the access is the size of the operand.
+	struct MemAccess
+	{
+		InstructionOperand operand;
+		uint8_t access; // X86_ACCESS_READ and/or X86_ACCESS_WRITE
+	};
+#ifndef __cplusplus
+	typedef struct MemAccess MemAccess;
+#endif
+
+
+	// Operand of an InstructionRecord
+	struct InstructionRecordOperand
+	{
+		int64_t immediate;
+		uint16_t operand;
+		uint16_t components[2];
+		uint16_t size;
+		uint8_t scale;
+		uint8_t segment;
+		uint8_t relative;
+		uint8_t reserved[5];
+	};
+#ifndef __cplusplus
+	typedef struct InstructionRecordOperand InstructionRecordOperand;
+#endif
+
+
+	// Fixed layout form of an Instruction for binary output, 136 bytes with no implicit padding.  Fields are
+	// in host byte order, and unused bytes are zero.
+	struct InstructionRecord
+	{
+		uint64_t addr;
+		uint32_t flags;
+		uint16_t operation;
+		uint8_t length;
+		uint8_t mode;
+		uint8_t bytes[15];
+		uint8_t segment;
+		uint16_t mask;
+		uint8_t rounding;
+		uint8_t broadcast;
+		uint8_t reserved[4];
+		InstructionRecordOperand operands[4];
+	};
+#ifndef __cplusplus
+	typedef struct InstructionRecord InstructionRecord;
+#endif
+
+
+	// Returns the name of the symbol containing addr and its offset from the start of the symbol, or NULL
+	// if there is none
+	typedef const char* (*SymbolResolver)(uint64_t addr, uint64_t* offset, void* ctx);
+
+	struct SymbolCacheEntry
+	{
+		uint64_t addr;
+		uint64_t offset;
+		const char* name;
+		uint8_t nameLength;
+		bool valid;
+	};
+#ifndef __cplusplus
+	typedef struct SymbolCacheEntry SymbolCacheEntry;
+#endif
+
+
+	// Resolver for branch targets and RIP-relative addresses, with a direct-mapped cache of recent lookups.
+	// A symbolizer must only be used by one thread at a time.
+	struct Symbolizer
+	{
+		SymbolResolver resolve;
+		void* ctx;
+		SymbolCacheEntry cache[X86_SYMBOL_CACHE_SIZE];
+	};
+#ifndef __cplusplus
+	typedef struct Symbolizer Symbolizer;
+#endif
+
+
+	// Field of a compiled format string, either literal text or one of the format specifiers
+	struct FormatField
+	{
+		char type; // 'a', 'b', 'i' or 'o', or zero for text
+		uint8_t textOffset;
+		uint8_t textLength;
+		uint32_t width;
+	};
+#ifndef __cplusplus
+	typedef struct FormatField FormatField;
+#endif
+
+
+	// Format string compiled by CompileFormat, for formatting many instructions without parsing the format
+	// string each time
+	struct FormatTemplate
+	{
+		size_t maxLength; // Longest possible output, not counting the terminator
+		uint8_t fieldCount;
+		uint8_t kind;
+		FormatField fields[X86_FORMAT_MAX_FIELDS];
+		char text[X86_FORMAT_MAX_TEXT];
+		Symbolizer* symbolizer; // Set to NULL by CompileFormat
+	};
+#ifndef __cplusplus
+	typedef struct FormatTemplate FormatTemplate;
+#endif
+
+
+	// Totals for one decode step or decoding function, including the functions it calls
+	struct DecodeProfileCounter
+	{
+		const char* name;
+		uint64_t calls;
+		uint64_t bytes; // Instruction bytes consumed
+		uint64_t cycles; // Time stamp counter cycles, only counted with X86_DECODE_PROFILE_CYCLES
+	};
+#ifndef __cplusplus
+	typedef struct DecodeProfileCounter DecodeProfileCounter;
+#endif
+
+
+	// Decode profile counters merged from one or more threads, must be zeroed before the first merge
+	struct DecodeProfile
+	{
+		size_t count;
+		DecodeProfileCounter counters[X86_DECODE_PROFILE_MAX_COUNTERS];
+	};
+#ifndef __cplusplus
+	typedef struct DecodeProfile DecodeProfile;
+#endif
+
+
 #ifdef __cplusplus
 	extern "C"
 	{
@@ -243,14 +568,208 @@ namespace asmx86
 		size_t FormatInstructionString(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
 			uint64_t addr, const Instruction* instr);
 
+		void InitSymbolizer(Symbolizer* sym, SymbolResolver resolve, void* ctx);
+		void FlushSymbolizer(Symbolizer* sym);
+		size_t FormatInstructionSymbolized(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
+			uint64_t addr, const Instruction* instr, Symbolizer* sym);
+
+		// Returns false if the format string has too many fields or too much literal text
+		bool CompileFormat(const char* fmt, FormatTemplate* tmpl);
+		size_t FormatInstructionCompiled(char* out, size_t outMaxLen, const FormatTemplate* tmpl,
+			const uint8_t* opcode, uint64_t addr, const Instruction* instr);
+
+		// Machine-readable output, FormatInstructionJson returns zero if the whole line doesn't fit
+		size_t FormatInstructionJson(char* out, size_t outMaxLen, const uint8_t* opcode, uint64_t addr,
+			const Instruction* instr);
+		void GetInstructionRecord(InstructionRecord* record, const uint8_t* opcode, uint64_t addr,
+			const Instruction* instr);
+
+		// Formats consecutive instructions as lines, returns the number of lines that fit
+		size_t FormatInstructionsBatch(char* out, size_t outMaxLen, const FormatTemplate* tmpl, const uint8_t* opcode,
+			uint64_t addr, const Instruction* instrs, size_t count, uint32_t* lineOffsets);
+
 		size_t DisassembleToString16(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
 			uint64_t addr, size_t maxLen, Instruction* instr);
 		size_t DisassembleToString32(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
 			uint64_t addr, size_t maxLen, Instruction* instr);
 		size_t DisassembleToString64(char* out, size_t outMaxLen, const char* fmt, const uint8_t* opcode,
 			uint64_t addr, size_t maxLen, Instruction* instr);
+
+		uint64_t GetRegisterMask(OperandType reg);
+		uint8_t GetOperandAccess(const Instruction* instr, size_t operand);
+		void GetRegisterAccess(const Instruction* instr, uint64_t* read, uint64_t* written);
+		FlagEffects GetFlagEffects(const Instruction* instr);
+		size_t GetMemoryAccesses(const Instruction* instr, MemAccess out[4]);
+		int GetRipRelativeOperand(const Instruction* instr);
+
+		uint16_t GetDispatchId(InstructionOperation operation, uint8_t shape, uint16_t size);
+		uint16_t GetDispatchIdCount(void);
+
+		size_t EncodeInstruction64(const Instruction* instr, uint64_t newAddr, uint8_t* out);
+
+		// Decode profiling, counters are only collected when the library is built with X86_DECODE_PROFILE
+		void ResetDecodeProfile(void);
+		bool MergeDecodeProfile(DecodeProfile* profile);
+		void SortDecodeProfile(DecodeProfile* profile);
+		size_t FormatDecodeProfile(char* out, size_t outMaxLen, const DecodeProfile* profile);
+
+		extern const RegisterInfo asmx86RegisterInfo[];
+		extern const uint16_t asmx86OperationAttributes[];
 #ifdef __cplusplus
 	}
+#endif
+
+	static __inline OperandType RegisterBase(OperandType reg)
+	{
+		return (OperandType)asmx86RegisterInfo[reg].base;
+	}
+
+	static __inline uint8_t RegisterOffset(OperandType reg)
+	{
+		return asmx86RegisterInfo[reg].offset;
+	}
+
+	static __inline uint8_t RegisterWidth(OperandType reg)
+	{
+		return asmx86RegisterInfo[reg].width;
+	}
+
+	// Value of an address register, NONE and vector index registers read as zero
+	static __inline uint64_t GetAddressRegisterValue(OperandType reg, const uint64_t regs[])
+	{
+		const RegisterInfo* info = &asmx86RegisterInfo[reg];
+		if ((info->base < REG_RAX) || (info->base > REG_R15))
+			return 0;
+		if (info->width == 8)
+			return regs[X86_REGFILE_GPR(info->base - REG_RAX)];
+		return regs[X86_REGFILE_GPR(info->base - REG_RAX)] & (((uint64_t)1 << (info->width * 8)) - 1);
+	}
+
+	// Linear address of a memory operand, using a register file laid out as described by X86_REGFILE_*
+	static __inline uint64_t ComputeEffectiveAddress(const InstructionOperand* operand, const uint64_t regs[])
+	{
+		uint64_t addr = (uint64_t)operand->immediate + GetAddressRegisterValue(operand->components[0], regs) +
+			(GetAddressRegisterValue(operand->components[1], regs) * operand->scale);
+		uint8_t width = asmx86RegisterInfo[operand->components[0]].width;
+		if (width == 0)
+			width = asmx86RegisterInfo[operand->components[1]].width;
+		if ((width == 2) || (width == 4))
+			addr &= ((uint64_t)1 << (width * 8)) - 1;
+		if (operand->segment <= SEG_GS)
+			addr += regs[X86_REGFILE_SEGMENT_BASE(operand->segment)];
+		return addr;
+	}
+
+	static __inline uint16_t GetOperationAttributes(InstructionOperation op)
+	{
+		return asmx86OperationAttributes[op];
+	}
+
+	// Checks the first two operands, which is where the register that selects the form of an operation is found
+	static __inline bool HasRegisterOperand(const Instruction* instr, OperandType first, OperandType last)
+	{
+		return ((instr->operands[0].operand >= first) && (instr->operands[0].operand <= last)) ||
+			((instr->operands[1].operand >= first) && (instr->operands[1].operand <= last));
+	}
+
+	static __inline bool IsBranchInstruction(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & X86_ATTR_BRANCH) != 0;
+	}
+
+	static __inline bool IsConditionalBranch(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & (X86_ATTR_BRANCH | X86_ATTR_CONDITIONAL)) ==
+			(X86_ATTR_BRANCH | X86_ATTR_CONDITIONAL);
+	}
+
+	static __inline bool IsCallInstruction(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & X86_ATTR_CALL) != 0;
+	}
+
+	static __inline bool IsReturnInstruction(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & X86_ATTR_RETURN) != 0;
+	}
+
+	static __inline bool InstructionReadsMemory(const Instruction* instr)
+	{
+		size_t i;
+		if (asmx86OperationAttributes[instr->operation] & X86_ATTR_READS_MEMORY)
+			return true;
+		for (i = 0; i < 4; i++)
+		{
+			if ((instr->operands[i].operand == MEM) && (GetOperandAccess(instr, i) & X86_ACCESS_READ))
+				return true;
+		}
+		return false;
+	}
+
+	static __inline bool InstructionWritesMemory(const Instruction* instr)
+	{
+		size_t i;
+		if (asmx86OperationAttributes[instr->operation] & X86_ATTR_WRITES_MEMORY)
+			return true;
+		for (i = 0; i < 4; i++)
+		{
+			if ((instr->operands[i].operand == MEM) && (GetOperandAccess(instr, i) & X86_ACCESS_WRITE))
+				return true;
+		}
+		return false;
+	}
+
+	static __inline bool IsPrivilegedInstruction(const Instruction* instr)
+	{
+		if (asmx86OperationAttributes[instr->operation] & X86_ATTR_PRIVILEGED)
+			return true;
+		return (instr->operation == MOV) && HasRegisterOperand(instr, REG_CR0, REG_TR7);
+	}
+
+	static __inline bool IsSerializingInstruction(const Instruction* instr)
+	{
+		if (asmx86OperationAttributes[instr->operation] & X86_ATTR_SERIALIZING)
+			return true;
+		return (instr->operation == MOV) && (instr->operands[0].operand >= REG_CR0) &&
+			(instr->operands[0].operand <= REG_DR15) && (instr->operands[0].operand != REG_CR8);
+	}
+
+	static __inline bool IsX87Instruction(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & X86_ATTR_X87) != 0;
+	}
+
+	static __inline bool IsMMXInstruction(const Instruction* instr)
+	{
+		uint16_t attr = asmx86OperationAttributes[instr->operation];
+		if (!(attr & X86_ATTR_MMX))
+			return false;
+		return (!(attr & X86_ATTR_SSE)) || HasRegisterOperand(instr, REG_MM0, REG_MM7);
+	}
+
+	static __inline bool IsSSEInstruction(const Instruction* instr)
+	{
+		uint16_t attr = asmx86OperationAttributes[instr->operation];
+		if (!(attr & X86_ATTR_SSE))
+			return false;
+		if (attr & (X86_ATTR_MMX | X86_ATTR_STRING))
+			return HasRegisterOperand(instr, REG_XMM0, REG_XMM31);
+		return true;
+	}
+
+	static __inline bool IsAVXInstruction(const Instruction* instr)
+	{
+		return (asmx86OperationAttributes[instr->operation] & X86_ATTR_AVX) != 0;
+	}
+
+	static __inline bool IsStringInstruction(const Instruction* instr)
+	{
+		uint16_t attr = asmx86OperationAttributes[instr->operation];
+		if (!(attr & X86_ATTR_STRING))
+			return false;
+		return (!(attr & X86_ATTR_SSE)) || (!HasRegisterOperand(instr, REG_XMM0, REG_XMM31));
+	}
+#ifdef __cplusplus
 }
 #endif
 
@@ -0,0 +1,529 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Command line disassembler.  Disassembles a raw file or a section of an ELF64 file as a linear sweep, in
+// parallel chunks that are joined in order, so the output is the same for any number of threads.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "asmx86.h"
+
+#define DEFAULT_FORMAT "%8a  %30b  %7i %o"
+#define DEFAULT_CHUNK_SIZE 0x40000
+#define MAX_THREADS 64
+
+// Instruction boundaries recorded at the start of each chunk, the end of the previous chunk must reach one
+// of these within this many bytes, or the chunk is decoded again from the right place
+#define RESYNC_WINDOW 64
+
+#define ELF_SECTION_HEADER_SIZE 64
+
+
+typedef struct DisConfig
+{
+	bool (*disassemble)(const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* result);
+	const uint8_t* data;
+	size_t len;
+	uint64_t base;
+	FormatTemplate tmpl;
+	FormatTemplate badTmpl;
+	bool json;
+	size_t maxLineLength;
+} DisConfig;
+
+
+typedef struct DisChunk
+{
+	const DisConfig* config;
+	size_t start;
+	size_t end;
+	size_t next; // Offset after the last instruction, which can be past the end of the chunk
+
+	char* out;
+	size_t outLen;
+	size_t outMaxLen;
+	bool failed;
+
+	size_t syncCount;
+	size_t syncOffset[RESYNC_WINDOW];
+	size_t syncOutput[RESYNC_WINDOW];
+} DisChunk;
+
+
+static void InitChunk(DisChunk* chunk, const DisConfig* config, size_t start, size_t end)
+{
+	chunk->config = config;
+	chunk->start = start;
+	chunk->end = end;
+	chunk->next = start;
+	chunk->out = NULL;
+	chunk->outLen = 0;
+	chunk->outMaxLen = 0;
+	chunk->failed = false;
+	chunk->syncCount = 0;
+}
+
+
+static bool ReserveOutput(DisChunk* chunk, size_t len)
+{
+	size_t newLen;
+	char* newOut;
+
+	if ((chunk->outMaxLen - chunk->outLen) > len)
+		return true;
+	newLen = (chunk->outMaxLen * 2) + len + 1;
+	newOut = (char*)realloc(chunk->out, newLen);
+	if (!newOut)
+	{
+		chunk->failed = true;
+		return false;
+	}
+	chunk->out = newOut;
+	chunk->outMaxLen = newLen;
+	return true;
+}
+
+
+// Formats the instruction at offset, or a single invalid byte, and returns the number of bytes consumed
+static size_t DecodeOne(DisChunk* chunk, size_t offset)
+{
+	const DisConfig* config = chunk->config;
+	const FormatTemplate* tmpl = &config->tmpl;
+	uint64_t addr = config->base + offset;
+	Instruction instr;
+	size_t i;
+
+	if (!ReserveOutput(chunk, config->maxLineLength))
+		return config->len - offset;
+
+	if (!config->disassemble(&config->data[offset], addr, config->len - offset, &instr))
+	{
+		memset(&instr, 0, sizeof(instr));
+		for (i = 0; i < 4; i++)
+			instr.operands[i].operand = NONE;
+		instr.length = 1;
+		tmpl = &config->badTmpl;
+	}
+
+	if (config->json)
+	{
+		chunk->outLen += FormatInstructionJson(&chunk->out[chunk->outLen], chunk->outMaxLen - chunk->outLen,
+			&config->data[offset], addr, &instr);
+	}
+	else
+	{
+		chunk->outLen += FormatInstructionCompiled(&chunk->out[chunk->outLen], chunk->outMaxLen - chunk->outLen,
+			tmpl, &config->data[offset], addr, &instr);
+		chunk->out[chunk->outLen++] = '\n';
+	}
+	return instr.length;
+}
+
+
+static void* DecodeChunk(void* param)
+{
+	DisChunk* chunk = (DisChunk*)param;
+	size_t offset = chunk->start;
+
+	ReserveOutput(chunk, (chunk->end - chunk->start) * 4);
+	while ((offset < chunk->end) && (!chunk->failed))
+	{
+		if ((offset - chunk->start) < RESYNC_WINDOW)
+		{
+			chunk->syncOffset[chunk->syncCount] = offset;
+			chunk->syncOutput[chunk->syncCount++] = chunk->outLen;
+		}
+		offset += DecodeOne(chunk, offset);
+	}
+	chunk->next = offset;
+	return NULL;
+}
+
+
+// Continues the linear sweep from offset into the chunk, which was decoded from its start.  Instructions are
+// decoded into fixup until one of them starts on a boundary that the chunk also found, after which the
+// chunk's own output is correct.  Returns the offset after the chunk's last instruction.
+static size_t JoinChunk(DisChunk* fixup, DisChunk* chunk, size_t offset, FILE* fp)
+{
+	size_t i;
+
+	fixup->outLen = 0;
+	while ((offset < chunk->end) && ((offset - chunk->start) < RESYNC_WINDOW) && (!fixup->failed))
+	{
+		for (i = 0; i < chunk->syncCount; i++)
+		{
+			if (chunk->syncOffset[i] == offset)
+			{
+				fwrite(fixup->out, 1, fixup->outLen, fp);
+				fwrite(&chunk->out[chunk->syncOutput[i]], 1, chunk->outLen - chunk->syncOutput[i], fp);
+				return chunk->next;
+			}
+		}
+		offset += DecodeOne(fixup, offset);
+	}
+
+	// No common boundary, decode the rest of the chunk here
+	while ((offset < chunk->end) && (!fixup->failed))
+		offset += DecodeOne(fixup, offset);
+	fwrite(fixup->out, 1, fixup->outLen, fp);
+	return offset;
+}
+
+
+// Writes the format with the mnemonic replaced by "(bad)" and the operands left out, for invalid bytes
+static void GetBadFormat(const char* fmt, char* out, size_t outMaxLen)
+{
+	const char* text;
+	size_t len = 0, textLen;
+
+	while (*fmt)
+	{
+		text = fmt++;
+		if (*text == '%')
+		{
+			for (; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+				;
+			if (*fmt)
+				fmt++;
+		}
+		textLen = (size_t)(fmt - text);
+		if ((*text == '%') && (fmt[-1] == 'i'))
+		{
+			text = "(bad)";
+			textLen = 5;
+		}
+		else if ((*text == '%') && (fmt[-1] == 'o'))
+			textLen = 0;
+		if ((len + textLen) >= outMaxLen)
+			break;
+		memcpy(&out[len], text, textLen);
+		len += textLen;
+	}
+	out[len] = 0;
+}
+
+
+static uint16_t Read16(const uint8_t* data)
+{
+	uint16_t result;
+	memcpy(&result, data, sizeof(result));
+	return result;
+}
+
+
+static uint32_t Read32(const uint8_t* data)
+{
+	uint32_t result;
+	memcpy(&result, data, sizeof(result));
+	return result;
+}
+
+
+static uint64_t Read64(const uint8_t* data)
+{
+	uint64_t result;
+	memcpy(&result, data, sizeof(result));
+	return result;
+}
+
+
+static bool IsElf(const uint8_t* data, size_t len)
+{
+	return (len >= 4) && (data[0] == 0x7f) && (data[1] == 'E') && (data[2] == 'L') && (data[3] == 'F');
+}
+
+
+// Finds a section of a little endian ELF64 file by name, returns its file offset, size and address
+static bool FindElfSection(const uint8_t* data, size_t len, const char* name, size_t* offset, size_t* size,
+	uint64_t* addr)
+{
+	uint64_t sectionTable, stringOffset, sectionOffset, sectionSize, nameOffset;
+	uint16_t sectionEntrySize, sectionCount, stringIndex, i;
+	const uint8_t* section;
+	size_t nameLen = strlen(name);
+
+	if ((len < 64) || (data[4] != 2) || (data[5] != 1))
+	{
+		fprintf(stderr, "Only little endian ELF64 files are supported, use -r for raw input\n");
+		return false;
+	}
+	sectionTable = Read64(&data[0x28]);
+	sectionEntrySize = Read16(&data[0x3a]);
+	sectionCount = Read16(&data[0x3c]);
+	stringIndex = Read16(&data[0x3e]);
+	if ((sectionEntrySize < ELF_SECTION_HEADER_SIZE) || (stringIndex >= sectionCount) ||
+		(sectionTable > len) || (((len - sectionTable) / sectionEntrySize) < sectionCount))
+	{
+		fprintf(stderr, "Invalid ELF section table\n");
+		return false;
+	}
+
+	section = &data[sectionTable + ((uint64_t)stringIndex * sectionEntrySize)];
+	stringOffset = Read64(&section[0x18]);
+	if (stringOffset > len)
+	{
+		fprintf(stderr, "Invalid ELF section name table\n");
+		return false;
+	}
+
+	for (i = 0; i < sectionCount; i++)
+	{
+		section = &data[sectionTable + ((uint64_t)i * sectionEntrySize)];
+		nameOffset = stringOffset + Read32(section);
+		if ((nameOffset >= len) || ((len - nameOffset) <= nameLen) || (memcmp(&data[nameOffset], name, nameLen + 1)))
+			continue;
+
+		sectionOffset = Read64(&section[0x18]);
+		sectionSize = Read64(&section[0x20]);
+		if (Read32(&section[4]) == 8) // SHT_NOBITS
+			sectionSize = 0;
+		if ((sectionOffset > len) || (sectionSize > (len - sectionOffset)))
+		{
+			fprintf(stderr, "Section %s is outside of the file\n", name);
+			return false;
+		}
+		*offset = (size_t)sectionOffset;
+		*size = (size_t)sectionSize;
+		*addr = Read64(&section[0x10]);
+		return true;
+	}
+
+	fprintf(stderr, "Section %s not found\n", name);
+	return false;
+}
+
+
+static void Usage(const char* name)
+{
+	fprintf(stderr, "usage: %s [options] file\n", name);
+	fprintf(stderr, "  -m 16|32|64   processor mode (default 64)\n");
+	fprintf(stderr, "  -f format     FormatInstructionString format (default \"%s\")\n", DEFAULT_FORMAT);
+	fprintf(stderr, "  -J            write NDJSON records instead of text\n");
+	fprintf(stderr, "  -S section    ELF section to disassemble (default .text)\n");
+	fprintf(stderr, "  -r            treat the file as raw code even if it is an ELF file\n");
+	fprintf(stderr, "  -b address    address of the first byte of raw input (default 0)\n");
+	fprintf(stderr, "  -s offset     start offset within the file or section\n");
+	fprintf(stderr, "  -e offset     end offset within the file or section\n");
+	fprintf(stderr, "  -t threads    number of threads (default is the number of processors)\n");
+	fprintf(stderr, "  -c size       smallest chunk given to a thread (default 0x%x)\n", DEFAULT_CHUNK_SIZE);
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* fmt = DEFAULT_FORMAT;
+	const char* sectionName = ".text";
+	char badFormat[256];
+	size_t start = 0, end = (size_t)-1, chunkSize = DEFAULT_CHUNK_SIZE;
+	size_t regionOffset = 0, regionLen, fileLen, chunkCount, i, offset;
+	long threads = sysconf(_SC_NPROCESSORS_ONLN);
+	uint64_t rawBase = 0;
+	int mode = 64, opt, fd, result = 0;
+	bool raw = false, baseSet = false;
+	struct stat st;
+	const uint8_t* file;
+	DisConfig config;
+	DisChunk* chunks;
+	DisChunk fixup;
+	pthread_t threadIds[MAX_THREADS];
+	bool threaded[MAX_THREADS];
+
+	memset(&config, 0, sizeof(config));
+	while ((opt = getopt(argc, argv, "m:f:JS:rb:s:e:t:c:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'm':
+			mode = atoi(optarg);
+			break;
+		case 'f':
+			fmt = optarg;
+			break;
+		case 'J':
+			config.json = true;
+			break;
+		case 'S':
+			sectionName = optarg;
+			break;
+		case 'r':
+			raw = true;
+			break;
+		case 'b':
+			rawBase = strtoull(optarg, NULL, 0);
+			baseSet = true;
+			break;
+		case 's':
+			start = (size_t)strtoull(optarg, NULL, 0);
+			break;
+		case 'e':
+			end = (size_t)strtoull(optarg, NULL, 0);
+			break;
+		case 't':
+			threads = atol(optarg);
+			break;
+		case 'c':
+			chunkSize = (size_t)strtoull(optarg, NULL, 0);
+			break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+	if ((optind + 1) != argc)
+	{
+		Usage(argv[0]);
+		return 1;
+	}
+
+	if (mode == 16)
+		config.disassemble = Disassemble16;
+	else if (mode == 32)
+		config.disassemble = Disassemble32;
+	else if (mode == 64)
+		config.disassemble = Disassemble64;
+	else
+	{
+		fprintf(stderr, "Invalid mode %d\n", mode);
+		return 1;
+	}
+	if ((threads < 1) || (threads > MAX_THREADS))
+		threads = (threads < 1) ? 1 : MAX_THREADS;
+	if (chunkSize < RESYNC_WINDOW)
+		chunkSize = RESYNC_WINDOW;
+
+	GetBadFormat(fmt, badFormat, sizeof(badFormat));
+	if ((!CompileFormat(fmt, &config.tmpl)) || (!CompileFormat(badFormat, &config.badTmpl)))
+	{
+		fprintf(stderr, "Format string is too long\n");
+		return 1;
+	}
+	config.maxLineLength = config.json ? 1024 : (config.tmpl.maxLength + 2);
+	if (config.badTmpl.maxLength + 2 > config.maxLineLength)
+		config.maxLineLength = config.badTmpl.maxLength + 2;
+
+	fd = open(argv[optind], O_RDONLY);
+	if ((fd < 0) || (fstat(fd, &st) < 0))
+	{
+		fprintf(stderr, "Unable to open %s\n", argv[optind]);
+		return 1;
+	}
+	fileLen = (size_t)st.st_size;
+	file = NULL;
+	if (fileLen > 0)
+	{
+		file = (const uint8_t*)mmap(NULL, fileLen, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (file == (const uint8_t*)MAP_FAILED)
+		{
+			fprintf(stderr, "Unable to map %s\n", argv[optind]);
+			close(fd);
+			return 1;
+		}
+		madvise((void*)file, fileLen, MADV_SEQUENTIAL);
+	}
+
+	if (!file)
+		goto done;
+
+	regionLen = fileLen;
+	config.base = rawBase;
+	if ((!raw) && IsElf(file, fileLen))
+	{
+		if (!FindElfSection(file, fileLen, sectionName, &regionOffset, &regionLen, &config.base))
+		{
+			result = 1;
+			goto done;
+		}
+		if (baseSet)
+			config.base = rawBase;
+	}
+
+	if (end > regionLen)
+		end = regionLen;
+	if (start > end)
+		start = end;
+	config.data = &file[regionOffset + start];
+	config.len = end - start;
+	config.base += start;
+
+	chunkCount = config.len / chunkSize;
+	if (chunkCount > (size_t)threads)
+		chunkCount = (size_t)threads;
+	if (chunkCount < 1)
+		chunkCount = 1;
+
+	chunks = (DisChunk*)malloc(chunkCount * sizeof(DisChunk));
+	if (!chunks)
+	{
+		fprintf(stderr, "Out of memory\n");
+		result = 1;
+		goto done;
+	}
+	for (i = 0; i < chunkCount; i++)
+	{
+		InitChunk(&chunks[i], &config, (config.len / chunkCount) * i,
+			(i == (chunkCount - 1)) ? config.len : ((config.len / chunkCount) * (i + 1)));
+	}
+
+	// Chunks that can't get a thread are decoded after the first one
+	for (i = 1; i < chunkCount; i++)
+		threaded[i] = (pthread_create(&threadIds[i], NULL, DecodeChunk, &chunks[i]) == 0);
+	DecodeChunk(&chunks[0]);
+	for (i = 1; i < chunkCount; i++)
+	{
+		if (threaded[i])
+			pthread_join(threadIds[i], NULL);
+		else
+			DecodeChunk(&chunks[i]);
+	}
+
+	// The first chunk starts where the sweep starts, each later chunk is joined to the end of the one before
+	InitChunk(&fixup, &config, 0, 0);
+	fwrite(chunks[0].out, 1, chunks[0].outLen, stdout);
+	offset = chunks[0].next;
+	for (i = 1; i < chunkCount; i++)
+		offset = JoinChunk(&fixup, &chunks[i], offset, stdout);
+
+	for (i = 0; i < chunkCount; i++)
+	{
+		if (chunks[i].failed)
+			result = 1;
+		free(chunks[i].out);
+	}
+	if (fixup.failed)
+		result = 1;
+	if (result)
+		fprintf(stderr, "Out of memory\n");
+	free(fixup.out);
+	free(chunks);
+
+done:
+	if (file)
+		munmap((void*)file, fileLen);
+	close(fd);
+	if (fflush(stdout) != 0)
+		result = 1;
+	return result;
+}
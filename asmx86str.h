@@ -1,791 +1,13201 @@
-static const char* operationString[] = {
-	"",
-	"aaa",
-	"aad",
-	"aam",
-	"aas",
-	"add",
-	"adc",
-	"and",
-	"arpl",
-	"blendpd",
-	"blendps",
-	"blendvpd",
-	"blendvps",
-	"bound",
-	"bsf",
-	"bsr",
-	"bswap",
-	"bt",
-	"btc",
-	"btr",
-	"bts",
-	"callf",
-	"call",
-	"clc",
-	"cld",
-	"clflush",
-	"cli",
-	"clts",
-	"cmc",
-	"cmp",
-	"cmpxch16b",
-	"cmpxch8b",
-	"cmpxchg",
-	"cpuid",
-	"crc32",
-	"daa",
-	"das",
-	"dec",
-	"div",
-	"dppd",
-	"dpps",
-	"emms",
-	"enter",
-	"f2xm1",
-	"fabs",
-	"fadd",
-	"faddp",
-	"fbld",
-	"fbstp",
-	"fchs",
-	"fclex",
-	"fcmovb",
-	"fcmovbe",
-	"fcmove",
-	"fcmovnb",
-	"fcmovnbe",
-	"fcmovne",
-	"fcmovnu",
-	"fcmovu",
-	"fcom",
-	"fcomi",
-	"fcomip",
-	"fcomp",
-	"fcompp",
-	"fcos",
-	"fdecstp",
-	"fdisi",
-	"fdiv",
-	"fdivp",
-	"fdivr",
-	"fdivrp",
-	"femms",
-	"feni",
-	"ffree",
-	"ffreep",
-	"fiadd",
-	"ficom",
-	"ficomp",
-	"fidiv",
-	"fidivr",
-	"fild",
-	"fimul",
-	"fincstp",
-	"finit",
-	"fist",
-	"fistp",
-	"fisttp",
-	"fisub",
-	"fisubr",
-	"fld",
-	"fld1",
-	"fldcw",
-	"fldenv",
-	"fldl2e",
-	"fldl2t",
-	"fldlg2",
-	"fldln2",
-	"fldpi",
-	"fldz",
-	"fmul",
-	"fmulp",
-	"fnop",
-	"fpatan",
-	"fprem",
-	"fprem1",
-	"fptan",
-	"frichop",
-	"frinear",
-	"frint2",
-	"frndint",
-	"frstor",
-	"frstpm",
-	"fsave",
-	"fscale",
-	"fsetpm",
-	"fsin",
-	"fsincos",
-	"fsqrt",
-	"fst",
-	"fstcw",
-	"fstdw",
-	"fstenv",
-	"fstp",
-	"fstsg",
-	"fstsw",
-	"fsub",
-	"fsubp",
-	"fsubr",
-	"fsubrp",
-	"ftst",
-	"fucom",
-	"fucomi",
-	"fucomip",
-	"fucomp",
-	"fucompp",
-	"fwait",
-	"fxam",
-	"fxch",
-	"fxrstor",
-	"fxsave",
-	"fxtract",
-	"fyl2x",
-	"fyl2xp1",
-	"getsec",
-	"hlt",
-	"idiv",
-	"imul",
-	"in",
-	"inc",
-	"int",
-	"int1",
-	"int3",
-	"into",
-	"invd",
-	"invlpg",
-	"iret",
-	"jmpf",
-	"jmp",
-	"lahf",
-	"lar",
-	"ldmxcsr",
-	"lds",
-	"lea",
-	"leave",
-	"les",
-	"lfence",
-	"lfs",
-	"lgs",
-	"loop",
-	"loope",
-	"loopne",
-	"lsl",
-	"lss",
-	"mfence",
-	"mov",
-	"movnti",
-	"movss",
-	"movsx",
-	"movsxd",
-	"movupd",
-	"movups",
-	"movzx",
-	"mpsadbw",
-	"mul",
-	"neg",
-	"nop",
-	"not",
-	"or",
-	"out",
-	"packssdw",
-	"packsswb",
-	"packusdw",
-	"packuswb",
-	"pabsb",
-	"pabsd",
-	"pabsw",
-	"paddb",
-	"paddd",
-	"paddq",
-	"paddw",
-	"paddsb",
-	"paddsw",
-	"paddusb",
-	"paddusw",
-	"palignr",
-	"pand",
-	"pandn",
-	"pause",
-	"pavgb",
-	"pavgusb",
-	"pavgw",
-	"pblendvb",
-	"pblendw",
-	"pcmpeqb",
-	"pcmpeqd",
-	"pcmpeqq",
-	"pcmpeqw",
-	"pcmpestri",
-	"pcmpestrm",
-	"pcmpgtb",
-	"pcmpgtd",
-	"pcmpgtq",
-	"pcmpgtw",
-	"pcmpistri",
-	"pcmpistrm",
-	"pf2id",
-	"pf2iw",
-	"pfacc",
-	"pfadd",
-	"pfcmpeq",
-	"pfcmpge",
-	"pfcmpgt",
-	"pfmax",
-	"pfmin",
-	"pfmul",
-	"pfnacc",
-	"pfpnacc",
-	"pfrcp",
-	"pfrcpit1",
-	"pfrcpit2",
-	"pfrcpv",
-	"pfrsqit1",
-	"pfrsqrt",
-	"pfrsqrtv",
-	"pfsub",
-	"pfsubr",
-	"phaddd",
-	"phaddsw",
-	"phaddw",
-	"phminposuw",
-	"phsubd",
-	"phsubsw",
-	"phsubw",
-	"pi2fd",
-	"pi2fw",
-	"pmaddwd",
-	"pmaddubsw",
-	"pmaxsb",
-	"pmaxsd",
-	"pmaxsw",
-	"pmaxub",
-	"pmaxud",
-	"pmaxuw",
-	"pminsb",
-	"pminsd",
-	"pminsw",
-	"pminub",
-	"pminud",
-	"pminuw",
-	"pmuldq",
-	"pmulhrsw",
-	"pmulhrw",
-	"pmulhuw",
-	"pmulhw",
-	"pmulld",
-	"pmullw",
-	"pmuludq",
-	"pop",
-	"popcnt",
-	"por",
-	"psadbw",
-	"pshufb",
-	"psignb",
-	"psignd",
-	"psignw",
-	"pslld",
-	"pslldq",
-	"psllq",
-	"psllw",
-	"psrad",
-	"psraw",
-	"psrld",
-	"psrldq",
-	"psrlq",
-	"psrlw",
-	"psubb",
-	"psubd",
-	"psubq",
-	"psubw",
-	"psubsb",
-	"psubsw",
-	"psubusb",
-	"psubusw",
-	"pswapd",
-	"ptest",
-	"punpckhbw",
-	"punpckhdq",
-	"punpckhqdq",
-	"punpckhwd",
-	"punpcklqdq",
-	"push",
-	"pxor",
-	"rdmsr",
-	"rdpmc",
-	"rdtsc",
-	"retf",
-	"retn",
-	"rcl",
-	"rcr",
-	"rol",
-	"ror",
-	"roundps",
-	"roundpd",
-	"rsm",
-	"sahf",
-	"salc",
-	"sar",
-	"sbb",
-	"sfence",
-	"shl",
-	"shld",
-	"shr",
-	"shrd",
-	"sub",
-	"stc",
-	"std",
-	"sti",
-	"stmxcsr",
-	"syscall",
-	"sysenter",
-	"sysexit",
-	"sysret",
-	"test",
-	"ud2",
-	"vmread",
-	"vmwrite",
-	"wbinvd",
-	"wrmsr",
-	"xchg",
-	"xlat",
-	"xadd",
-	"xor",
-	"xrstor",
-	"xsave",
-	"addps",
-	"addpd",
-	"addsd",
-	"addss",
-	"addsubpd",
-	"addsubps",
-	"andnps",
-	"andnpd",
-	"andps",
-	"andpd",
-	"cbw",
-	"cwde",
-	"cdqe",
-	"cmpsb",
-	"cmpsw",
-	"cmpsd",
-	"cmpsq",
-	"cmovo",
-	"cmovno",
-	"cmovb",
-	"cmovae",
-	"cmove",
-	"cmovne",
-	"cmovbe",
-	"cmova",
-	"cmovs",
-	"cmovns",
-	"cmovpe",
-	"cmovpo",
-	"cmovl",
-	"cmovge",
-	"cmovle",
-	"cmovg",
-	"cwd",
-	"cdq",
-	"cqo",
-	"divps",
-	"divpd",
-	"divsd",
-	"divss",
-	"insb",
-	"insw",
-	"insd",
-	"insq",
-	"jcxz",
-	"jecxz",
-	"jrcxz",
-	"jo",
-	"jno",
-	"jb",
-	"jae",
-	"je",
-	"jne",
-	"jbe",
-	"ja",
-	"js",
-	"jns",
-	"jpe",
-	"jpo",
-	"jl",
-	"jge",
-	"jle",
-	"jg",
-	"lodsb",
-	"lodsw",
-	"lodsd",
-	"lodsq",
-	"maxps",
-	"maxpd",
-	"maxsd",
-	"maxss",
-	"minps",
-	"minpd",
-	"minsd",
-	"minss",
-	"movd",
-	"movq",
-	"movsb",
-	"movsw",
-	"movsd",
-	"movsq",
-	"mulps",
-	"mulpd",
-	"mulsd",
-	"mulss",
-	"orps",
-	"orpd",
-	"outsb",
-	"outsw",
-	"outsd",
-	"outsq",
-	"pextrd",
-	"pextrq",
-	"pinsrd",
-	"pinsrq",
-	"popa",
-	"popad",
-	"popf",
-	"popfd",
-	"popfq",
-	"pusha",
-	"pushad",
-	"pushf",
-	"pushfd",
-	"pushfq",
-	"rcpps",
-	"rcpss",
-	"rsqrtps",
-	"rsqrtss",
-	"scasb",
-	"scasw",
-	"scasd",
-	"scasq",
-	"seto",
-	"setno",
-	"setb",
-	"setae",
-	"sete",
-	"setne",
-	"setbe",
-	"seta",
-	"sets",
-	"setns",
-	"setpe",
-	"setpo",
-	"setl",
-	"setge",
-	"setle",
-	"setg",
-	"sqrtps",
-	"sqrtpd",
-	"sqrtsd",
-	"sqrtss",
-	"stosb",
-	"stosw",
-	"stosd",
-	"stosq",
-	"subps",
-	"subpd",
-	"subsd",
-	"subss",
-	"xorps",
-	"xorpd",
-	"cmppd",
-	"cmpps",
-	"cmpss",
-	"comisd",
-	"comiss",
-	"cvtdq2pd",
-	"cvtdq2ps",
-	"cvtpd2dq",
-	"cvtpd2pi",
-	"cvtpd2ps",
-	"cvtpi2pd",
-	"cvtpi2ps",
-	"cvtps2dq",
-	"cvtps2pd",
-	"cvtps2pi",
-	"cvtsd2si",
-	"cvtsd2ss",
-	"cvtsi2sd",
-	"cvtsi2ss",
-	"cvtss2sd",
-	"cvtss2si",
-	"cvttpd2dq",
-	"cvttpd2pi",
-	"cvttps2dq",
-	"cvttps2pi",
-	"cvttsd2si",
-	"cvttss2si",
-	"extractps",
-	"haddpd",
-	"haddps",
-	"hsubpd",
-	"hsubps",
-	"insertps",
-	"lddqu",
-	"lgdt",
-	"lidt",
-	"lldt",
-	"lmsw",
-	"ltr",
-	"maskmovq",
-	"maskmovdqu",
-	"mmxnop",
-	"monitor",
-	"movapd",
-	"movaps",
-	"movddup",
-	"movdq2q",
-	"movdqa",
-	"movdqu",
-	"movhlps",
-	"movhpd",
-	"movhps",
-	"movshdup",
-	"movsldup",
-	"movlhps",
-	"movlpd",
-	"movlps",
-	"movmskpd",
-	"movmskps",
-	"movntdq",
-	"movntdqa",
-	"movntpd",
-	"movntps",
-	"movntq",
-	"movq2dq",
-	"mwait",
-	"pinsrb",
-	"pinsrw",
-	"pextrb",
-	"pextrw",
-	"pmovmskb",
-	"pmovsxbd",
-	"pmovsxbq",
-	"pmovsxdq",
-	"pmovsxbw",
-	"pmovsxwd",
-	"pmovsxwq",
-	"pmovzxbd",
-	"pmovzxbq",
-	"pmovzxdq",
-	"pmovzxbw",
-	"pmovzxwd",
-	"pmovzxwq",
-	"prefetch",
-	"prefetchnta",
-	"prefetcht0",
-	"prefetcht1",
-	"prefetcht2",
-	"prefetchw",
-	"pshufd",
-	"pshufhw",
-	"pshuflw",
-	"pshufw",
-	"punpcklbw",
-	"punpckldq",
-	"punpcklwd",
-	"roundsd",
-	"roundss",
-	"sgdt",
-	"sidt",
-	"sldt",
-	"shufpd",
-	"shufps",
-	"smsw",
-	"str",
-	"swapgs",
-	"ucomisd",
-	"ucomiss",
-	"unpckhpd",
-	"unpckhps",
-	"unpcklpd",
-	"unpcklps",
-	"verr",
-	"verw",
-	"vmcall",
-	"vmclear",
-	"vmlaunch",
-	"vmptrld",
-	"vmptrst",
-	"vmresume",
-	"vmxoff",
-	"vmxon",
-	"xgetbv",
-	"xsetbv",
-	"clac",
-	"stac",
-	"encls",
-	"vmfunc",
-	"xend",
-	"xtext",
-	"enclu",
-	"rdtscp"
+#define STRING_MAX_LENGTH 16
+static const char stringBlob[] =
+	"vaeskeygenassistvbroadcastf32x2vbroadcastf32x4vbroadcastf32x8vbroadcastf64x2vbroadcastf64x4vbroa"
+	"dcasti32x2vbroadcasti32x4vbroadcasti32x8vbroadcasti64x2vbroadcasti64x4vpbroadcastmb2qvpbroadcast"
+	"mw2dvbroadcastf128vbroadcasti128vfmaddsub132pdvfmaddsub132psvfmaddsub213pdvfmaddsub213psvfmaddsu"
+	"b231pdvfmaddsub231psvfmsubadd132pdvfmsubadd132psvfmsubadd213pdvfmsubadd213psvfmsubadd231pdvfmsub"
+	"add231psvextractf32x4vextractf32x8vextractf64x2vextractf64x4vextracti32x4vextracti32x8vextracti6"
+	"4x2vextracti64x4vbroadcastsdvbroadcastssvextractf128vextracti128vfnmadd132pdvfnmadd132psvfnmadd1"
+	"32sdvfnmadd132ssvfnmadd213pdvfnmadd213psvfnmadd213sdvfnmadd213ssvfnmadd231pdvfnmadd231psvfnmadd2"
+	"31sdvfnmadd231ssvfnmsub132pdvfnmsub132psvfnmsub132sdvfnmsub132ssvfnmsub213pdvfnmsub213psvfnmsub2"
+	"13sdvfnmsub213ssvfnmsub231pdvfnmsub231psvfnmsub231sdvfnmsub231ssvinsertf32x4vinsertf32x8vinsertf"
+	"64x2vinsertf64x4vinserti32x4vinserti32x8vinserti64x2vinserti64x4vpbroadcastbvpbroadcastdvpbroadc"
+	"astqvpbroadcastwprefetchntavaesdeclastvaesenclastvcompresspdvcompresspsvcvttpd2udqvcvttpd2uqqvcv"
+	"ttps2udqvcvttps2uqqvcvttsd2usivcvttss2usivfixupimmpdvfixupimmpsvfixupimmsdvfixupimmssvfmadd132pd"
+	"vfmadd132psvfmadd132sdvfmadd132ssvfmadd213pdvfmadd213psvfmadd213sdvfmadd213ssvfmadd231pdvfmadd23"
+	"1psvfmadd231sdvfmadd231ssvfmsub132pdvfmsub132psvfmsub132sdvfmsub132ssvfmsub213pdvfmsub213psvfmsu"
+	"b213sdvfmsub213ssvfmsub231pdvfmsub231psvfmsub231sdvfmsub231ssvinsertf128vinserti128vmaskmovdquvp"
+	"compressdvpcompressqvpconflictdvpconflictqvphminposuwvpscatterddvpscatterdqvpscatterqdvpscatterq"
+	"qvpunpckhqdqvpunpcklqdqvrndscalepdvrndscalepsvrndscalesdvrndscalessvscatterdpdvscatterdpsvscatte"
+	"rqpdvscatterqpsprefetcht0prefetcht1prefetcht2vcvtpd2udqvcvtpd2uqqvcvtps2udqvcvtps2uqqvcvtsd2usiv"
+	"cvtss2usivcvttpd2dqvcvttpd2qqvcvttps2dqvcvttps2qqvcvttsd2sivcvttss2sivcvtudq2pdvcvtudq2psvcvtuqq"
+	"2pdvcvtuqq2psvcvtusi2sdvcvtusi2ssvextractpsvfpclasspdvfpclasspsvfpclasssdvfpclassssvgatherdpdvga"
+	"therdpsvgatherqpdvgatherqpsvgetmantpdvgetmantpsvgetmantsdvgetmantssvmaskmovpdvmaskmovpsvpclmulqd"
+	"qvpcmpestrivpcmpestrmvpcmpistrivpcmpistrmvperm2f128vperm2i128vpgatherddvpgatherdqvpgatherqdvpgat"
+	"herqqvpmaddubswvpmaskmovdvpmaskmovqvpternlogdvpternlogqvpunpckhbwvpunpckhdqvpunpckhwdvpunpcklbwv"
+	"punpckldqvpunpcklwdvrsqrt14pdvrsqrt14psvrsqrt14sdvrsqrt14ssvshuff32x4vshuff64x2vshufi32x4vshufi6"
+	"4x2vzerouppercmpxch16bcvttpd2picvttps2piprefetchwvaddsubpdvaddsubpsvblendmpdvblendmpsvblendvpdvb"
+	"lendvpsvcvtdq2pdvcvtdq2psvcvtpd2dqvcvtpd2psvcvtpd2qqvcvtph2psvcvtps2dqvcvtps2pdvcvtps2phvcvtps2q"
+	"qvcvtqq2pdvcvtqq2psvcvtsd2sivcvtsd2ssvcvtsi2sdvcvtsi2ssvcvtss2sdvcvtss2sivdbpsadbwvexpandpdvexpa"
+	"ndpsvgetexppdvgetexppsvgetexpsdvgetexpssvinsertpsvmovdqa32vmovdqa64vmovdqu16vmovdqu32vmovdqu64vm"
+	"ovmskpdvmovmskpsvmovntdqavmovshdupvmovsldupvpackssdwvpacksswbvpackusdwvpackuswbvpblendmbvpblendm"
+	"dvpblendmqvpblendmwvpblendvbvpermi2pdvpermi2psvpermilpdvpermilpsvpermt2pdvpermt2psvpexpanddvpexp"
+	"andqvpmovmskbvpmovsxbdvpmovsxbqvpmovsxbwvpmovsxdqvpmovsxwdvpmovsxwqvpmovusdbvpmovusdwvpmovusqbvp"
+	"movusqdvpmovusqwvpmovuswbvpmovzxbdvpmovzxbqvpmovzxbwvpmovzxdqvpmovzxwdvpmovzxwqvpmulhrswvptestnm"
+	"bvptestnmdvptestnmqvptestnmwvreducepdvreducepsvreducesdvreducessvscalefpdvscalefpsvscalefsdvscal"
+	"efssvunpckhpdvunpckhpsvunpcklpdvunpcklpsxrstors64cmpxch8bcvtpd2picvtpi2pdcvtpi2pscvtps2pifcmovnb"
+	"ekortestbkortestdkortestqkortestwkshiftlbkshiftldkshiftlqkshiftlwkshiftrbkshiftrdkshiftrqkshiftr"
+	"wkunpckbwkunpckdqkunpckwdpfrcpit1pfrcpit2pfrsqit1pfrsqrtvsysentervblendpdvblendpsvldmxcsrvmlaunc"
+	"hvmovddupvmovdqu8vmovhlpsvmovlhpsvmovntpdvmovntpsvmpsadbwvmresumevpaddusbvpadduswvpalignrvpblend"
+	"dvpblendwvpcmpeqbvpcmpeqdvpcmpeqqvpcmpeqwvpcmpgtbvpcmpgtdvpcmpgtqvpcmpgtwvpermi2bvpermi2dvpermi2"
+	"qvpermi2wvpermt2bvpermt2dvpermt2qvpermt2wvphaddswvphsubswvplzcntdvplzcntqvpmaddwdvpmovb2mvpmovd2"
+	"mvpmovm2bvpmovm2dvpmovm2qvpmovm2wvpmovq2mvpmovsdbvpmovsdwvpmovsqbvpmovsqdvpmovsqwvpmovswbvpmovw2"
+	"mvpmulhuwvpmuludqvpshufhwvpshuflwvpsubusbvpsubuswvptestmbvptestmdvptestmqvptestmwvrangepdvrangep"
+	"svrangesdvrangessvrcp14pdvrcp14psvrcp14sdvrcp14ssvroundpdvroundpsvroundsdvroundssvrsqrtpsvrsqrts"
+	"svstmxcsrvucomisdvucomissvzeroallxsavec64xsaves64clflushcmpxchgfcmovbefcmovnefcmovnufdecstpfincs"
+	"tpfrichopfrinearfrndintfsincosfucomipfucomppfxrstorfxtractfyl2xp1monitormovdq2qmovq2dqpavgusbpfc"
+	"mpeqpfcmpgepfcmpgtpfpnaccpmulhrwsyscallsysexitvaesimcvaligndvalignqvandnpdvandnpsvcomisdvcomissv"
+	"haddpdvhaddpsvhsubpdvhsubpsvmclearvmovapdvmovapsvmovhpdvmovhpsvmovlpdvmovlpsvmovupdvmovupsvmptrl"
+	"dvmptrstvmwritevpaddsbvpaddswvpandndvpandnqvpcmpubvpcmpudvpcmpuqvpcmpuwvpermpdvpermpsvpextrbvpex"
+	"trdvpextrqvpextrwvphadddvphaddwvphsubdvphsubwvpinsrbvpinsrdvpinsrqvpinsrwvpmaxsbvpmaxsdvpmaxsqvp"
+	"maxswvpmaxubvpmaxudvpmaxuqvpmaxuwvpminsbvpminsdvpminsqvpminswvpminubvpminudvpminuqvpminuwvpmovdb"
+	"vpmovdwvpmovqbvpmovqdvpmovqwvpmovwbvpmuldqvpmulhwvpmulldvpmullqvpmullwvprolvdvprolvqvprorvdvpror"
+	"vqvpsadbwvpshufbvpshufdvpsignbvpsigndvpsignwvpslldqvpsllvdvpsllvqvpsllvwvpsravdvpsravqvpsravwvps"
+	"rldqvpsrlvdvpsrlvqvpsrlvwvpsubsbvpsubswvshufpdvshufpsvsqrtpdvsqrtpsvsqrtsdvsqrtssvtestpdvtestpsb"
+	"lsmskcmovaecmovgecmovlecmovnocmovnscmovpecmovpofcmovefcmovufcomipfcomppfdivrpffreepficompfidivrf"
+	"isttpfisubrfldenvfldl2efldl2tfldlg2fldln2fpatanfprem1frint2frstorfrstpmfscalefsetpmfstenvfsubrpf"
+	"xsavegetsecinvlpgkandnbkandndkandnqkandnwktestbktestdktestqktestwkxnorbkxnordkxnorqkxnorwlfencel"
+	"oopnemfencemmxnopmovntimovntqpfnaccpfrcpvpfsubrpopcntpshufwpswapdpushadpushfdpushfqrdtscpsfences"
+	"wapgssysretvaddpdvaddpsvaddsdvaddssvandpdvandpsvcmppdvcmppsvcmpsdvcmpssvdivpdvdivpsvdivsdvdivssv"
+	"lddquvmaxpdvmaxpsvmaxsdvmaxssvmcallvmfuncvminpdvminpsvminsdvminssvmovsdvmovssvmreadvmulpdvmulpsv"
+	"mulsdvmulssvmxoffvpabsbvpabsdvpabsqvpabswvpaddbvpadddvpaddqvpaddwvpanddvpandqvpavgbvpavgwvpcmpbv"
+	"pcmpdvpcmpqvpcmpwvpermbvpermdvpermqvpermwvproldvprolqvprordvprorqvpsllqvpsllwvpsradvpsraqvpsrawv"
+	"psrlqvpsrlwvpsubbvpsubdvpsubqvpsubwvpxordvpxorqvrcppsvrcpssvsubpdvsubpsvsubsdvsubssvxorpdvxorpsw"
+	"binvdxgetbvxsetbvbextrboundbswapcallfcmovocmovscmpsbcmpsqcmpswcpuidcrc32enclsencluf2xm1faddpfbst"
+	"pfclexfdisifdivpfemmsfiaddfimulfinitfistpfldcwfldpifmulpfptanfsavefsqrtfstcwfstdwfstsgfstswfsubp"
+	"fwaitjecxzjrcxzkaddbkadddkaddqkaddwkandbkanddkandqkandwkmovbkmovwknotbknotdknotqknotwkxorbkxordk"
+	"xorqkxorwleavelodsblodsdlodsqlodswloopemovsbmwaitoutsboutsdoutsqoutswpausepf2idpf2iwpfaccpfaddpf"
+	"maxpfminpfmulpi2fdpi2fwpopadpopfdpopfqrdmsrrdpmcscasbscasdscasqscaswsetaesetbesetgesetlesetneset"
+	"nosetnssetpesetpostosbstosdstosqstoswtzcntvdppdvdppsvmovqvmxonvorpdvorpsvpordvporqwrmsrxtextarpl"
+	"blsiblsrbzhicdqeclaccltscwdefabsfbldfchsfcosfenifildfld1fldzfnopfstpftstfxamfxchint1int3intoiret"
+	"jcxzjmpfkorbkordkorqkorwlahflgdtlidtlldtlmswmulxpdepretfretnrorxsahfsalcsarxsetesetosetssgdtshld"
+	"shlxshrdshrxsidtsldtsmswstacverrverwxaddxendxlataaaaadaamaasbsrbtcbtrbtscbwclccldclicmccqodashlt"
+	"jaejbejgejlejnejnojnsjpejpolarlfslgslslltrnegrclrcrrsmsbbud2jojsxmm10xmm11xmm12xmm13xmm14xmm15xm"
+	"m16xmm17xmm18xmm19xmm20xmm21xmm22xmm23xmm24xmm25xmm26xmm27xmm28xmm29xmm30xmm31ymm10ymm11ymm12ymm"
+	"13ymm14ymm15ymm16ymm17ymm18ymm19ymm20ymm21ymm22ymm23ymm24ymm25ymm26ymm27ymm28ymm29ymm30ymm31zmm1"
+	"0zmm11zmm12zmm13zmm14zmm15zmm16zmm17zmm18zmm19zmm20zmm21zmm22zmm23zmm24zmm25zmm26zmm27zmm28zmm29"
+	"zmm30zmm31cr10cr11cr12cr13cr14cr15dr10dr11dr12dr13dr14dr15r10br10wr11br11wr12br12wr13br13wr14br1"
+	"4wr15br15wtr10tr11tr12tr13tr14tr15xmm0xmm4xmm5xmm6xmm7xmm8xmm9ymm0ymm4ymm5ymm6ymm7ymm8ymm9zmm0zm"
+	"m4zmm5zmm6zmm7zmm8zmm9bplcr0cr2cr3cr4cr5cr6cr7cr8cr9dildr0dr2dr3dr4dr5dr6dr7dr8dr9eaxebpebxedied"
+	"xespr8br8wr9br9wraxrbprbxrdirdxriprsirspsilsplst0st1st2st3st4st5st6st7tr0tr2tr3tr4tr5tr6tr7tr8tr"
+	"9bhdhk0k1k2k3k4k5k6k7"
+	"\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
+static const uint16_t operationStringOffset[] = {
+	0,
+	6672,
+	6675,
+	6678,
+	6681,
+	227,
+	20,
+	2582,
+	6428,
+	3426,
+	3434,
+	2390,
+	2399,
+	5878,
+	6462,
+	6684,
+	5883,
+	6687,
+	6687,
+	6690,
+	6693,
+	5888,
+	4259,
+	6699,
+	6702,
+	4081,
+	6705,
+	6452,
+	6708,
+	2019,
+	2317,
+	3217,
+	4088,
+	5918,
+	5923,
+	6677,
+	6714,
+	991,
+	5064,
+	6379,
+	6384,
+	5969,
+	3420,
+	5938,
+	6460,
+	5943,
+	5943,
+	6464,
+	5948,
+	6468,
+	5953,
+	4095,
+	4095,
+	5039,
+	3257,
+	3257,
+	4102,
+	4109,
+	5045,
+	5051,
+	5051,
+	5051,
+	5057,
+	5057,
+	6472,
+	4116,
+	5958,
+	5063,
+	5963,
+	5063,
+	5063,
+	5968,
+	6476,
+	5069,
+	5069,
+	5973,
+	5075,
+	5075,
+	5081,
+	5081,
+	6480,
+	5978,
+	4123,
+	5983,
+	5087,
+	5988,
+	5087,
+	5093,
+	5093,
+	5099,
+	6484,
+	5993,
+	5099,
+	5105,
+	5111,
+	5117,
+	5123,
+	5998,
+	6488,
+	6003,
+	6003,
+	6492,
+	5129,
+	5135,
+	5135,
+	6008,
+	4130,
+	4137,
+	5141,
+	4144,
+	5147,
+	5153,
+	6013,
+	5159,
+	5165,
+	4151,
+	4151,
+	6018,
+	5171,
+	6023,
+	6028,
+	5171,
+	6496,
+	6033,
+	6038,
+	5177,
+	6043,
+	5177,
+	5177,
+	6500,
+	4158,
+	4158,
+	4158,
+	4165,
+	4165,
+	6048,
+	6504,
+	6508,
+	4172,
+	5183,
+	4179,
+	4186,
+	4186,
+	5189,
+	6717,
+	5082,
+	5979,
+	833,
+	4124,
+	4148,
+	6512,
+	6516,
+	6520,
+	5857,
+	5195,
+	6524,
+	6532,
+	6532,
+	6552,
+	6747,
+	3442,
+	6622,
+	4350,
+	6153,
+	1588,
+	5273,
+	6750,
+	6753,
+	5279,
+	6178,
+	5279,
+	6756,
+	5576,
+	5285,
+	1432,
+	5297,
+	5544,
+	2895,
+	2922,
+	4397,
+	4404,
+	3003,
+	3506,
+	2011,
+	6762,
+	5294,
+	6114,
+	3212,
+	6193,
+	2732,
+	2741,
+	2750,
+	2759,
+	5586,
+	5592,
+	5604,
+	5610,
+	5616,
+	5622,
+	5628,
+	4432,
+	4439,
+	3522,
+	3530,
+	3538,
+	2581,
+	4446,
+	6213,
+	5646,
+	4214,
+	5652,
+	2804,
+	3554,
+	3562,
+	3570,
+	3578,
+	3586,
+	2018,
+	2028,
+	3594,
+	3602,
+	3610,
+	3618,
+	2038,
+	2048,
+	6218,
+	6223,
+	6228,
+	6233,
+	4221,
+	4228,
+	4235,
+	6238,
+	6243,
+	6248,
+	5309,
+	4242,
+	3385,
+	3385,
+	3393,
+	5315,
+	3401,
+	3409,
+	3409,
+	5321,
+	5321,
+	4530,
+	3690,
+	4537,
+	1483,
+	4544,
+	3698,
+	4551,
+	6253,
+	6258,
+	3722,
+	2118,
+	4586,
+	4593,
+	4607,
+	4614,
+	4621,
+	4635,
+	4642,
+	4649,
+	4663,
+	4670,
+	4677,
+	4691,
+	4740,
+	3056,
+	4249,
+	3842,
+	4747,
+	4754,
+	4768,
+	3850,
+	5327,
+	5327,
+	6409,
+	2572,
+	4810,
+	4824,
+	4831,
+	4838,
+	4845,
+	4845,
+	5730,
+	5736,
+	5742,
+	5754,
+	4894,
+	4894,
+	5760,
+	5766,
+	5772,
+	5778,
+	5784,
+	5790,
+	4922,
+	4929,
+	3874,
+	3882,
+	5339,
+	3065,
+	2168,
+	2178,
+	1538,
+	2188,
+	1549,
+	5345,
+	5796,
+	6278,
+	6283,
+	5363,
+	6580,
+	6584,
+	6765,
+	6768,
+	4776,
+	4790,
+	3994,
+	3986,
+	6771,
+	6592,
+	6596,
+	6600,
+	6774,
+	5369,
+	6620,
+	6620,
+	6628,
+	6628,
+	230,
+	6024,
+	949,
+	99,
+	4034,
+	4256,
+	3417,
+	4263,
+	5381,
+	3066,
+	6777,
+	5549,
+	4424,
+	5855,
+	6418,
+	4091,
+	6668,
+	6660,
+	5797,
+	3208,
+	4065,
+	4328,
+	4321,
+	5400,
+	5406,
+	2354,
+	2363,
+	4299,
+	4292,
+	2591,
+	2582,
+	6696,
+	6456,
+	6444,
+	5903,
+	5913,
+	5436,
+	5908,
+	5893,
+	5015,
+	4096,
+	4997,
+	5040,
+	4103,
+	4096,
+	4997,
+	5898,
+	5021,
+	5027,
+	5033,
+	5009,
+	5003,
+	5009,
+	5003,
+	6456,
+	6444,
+	6711,
+	5454,
+	5448,
+	5460,
+	5466,
+	4644,
+	4665,
+	4651,
+	4658,
+	6528,
+	6053,
+	6058,
+	6780,
+	6735,
+	6723,
+	6720,
+	6053,
+	6732,
+	6723,
+	6720,
+	6782,
+	6738,
+	6741,
+	6744,
+	6729,
+	6726,
+	6729,
+	6726,
+	6158,
+	6173,
+	6163,
+	6168,
+	5484,
+	5478,
+	4594,
+	5496,
+	5520,
+	5514,
+	4650,
+	5532,
+	1432,
+	2143,
+	6183,
+	3827,
+	3787,
+	3803,
+	5562,
+	5556,
+	5568,
+	5574,
+	5851,
+	5845,
+	6193,
+	6208,
+	6198,
+	6203,
+	4509,
+	4516,
+	4565,
+	4572,
+	6263,
+	6263,
+	6268,
+	6268,
+	6273,
+	5345,
+	5345,
+	5351,
+	5351,
+	5357,
+	5808,
+	5814,
+	4018,
+	4026,
+	6288,
+	6303,
+	6293,
+	6298,
+	6608,
+	6333,
+	5868,
+	6308,
+	6604,
+	6328,
+	6313,
+	6308,
+	6612,
+	6338,
+	6343,
+	6348,
+	6323,
+	6318,
+	6323,
+	6318,
+	4019,
+	4950,
+	4964,
+	4027,
+	6353,
+	6368,
+	6358,
+	6363,
+	2366,
+	2357,
+	5832,
+	5838,
+	5850,
+	5844,
+	5424,
+	5430,
+	5442,
+	4043,
+	4051,
+	2408,
+	2417,
+	2426,
+	3225,
+	2435,
+	3233,
+	3241,
+	2462,
+	2471,
+	3249,
+	2516,
+	2525,
+	2534,
+	2543,
+	2552,
+	2561,
+	1738,
+	2326,
+	1758,
+	2335,
+	1778,
+	1788,
+	1858,
+	4320,
+	4327,
+	4334,
+	4341,
+	2633,
+	5472,
+	6556,
+	6560,
+	6564,
+	6568,
+	6759,
+	2139,
+	1428,
+	5291,
+	4193,
+	4355,
+	4362,
+	3458,
+	4200,
+	2642,
+	1432,
+	3474,
+	4369,
+	4376,
+	2714,
+	2723,
+	3482,
+	4383,
+	4390,
+	2687,
+	2696,
+	2705,
+	2705,
+	3490,
+	3498,
+	5303,
+	4207,
+	6188,
+	4558,
+	4579,
+	4502,
+	4523,
+	2885,
+	2894,
+	2903,
+	2921,
+	2912,
+	2930,
+	2939,
+	3002,
+	3011,
+	3029,
+	3020,
+	3038,
+	3047,
+	976,
+	976,
+	1647,
+	1657,
+	1667,
+	2344,
+	4817,
+	3858,
+	3866,
+	5333,
+	2198,
+	2208,
+	2218,
+	4002,
+	4010,
+	6616,
+	6636,
+	6640,
+	4936,
+	4943,
+	6644,
+	2023,
+	5375,
+	4042,
+	4050,
+	3173,
+	3182,
+	3191,
+	3200,
+	6652,
+	6656,
+	5501,
+	4347,
+	3449,
+	4410,
+	4417,
+	3513,
+	5579,
+	6393,
+	5861,
+	5867,
+	6448,
+	6648,
+	5928,
+	5507,
+	6664,
+	6423,
+	5933,
+	5363,
+	3707,
+	6373,
+	4097,
+	3208,
+	4065,
+	4073,
+	3208,
+	4065,
+	4073,
+	4403,
+	4396,
+	5537,
+	5543,
+	3473,
+	4389,
+	4382,
+	3457,
+	2722,
+	3199,
+	3190,
+	3181,
+	3172,
+	3481,
+	4375,
+	4368,
+	2713,
+	4361,
+	4354,
+	2533,
+	2542,
+	3497,
+	3489,
+	1777,
+	1787,
+	2515,
+	2560,
+	4049,
+	4041,
+	4312,
+	4305,
+	2695,
+	2686,
+	4956,
+	4949,
+	4963,
+	4970,
+	4017,
+	4025,
+	5807,
+	5813,
+	5417,
+	5411,
+	4298,
+	4291,
+	6403,
+	6398,
+	5849,
+	5843,
+	5393,
+	5387,
+	5399,
+	5405,
+	5561,
+	5555,
+	5567,
+	5573,
+	2470,
+	2434,
+	2524,
+	2551,
+	2416,
+	2461,
+	1757,
+	5825,
+	5819,
+	5831,
+	5837,
+	5519,
+	5513,
+	5525,
+	5531,
+	5453,
+	5447,
+	5459,
+	5465,
+	5483,
+	5477,
+	5489,
+	5495,
+	2197,
+	2217,
+	2207,
+	2740,
+	3593,
+	3617,
+	3601,
+	2758,
+	2167,
+	2187,
+	2177,
+	2731,
+	1548,
+	1537,
+	2641,
+	6388,
+	2641,
+	2659,
+	4816,
+	3865,
+	3857,
+	3561,
+	3585,
+	3569,
+	2307,
+	4057,
+	4319,
+	4326,
+	4333,
+	4340,
+	5429,
+	5423,
+	5435,
+	5441,
+	4578,
+	4522,
+	4942,
+	4935,
+	2353,
+	2362,
+	2884,
+	1737,
+	2425,
+	2407,
+	2704,
+	5471,
+	1427,
+	5765,
+	4893,
+	5759,
+	5753,
+	5741,
+	5735,
+	4844,
+	5729,
+	5621,
+	4767,
+	3873,
+	3881,
+	4669,
+	4445,
+	3521,
+	3529,
+	4613,
+	4445,
+	5645,
+	5651,
+	3841,
+	4746,
+	4921,
+	4928,
+	4662,
+	6408,
+	4431,
+	4438,
+	4606,
+	5795,
+	3849,
+	3721,
+	4802,
+	5771,
+	5789,
+	5777,
+	5783,
+	5609,
+	5627,
+	5615,
+	4809,
+	4536,
+	4529,
+	3689,
+	2117,
+	4550,
+	4543,
+	3697,
+	4823,
+	4837,
+	4830,
+	3055,
+	2839,
+	2830,
+	4984,
+	4977,
+	2452,
+	4494,
+	3064,
+	508,
+	496,
+	196,
+	5585,
+	5603,
+	5591,
+	2911,
+	2893,
+	2902,
+	2929,
+	2938,
+	2920,
+	3019,
+	3001,
+	3010,
+	3037,
+	3046,
+	3028,
+	4739,
+	3577,
+	2704,
+	2749,
+	1997,
+	1987,
+	5687,
+	3609,
+	4641,
+	4648,
+	4690,
+	4676,
+	4585,
+	4592,
+	4634,
+	4620,
+	4753,
+	1482,
+	4900,
+	4907,
+	4872,
+	4851,
+	4858,
+	940,
+	952,
+	210,
+	928,
+	964,
+	2127,
+	2137,
+	2077,
+	2087,
+	2097,
+	2107,
+	1917,
+	1907,
+	1937,
+	1927,
+	238,
+	224,
+	322,
+	308,
+	1152,
+	1141,
+	1174,
+	1163,
+	1284,
+	1273,
+	1306,
+	1295,
+	556,
+	544,
+	580,
+	568,
+	700,
+	688,
+	724,
+	712,
+	266,
+	252,
+	350,
+	336,
+	1196,
+	1185,
+	1218,
+	1207,
+	1328,
+	1317,
+	1350,
+	1339,
+	604,
+	592,
+	628,
+	616,
+	748,
+	736,
+	772,
+	760,
+	294,
+	280,
+	378,
+	364,
+	1240,
+	1229,
+	1262,
+	1251,
+	1372,
+	1361,
+	1394,
+	1383,
+	652,
+	640,
+	676,
+	664,
+	796,
+	784,
+	820,
+	808,
+	4270,
+	998,
+	998,
+	987,
+	987,
+	4292,
+	6440,
+	6576,
+	4502,
+	6572,
+	5873,
+	6624,
+	6632,
+	6600,
+	5693,
+	4487,
+	3545,
+	2057,
+	3993,
+	3985,
+	4009,
+	4001,
+	3433,
+	3425,
+	3553,
+	3537,
+	4501,
+	4508,
+	4515,
+	1857,
+	1405,
+	520,
+	2479,
+	4557,
+	2632,
+	4564,
+	4571,
+	1416,
+	532,
+	6383,
+	6378,
+	3505,
+	2007,
+	2067,
+	2398,
+	2389,
+	2803,
+	2027,
+	2017,
+	2047,
+	2037,
+	0,
+	6588,
+	4893,
+	4844,
+	6432,
+	4991,
+	6436,
+	3441,
+	4033,
+	6098,
+	6093,
+	6083,
+	6088,
+	5219,
+	5213,
+	5201,
+	5207,
+	6548,
+	6544,
+	6536,
+	6540,
+	5267,
+	5261,
+	5249,
+	5255,
+	6148,
+	6143,
+	6133,
+	6138,
+	6078,
+	6073,
+	6063,
+	6068,
+	6128,
+	6123,
+	6113,
+	6118,
+	3377,
+	3369,
+	3361,
+	6108,
+	6103,
+	1431,
+	2142,
+	3289,
+	3281,
+	3265,
+	3273,
+	5243,
+	5237,
+	5225,
+	5231,
+	3329,
+	3353,
+	3337,
+	3345,
+	3297,
+	3321,
+	3305,
+	3313,
+	2506,
+	2641,
+	2650,
+	2668,
+	2677,
+	3465,
+	2659,
+	1053,
+	1031,
+	1064,
+	1042,
+	1086,
+	1075,
+	1697,
+	1677,
+	1707,
+	1687,
+	1727,
+	1717,
+	1767,
+	1747,
+	1797,
+	1817,
+	1807,
+	1827,
+	2488,
+	2443,
+	1847,
+	1837,
+	5747,
+	2497,
+	5633,
+	5639,
+	4445,
+	4452,
+	6408,
+	6413,
+	5795,
+	5801,
+	4914,
+	4886,
+	4865,
+	4788,
+	4795,
+	4774,
+	4781,
+	2992,
+	2947,
+	2965,
+	2956,
+	2983,
+	2974,
+	3825,
+	3785,
+	3801,
+	3793,
+	3817,
+	3809,
+	4732,
+	4697,
+	4711,
+	4704,
+	4725,
+	4718,
+	16,
+	31,
+	61,
+	46,
+	76,
+	5597,
+	3889,
+	3913,
+	3064,
+	3091,
+	3897,
+	3905,
+	3073,
+	3082,
+	3745,
+	3769,
+	3729,
+	3833,
+	166,
+	3145,
+	3136,
+	3163,
+	3154,
+	3753,
+	3761,
+	3737,
+	3777,
+	181,
+	4655,
+	4683,
+	4599,
+	4627,
+	4760,
+	2605,
+	2596,
+	2623,
+	2614,
+	3705,
+	3713,
+	4879,
+	3961,
+	3953,
+	3977,
+	3969,
+	2237,
+	2227,
+	2257,
+	2247,
+	91,
+	106,
+	136,
+	121,
+	151,
+	2776,
+	2785,
+	2380,
+	2371,
+	2767,
+	2794,
+	3625,
+	3649,
+	3633,
+	3641,
+	2821,
+	2812,
+	3657,
+	3681,
+	3665,
+	3673,
+	2857,
+	2848,
+	2587,
+	2578,
+	2866,
+	2875,
+	1020,
+	1009,
+	1438,
+	1449,
+	5681,
+	5699,
+	1493,
+	1504,
+	1515,
+	1526,
+	1614,
+	1603,
+	1636,
+	1625,
+	1460,
+	1471,
+	4277,
+	4284,
+	1570,
+	1559,
+	1592,
+	1581,
+	832,
+	856,
+	392,
+	418,
+	844,
+	868,
+	405,
+	431,
+	880,
+	904,
+	444,
+	470,
+	892,
+	916,
+	457,
+	483,
+	4466,
+	4473,
+	5663,
+	5669,
+	2267,
+	2277,
+	2147,
+	2157,
+	1957,
+	1947,
+	1977,
+	1967,
+	4459,
+	4480,
+	5657,
+	5675,
+	2569,
+	2287,
+	2297,
+	3929,
+	3921,
+	3945,
+	3937,
+	1108,
+	1097,
+	1130,
+	1119,
+	3109,
+	3100,
+	3127,
+	3118,
+	1877,
+	1867,
+	1897,
+	1887,
+	5717,
+	5705,
+	5723,
+	5711
 };
-static const char* operandString[] = {
-	"",
-	"",
-	"",
-	"al",
-	"cl",
-	"dl",
-	"bl",
-	"ah",
-	"ch",
-	"dh",
-	"bh",
-	"spl",
-	"bpl",
-	"sil",
-	"dil",
-	"r8b",
-	"r9b",
-	"r10b",
-	"r11b",
-	"r12b",
-	"r13b",
-	"r14b",
-	"r15b",
-	"ax",
-	"cx",
-	"dx",
-	"bx",
-	"sp",
-	"bp",
-	"si",
-	"di",
-	"r8w",
-	"r9w",
-	"r10w",
-	"r11w",
-	"r12w",
-	"r13w",
-	"r14w",
-	"r15w",
-	"eax",
-	"ecx",
-	"edx",
-	"ebx",
-	"esp",
-	"ebp",
-	"esi",
-	"edi",
-	"r8d",
-	"r9d",
-	"r10d",
-	"r11d",
-	"r12d",
-	"r13d",
-	"r14d",
-	"r15d",
-	"rax",
-	"rcx",
-	"rdx",
-	"rbx",
-	"rsp",
-	"rbp",
-	"rsi",
-	"rdi",
-	"r8",
-	"r9",
-	"r10",
-	"r11",
-	"r12",
-	"r13",
-	"r14",
-	"r15",
-	"st0",
-	"st1",
-	"st2",
-	"st3",
-	"st4",
-	"st5",
-	"st6",
-	"st7",
-	"mm0",
-	"mm1",
-	"mm2",
-	"mm3",
-	"mm4",
-	"mm5",
-	"mm6",
-	"mm7",
-	"xmm0",
-	"xmm1",
-	"xmm2",
-	"xmm3",
-	"xmm4",
-	"xmm5",
-	"xmm6",
-	"xmm7",
-	"xmm8",
-	"xmm9",
-	"xmm10",
-	"xmm11",
-	"xmm12",
-	"xmm13",
-	"xmm14",
-	"xmm15",
-	"cr0",
-	"cr1",
-	"cr2",
-	"cr3",
-	"cr4",
-	"cr5",
-	"cr6",
-	"cr7",
-	"cr8",
-	"cr9",
-	"cr10",
-	"cr11",
-	"cr12",
-	"cr13",
-	"cr14",
-	"cr15",
-	"dr0",
-	"dr1",
-	"dr2",
-	"dr3",
-	"dr4",
-	"dr5",
-	"dr6",
-	"dr7",
-	"dr8",
-	"dr9",
-	"dr10",
-	"dr11",
-	"dr12",
-	"dr13",
-	"dr14",
-	"dr15",
-	"tr0",
-	"tr1",
-	"tr2",
-	"tr3",
-	"tr4",
-	"tr5",
-	"tr6",
-	"tr7",
-	"tr8",
-	"tr9",
-	"tr10",
-	"tr11",
-	"tr12",
-	"tr13",
-	"tr14",
-	"tr15",
-	"es",
-	"cs",
-	"ss",
-	"ds",
-	"fs",
-	"gs",
-	"rip"
+static const uint8_t operationStringLength[] = {
+	0,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	7,
+	7,
+	8,
+	8,
+	5,
+	3,
+	3,
+	5,
+	2,
+	3,
+	3,
+	3,
+	5,
+	4,
+	3,
+	3,
+	7,
+	3,
+	4,
+	3,
+	3,
+	9,
+	8,
+	7,
+	5,
+	5,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	5,
+	5,
+	4,
+	4,
+	5,
+	4,
+	5,
+	4,
+	5,
+	6,
+	7,
+	6,
+	7,
+	8,
+	7,
+	7,
+	6,
+	4,
+	5,
+	6,
+	5,
+	6,
+	4,
+	7,
+	5,
+	4,
+	5,
+	5,
+	6,
+	5,
+	4,
+	5,
+	6,
+	5,
+	5,
+	6,
+	5,
+	6,
+	4,
+	5,
+	7,
+	5,
+	4,
+	5,
+	6,
+	5,
+	6,
+	3,
+	4,
+	5,
+	6,
+	6,
+	6,
+	6,
+	6,
+	5,
+	4,
+	4,
+	5,
+	4,
+	6,
+	5,
+	6,
+	5,
+	7,
+	7,
+	6,
+	7,
+	6,
+	6,
+	5,
+	6,
+	6,
+	4,
+	7,
+	5,
+	3,
+	5,
+	5,
+	6,
+	4,
+	5,
+	5,
+	4,
+	5,
+	5,
+	6,
+	4,
+	5,
+	6,
+	7,
+	6,
+	7,
+	5,
+	4,
+	4,
+	7,
+	6,
+	7,
+	5,
+	7,
+	6,
+	3,
+	4,
+	4,
+	2,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	6,
+	4,
+	4,
+	3,
+	4,
+	3,
+	7,
+	3,
+	3,
+	5,
+	3,
+	6,
+	3,
+	3,
+	4,
+	5,
+	6,
+	3,
+	3,
+	6,
+	3,
+	6,
+	5,
+	5,
+	6,
+	6,
+	6,
+	5,
+	7,
+	3,
+	3,
+	3,
+	3,
+	2,
+	3,
+	8,
+	8,
+	8,
+	8,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	6,
+	6,
+	7,
+	7,
+	7,
+	4,
+	5,
+	5,
+	5,
+	7,
+	5,
+	8,
+	7,
+	7,
+	7,
+	7,
+	7,
+	9,
+	9,
+	7,
+	7,
+	7,
+	7,
+	9,
+	9,
+	5,
+	5,
+	5,
+	5,
+	7,
+	7,
+	7,
+	5,
+	5,
+	5,
+	6,
+	7,
+	5,
+	8,
+	8,
+	6,
+	8,
+	7,
+	8,
+	5,
+	6,
+	6,
+	7,
+	6,
+	10,
+	6,
+	7,
+	6,
+	5,
+	5,
+	7,
+	9,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	8,
+	7,
+	7,
+	6,
+	6,
+	6,
+	7,
+	3,
+	6,
+	3,
+	6,
+	6,
+	6,
+	6,
+	6,
+	5,
+	6,
+	5,
+	5,
+	5,
+	5,
+	5,
+	6,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	6,
+	6,
+	7,
+	7,
+	6,
+	5,
+	9,
+	9,
+	10,
+	9,
+	10,
+	4,
+	4,
+	5,
+	5,
+	5,
+	4,
+	4,
+	3,
+	3,
+	3,
+	3,
+	7,
+	7,
+	3,
+	4,
+	4,
+	3,
+	3,
+	6,
+	3,
+	4,
+	3,
+	4,
+	3,
+	3,
+	3,
+	3,
+	7,
+	7,
+	8,
+	7,
+	6,
+	4,
+	3,
+	6,
+	7,
+	6,
+	5,
+	4,
+	4,
+	4,
+	3,
+	6,
+	5,
+	5,
+	5,
+	5,
+	5,
+	8,
+	8,
+	6,
+	6,
+	5,
+	5,
+	3,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	5,
+	6,
+	5,
+	6,
+	5,
+	6,
+	6,
+	5,
+	5,
+	6,
+	6,
+	6,
+	5,
+	6,
+	6,
+	5,
+	3,
+	3,
+	3,
+	5,
+	5,
+	5,
+	5,
+	4,
+	4,
+	4,
+	4,
+	4,
+	5,
+	5,
+	2,
+	3,
+	2,
+	3,
+	2,
+	3,
+	3,
+	2,
+	2,
+	3,
+	3,
+	3,
+	2,
+	3,
+	3,
+	2,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	6,
+	6,
+	6,
+	6,
+	4,
+	5,
+	4,
+	5,
+	5,
+	5,
+	6,
+	5,
+	6,
+	6,
+	5,
+	5,
+	7,
+	7,
+	5,
+	5,
+	5,
+	5,
+	4,
+	5,
+	4,
+	5,
+	4,
+	5,
+	5,
+	4,
+	4,
+	5,
+	5,
+	5,
+	4,
+	5,
+	5,
+	4,
+	6,
+	6,
+	6,
+	6,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	6,
+	6,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	6,
+	6,
+	6,
+	6,
+	8,
+	5,
+	4,
+	4,
+	4,
+	4,
+	3,
+	8,
+	10,
+	6,
+	7,
+	6,
+	6,
+	7,
+	7,
+	6,
+	6,
+	7,
+	6,
+	6,
+	8,
+	8,
+	7,
+	6,
+	6,
+	8,
+	8,
+	7,
+	8,
+	7,
+	7,
+	6,
+	7,
+	5,
+	6,
+	6,
+	6,
+	6,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	11,
+	10,
+	10,
+	10,
+	9,
+	6,
+	7,
+	7,
+	6,
+	9,
+	9,
+	9,
+	7,
+	7,
+	4,
+	4,
+	4,
+	6,
+	6,
+	4,
+	3,
+	6,
+	7,
+	7,
+	8,
+	8,
+	8,
+	8,
+	4,
+	4,
+	6,
+	7,
+	8,
+	7,
+	7,
+	8,
+	6,
+	5,
+	6,
+	6,
+	4,
+	4,
+	5,
+	6,
+	4,
+	5,
+	5,
+	6,
+	5,
+	5,
+	5,
+	7,
+	6,
+	6,
+	9,
+	8,
+	8,
+	7,
+	7,
+	6,
+	6,
+	8,
+	7,
+	7,
+	8,
+	9,
+	9,
+	9,
+	9,
+	9,
+	8,
+	7,
+	7,
+	9,
+	7,
+	7,
+	9,
+	9,
+	8,
+	8,
+	10,
+	10,
+	9,
+	9,
+	8,
+	8,
+	7,
+	7,
+	9,
+	9,
+	7,
+	7,
+	7,
+	7,
+	8,
+	8,
+	6,
+	6,
+	6,
+	6,
+	7,
+	7,
+	5,
+	5,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	10,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	10,
+	10,
+	10,
+	9,
+	8,
+	8,
+	8,
+	9,
+	10,
+	10,
+	10,
+	9,
+	11,
+	11,
+	5,
+	5,
+	7,
+	7,
+	7,
+	8,
+	8,
+	8,
+	8,
+	8,
+	10,
+	8,
+	7,
+	7,
+	7,
+	7,
+	6,
+	6,
+	6,
+	6,
+	7,
+	7,
+	7,
+	7,
+	9,
+	9,
+	9,
+	10,
+	9,
+	9,
+	8,
+	6,
+	11,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	7,
+	8,
+	8,
+	7,
+	5,
+	8,
+	8,
+	7,
+	6,
+	6,
+	6,
+	8,
+	7,
+	7,
+	7,
+	7,
+	4,
+	7,
+	7,
+	7,
+	5,
+	8,
+	8,
+	7,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	6,
+	7,
+	7,
+	7,
+	8,
+	10,
+	7,
+	7,
+	8,
+	7,
+	7,
+	7,
+	9,
+	9,
+	9,
+	7,
+	7,
+	9,
+	7,
+	6,
+	12,
+	12,
+	14,
+	6,
+	6,
+	6,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	7,
+	8,
+	9,
+	9,
+	10,
+	10,
+	6,
+	8,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	11,
+	7,
+	7,
+	7,
+	7,
+	7,
+	12,
+	12,
+	14,
+	12,
+	12,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	14,
+	14,
+	14,
+	14,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	14,
+	14,
+	14,
+	14,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	14,
+	14,
+	14,
+	14,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	12,
+	7,
+	7,
+	11,
+	7,
+	11,
+	4,
+	4,
+	4,
+	4,
+	4,
+	5,
+	4,
+	4,
+	4,
+	6,
+	7,
+	8,
+	10,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	7,
+	7,
+	7,
+	10,
+	11,
+	12,
+	9,
+	7,
+	9,
+	7,
+	7,
+	11,
+	12,
+	5,
+	5,
+	8,
+	10,
+	10,
+	9,
+	9,
+	9,
+	10,
+	10,
+	10,
+	10,
+	16,
+	4,
+	7,
+	7,
+	4,
+	6,
+	4,
+	8,
+	8,
+	5,
+	5,
+	5,
+	5,
+	6,
+	6,
+	6,
+	6,
+	4,
+	4,
+	4,
+	4,
+	6,
+	6,
+	6,
+	6,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	8,
+	8,
+	8,
+	5,
+	5,
+	5,
+	5,
+	8,
+	8,
+	8,
+	8,
+	6,
+	6,
+	6,
+	6,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	9,
+	9,
+	9,
+	9,
+	9,
+	8,
+	9,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	9,
+	9,
+	10,
+	10,
+	6,
+	9,
+	6,
+	6,
+	7,
+	7,
+	5,
+	5,
+	6,
+	6,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	7,
+	7,
+	7,
+	7,
+	7,
+	7,
+	15,
+	15,
+	15,
+	15,
+	15,
+	6,
+	8,
+	8,
+	9,
+	9,
+	8,
+	8,
+	9,
+	9,
+	8,
+	8,
+	8,
+	8,
+	15,
+	9,
+	9,
+	9,
+	9,
+	8,
+	8,
+	8,
+	8,
+	15,
+	7,
+	7,
+	7,
+	7,
+	7,
+	9,
+	9,
+	9,
+	9,
+	8,
+	8,
+	7,
+	8,
+	8,
+	8,
+	8,
+	10,
+	10,
+	10,
+	10,
+	15,
+	15,
+	15,
+	15,
+	15,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	8,
+	8,
+	8,
+	8,
+	9,
+	9,
+	8,
+	8,
+	8,
+	8,
+	9,
+	9,
+	9,
+	9,
+	9,
+	9,
+	11,
+	11,
+	11,
+	11,
+	6,
+	6,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	11,
+	7,
+	7,
+	11,
+	11,
+	11,
+	11,
+	12,
+	12,
+	13,
+	13,
+	12,
+	12,
+	13,
+	13,
+	12,
+	12,
+	13,
+	13,
+	12,
+	12,
+	13,
+	13,
+	7,
+	7,
+	6,
+	6,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	7,
+	7,
+	6,
+	6,
+	9,
+	10,
+	10,
+	8,
+	8,
+	8,
+	8,
+	11,
+	11,
+	11,
+	11,
+	9,
+	9,
+	9,
+	9,
+	10,
+	10,
+	10,
+	10,
+	6,
+	6,
+	6,
+	6
+};
+static const uint16_t operandStringOffset[] = {
+	0,
+	0,
+	0,
+	1565,
+	993,
+	5107,
+	2372,
+	6553,
+	982,
+	7491,
+	7489,
+	7435,
+	7318,
+	7432,
+	7348,
+	7396,
+	7402,
+	7162,
+	7170,
+	7178,
+	7186,
+	7194,
+	7202,
+	4588,
+	6055,
+	5860,
+	7385,
+	1017,
+	2359,
+	12,
+	4147,
+	7399,
+	7405,
+	7166,
+	7174,
+	7182,
+	7190,
+	7198,
+	7206,
+	7378,
+	6054,
+	7390,
+	7384,
+	7393,
+	7381,
+	4272,
+	7387,
+	7373,
+	7346,
+	7139,
+	7143,
+	7147,
+	7151,
+	7155,
+	7135,
+	7408,
+	6059,
+	7420,
+	7414,
+	7429,
+	7411,
+	7426,
+	7417,
+	7343,
+	7346,
+	7115,
+	7119,
+	7123,
+	7127,
+	7131,
+	7135,
+	7438,
+	7441,
+	7444,
+	7447,
+	7450,
+	7453,
+	7456,
+	7459,
+	7235,
+	6785,
+	6835,
+	6885,
+	7239,
+	7243,
+	7247,
+	7251,
+	7234,
+	6784,
+	6834,
+	6884,
+	7238,
+	7242,
+	7246,
+	7250,
+	7254,
+	7258,
+	6784,
+	6789,
+	6794,
+	6799,
+	6804,
+	6809,
+	6814,
+	6819,
+	6824,
+	6829,
+	6834,
+	6839,
+	6844,
+	6849,
+	6854,
+	6859,
+	6864,
+	6869,
+	6874,
+	6879,
+	6884,
+	6889,
+	7262,
+	6894,
+	6944,
+	6994,
+	7266,
+	7270,
+	7274,
+	7278,
+	7282,
+	7286,
+	6894,
+	6899,
+	6904,
+	6909,
+	6914,
+	6919,
+	6924,
+	6929,
+	6934,
+	6939,
+	6944,
+	6949,
+	6954,
+	6959,
+	6964,
+	6969,
+	6974,
+	6979,
+	6984,
+	6989,
+	6994,
+	6999,
+	7290,
+	7004,
+	7054,
+	7104,
+	7294,
+	7298,
+	7302,
+	7306,
+	7310,
+	7314,
+	7004,
+	7009,
+	7014,
+	7019,
+	7024,
+	7029,
+	7034,
+	7039,
+	7044,
+	7049,
+	7054,
+	7059,
+	7064,
+	7069,
+	7074,
+	7079,
+	7084,
+	7089,
+	7094,
+	7099,
+	7104,
+	7109,
+	7493,
+	7495,
+	7497,
+	7499,
+	7501,
+	7503,
+	7505,
+	7507,
+	7321,
+	7114,
+	7324,
+	7327,
+	7330,
+	7333,
+	7336,
+	7339,
+	7342,
+	7345,
+	7114,
+	7118,
+	7122,
+	7126,
+	7130,
+	7134,
+	7351,
+	7138,
+	7354,
+	7357,
+	7360,
+	7363,
+	7366,
+	7369,
+	7372,
+	7375,
+	7138,
+	7142,
+	7146,
+	7150,
+	7154,
+	7158,
+	7462,
+	7210,
+	7465,
+	7468,
+	7471,
+	7474,
+	7477,
+	7480,
+	7483,
+	7486,
+	7210,
+	7214,
+	7218,
+	7222,
+	7226,
+	7230,
+	2,
+	3446,
+	11,
+	229,
+	3160,
+	5379,
+	7423
+};
+static const uint8_t operandStringLength[] = {
+	0,
+	0,
+	0,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	2,
+	2,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	3,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	2,
+	2,
+	2,
+	2,
+	2,
+	2,
+	3
+};
+static const uint64_t operandRegisterMask[] = {
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x1ULL,
+	0x2ULL,
+	0x4ULL,
+	0x8ULL,
+	0x1ULL,
+	0x2ULL,
+	0x4ULL,
+	0x8ULL,
+	0x10ULL,
+	0x20ULL,
+	0x40ULL,
+	0x80ULL,
+	0x100ULL,
+	0x200ULL,
+	0x400ULL,
+	0x800ULL,
+	0x1000ULL,
+	0x2000ULL,
+	0x4000ULL,
+	0x8000ULL,
+	0x1ULL,
+	0x2ULL,
+	0x4ULL,
+	0x8ULL,
+	0x10ULL,
+	0x20ULL,
+	0x40ULL,
+	0x80ULL,
+	0x100ULL,
+	0x200ULL,
+	0x400ULL,
+	0x800ULL,
+	0x1000ULL,
+	0x2000ULL,
+	0x4000ULL,
+	0x8000ULL,
+	0x1ULL,
+	0x2ULL,
+	0x4ULL,
+	0x8ULL,
+	0x10ULL,
+	0x20ULL,
+	0x40ULL,
+	0x80ULL,
+	0x100ULL,
+	0x200ULL,
+	0x400ULL,
+	0x800ULL,
+	0x1000ULL,
+	0x2000ULL,
+	0x4000ULL,
+	0x8000ULL,
+	0x1ULL,
+	0x2ULL,
+	0x4ULL,
+	0x8ULL,
+	0x10ULL,
+	0x20ULL,
+	0x40ULL,
+	0x80ULL,
+	0x100ULL,
+	0x200ULL,
+	0x400ULL,
+	0x800ULL,
+	0x1000ULL,
+	0x2000ULL,
+	0x4000ULL,
+	0x8000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x1000000000000ULL,
+	0x10000ULL,
+	0x20000ULL,
+	0x40000ULL,
+	0x80000ULL,
+	0x100000ULL,
+	0x200000ULL,
+	0x400000ULL,
+	0x800000ULL,
+	0x1000000ULL,
+	0x2000000ULL,
+	0x4000000ULL,
+	0x8000000ULL,
+	0x10000000ULL,
+	0x20000000ULL,
+	0x40000000ULL,
+	0x80000000ULL,
+	0x100000000ULL,
+	0x200000000ULL,
+	0x400000000ULL,
+	0x800000000ULL,
+	0x1000000000ULL,
+	0x2000000000ULL,
+	0x4000000000ULL,
+	0x8000000000ULL,
+	0x10000000000ULL,
+	0x20000000000ULL,
+	0x40000000000ULL,
+	0x80000000000ULL,
+	0x100000000000ULL,
+	0x200000000000ULL,
+	0x400000000000ULL,
+	0x800000000000ULL,
+	0x10000ULL,
+	0x20000ULL,
+	0x40000ULL,
+	0x80000ULL,
+	0x100000ULL,
+	0x200000ULL,
+	0x400000ULL,
+	0x800000ULL,
+	0x1000000ULL,
+	0x2000000ULL,
+	0x4000000ULL,
+	0x8000000ULL,
+	0x10000000ULL,
+	0x20000000ULL,
+	0x40000000ULL,
+	0x80000000ULL,
+	0x100000000ULL,
+	0x200000000ULL,
+	0x400000000ULL,
+	0x800000000ULL,
+	0x1000000000ULL,
+	0x2000000000ULL,
+	0x4000000000ULL,
+	0x8000000000ULL,
+	0x10000000000ULL,
+	0x20000000000ULL,
+	0x40000000000ULL,
+	0x80000000000ULL,
+	0x100000000000ULL,
+	0x200000000000ULL,
+	0x400000000000ULL,
+	0x800000000000ULL,
+	0x10000ULL,
+	0x20000ULL,
+	0x40000ULL,
+	0x80000ULL,
+	0x100000ULL,
+	0x200000ULL,
+	0x400000ULL,
+	0x800000ULL,
+	0x1000000ULL,
+	0x2000000ULL,
+	0x4000000ULL,
+	0x8000000ULL,
+	0x10000000ULL,
+	0x20000000ULL,
+	0x40000000ULL,
+	0x80000000ULL,
+	0x100000000ULL,
+	0x200000000ULL,
+	0x400000000ULL,
+	0x800000000ULL,
+	0x1000000000ULL,
+	0x2000000000ULL,
+	0x4000000000ULL,
+	0x8000000000ULL,
+	0x10000000000ULL,
+	0x20000000000ULL,
+	0x40000000000ULL,
+	0x80000000000ULL,
+	0x100000000000ULL,
+	0x200000000000ULL,
+	0x400000000000ULL,
+	0x800000000000ULL,
+	0x100000000000000ULL,
+	0x200000000000000ULL,
+	0x400000000000000ULL,
+	0x800000000000000ULL,
+	0x1000000000000000ULL,
+	0x2000000000000000ULL,
+	0x4000000000000000ULL,
+	0x8000000000000000ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL,
+	0x0ULL
+};
+const RegisterInfo asmx86RegisterInfo[] = {
+	{0, 0, 0},
+	{0, 0, 0},
+	{0, 0, 0},
+	{55, 0, 1},
+	{56, 0, 1},
+	{57, 0, 1},
+	{58, 0, 1},
+	{55, 1, 1},
+	{56, 1, 1},
+	{57, 1, 1},
+	{58, 1, 1},
+	{59, 0, 1},
+	{60, 0, 1},
+	{61, 0, 1},
+	{62, 0, 1},
+	{63, 0, 1},
+	{64, 0, 1},
+	{65, 0, 1},
+	{66, 0, 1},
+	{67, 0, 1},
+	{68, 0, 1},
+	{69, 0, 1},
+	{70, 0, 1},
+	{55, 0, 2},
+	{56, 0, 2},
+	{57, 0, 2},
+	{58, 0, 2},
+	{59, 0, 2},
+	{60, 0, 2},
+	{61, 0, 2},
+	{62, 0, 2},
+	{63, 0, 2},
+	{64, 0, 2},
+	{65, 0, 2},
+	{66, 0, 2},
+	{67, 0, 2},
+	{68, 0, 2},
+	{69, 0, 2},
+	{70, 0, 2},
+	{55, 0, 4},
+	{56, 0, 4},
+	{57, 0, 4},
+	{58, 0, 4},
+	{59, 0, 4},
+	{60, 0, 4},
+	{61, 0, 4},
+	{62, 0, 4},
+	{63, 0, 4},
+	{64, 0, 4},
+	{65, 0, 4},
+	{66, 0, 4},
+	{67, 0, 4},
+	{68, 0, 4},
+	{69, 0, 4},
+	{70, 0, 4},
+	{55, 0, 8},
+	{56, 0, 8},
+	{57, 0, 8},
+	{58, 0, 8},
+	{59, 0, 8},
+	{60, 0, 8},
+	{61, 0, 8},
+	{62, 0, 8},
+	{63, 0, 8},
+	{64, 0, 8},
+	{65, 0, 8},
+	{66, 0, 8},
+	{67, 0, 8},
+	{68, 0, 8},
+	{69, 0, 8},
+	{70, 0, 8},
+	{71, 0, 10},
+	{72, 0, 10},
+	{73, 0, 10},
+	{74, 0, 10},
+	{75, 0, 10},
+	{76, 0, 10},
+	{77, 0, 10},
+	{78, 0, 10},
+	{79, 0, 8},
+	{80, 0, 8},
+	{81, 0, 8},
+	{82, 0, 8},
+	{83, 0, 8},
+	{84, 0, 8},
+	{85, 0, 8},
+	{86, 0, 8},
+	{151, 0, 16},
+	{152, 0, 16},
+	{153, 0, 16},
+	{154, 0, 16},
+	{155, 0, 16},
+	{156, 0, 16},
+	{157, 0, 16},
+	{158, 0, 16},
+	{159, 0, 16},
+	{160, 0, 16},
+	{161, 0, 16},
+	{162, 0, 16},
+	{163, 0, 16},
+	{164, 0, 16},
+	{165, 0, 16},
+	{166, 0, 16},
+	{167, 0, 16},
+	{168, 0, 16},
+	{169, 0, 16},
+	{170, 0, 16},
+	{171, 0, 16},
+	{172, 0, 16},
+	{173, 0, 16},
+	{174, 0, 16},
+	{175, 0, 16},
+	{176, 0, 16},
+	{177, 0, 16},
+	{178, 0, 16},
+	{179, 0, 16},
+	{180, 0, 16},
+	{181, 0, 16},
+	{182, 0, 16},
+	{151, 0, 32},
+	{152, 0, 32},
+	{153, 0, 32},
+	{154, 0, 32},
+	{155, 0, 32},
+	{156, 0, 32},
+	{157, 0, 32},
+	{158, 0, 32},
+	{159, 0, 32},
+	{160, 0, 32},
+	{161, 0, 32},
+	{162, 0, 32},
+	{163, 0, 32},
+	{164, 0, 32},
+	{165, 0, 32},
+	{166, 0, 32},
+	{167, 0, 32},
+	{168, 0, 32},
+	{169, 0, 32},
+	{170, 0, 32},
+	{171, 0, 32},
+	{172, 0, 32},
+	{173, 0, 32},
+	{174, 0, 32},
+	{175, 0, 32},
+	{176, 0, 32},
+	{177, 0, 32},
+	{178, 0, 32},
+	{179, 0, 32},
+	{180, 0, 32},
+	{181, 0, 32},
+	{182, 0, 32},
+	{151, 0, 64},
+	{152, 0, 64},
+	{153, 0, 64},
+	{154, 0, 64},
+	{155, 0, 64},
+	{156, 0, 64},
+	{157, 0, 64},
+	{158, 0, 64},
+	{159, 0, 64},
+	{160, 0, 64},
+	{161, 0, 64},
+	{162, 0, 64},
+	{163, 0, 64},
+	{164, 0, 64},
+	{165, 0, 64},
+	{166, 0, 64},
+	{167, 0, 64},
+	{168, 0, 64},
+	{169, 0, 64},
+	{170, 0, 64},
+	{171, 0, 64},
+	{172, 0, 64},
+	{173, 0, 64},
+	{174, 0, 64},
+	{175, 0, 64},
+	{176, 0, 64},
+	{177, 0, 64},
+	{178, 0, 64},
+	{179, 0, 64},
+	{180, 0, 64},
+	{181, 0, 64},
+	{182, 0, 64},
+	{183, 0, 8},
+	{184, 0, 8},
+	{185, 0, 8},
+	{186, 0, 8},
+	{187, 0, 8},
+	{188, 0, 8},
+	{189, 0, 8},
+	{190, 0, 8},
+	{191, 0, 8},
+	{192, 0, 8},
+	{193, 0, 8},
+	{194, 0, 8},
+	{195, 0, 8},
+	{196, 0, 8},
+	{197, 0, 8},
+	{198, 0, 8},
+	{199, 0, 8},
+	{200, 0, 8},
+	{201, 0, 8},
+	{202, 0, 8},
+	{203, 0, 8},
+	{204, 0, 8},
+	{205, 0, 8},
+	{206, 0, 8},
+	{207, 0, 8},
+	{208, 0, 8},
+	{209, 0, 8},
+	{210, 0, 8},
+	{211, 0, 8},
+	{212, 0, 8},
+	{213, 0, 8},
+	{214, 0, 8},
+	{215, 0, 8},
+	{216, 0, 8},
+	{217, 0, 8},
+	{218, 0, 8},
+	{219, 0, 8},
+	{220, 0, 8},
+	{221, 0, 8},
+	{222, 0, 8},
+	{223, 0, 4},
+	{224, 0, 4},
+	{225, 0, 4},
+	{226, 0, 4},
+	{227, 0, 4},
+	{228, 0, 4},
+	{229, 0, 4},
+	{230, 0, 4},
+	{231, 0, 4},
+	{232, 0, 4},
+	{233, 0, 4},
+	{234, 0, 4},
+	{235, 0, 4},
+	{236, 0, 4},
+	{237, 0, 4},
+	{238, 0, 4},
+	{239, 0, 2},
+	{240, 0, 2},
+	{241, 0, 2},
+	{242, 0, 2},
+	{243, 0, 2},
+	{244, 0, 2},
+	{245, 0, 8}
+};
+static const RegisterAccessEntry registerAccessTable[] = {
+	{0x0, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x2000000000001ULL, 0x2000000000001ULL},
+	{0x1, 0, 0, 0, 0x1ULL, 0x2000000000001ULL},
+	{0xb, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0xb, 0, 0, 0, 0x2000000000000ULL, 0x2000000000000ULL},
+	{0x4b, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0xb, 0, 0, 0, 0x10000ULL, 0x0ULL},
+	{0x9, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0xa, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x3, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x9, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x1, 0, 0, 0, 0x10ULL, 0x10ULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x0, 0, 0, 0, 0x2000000000000ULL, 0x2000000000000ULL},
+	{0x3, 0, 0, 0, 0xfULL, 0x2000000000005ULL},
+	{0xb, 0, 0, 0, 0x1ULL, 0x2000000000001ULL},
+	{0x0, 0, 0, 0, 0x3ULL, 0xfULL},
+	{0xb, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x3, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x1, 4, 0, 0, 0x1ULL, 0x2000000000001ULL},
+	{0x1, 0, 19, 0, 0x5ULL, 0x2000000000005ULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0x1000000000000ULL},
+	{0x9, 0, 0, 0, 0x30ULL, 0x30ULL},
+	{0x0, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0xb, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0x1, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0x2, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0xb, 0, 0, 0, 0x3000000000000ULL, 0x1000000000000ULL},
+	{0x9, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0x9, 0, 0, 0, 0x1000000000000ULL, 0x3000000000000ULL},
+	{0x1b, 0, 0, 0, 0x1000000000000ULL, 0x1000000000000ULL},
+	{0x1, 0, 0, 0, 0x0ULL, 0x1000000000000ULL},
+	{0x2, 0, 0, 0, 0x1000000000000ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x1ULL, 0x1ULL},
+	{0x4a, 2, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x1, 1, 34, 0, 0x1ULL, 0x2000000000005ULL},
+	{0x1, 5, 35, 0, 0x1ULL, 0x2000000000001ULL},
+	{0xb, 0, 36, 0, 0x0ULL, 0x2000000000000ULL},
+	{0xa, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x2000000000010ULL, 0x10ULL},
+	{0x0, 0, 0, 0, 0x10ULL, 0x2000000000010ULL},
+	{0x1, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x2000000000000ULL, 0x1ULL},
+	{0x2, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x20ULL, 0x30ULL},
+	{0x1, 0, 0, 0, 0x2ULL, 0x2ULL},
+	{0x1, 0, 0, 0, 0x2000000000002ULL, 0x2ULL},
+	{0xc, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x1, 0, 19, 0, 0x1ULL, 0x2000000000005ULL},
+	{0x49, 0, 0, 0, 0x5ULL, 0x2000000000002ULL},
+	{0x49, 0, 0, 0, 0x5ULL, 0x2000000010000ULL},
+	{0x49, 0, 0, 0, 0x0ULL, 0x2000000000002ULL},
+	{0x49, 0, 0, 0, 0x0ULL, 0x2000000010000ULL},
+	{0x2, 0, 0, 0, 0x10ULL, 0x10ULL},
+	{0x0, 0, 0, 0, 0x2ULL, 0x5ULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0x5ULL},
+	{0x4a, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x1ULL, 0x2000000000000ULL},
+	{0x0, 0, 0, 0, 0x2000000000001ULL, 0x1ULL},
+	{0x4b, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x0, 0, 0, 0, 0x2000000000000ULL, 0x2000000000802ULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0x10ULL},
+	{0x0, 0, 0, 0, 0x6ULL, 0x10ULL},
+	{0x0, 0, 0, 0, 0x802ULL, 0x2000000000000ULL},
+	{0x0, 0, 0, 0, 0x7ULL, 0x0ULL},
+	{0x1b, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x1b, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x1, 0, 0, 0, 0x5ULL, 0x1000000000000ULL},
+	{0x2, 0, 0, 0, 0x1000000000005ULL, 0x0ULL},
+	{0x9, 0, 0, 0, 0x20000000000c0ULL, 0x20000000000c0ULL},
+	{0x4b, 8, 0, 0, 0x0ULL, 0x0ULL},
+	{0x9, 0, 70, 0, 0x20000000000c0ULL, 0x20000000000c0ULL},
+	{0xb, 0, 0, 0, 0x2000000000000ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0x1ULL, 0x4ULL},
+	{0xa, 0, 0, 0, 0x2000000000080ULL, 0x80ULL},
+	{0x1, 0, 0, 0, 0x2ULL, 0x0ULL},
+	{0x1, 0, 0, 0, 0x2000000000000ULL, 0x0ULL},
+	{0xa, 0, 0, 0, 0x2000000000040ULL, 0x40ULL},
+	{0xa, 0, 0, 0, 0x20000000000c0ULL, 0xc0ULL},
+	{0xc, 8, 0, 0, 0x0ULL, 0x0ULL},
+	{0xa, 24, 79, 0, 0x0ULL, 0x0ULL},
+	{0xa, 0, 80, 0, 0x20000000000c0ULL, 0xc0ULL},
+	{0x9, 0, 0, 0, 0x2000000000040ULL, 0x40ULL},
+	{0x0, 0, 0, 0, 0x10ULL, 0xffULL},
+	{0x0, 0, 0, 0, 0xffULL, 0x10ULL},
+	{0x9, 0, 0, 0, 0x2000000000080ULL, 0x2000000000080ULL},
+	{0x2, 0, 0, 0, 0x2000000000000ULL, 0x0ULL},
+	{0x9, 0, 0, 0, 0x0ULL, 0x80ULL},
+	{0x0, 0, 0, 0, 0x3ULL, 0x0ULL},
+	{0x1, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x0, 0, 0, 0, 0xfULL, 0xfULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0x7ULL},
+	{0x24a, 0, 0, 0, 0x0ULL, 0x0ULL},
+	{0x0, 0, 0, 0, 0xffff0000ULL, 0xffff0000ULL},
+	{0x0, 0, 0, 0, 0x0ULL, 0xffff0000ULL},
+	{0x9, 0, 0, 0, 0x80ULL, 0x0ULL},
+	{0xcb, 0, 0, 1, 0x0ULL, 0x0ULL},
+	{0x4a, 0, 0, 0, 0x0ULL, 0x2000000000000ULL},
+	{0x52, 0, 0, 0, 0x4ULL, 0x0ULL},
+	{0xa, 0, 0, 1, 0x0ULL, 0x0ULL},
+	{0x24b, 0, 0, 0, 0x0ULL, 0x0ULL}
+};
+static const uint8_t registerAccessIndex[] = {
+	0,
+	1,
+	2,
+	2,
+	1,
+	3,
+	4,
+	3,
+	3,
+	5,
+	5,
+	6,
+	6,
+	7,
+	8,
+	8,
+	9,
+	10,
+	3,
+	3,
+	3,
+	11,
+	11,
+	12,
+	12,
+	0,
+	12,
+	0,
+	13,
+	10,
+	14,
+	14,
+	15,
+	16,
+	17,
+	1,
+	1,
+	18,
+	20,
+	5,
+	5,
+	21,
+	22,
+	23,
+	23,
+	24,
+	24,
+	25,
+	26,
+	23,
+	23,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	28,
+	29,
+	29,
+	28,
+	23,
+	23,
+	23,
+	23,
+	24,
+	24,
+	24,
+	24,
+	21,
+	23,
+	25,
+	25,
+	25,
+	28,
+	28,
+	25,
+	25,
+	25,
+	25,
+	23,
+	23,
+	26,
+	26,
+	26,
+	25,
+	25,
+	25,
+	23,
+	25,
+	25,
+	23,
+	23,
+	23,
+	23,
+	23,
+	23,
+	24,
+	24,
+	0,
+	23,
+	23,
+	23,
+	23,
+	23,
+	23,
+	23,
+	23,
+	25,
+	23,
+	26,
+	23,
+	23,
+	23,
+	23,
+	23,
+	26,
+	26,
+	26,
+	26,
+	26,
+	26,
+	26,
+	24,
+	24,
+	24,
+	24,
+	23,
+	28,
+	29,
+	29,
+	28,
+	23,
+	0,
+	23,
+	30,
+	31,
+	32,
+	23,
+	23,
+	23,
+	33,
+	0,
+	20,
+	37,
+	38,
+	18,
+	11,
+	11,
+	11,
+	39,
+	0,
+	0,
+	40,
+	41,
+	41,
+	42,
+	8,
+	41,
+	38,
+	43,
+	44,
+	38,
+	0,
+	38,
+	38,
+	45,
+	46,
+	46,
+	8,
+	38,
+	0,
+	38,
+	38,
+	47,
+	38,
+	38,
+	38,
+	38,
+	38,
+	5,
+	48,
+	18,
+	0,
+	9,
+	3,
+	7,
+	17,
+	17,
+	17,
+	17,
+	38,
+	38,
+	38,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	5,
+	17,
+	17,
+	0,
+	17,
+	17,
+	17,
+	6,
+	5,
+	17,
+	17,
+	17,
+	17,
+	49,
+	50,
+	17,
+	17,
+	17,
+	17,
+	51,
+	52,
+	38,
+	38,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	38,
+	17,
+	17,
+	38,
+	17,
+	38,
+	38,
+	17,
+	17,
+	17,
+	17,
+	17,
+	38,
+	17,
+	17,
+	17,
+	38,
+	38,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	53,
+	8,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	38,
+	10,
+	17,
+	17,
+	17,
+	17,
+	17,
+	11,
+	17,
+	54,
+	54,
+	55,
+	11,
+	11,
+	4,
+	4,
+	3,
+	3,
+	56,
+	56,
+	0,
+	57,
+	58,
+	3,
+	4,
+	0,
+	3,
+	59,
+	3,
+	59,
+	3,
+	12,
+	12,
+	12,
+	43,
+	60,
+	61,
+	62,
+	63,
+	10,
+	0,
+	38,
+	7,
+	0,
+	64,
+	65,
+	38,
+	66,
+	3,
+	67,
+	68,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	33,
+	33,
+	33,
+	69,
+	69,
+	71,
+	69,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	72,
+	73,
+	73,
+	73,
+	17,
+	17,
+	17,
+	17,
+	74,
+	74,
+	74,
+	74,
+	75,
+	75,
+	75,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	76,
+	77,
+	77,
+	77,
+	77,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	38,
+	38,
+	78,
+	78,
+	81,
+	78,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	82,
+	82,
+	82,
+	82,
+	56,
+	56,
+	5,
+	5,
+	83,
+	83,
+	40,
+	40,
+	40,
+	84,
+	84,
+	39,
+	39,
+	39,
+	38,
+	17,
+	38,
+	17,
+	85,
+	85,
+	85,
+	85,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	86,
+	38,
+	38,
+	17,
+	17,
+	74,
+	74,
+	74,
+	74,
+	17,
+	17,
+	17,
+	17,
+	17,
+	17,
+	5,
+	5,
+	5,
+	10,
+	10,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	17,
+	38,
+	38,
+	38,
+	38,
+	17,
+	17,
+	17,
+	17,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	56,
+	17,
+	17,
+	17,
+	17,
+	5,
+	38,
+	41,
+	41,
+	41,
+	41,
+	41,
+	87,
+	87,
+	0,
+	64,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	47,
+	47,
+	47,
+	38,
+	38,
+	47,
+	47,
+	47,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	88,
+	5,
+	5,
+	56,
+	56,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	38,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	56,
+	56,
+	56,
+	56,
+	17,
+	17,
+	17,
+	5,
+	5,
+	43,
+	43,
+	43,
+	5,
+	5,
+	43,
+	43,
+	0,
+	10,
+	10,
+	17,
+	17,
+	17,
+	17,
+	89,
+	89,
+	0,
+	41,
+	0,
+	41,
+	43,
+	0,
+	0,
+	41,
+	54,
+	64,
+	12,
+	12,
+	90,
+	88,
+	0,
+	12,
+	90,
+	91,
+	8,
+	8,
+	92,
+	67,
+	68,
+	68,
+	67,
+	68,
+	68,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	10,
+	10,
+	10,
+	10,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	93,
+	94,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	95,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	10,
+	10,
+	92,
+	92,
+	10,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	96,
+	96,
+	96,
+	96,
+	96,
+	96,
+	96,
+	96,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	92,
+	92,
+	92,
+	92,
+	92,
+	97,
+	97,
+	92,
+	92,
+	98,
+	97,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	50,
+	49,
+	52,
+	51,
+	92,
+	92,
+	92,
+	92,
+	8,
+	8,
+	8,
+	41,
+	43,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	10,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	5,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	99,
+	99,
+	99,
+	99,
+	99,
+	99,
+	99,
+	99,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	100,
+	100,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	100,
+	100,
+	100,
+	100,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92,
+	92
+};
+static const FlagEffectsEntry flagEffectsTable[] = {
+	{0x0, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x10, 0x11, 0x0, 0x0, 0x8c4, 0, 0, 0},
+	{0x0, 0xc4, 0x0, 0x0, 0x811, 0, 0, 0},
+	{0x0, 0x8d5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x1, 0x8d5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0xc4, 0x801, 0x0, 0x10, 0, 0, 0},
+	{0x0, 0x40, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x40, 0x0, 0x0, 0x895, 0, 0, 0},
+	{0x0, 0x1, 0x0, 0x0, 0x894, 0, 0, 0},
+	{0x0, 0x0, 0x1, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x400, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x200, 0x0, 0x0, 0, 0, 0},
+	{0x1, 0x1, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x11, 0xd5, 0x0, 0x0, 0x800, 0, 0, 0},
+	{0x0, 0x8d4, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x0, 0x0, 0x8d5, 0, 0, 0},
+	{0x1, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x41, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x40, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x4, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x45, 0x890, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x801, 0x0, 0x0, 0xd4, 0, 0, 0},
+	{0x800, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x40fd5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0xd5, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x8c1, 0x14, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x40, 0x895, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x41, 0x894, 0x0, 0x0, 0, 0, 0},
+	{0x1, 0x801, 0x0, 0x0, 0x0, 0, 0, 1},
+	{0x0, 0x801, 0x0, 0x0, 0x0, 0, 0, 1},
+	{0x0, 0xd5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x8c5, 0x0, 0x0, 0x10, 0, 0, 1},
+	{0x0, 0x0, 0x0, 0x1, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x0, 0x400, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x0, 0x200, 0x0, 0, 0, 0},
+	{0x40fd5, 0x40fd5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x400, 0x8d5, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x0, 0x0, 0x0, 8, 0, 0},
+	{0x400, 0x8d5, 0x0, 0x0, 0x0, 0, 37, 0},
+	{0x80, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x880, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x8c0, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x400, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x400, 0x0, 0x0, 0x0, 0x0, 0, 37, 0},
+	{0x40fd5, 0x0, 0x0, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x40000, 0x0, 0x0, 0, 0, 0},
+	{0x0, 0x0, 0x0, 0x40000, 0x0, 0, 0, 0},
+	{0x0, 0x41, 0x0, 0x0, 0x894, 0, 0, 0},
+	{0x0, 0xc0, 0x801, 0x0, 0x14, 0, 0, 0},
+	{0x0, 0xc1, 0x800, 0x0, 0x14, 0, 0, 0},
+	{0x0, 0x40, 0x801, 0x0, 0x94, 0, 0, 0},
+	{0x0, 0x81, 0x840, 0x0, 0x14, 0, 0, 0}
+};
+static const uint8_t flagEffectsIndex[] = {
+	0,
+	1,
+	2,
+	2,
+	1,
+	3,
+	4,
+	5,
+	6,
+	0,
+	0,
+	0,
+	0,
+	0,
+	7,
+	7,
+	0,
+	8,
+	8,
+	8,
+	8,
+	0,
+	0,
+	9,
+	10,
+	0,
+	11,
+	0,
+	12,
+	3,
+	6,
+	6,
+	3,
+	0,
+	0,
+	13,
+	13,
+	14,
+	15,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	16,
+	17,
+	18,
+	16,
+	17,
+	18,
+	19,
+	19,
+	0,
+	20,
+	20,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	20,
+	20,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	15,
+	21,
+	0,
+	14,
+	0,
+	0,
+	0,
+	22,
+	0,
+	0,
+	23,
+	0,
+	0,
+	24,
+	6,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	18,
+	18,
+	6,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	21,
+	3,
+	0,
+	0,
+	5,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	25,
+	25,
+	0,
+	0,
+	0,
+	0,
+	25,
+	25,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	26,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	27,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	28,
+	28,
+	29,
+	29,
+	0,
+	0,
+	23,
+	30,
+	16,
+	31,
+	4,
+	0,
+	31,
+	31,
+	31,
+	31,
+	3,
+	32,
+	33,
+	34,
+	0,
+	35,
+	0,
+	0,
+	23,
+	5,
+	0,
+	27,
+	27,
+	0,
+	0,
+	0,
+	0,
+	3,
+	5,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	36,
+	36,
+	38,
+	36,
+	22,
+	22,
+	16,
+	16,
+	18,
+	18,
+	17,
+	17,
+	39,
+	39,
+	19,
+	19,
+	40,
+	40,
+	41,
+	41,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	42,
+	42,
+	42,
+	42,
+	0,
+	0,
+	0,
+	22,
+	22,
+	16,
+	16,
+	18,
+	18,
+	17,
+	17,
+	39,
+	39,
+	19,
+	19,
+	40,
+	40,
+	41,
+	41,
+	42,
+	42,
+	42,
+	42,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	42,
+	42,
+	43,
+	42,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	42,
+	42,
+	42,
+	42,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	23,
+	23,
+	23,
+	0,
+	0,
+	44,
+	44,
+	44,
+	0,
+	0,
+	0,
+	0,
+	36,
+	36,
+	36,
+	36,
+	22,
+	22,
+	16,
+	16,
+	18,
+	18,
+	17,
+	17,
+	39,
+	39,
+	19,
+	19,
+	40,
+	40,
+	41,
+	41,
+	0,
+	0,
+	0,
+	0,
+	42,
+	42,
+	42,
+	42,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	20,
+	20,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	20,
+	20,
+	0,
+	0,
+	0,
+	0,
+	6,
+	6,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	0,
+	0,
+	45,
+	46,
+	0,
+	0,
+	0,
+	26,
+	0,
+	0,
+	47,
+	47,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	20,
+	20,
+	20,
+	20,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	27,
+	27,
+	0,
+	0,
+	27,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	48,
+	49,
+	0,
+	0,
+	0,
+	50,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	25,
+	25,
+	25,
+	25,
+	0,
+	0,
+	0,
+	0,
+	49,
+	51,
+	49,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	27,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0
+};
+const uint16_t asmx86OperationAttributes[] = {
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x25,
+	0x25,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x40,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x80,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x200,
+	0x30,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x102,
+	0x102,
+	0x102,
+	0x102,
+	0x102,
+	0x102,
+	0x102,
+	0x102,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x200,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x100,
+	0x500,
+	0x500,
+	0x100,
+	0x100,
+	0x100,
+	0x0,
+	0x40,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x21,
+	0x21,
+	0x21,
+	0x23,
+	0xc0,
+	0xc0,
+	0x99,
+	0x1,
+	0x1,
+	0x0,
+	0x0,
+	0x400,
+	0x0,
+	0x0,
+	0x10,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x3,
+	0x3,
+	0x3,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x0,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x0,
+	0x600,
+	0x200,
+	0x600,
+	0x400,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x400,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x400,
+	0x400,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x200,
+	0x600,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x600,
+	0x200,
+	0x200,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x200,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x10,
+	0x0,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x600,
+	0x200,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x600,
+	0x400,
+	0x20,
+	0x600,
+	0x40,
+	0x0,
+	0x0,
+	0x19,
+	0x19,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x80,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x1,
+	0x1,
+	0x41,
+	0x41,
+	0x0,
+	0x0,
+	0x40,
+	0x40,
+	0xc0,
+	0xc0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x1000,
+	0x1000,
+	0x1400,
+	0x1000,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x2,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x3,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x600,
+	0x1000,
+	0x1000,
+	0x1400,
+	0x1000,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x10,
+	0x10,
+	0x10,
+	0x10,
+	0x10,
+	0x20,
+	0x20,
+	0x20,
+	0x20,
+	0x20,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x1000,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x400,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0xc0,
+	0xc0,
+	0xc0,
+	0x40,
+	0xc0,
+	0x220,
+	0x420,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x200,
+	0x600,
+	0x0,
+	0x400,
+	0x600,
+	0x400,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x400,
+	0x200,
+	0x600,
+	0x600,
+	0x600,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x40,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x400,
+	0x0,
+	0x0,
+	0x0,
+	0x40,
+	0x40,
+	0x40,
+	0x40,
+	0x40,
+	0x40,
+	0x40,
+	0x0,
+	0x40,
+	0x40,
+	0x40,
+	0x40,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x820,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x0,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x0,
+	0x800,
+	0x800,
+	0x0,
+	0x0,
+	0x0,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800,
+	0x800
+};
+#define DISPATCH_ID_COUNT 2376
+static const DispatchEntry dispatchTable[] = {
+	{0, 0, 0},
+	{1, 0, 0},
+	{2, 0, 0},
+	{3, 0, 0},
+	{4, 0, 0},
+	{5, 128, 1},
+	{29, 128, 1},
+	{53, 128, 1},
+	{77, 0, 0},
+	{78, 0, 0},
+	{79, 0, 0},
+	{80, 0, 0},
+	{81, 0, 0},
+	{82, 0, 0},
+	{83, 256, 1},
+	{95, 256, 1},
+	{107, 0, 0},
+	{108, 384, 1},
+	{128, 384, 1},
+	{148, 384, 1},
+	{168, 384, 1},
+	{188, 0, 0},
+	{189, 512, 0},
+	{193, 0, 0},
+	{194, 0, 0},
+	{195, 0, 0},
+	{196, 0, 0},
+	{197, 0, 0},
+	{198, 0, 0},
+	{199, 128, 1},
+	{223, 0, 0},
+	{224, 0, 0},
+	{225, 640, 1},
+	{237, 0, 0},
+	{238, 0, 0},
+	{239, 0, 0},
+	{240, 0, 0},
+	{241, 768, 1},
+	{253, 768, 1},
+	{265, 0, 0},
+	{266, 0, 0},
+	{267, 0, 0},
+	{268, 0, 0},
+	{269, 0, 0},
+	{270, 0, 0},
+	{271, 0, 0},
+	{272, 0, 0},
+	{273, 0, 0},
+	{274, 0, 0},
+	{275, 0, 0},
+	{276, 0, 0},
+	{277, 0, 0},
+	{278, 0, 0},
+	{279, 0, 0},
+	{280, 0, 0},
+	{281, 0, 0},
+	{282, 0, 0},
+	{283, 0, 0},
+	{284, 0, 0},
+	{285, 0, 0},
+	{286, 0, 0},
+	{287, 0, 0},
+	{288, 0, 0},
+	{289, 0, 0},
+	{290, 0, 0},
+	{291, 0, 0},
+	{292, 0, 0},
+	{293, 0, 0},
+	{294, 0, 0},
+	{295, 0, 0},
+	{296, 0, 0},
+	{297, 0, 0},
+	{298, 0, 0},
+	{299, 0, 0},
+	{300, 0, 0},
+	{301, 0, 0},
+	{302, 0, 0},
+	{303, 0, 0},
+	{304, 0, 0},
+	{305, 0, 0},
+	{306, 0, 0},
+	{307, 0, 0},
+	{308, 0, 0},
+	{309, 0, 0},
+	{310, 0, 0},
+	{311, 0, 0},
+	{312, 0, 0},
+	{313, 0, 0},
+	{314, 0, 0},
+	{315, 0, 0},
+	{316, 0, 0},
+	{317, 0, 0},
+	{318, 0, 0},
+	{319, 0, 0},
+	{320, 0, 0},
+	{321, 0, 0},
+	{322, 0, 0},
+	{323, 0, 0},
+	{324, 0, 0},
+	{325, 0, 0},
+	{326, 0, 0},
+	{327, 0, 0},
+	{328, 0, 0},
+	{329, 0, 0},
+	{330, 0, 0},
+	{331, 0, 0},
+	{332, 0, 0},
+	{333, 0, 0},
+	{334, 0, 0},
+	{335, 0, 0},
+	{336, 0, 0},
+	{337, 0, 0},
+	{338, 0, 0},
+	{339, 0, 0},
+	{340, 0, 0},
+	{341, 0, 0},
+	{342, 0, 0},
+	{343, 0, 0},
+	{344, 0, 0},
+	{345, 0, 0},
+	{346, 0, 0},
+	{347, 0, 0},
+	{348, 0, 0},
+	{349, 0, 0},
+	{350, 0, 0},
+	{351, 0, 0},
+	{352, 0, 0},
+	{353, 0, 0},
+	{354, 0, 0},
+	{355, 0, 0},
+	{356, 0, 0},
+	{357, 0, 0},
+	{358, 0, 0},
+	{359, 0, 0},
+	{360, 0, 0},
+	{361, 0, 0},
+	{362, 0, 0},
+	{363, 0, 0},
+	{364, 0, 0},
+	{365, 0, 0},
+	{366, 0, 0},
+	{367, 0, 0},
+	{368, 0, 0},
+	{369, 0, 0},
+	{370, 0, 0},
+	{371, 768, 1},
+	{383, 896, 1},
+	{411, 1024, 1},
+	{423, 768, 1},
+	{435, 0, 0},
+	{436, 0, 0},
+	{437, 0, 0},
+	{438, 0, 0},
+	{439, 0, 0},
+	{440, 0, 0},
+	{441, 0, 0},
+	{442, 0, 0},
+	{443, 512, 0},
+	{447, 0, 0},
+	{448, 0, 0},
+	{449, 0, 0},
+	{450, 0, 0},
+	{451, 256, 1},
+	{463, 0, 0},
+	{464, 0, 0},
+	{465, 0, 0},
+	{466, 0, 0},
+	{467, 0, 0},
+	{468, 0, 0},
+	{469, 0, 0},
+	{470, 0, 0},
+	{471, 0, 0},
+	{472, 0, 0},
+	{473, 0, 0},
+	{474, 128, 1},
+	{498, 0, 0},
+	{499, 0, 0},
+	{500, 256, 2},
+	{548, 256, 2},
+	{596, 0, 0},
+	{597, 0, 0},
+	{598, 256, 2},
+	{646, 0, 0},
+	{647, 768, 1},
+	{659, 768, 1},
+	{671, 0, 0},
+	{672, 768, 1},
+	{684, 128, 1},
+	{708, 1152, 1},
+	{720, 0, 0},
+	{721, 0, 0},
+	{722, 0, 0},
+	{723, 0, 0},
+	{724, 0, 0},
+	{725, 0, 0},
+	{726, 0, 0},
+	{727, 0, 0},
+	{728, 0, 0},
+	{729, 0, 0},
+	{730, 0, 0},
+	{731, 0, 0},
+	{732, 0, 0},
+	{733, 0, 0},
+	{734, 0, 0},
+	{735, 0, 0},
+	{736, 0, 0},
+	{737, 0, 0},
+	{738, 0, 0},
+	{739, 0, 0},
+	{740, 0, 0},
+	{741, 0, 0},
+	{742, 0, 0},
+	{743, 0, 0},
+	{744, 0, 0},
+	{745, 0, 0},
+	{746, 0, 0},
+	{747, 0, 0},
+	{748, 0, 0},
+	{749, 0, 0},
+	{750, 0, 0},
+	{751, 0, 0},
+	{752, 0, 0},
+	{753, 0, 0},
+	{754, 0, 0},
+	{755, 0, 0},
+	{756, 0, 0},
+	{757, 0, 0},
+	{758, 0, 0},
+	{759, 0, 0},
+	{760, 0, 0},
+	{761, 0, 0},
+	{762, 0, 0},
+	{763, 0, 0},
+	{764, 0, 0},
+	{765, 0, 0},
+	{766, 0, 0},
+	{767, 0, 0},
+	{768, 0, 0},
+	{769, 0, 0},
+	{770, 0, 0},
+	{771, 0, 0},
+	{772, 0, 0},
+	{773, 0, 0},
+	{774, 0, 0},
+	{775, 0, 0},
+	{776, 0, 0},
+	{777, 0, 0},
+	{778, 0, 0},
+	{779, 0, 0},
+	{780, 0, 0},
+	{781, 0, 0},
+	{782, 0, 0},
+	{783, 0, 0},
+	{784, 0, 0},
+	{785, 0, 0},
+	{786, 0, 0},
+	{787, 0, 0},
+	{788, 0, 0},
+	{789, 0, 0},
+	{790, 0, 0},
+	{791, 0, 0},
+	{792, 0, 0},
+	{793, 0, 0},
+	{794, 0, 0},
+	{795, 0, 0},
+	{796, 0, 0},
+	{797, 0, 0},
+	{798, 0, 0},
+	{799, 0, 0},
+	{800, 0, 0},
+	{801, 0, 0},
+	{802, 0, 0},
+	{803, 0, 0},
+	{804, 0, 0},
+	{805, 0, 0},
+	{806, 0, 0},
+	{807, 0, 0},
+	{808, 768, 1},
+	{820, 256, 1},
+	{832, 0, 0},
+	{833, 0, 0},
+	{834, 0, 0},
+	{835, 0, 0},
+	{836, 0, 0},
+	{837, 0, 0},
+	{838, 0, 0},
+	{839, 0, 0},
+	{840, 0, 0},
+	{841, 0, 0},
+	{842, 0, 0},
+	{843, 0, 0},
+	{844, 0, 0},
+	{845, 0, 0},
+	{846, 0, 0},
+	{847, 0, 0},
+	{848, 0, 0},
+	{849, 0, 0},
+	{850, 0, 0},
+	{851, 0, 0},
+	{852, 0, 0},
+	{853, 0, 0},
+	{854, 0, 0},
+	{855, 0, 0},
+	{856, 0, 0},
+	{857, 0, 0},
+	{858, 0, 0},
+	{859, 0, 0},
+	{860, 0, 0},
+	{861, 0, 0},
+	{862, 0, 0},
+	{863, 1280, 1},
+	{879, 0, 0},
+	{880, 0, 0},
+	{881, 0, 0},
+	{882, 0, 0},
+	{883, 1408, 0},
+	{886, 1408, 0},
+	{889, 384, 1},
+	{909, 384, 1},
+	{929, 384, 1},
+	{949, 384, 1},
+	{969, 0, 0},
+	{970, 0, 0},
+	{971, 0, 0},
+	{972, 0, 0},
+	{973, 0, 0},
+	{974, 384, 1},
+	{994, 128, 1},
+	{1018, 0, 0},
+	{1019, 384, 1},
+	{1039, 1536, 1},
+	{1059, 384, 1},
+	{1079, 1536, 1},
+	{1099, 128, 1},
+	{1123, 0, 0},
+	{1124, 0, 0},
+	{1125, 0, 0},
+	{1126, 0, 0},
+	{1127, 0, 0},
+	{1128, 0, 0},
+	{1129, 0, 0},
+	{1130, 0, 0},
+	{1131, 128, 1},
+	{1155, 0, 0},
+	{1156, 0, 0},
+	{1157, 0, 0},
+	{1158, 0, 0},
+	{1159, 0, 0},
+	{1160, 1664, 1},
+	{1176, 0, 0},
+	{1177, 640, 1},
+	{1189, 128, 1},
+	{1213, 0, 0},
+	{1214, 0, 0},
+	{1215, 0, 0},
+	{1216, 0, 0},
+	{1217, 0, 0},
+	{1218, 0, 0},
+	{1219, 0, 0},
+	{1220, 0, 0},
+	{1221, 0, 0},
+	{1222, 0, 0},
+	{1223, 0, 0},
+	{1224, 0, 0},
+	{1225, 0, 0},
+	{1226, 0, 0},
+	{1227, 0, 0},
+	{1228, 0, 0},
+	{1229, 0, 0},
+	{1230, 1792, 0},
+	{1234, 0, 0},
+	{1235, 256, 1},
+	{1247, 256, 1},
+	{1259, 256, 1},
+	{1271, 256, 1},
+	{1283, 256, 1},
+	{1295, 256, 1},
+	{1307, 256, 1},
+	{1319, 256, 1},
+	{1331, 256, 1},
+	{1343, 256, 1},
+	{1355, 256, 1},
+	{1367, 256, 1},
+	{1379, 256, 1},
+	{1391, 256, 1},
+	{1403, 256, 1},
+	{1415, 256, 1},
+	{1427, 0, 0},
+	{1428, 0, 0},
+	{1429, 0, 0},
+	{1430, 0, 0},
+	{1431, 0, 0},
+	{1432, 0, 0},
+	{1433, 0, 0},
+	{1434, 0, 0},
+	{1435, 0, 0},
+	{1436, 0, 0},
+	{1437, 0, 0},
+	{1438, 0, 0},
+	{1439, 0, 0},
+	{1440, 0, 0},
+	{1441, 0, 0},
+	{1442, 0, 0},
+	{1443, 0, 0},
+	{1444, 0, 0},
+	{1445, 0, 0},
+	{1446, 0, 0},
+	{1447, 0, 0},
+	{1448, 0, 0},
+	{1449, 0, 0},
+	{1450, 0, 0},
+	{1451, 0, 0},
+	{1452, 0, 0},
+	{1453, 0, 0},
+	{1454, 0, 0},
+	{1455, 0, 0},
+	{1456, 0, 0},
+	{1457, 0, 0},
+	{1458, 0, 0},
+	{1459, 0, 0},
+	{1460, 0, 0},
+	{1461, 0, 0},
+	{1462, 0, 0},
+	{1463, 0, 0},
+	{1464, 0, 0},
+	{1465, 0, 0},
+	{1466, 0, 0},
+	{1467, 0, 0},
+	{1468, 0, 0},
+	{1469, 0, 0},
+	{1470, 0, 0},
+	{1471, 0, 0},
+	{1472, 0, 0},
+	{1473, 1920, 0},
+	{1478, 0, 0},
+	{1479, 0, 0},
+	{1480, 0, 0},
+	{1481, 0, 0},
+	{1482, 0, 0},
+	{1483, 0, 0},
+	{1484, 0, 0},
+	{1485, 0, 0},
+	{1486, 0, 0},
+	{1487, 0, 0},
+	{1488, 0, 0},
+	{1489, 0, 0},
+	{1490, 0, 0},
+	{1491, 0, 0},
+	{1492, 0, 0},
+	{1493, 0, 0},
+	{1494, 0, 0},
+	{1495, 0, 0},
+	{1496, 0, 0},
+	{1497, 0, 0},
+	{1498, 0, 0},
+	{1499, 0, 0},
+	{1500, 0, 0},
+	{1501, 0, 0},
+	{1502, 0, 0},
+	{1503, 0, 0},
+	{1504, 0, 0},
+	{1505, 0, 0},
+	{1506, 0, 0},
+	{1507, 0, 0},
+	{1508, 0, 0},
+	{1509, 0, 0},
+	{1510, 0, 0},
+	{1511, 768, 0},
+	{1514, 768, 0},
+	{1517, 768, 0},
+	{1520, 768, 0},
+	{1523, 768, 0},
+	{1526, 768, 0},
+	{1529, 768, 0},
+	{1532, 768, 0},
+	{1535, 768, 0},
+	{1538, 768, 0},
+	{1541, 768, 0},
+	{1544, 768, 0},
+	{1547, 768, 0},
+	{1550, 768, 0},
+	{1553, 768, 0},
+	{1556, 768, 0},
+	{1559, 0, 0},
+	{1560, 0, 0},
+	{1561, 0, 0},
+	{1562, 0, 0},
+	{1563, 0, 0},
+	{1564, 0, 0},
+	{1565, 0, 0},
+	{1566, 0, 0},
+	{1567, 0, 0},
+	{1568, 0, 0},
+	{1569, 0, 0},
+	{1570, 0, 0},
+	{1571, 0, 0},
+	{1572, 0, 0},
+	{1573, 0, 0},
+	{1574, 0, 0},
+	{1575, 0, 0},
+	{1576, 0, 0},
+	{1577, 0, 0},
+	{1578, 0, 0},
+	{1579, 0, 0},
+	{1580, 0, 0},
+	{1581, 0, 0},
+	{1582, 0, 0},
+	{1583, 0, 0},
+	{1584, 0, 0},
+	{1585, 0, 0},
+	{1586, 0, 0},
+	{1587, 0, 0},
+	{1588, 0, 0},
+	{1589, 0, 0},
+	{1590, 0, 0},
+	{1591, 0, 0},
+	{1592, 0, 0},
+	{1593, 0, 0},
+	{1594, 0, 0},
+	{1595, 0, 0},
+	{1596, 0, 0},
+	{1597, 0, 0},
+	{1598, 0, 0},
+	{1599, 0, 0},
+	{1600, 0, 0},
+	{1601, 0, 0},
+	{1602, 0, 0},
+	{1603, 0, 0},
+	{1604, 0, 0},
+	{1605, 0, 0},
+	{1606, 0, 0},
+	{1607, 0, 0},
+	{1608, 0, 0},
+	{1609, 0, 0},
+	{1610, 0, 0},
+	{1611, 0, 0},
+	{1612, 0, 0},
+	{1613, 0, 0},
+	{1614, 0, 0},
+	{1615, 0, 0},
+	{1616, 0, 0},
+	{1617, 0, 0},
+	{1618, 0, 0},
+	{1619, 0, 0},
+	{1620, 0, 0},
+	{1621, 0, 0},
+	{1622, 0, 0},
+	{1623, 0, 0},
+	{1624, 0, 0},
+	{1625, 0, 0},
+	{1626, 0, 0},
+	{1627, 0, 0},
+	{1628, 0, 0},
+	{1629, 0, 0},
+	{1630, 0, 0},
+	{1631, 0, 0},
+	{1632, 0, 0},
+	{1633, 0, 0},
+	{1634, 0, 0},
+	{1635, 0, 0},
+	{1636, 0, 0},
+	{1637, 0, 0},
+	{1638, 0, 0},
+	{1639, 0, 0},
+	{1640, 0, 0},
+	{1641, 0, 0},
+	{1642, 0, 0},
+	{1643, 0, 0},
+	{1644, 0, 0},
+	{1645, 0, 0},
+	{1646, 0, 0},
+	{1647, 0, 0},
+	{1648, 0, 0},
+	{1649, 0, 0},
+	{1650, 0, 0},
+	{1651, 0, 0},
+	{1652, 0, 0},
+	{1653, 0, 0},
+	{1654, 0, 0},
+	{1655, 0, 0},
+	{1656, 0, 0},
+	{1657, 0, 0},
+	{1658, 0, 0},
+	{1659, 0, 0},
+	{1660, 0, 0},
+	{1661, 0, 0},
+	{1662, 0, 0},
+	{1663, 0, 0},
+	{1664, 0, 0},
+	{1665, 0, 0},
+	{1666, 0, 0},
+	{1667, 0, 0},
+	{1668, 0, 0},
+	{1669, 0, 0},
+	{1670, 0, 0},
+	{1671, 0, 0},
+	{1672, 0, 0},
+	{1673, 0, 0},
+	{1674, 0, 0},
+	{1675, 0, 0},
+	{1676, 0, 0},
+	{1677, 0, 0},
+	{1678, 0, 0},
+	{1679, 0, 0},
+	{1680, 0, 0},
+	{1681, 0, 0},
+	{1682, 0, 0},
+	{1683, 0, 0},
+	{1684, 0, 0},
+	{1685, 0, 0},
+	{1686, 0, 0},
+	{1687, 0, 0},
+	{1688, 0, 0},
+	{1689, 0, 0},
+	{1690, 0, 0},
+	{1691, 0, 0},
+	{1692, 0, 0},
+	{1693, 0, 0},
+	{1694, 0, 0},
+	{1695, 0, 0},
+	{1696, 0, 0},
+	{1697, 0, 0},
+	{1698, 0, 0},
+	{1699, 0, 0},
+	{1700, 0, 0},
+	{1701, 0, 0},
+	{1702, 0, 0},
+	{1703, 0, 0},
+	{1704, 0, 0},
+	{1705, 256, 1},
+	{1717, 256, 1},
+	{1729, 2048, 1},
+	{1741, 0, 0},
+	{1742, 0, 0},
+	{1743, 0, 0},
+	{1744, 0, 0},
+	{1745, 0, 0},
+	{1746, 0, 0},
+	{1747, 0, 0},
+	{1748, 0, 0},
+	{1749, 0, 0},
+	{1750, 0, 0},
+	{1751, 0, 0},
+	{1752, 0, 0},
+	{1753, 0, 0},
+	{1754, 0, 0},
+	{1755, 0, 0},
+	{1756, 0, 0},
+	{1757, 0, 0},
+	{1758, 0, 0},
+	{1759, 0, 0},
+	{1760, 0, 0},
+	{1761, 0, 0},
+	{1762, 0, 0},
+	{1763, 0, 0},
+	{1764, 0, 0},
+	{1765, 0, 0},
+	{1766, 0, 0},
+	{1767, 0, 0},
+	{1768, 0, 0},
+	{1769, 0, 0},
+	{1770, 0, 0},
+	{1771, 0, 0},
+	{1772, 0, 0},
+	{1773, 0, 0},
+	{1774, 0, 0},
+	{1775, 0, 0},
+	{1776, 0, 0},
+	{1777, 0, 0},
+	{1778, 0, 0},
+	{1779, 0, 0},
+	{1780, 0, 0},
+	{1781, 0, 0},
+	{1782, 0, 0},
+	{1783, 0, 0},
+	{1784, 0, 0},
+	{1785, 0, 0},
+	{1786, 0, 0},
+	{1787, 0, 0},
+	{1788, 0, 0},
+	{1789, 0, 0},
+	{1790, 0, 0},
+	{1791, 0, 0},
+	{1792, 0, 0},
+	{1793, 0, 0},
+	{1794, 0, 0},
+	{1795, 0, 0},
+	{1796, 0, 0},
+	{1797, 0, 0},
+	{1798, 0, 0},
+	{1799, 0, 0},
+	{1800, 0, 0},
+	{1801, 0, 0},
+	{1802, 0, 0},
+	{1803, 0, 0},
+	{1804, 0, 0},
+	{1805, 0, 0},
+	{1806, 0, 0},
+	{1807, 0, 0},
+	{1808, 0, 0},
+	{1809, 0, 0},
+	{1810, 0, 0},
+	{1811, 0, 0},
+	{1812, 0, 0},
+	{1813, 0, 0},
+	{1814, 0, 0},
+	{1815, 0, 0},
+	{1816, 0, 0},
+	{1817, 0, 0},
+	{1818, 0, 0},
+	{1819, 0, 0},
+	{1820, 0, 0},
+	{1821, 0, 0},
+	{1822, 0, 0},
+	{1823, 0, 0},
+	{1824, 0, 0},
+	{1825, 0, 0},
+	{1826, 0, 0},
+	{1827, 0, 0},
+	{1828, 0, 0},
+	{1829, 0, 0},
+	{1830, 0, 0},
+	{1831, 0, 0},
+	{1832, 0, 0},
+	{1833, 0, 0},
+	{1834, 0, 0},
+	{1835, 0, 0},
+	{1836, 0, 0},
+	{1837, 0, 0},
+	{1838, 0, 0},
+	{1839, 0, 0},
+	{1840, 0, 0},
+	{1841, 0, 0},
+	{1842, 0, 0},
+	{1843, 0, 0},
+	{1844, 0, 0},
+	{1845, 0, 0},
+	{1846, 0, 0},
+	{1847, 0, 0},
+	{1848, 0, 0},
+	{1849, 0, 0},
+	{1850, 0, 0},
+	{1851, 0, 0},
+	{1852, 0, 0},
+	{1853, 0, 0},
+	{1854, 0, 0},
+	{1855, 0, 0},
+	{1856, 0, 0},
+	{1857, 0, 0},
+	{1858, 0, 0},
+	{1859, 0, 0},
+	{1860, 0, 0},
+	{1861, 0, 0},
+	{1862, 0, 0},
+	{1863, 0, 0},
+	{1864, 0, 0},
+	{1865, 0, 0},
+	{1866, 0, 0},
+	{1867, 0, 0},
+	{1868, 0, 0},
+	{1869, 0, 0},
+	{1870, 0, 0},
+	{1871, 0, 0},
+	{1872, 0, 0},
+	{1873, 0, 0},
+	{1874, 0, 0},
+	{1875, 0, 0},
+	{1876, 0, 0},
+	{1877, 0, 0},
+	{1878, 0, 0},
+	{1879, 0, 0},
+	{1880, 0, 0},
+	{1881, 0, 0},
+	{1882, 0, 0},
+	{1883, 0, 0},
+	{1884, 0, 0},
+	{1885, 0, 0},
+	{1886, 0, 0},
+	{1887, 0, 0},
+	{1888, 0, 0},
+	{1889, 0, 0},
+	{1890, 0, 0},
+	{1891, 0, 0},
+	{1892, 0, 0},
+	{1893, 0, 0},
+	{1894, 0, 0},
+	{1895, 0, 0},
+	{1896, 0, 0},
+	{1897, 0, 0},
+	{1898, 0, 0},
+	{1899, 0, 0},
+	{1900, 0, 0},
+	{1901, 0, 0},
+	{1902, 0, 0},
+	{1903, 0, 0},
+	{1904, 0, 0},
+	{1905, 0, 0},
+	{1906, 0, 0},
+	{1907, 0, 0},
+	{1908, 0, 0},
+	{1909, 0, 0},
+	{1910, 0, 0},
+	{1911, 0, 0},
+	{1912, 0, 0},
+	{1913, 0, 0},
+	{1914, 0, 0},
+	{1915, 0, 0},
+	{1916, 0, 0},
+	{1917, 0, 0},
+	{1918, 0, 0},
+	{1919, 0, 0},
+	{1920, 0, 0},
+	{1921, 0, 0},
+	{1922, 0, 0},
+	{1923, 0, 0},
+	{1924, 0, 0},
+	{1925, 0, 0},
+	{1926, 0, 0},
+	{1927, 0, 0},
+	{1928, 0, 0},
+	{1929, 0, 0},
+	{1930, 0, 0},
+	{1931, 0, 0},
+	{1932, 0, 0},
+	{1933, 0, 0},
+	{1934, 0, 0},
+	{1935, 0, 0},
+	{1936, 0, 0},
+	{1937, 0, 0},
+	{1938, 0, 0},
+	{1939, 0, 0},
+	{1940, 0, 0},
+	{1941, 0, 0},
+	{1942, 0, 0},
+	{1943, 0, 0},
+	{1944, 0, 0},
+	{1945, 0, 0},
+	{1946, 0, 0},
+	{1947, 0, 0},
+	{1948, 0, 0},
+	{1949, 0, 0},
+	{1950, 0, 0},
+	{1951, 0, 0},
+	{1952, 0, 0},
+	{1953, 0, 0},
+	{1954, 0, 0},
+	{1955, 0, 0},
+	{1956, 0, 0},
+	{1957, 0, 0},
+	{1958, 0, 0},
+	{1959, 0, 0},
+	{1960, 0, 0},
+	{1961, 0, 0},
+	{1962, 0, 0},
+	{1963, 0, 0},
+	{1964, 0, 0},
+	{1965, 0, 0},
+	{1966, 0, 0},
+	{1967, 0, 0},
+	{1968, 0, 0},
+	{1969, 0, 0},
+	{1970, 0, 0},
+	{1971, 0, 0},
+	{1972, 0, 0},
+	{1973, 0, 0},
+	{1974, 0, 0},
+	{1975, 0, 0},
+	{1976, 0, 0},
+	{1977, 0, 0},
+	{1978, 0, 0},
+	{1979, 0, 0},
+	{1980, 0, 0},
+	{1981, 0, 0},
+	{1982, 0, 0},
+	{1983, 0, 0},
+	{1984, 0, 0},
+	{1985, 0, 0},
+	{1986, 0, 0},
+	{1987, 0, 0},
+	{1988, 0, 0},
+	{1989, 0, 0},
+	{1990, 0, 0},
+	{1991, 0, 0},
+	{1992, 0, 0},
+	{1993, 0, 0},
+	{1994, 0, 0},
+	{1995, 0, 0},
+	{1996, 0, 0},
+	{1997, 0, 0},
+	{1998, 0, 0},
+	{1999, 0, 0},
+	{2000, 0, 0},
+	{2001, 0, 0},
+	{2002, 0, 0},
+	{2003, 0, 0},
+	{2004, 0, 0},
+	{2005, 0, 0},
+	{2006, 0, 0},
+	{2007, 0, 0},
+	{2008, 0, 0},
+	{2009, 0, 0},
+	{2010, 0, 0},
+	{2011, 0, 0},
+	{2012, 0, 0},
+	{2013, 0, 0},
+	{2014, 0, 0},
+	{2015, 0, 0},
+	{2016, 0, 0},
+	{2017, 0, 0},
+	{2018, 0, 0},
+	{2019, 0, 0},
+	{2020, 0, 0},
+	{2021, 0, 0},
+	{2022, 0, 0},
+	{2023, 0, 0},
+	{2024, 0, 0},
+	{2025, 0, 0},
+	{2026, 0, 0},
+	{2027, 0, 0},
+	{2028, 0, 0},
+	{2029, 0, 0},
+	{2030, 0, 0},
+	{2031, 0, 0},
+	{2032, 0, 0},
+	{2033, 0, 0},
+	{2034, 0, 0},
+	{2035, 0, 0},
+	{2036, 0, 0},
+	{2037, 0, 0},
+	{2038, 0, 0},
+	{2039, 0, 0},
+	{2040, 0, 0},
+	{2041, 0, 0},
+	{2042, 0, 0},
+	{2043, 0, 0},
+	{2044, 0, 0},
+	{2045, 0, 0},
+	{2046, 0, 0},
+	{2047, 0, 0},
+	{2048, 0, 0},
+	{2049, 0, 0},
+	{2050, 0, 0},
+	{2051, 0, 0},
+	{2052, 0, 0},
+	{2053, 0, 0},
+	{2054, 0, 0},
+	{2055, 0, 0},
+	{2056, 0, 0},
+	{2057, 0, 0},
+	{2058, 0, 0},
+	{2059, 0, 0},
+	{2060, 0, 0},
+	{2061, 0, 0},
+	{2062, 0, 0},
+	{2063, 0, 0},
+	{2064, 0, 0},
+	{2065, 0, 0},
+	{2066, 0, 0},
+	{2067, 0, 0},
+	{2068, 0, 0},
+	{2069, 0, 0},
+	{2070, 0, 0},
+	{2071, 0, 0},
+	{2072, 0, 0},
+	{2073, 0, 0},
+	{2074, 0, 0},
+	{2075, 0, 0},
+	{2076, 0, 0},
+	{2077, 0, 0},
+	{2078, 0, 0},
+	{2079, 0, 0},
+	{2080, 0, 0},
+	{2081, 0, 0},
+	{2082, 0, 0},
+	{2083, 0, 0},
+	{2084, 0, 0},
+	{2085, 0, 0},
+	{2086, 0, 0},
+	{2087, 0, 0},
+	{2088, 0, 0},
+	{2089, 0, 0},
+	{2090, 0, 0},
+	{2091, 0, 0},
+	{2092, 0, 0},
+	{2093, 0, 0},
+	{2094, 0, 0},
+	{2095, 0, 0},
+	{2096, 0, 0},
+	{2097, 0, 0},
+	{2098, 0, 0},
+	{2099, 0, 0},
+	{2100, 0, 0},
+	{2101, 0, 0},
+	{2102, 0, 0},
+	{2103, 0, 0},
+	{2104, 0, 0},
+	{2105, 0, 0},
+	{2106, 0, 0},
+	{2107, 0, 0},
+	{2108, 0, 0},
+	{2109, 0, 0},
+	{2110, 0, 0},
+	{2111, 0, 0},
+	{2112, 0, 0},
+	{2113, 0, 0},
+	{2114, 0, 0},
+	{2115, 0, 0},
+	{2116, 0, 0},
+	{2117, 0, 0},
+	{2118, 0, 0},
+	{2119, 0, 0},
+	{2120, 0, 0},
+	{2121, 0, 0},
+	{2122, 0, 0},
+	{2123, 0, 0},
+	{2124, 0, 0},
+	{2125, 0, 0},
+	{2126, 0, 0},
+	{2127, 0, 0},
+	{2128, 0, 0},
+	{2129, 0, 0},
+	{2130, 0, 0},
+	{2131, 0, 0},
+	{2132, 0, 0},
+	{2133, 0, 0},
+	{2134, 0, 0},
+	{2135, 0, 0},
+	{2136, 0, 0},
+	{2137, 0, 0},
+	{2138, 0, 0},
+	{2139, 0, 0},
+	{2140, 0, 0},
+	{2141, 0, 0},
+	{2142, 0, 0},
+	{2143, 0, 0},
+	{2144, 0, 0},
+	{2145, 0, 0},
+	{2146, 0, 0},
+	{2147, 0, 0},
+	{2148, 0, 0},
+	{2149, 0, 0},
+	{2150, 0, 0},
+	{2151, 0, 0},
+	{2152, 0, 0},
+	{2153, 0, 0},
+	{2154, 0, 0},
+	{2155, 0, 0},
+	{2156, 0, 0},
+	{2157, 0, 0},
+	{2158, 0, 0},
+	{2159, 0, 0},
+	{2160, 0, 0},
+	{2161, 0, 0},
+	{2162, 0, 0},
+	{2163, 0, 0},
+	{2164, 0, 0},
+	{2165, 0, 0},
+	{2166, 0, 0},
+	{2167, 0, 0},
+	{2168, 0, 0},
+	{2169, 0, 0},
+	{2170, 0, 0},
+	{2171, 0, 0},
+	{2172, 0, 0},
+	{2173, 0, 0},
+	{2174, 0, 0},
+	{2175, 0, 0},
+	{2176, 0, 0},
+	{2177, 0, 0},
+	{2178, 0, 0},
+	{2179, 0, 0},
+	{2180, 0, 0},
+	{2181, 0, 0},
+	{2182, 0, 0},
+	{2183, 0, 0},
+	{2184, 0, 0},
+	{2185, 0, 0},
+	{2186, 0, 0},
+	{2187, 0, 0},
+	{2188, 0, 0},
+	{2189, 0, 0},
+	{2190, 0, 0},
+	{2191, 0, 0},
+	{2192, 0, 0},
+	{2193, 0, 0},
+	{2194, 0, 0},
+	{2195, 0, 0},
+	{2196, 0, 0},
+	{2197, 0, 0},
+	{2198, 0, 0},
+	{2199, 0, 0},
+	{2200, 0, 0},
+	{2201, 0, 0},
+	{2202, 0, 0},
+	{2203, 0, 0},
+	{2204, 0, 0},
+	{2205, 0, 0},
+	{2206, 0, 0},
+	{2207, 0, 0},
+	{2208, 0, 0},
+	{2209, 0, 0},
+	{2210, 0, 0},
+	{2211, 0, 0},
+	{2212, 0, 0},
+	{2213, 0, 0},
+	{2214, 0, 0},
+	{2215, 0, 0},
+	{2216, 0, 0},
+	{2217, 0, 0},
+	{2218, 0, 0},
+	{2219, 0, 0},
+	{2220, 0, 0},
+	{2221, 0, 0},
+	{2222, 0, 0},
+	{2223, 0, 0},
+	{2224, 0, 0},
+	{2225, 0, 0},
+	{2226, 0, 0},
+	{2227, 0, 0},
+	{2228, 0, 0},
+	{2229, 0, 0},
+	{2230, 0, 0},
+	{2231, 0, 0},
+	{2232, 0, 0},
+	{2233, 0, 0},
+	{2234, 0, 0},
+	{2235, 0, 0},
+	{2236, 0, 0},
+	{2237, 0, 0},
+	{2238, 0, 0},
+	{2239, 0, 0},
+	{2240, 0, 0},
+	{2241, 0, 0},
+	{2242, 0, 0},
+	{2243, 0, 0},
+	{2244, 0, 0},
+	{2245, 0, 0},
+	{2246, 0, 0},
+	{2247, 0, 0},
+	{2248, 0, 0},
+	{2249, 0, 0},
+	{2250, 0, 0},
+	{2251, 0, 0},
+	{2252, 0, 0},
+	{2253, 0, 0},
+	{2254, 0, 0},
+	{2255, 0, 0},
+	{2256, 0, 0},
+	{2257, 0, 0},
+	{2258, 0, 0},
+	{2259, 0, 0},
+	{2260, 0, 0},
+	{2261, 0, 0},
+	{2262, 0, 0},
+	{2263, 0, 0},
+	{2264, 0, 0},
+	{2265, 0, 0},
+	{2266, 0, 0},
+	{2267, 0, 0},
+	{2268, 0, 0},
+	{2269, 0, 0},
+	{2270, 0, 0},
+	{2271, 0, 0},
+	{2272, 0, 0},
+	{2273, 0, 0},
+	{2274, 0, 0},
+	{2275, 0, 0},
+	{2276, 0, 0},
+	{2277, 0, 0},
+	{2278, 0, 0},
+	{2279, 0, 0},
+	{2280, 0, 0},
+	{2281, 0, 0},
+	{2282, 0, 0},
+	{2283, 0, 0},
+	{2284, 0, 0},
+	{2285, 0, 0},
+	{2286, 0, 0},
+	{2287, 0, 0},
+	{2288, 0, 0},
+	{2289, 0, 0},
+	{2290, 0, 0},
+	{2291, 0, 0},
+	{2292, 0, 0},
+	{2293, 0, 0},
+	{2294, 0, 0},
+	{2295, 0, 0},
+	{2296, 0, 0},
+	{2297, 0, 0},
+	{2298, 0, 0},
+	{2299, 0, 0},
+	{2300, 0, 0},
+	{2301, 0, 0},
+	{2302, 0, 0},
+	{2303, 0, 0},
+	{2304, 0, 0},
+	{2305, 0, 0},
+	{2306, 0, 0},
+	{2307, 0, 0},
+	{2308, 0, 0},
+	{2309, 0, 0},
+	{2310, 0, 0},
+	{2311, 0, 0},
+	{2312, 0, 0},
+	{2313, 0, 0},
+	{2314, 0, 0},
+	{2315, 0, 0},
+	{2316, 0, 0},
+	{2317, 0, 0},
+	{2318, 0, 0},
+	{2319, 0, 0},
+	{2320, 0, 0},
+	{2321, 0, 0},
+	{2322, 0, 0},
+	{2323, 0, 0},
+	{2324, 0, 0},
+	{2325, 0, 0},
+	{2326, 0, 0},
+	{2327, 0, 0},
+	{2328, 0, 0},
+	{2329, 0, 0},
+	{2330, 0, 0},
+	{2331, 0, 0},
+	{2332, 0, 0},
+	{2333, 0, 0},
+	{2334, 0, 0},
+	{2335, 0, 0},
+	{2336, 0, 0},
+	{2337, 0, 0},
+	{2338, 0, 0},
+	{2339, 0, 0},
+	{2340, 0, 0},
+	{2341, 0, 0},
+	{2342, 0, 0},
+	{2343, 0, 0},
+	{2344, 0, 0},
+	{2345, 0, 0},
+	{2346, 0, 0},
+	{2347, 0, 0},
+	{2348, 0, 0},
+	{2349, 0, 0},
+	{2350, 0, 0},
+	{2351, 0, 0},
+	{2352, 0, 0},
+	{2353, 0, 0},
+	{2354, 0, 0},
+	{2355, 0, 0},
+	{2356, 0, 0},
+	{2357, 0, 0},
+	{2358, 0, 0},
+	{2359, 0, 0},
+	{2360, 0, 0},
+	{2361, 0, 0},
+	{2362, 0, 0},
+	{2363, 0, 0},
+	{2364, 0, 0},
+	{2365, 0, 0},
+	{2366, 0, 0},
+	{2367, 0, 0},
+	{2368, 0, 0},
+	{2369, 0, 0},
+	{2370, 0, 0},
+	{2371, 0, 0},
+	{2372, 0, 0},
+	{2373, 0, 0},
+	{2374, 0, 0},
+	{2375, 0, 0}
+};
+static const uint8_t dispatchShapeIndex[] = {
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	5,
+	4,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	3,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	5,
+	4,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	3,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	3,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	3,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	0,
+	0,
+	0,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	6,
+	0,
+	0,
+	0,
+	5,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	0,
+	0,
+	0,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	6,
+	0,
+	0,
+	0,
+	5,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	4,
+	3,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	3,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	3,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	3,
+	0,
+	0,
+	4,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	1,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0
+};
+static const EncodingEntry encodingTable[] = {
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x0}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x1}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x2}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x3}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x4}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x5}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0x81}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x10}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x11}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x12}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x13}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x14}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x15}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xa, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0x81}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x20}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x21}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x22}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x23}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x24}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x25}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xc, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0x81}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xd}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xc}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xbc}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xbd}},
+	{{5, 0, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x0, 0x0, 2, {0xf, 0xc8}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xa3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 2, {0xf, 0xba}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xbb}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 2, {0xf, 0xba}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xb3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xe, 2, {0xf, 0xba}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xab}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 2, {0xf, 0xba}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe8}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0xa, 1, {0xff}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xf8}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xfc}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 2, {0xf, 0xae}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xf5}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x38}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x39}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x3a}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x3b}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x3c}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x3d}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xf, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0x81}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x9, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x9, 2, {0xf, 0xc7}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 2, {0xf, 0xb0}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xb1}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0xa2}},
+	{{1, 3, 0, 0}, {0, 1, 0, 0}, 3, 0xf2, 0x0, 0x1, 3, {0xf, 0x38, 0xf0}},
+	{{1, 3, 0, 0}, {4, 4, 0, 0}, 0, 0xf2, 0x0, 0x1, 3, {0xf, 0x38, 0xf1}},
+	{{1, 3, 0, 0}, {8, 8, 0, 0}, 5, 0xf2, 0x0, 0x1, 3, {0xf, 0x38, 0xf1}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x9, 1, {0xfe}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0xff}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xe, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xe, 1, {0xf7}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x41}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x40}},
+	{{16, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xc8}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 2, {0xf, 0xae}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 2, {0xf, 0xae}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xf4}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xf, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0xf7}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xd, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0xf7}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xaf}},
+	{{1, 3, 14, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x6b}},
+	{{1, 3, 17, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x69}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xfe}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xff}},
+	{{15, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xcd}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xf1}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xcc}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xeb}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe9}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0xc, 1, {0xff}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x9f}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 2, {0xf, 0xae}},
+	{{1, 4, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x8d}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xc9}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0xae, 0xe8}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe2}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe1}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe0}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0xae, 0xf0}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x88}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x89}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x8a}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x8b}},
+	{{5, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0xb0}},
+	{{5, 18, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0xb8}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xc6}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xc7}},
+	{{11, 21, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0xa0}},
+	{{11, 21, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0xa1}},
+	{{21, 11, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0xa2}},
+	{{21, 11, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0xa3}},
+	{{4, 1, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x0, 0x1, 2, {0xf, 0xc3}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x11}},
+	{{1, 3, 0, 0}, {0, 1, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xbe}},
+	{{1, 3, 0, 0}, {0, 2, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xbf}},
+	{{1, 3, 0, 0}, {0, 4, 0, 0}, 3, 0x0, 0x0, 0x1, 1, {0x63}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x11}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x11}},
+	{{1, 3, 0, 0}, {0, 1, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xb6}},
+	{{1, 3, 0, 0}, {0, 2, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xb7}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x42}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xc, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0xf7}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xb, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0xf7}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x90}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 2, {0xf, 0x1f}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xa, 1, {0xf6}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0xf7}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x8}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x9}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0xa}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0xb}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0xc}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0xd}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x9, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0x81}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6b}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x63}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x2b}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x67}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x1c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x1e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x1d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xfc}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xfe}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd4}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xfd}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xec}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xed}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xdc}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xdd}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xf}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xdb}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xdf}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x0, 1, {0x90}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe0}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe3}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xe}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x74}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x76}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x29}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x75}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x61}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x60}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x64}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x66}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x37}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x65}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x63}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x62}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x2}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x1}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x41}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x7}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x4}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xee}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xde}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x38}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x39}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xea}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xda}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3b}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x3a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x28}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0xb}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe4}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x40}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf4}},
+	{{5, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0x0, 1, {0x58}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0x8, 1, {0x8f}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0xf3, 0x0, 0x1, 2, {0xf, 0xb8}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xeb}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x0}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x8}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0xa}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x9}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf2}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xe, 2, {0xf, 0x72}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xf, 2, {0xf, 0x73}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf3}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xe, 2, {0xf, 0x73}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf1}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xe, 2, {0xf, 0x71}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe2}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xc, 2, {0xf, 0x72}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe1}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xc, 2, {0xf, 0x71}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd2}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xa, 2, {0xf, 0x72}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xb, 2, {0xf, 0x73}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd3}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xa, 2, {0xf, 0x73}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd1}},
+	{{7, 15, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0xa, 2, {0xf, 0x71}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf8}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xfa}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xfb}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xf9}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe8}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe9}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd8}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd9}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x17}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x68}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x69}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6c}},
+	{{5, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0x0, 1, {0x50}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0xe, 1, {0xff}},
+	{{14, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0x0, 1, {0x6a}},
+	{{17, 0, 0, 0}, {0, 0, 0, 0}, 4, 0x0, 0x0, 0x0, 1, {0x68}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xef}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x31}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xc3}},
+	{{16, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xc2}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xa, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xa, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xa, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 1, {0xc1}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xb, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xb, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xb, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0xc1}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xc1}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x9, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x9, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x9, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 1, {0xc1}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x8}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x9}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x9e}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xf, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xf, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xf, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xf, 1, {0xc1}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x18}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x19}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x1a}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x1b}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x1c}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x1d}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xb, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 1, {0x81}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0xae, 0xf8}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xc, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xc, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xc, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 1, {0xc1}},
+	{{3, 1, 15, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xa4}},
+	{{3, 1, 12, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xa5}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xd, 1, {0xd0}},
+	{{3, 13, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0xd1}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xd, 1, {0xd2}},
+	{{3, 12, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0xd3}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xd, 1, {0xc0}},
+	{{3, 15, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0xc1}},
+	{{3, 1, 15, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xac}},
+	{{3, 1, 12, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xad}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x28}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x29}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x2a}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x2b}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x2c}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x2d}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xd, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 1, {0x81}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xf9}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xfd}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 2, {0xf, 0xae}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x5}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x84}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x85}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0xa8}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0xa9}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 1, {0xf6}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 1, {0xf7}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0xb}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x86}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x87}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x87}},
+	{{11, 5, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x90}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 2, {0xf, 0xc0}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0xc1}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x30}},
+	{{3, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x31}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x1, 1, {0x32}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 1, {0x33}},
+	{{3, 14, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xe, 1, {0x83}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x0, 1, {0x34}},
+	{{11, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x0, 1, {0x35}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0xe, 1, {0x80}},
+	{{3, 17, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xe, 1, {0x81}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xd, 2, {0xf, 0xae}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xc, 2, {0xf, 0xae}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x58}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x58}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x58}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x58}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd0}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0xd0}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x55}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x55}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x54}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x54}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0x98}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x98}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0x98}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xa6}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0xa7}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xa7}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0xc2}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0xa7}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x40}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x41}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x42}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x43}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x44}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x45}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x46}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x47}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x48}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x49}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4a}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4b}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4c}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4d}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4e}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 2, {0xf, 0x4f}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0x99}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x99}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0x99}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x5e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5e}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe3}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xe3}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x70}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x80}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x71}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x81}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x72}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x82}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x73}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x83}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x74}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x84}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x75}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x85}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x76}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x86}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x77}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x87}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x78}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x88}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x79}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x89}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7a}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8a}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7b}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8b}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7c}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8c}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7d}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8d}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7e}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8e}},
+	{{19, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x7f}},
+	{{20, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 2, {0xf, 0x8f}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xac}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0xad}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xad}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0xad}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x5f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x5d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5d}},
+	{{6, 3, 0, 0}, {0, 4, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6e}},
+	{{3, 6, 0, 0}, {4, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x7e}},
+	{{6, 3, 0, 0}, {0, 8, 0, 0}, 5, 0x66, 0x0, 0x1, 2, {0xf, 0x6e}},
+	{{3, 6, 0, 0}, {8, 0, 0, 0}, 5, 0x66, 0x0, 0x1, 2, {0xf, 0x7e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x7e}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xd6}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xa4}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0xa5}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xa5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x11}},
+	{{22, 22, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0xa5}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x59}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x59}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x59}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x59}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x56}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x56}},
+	{{3, 6, 15, 0}, {4, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x16}},
+	{{3, 6, 15, 0}, {8, 0, 0, 0}, 5, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x16}},
+	{{6, 3, 15, 0}, {0, 4, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x22}},
+	{{6, 3, 15, 0}, {0, 8, 0, 0}, 5, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x22}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x9d}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0x9c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x53}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x53}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x52}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x52}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xae}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0xaf}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xaf}},
+	{{11, 22, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0xaf}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x90}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x91}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x92}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x93}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x94}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x95}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x96}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x97}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x98}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x99}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9a}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9b}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9c}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9d}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9e}},
+	{{3, 0, 0, 0}, {0, 0, 0, 0}, 1, 0x0, 0x0, 0x8, 2, {0xf, 0x9f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x51}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x51}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x51}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x51}},
+	{{22, 11, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xaa}},
+	{{22, 11, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x0, 1, {0xab}},
+	{{22, 11, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 1, {0xab}},
+	{{22, 11, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0x0, 1, {0xab}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x5c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x57}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x57}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xc2}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0xc2}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0xc2}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x2f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x2f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0xe6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5b}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0xe6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x5b}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x5a}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0xf2, 0x0, 0x1, 2, {0xf, 0x2d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x5a}},
+	{{6, 3, 0, 0}, {0, 4, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x2a}},
+	{{6, 3, 0, 0}, {0, 8, 0, 0}, 5, 0xf2, 0x0, 0x1, 2, {0xf, 0x2a}},
+	{{6, 3, 0, 0}, {0, 4, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x2a}},
+	{{6, 3, 0, 0}, {0, 8, 0, 0}, 5, 0xf3, 0x0, 0x1, 2, {0xf, 0x2a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5a}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0xf3, 0x0, 0x1, 2, {0xf, 0x2d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x5b}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0xf2, 0x0, 0x1, 2, {0xf, 0x2c}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0xf3, 0x0, 0x1, 2, {0xf, 0x2c}},
+	{{3, 6, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x17}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x7c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x7c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x7d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x7d}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x21}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0xf0}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 2, {0xf, 0x1f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x28}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x29}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x28}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x29}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x12}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x6f}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x7f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x6f}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x7f}},
+	{{6, 7, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x12}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x16}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x17}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x16}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x17}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x16}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x12}},
+	{{6, 7, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x16}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x12}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x13}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x12}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x13}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x66, 0x0, 0x1, 2, {0xf, 0x50}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x0, 0x1, 2, {0xf, 0x50}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xe7}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x2a}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x2b}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x2b}},
+	{{6, 3, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x20}},
+	{{6, 3, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xc4}},
+	{{3, 6, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0x14}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x66, 0x0, 0x1, 2, {0xf, 0xd7}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x21}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x22}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x25}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x20}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x23}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x24}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x31}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x32}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x35}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x30}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x33}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x38, 0x34}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 2, {0xf, 0xd}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x8, 2, {0xf, 0x18}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 2, {0xf, 0x18}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xa, 2, {0xf, 0x18}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0xb, 2, {0xf, 0x18}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x9, 2, {0xf, 0xd}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x70}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0xf3, 0x0, 0x1, 2, {0xf, 0x70}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0xf2, 0x0, 0x1, 2, {0xf, 0x70}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x60}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x62}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x61}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xb}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 3, {0xf, 0x3a, 0xa}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0xc6}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0xc6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x2e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x2e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x15}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x15}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x66, 0x0, 0x1, 2, {0xf, 0x14}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x1, 2, {0xf, 0x14}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0x1, 0xd0}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0x1, 0xd5}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0x1, 0xd6}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0x0, 3, {0xf, 0x1, 0xf9}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0xf3, 0x0, 0x1, 2, {0xf, 0xbd}},
+	{{1, 3, 0, 0}, {0, 0, 0, 0}, 2, 0xf3, 0x0, 0x1, 2, {0xf, 0xbc}},
+	{{1, 4, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 3, {0xf, 0x38, 0xf0}},
+	{{4, 1, 0, 0}, {0, 0, 0, 0}, 2, 0x0, 0x0, 0x1, 3, {0xf, 0x38, 0xf1}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0xb, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0xc, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x0, 0xd, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0xb, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0xc, 2, {0xf, 0xc7}},
+	{{4, 0, 0, 0}, {0, 0, 0, 0}, 5, 0x0, 0x0, 0xd, 2, {0xf, 0xc7}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x11}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x10}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x11}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x10}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x11}},
+	{{6, 9, 7, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x10}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x10}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x11}},
+	{{6, 9, 7, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x10}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x14}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x14}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x15}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x15}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x28}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x29}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x28}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x29}},
+	{{6, 9, 3, 0}, {0, 0, 4, 0}, 0, 0x0, 0x103, 0x1, 1, {0x2a}},
+	{{6, 9, 3, 0}, {0, 0, 8, 0}, 5, 0x0, 0x103, 0x1, 1, {0x2a}},
+	{{6, 9, 3, 0}, {0, 0, 4, 0}, 0, 0x0, 0x102, 0x1, 1, {0x2a}},
+	{{6, 9, 3, 0}, {0, 0, 8, 0}, 5, 0x0, 0x102, 0x1, 1, {0x2a}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x2b}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x2b}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x103, 0x1, 1, {0x2c}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x102, 0x1, 1, {0x2c}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x103, 0x1, 1, {0x2d}},
+	{{1, 8, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x102, 0x1, 1, {0x2d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x2e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x2e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x2f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x2f}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x100, 0x1, 1, {0x50}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x101, 0x1, 1, {0x50}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x51}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x51}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x51}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x51}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x54}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x54}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x55}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x55}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x56}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x56}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x57}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x57}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x58}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x58}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x58}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x58}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x59}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x59}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x59}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x59}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x5a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x5a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x5c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x5c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x5c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x5c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x5d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x5d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x5d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x5d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x5e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x5e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x5e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x5e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0x5f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x5f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x5f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x5f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x60}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x61}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x62}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x63}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x64}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x65}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x66}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x67}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x68}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x69}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6b}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6d}},
+	{{6, 3, 0, 0}, {0, 4, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6e}},
+	{{3, 6, 0, 0}, {4, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x7e}},
+	{{6, 3, 0, 0}, {0, 8, 0, 0}, 5, 0x0, 0x101, 0x1, 1, {0x6e}},
+	{{3, 6, 0, 0}, {8, 0, 0, 0}, 5, 0x0, 0x101, 0x1, 1, {0x7e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x7e}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd6}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x6f}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x7f}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x6f}},
+	{{8, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x7f}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x70}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0x70}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0x70}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x74}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x75}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0x76}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x108, 0x0, 1, {0x77}},
+	{{0, 0, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x10c, 0x0, 1, {0x77}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0xc2}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xc2}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x103, 0x1, 1, {0xc2}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x102, 0x1, 1, {0xc2}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x100, 0x1, 1, {0xc6}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xc6}},
+	{{1, 7, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x101, 0x1, 1, {0xd7}},
+	{{4, 6, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe7}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd1}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xa, 1, {0x71}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd2}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xa, 1, {0x72}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd3}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xa, 1, {0x73}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe1}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xc, 1, {0x71}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe2}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xc, 1, {0x72}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf1}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xe, 1, {0x71}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf2}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xe, 1, {0x72}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf3}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xe, 1, {0x73}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd4}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd5}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xd9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xda}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xdb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xdc}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xdd}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xde}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xdf}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe0}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe3}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe4}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe5}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xe9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xea}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xeb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xec}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xed}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xee}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xef}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf4}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf5}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf6}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xf9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xfa}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xfb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xfc}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xfd}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0x1, 1, {0xfe}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x0}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x1}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x2}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x4}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x5}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x6}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x7}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xa}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x20d, 0x1, 1, {0x16}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x17}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x18}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x20d, 0x1, 1, {0x19}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x20d, 0x1, 1, {0x1a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x1c}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x1d}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x1e}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x20}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x21}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x22}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x23}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x24}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x25}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x30}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x31}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x32}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x33}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x34}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x35}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x28}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x29}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x2a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x2b}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x20d, 0x1, 1, {0x36}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x37}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x38}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x39}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3b}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x3f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x40}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x41}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x45}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x45}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x46}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x47}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x47}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x58}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x59}},
+	{{6, 4, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x20d, 0x1, 1, {0x5a}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x78}},
+	{{6, 8, 0, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x79}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x98}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x98}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x99}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x99}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9a}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9b}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9b}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9c}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9d}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9e}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0x9f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0x9f}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xa8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xa8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xa9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xa9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xaa}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xaa}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xab}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xab}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xac}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xac}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xad}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xad}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xae}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xae}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xaf}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xaf}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xb8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xb8}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xb9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xb9}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xba}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xba}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xbb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xbb}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xbc}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xbc}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xbd}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xbd}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xbe}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xbe}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x201, 0x1, 1, {0xbf}},
+	{{6, 9, 8, 0}, {0, 0, 0, 0}, 0, 0x0, 0x281, 0x1, 1, {0xbf}},
+	{{1, 10, 3, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0x1, 1, {0xf2}},
+	{{1, 3, 10, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0x1, 1, {0xf5}},
+	{{1, 10, 3, 0}, {0, 0, 0, 0}, 3, 0x0, 0x203, 0x1, 1, {0xf5}},
+	{{1, 10, 3, 0}, {0, 0, 0, 0}, 3, 0x0, 0x202, 0x1, 1, {0xf5}},
+	{{1, 10, 3, 0}, {0, 0, 0, 0}, 3, 0x0, 0x203, 0x1, 1, {0xf6}},
+	{{1, 3, 10, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0x1, 1, {0xf7}},
+	{{1, 3, 10, 0}, {0, 0, 0, 0}, 3, 0x0, 0x201, 0x1, 1, {0xf7}},
+	{{1, 3, 10, 0}, {0, 0, 0, 0}, 3, 0x0, 0x203, 0x1, 1, {0xf7}},
+	{{1, 3, 10, 0}, {0, 0, 0, 0}, 3, 0x0, 0x202, 0x1, 1, {0xf7}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x38d, 0x1, 1, {0x0}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x38d, 0x1, 1, {0x1}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x2}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x6}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x8}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x9}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0xa}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0xb}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0xe}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0xf}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x18}},
+	{{8, 6, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x19}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x38}},
+	{{8, 6, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x39}},
+	{{6, 9, 8, 15}, {0, 0, 0, 0}, 0, 0x0, 0x30d, 0x1, 1, {0x46}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x60}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x61}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x62}},
+	{{6, 8, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x301, 0x1, 1, {0x63}},
+	{{1, 3, 15, 0}, {0, 0, 0, 0}, 3, 0x0, 0x303, 0x1, 1, {0xf0}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xb, 1, {0x73}},
+	{{9, 7, 15, 0}, {0, 0, 0, 0}, 0, 0x0, 0x101, 0xf, 1, {0x73}},
+	{{10, 3, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0xb, 1, {0xf3}},
+	{{10, 3, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0xa, 1, {0xf3}},
+	{{10, 3, 0, 0}, {0, 0, 0, 0}, 3, 0x0, 0x200, 0x9, 1, {0xf3}}
+};
+static const uint16_t encodingIndex[] = {
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	9,
+	18,
+	27,
+	27,
+	28,
+	29,
+	29,
+	29,
+	29,
+	30,
+	31,
+	32,
+	34,
+	36,
+	38,
+	40,
+	40,
+	42,
+	43,
+	44,
+	45,
+	45,
+	45,
+	46,
+	55,
+	56,
+	57,
+	59,
+	60,
+	63,
+	63,
+	63,
+	65,
+	67,
+	68,
+	69,
+	69,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	70,
+	71,
+	72,
+	72,
+	72,
+	72,
+	72,
+	73,
+	75,
+	80,
+	80,
+	82,
+	83,
+	84,
+	85,
+	85,
+	85,
+	85,
+	85,
+	85,
+	88,
+	89,
+	89,
+	90,
+	90,
+	91,
+	92,
+	92,
+	93,
+	93,
+	93,
+	94,
+	95,
+	96,
+	96,
+	96,
+	97,
+	109,
+	110,
+	112,
+	114,
+	115,
+	117,
+	119,
+	121,
+	122,
+	124,
+	126,
+	128,
+	130,
+	139,
+	139,
+	140,
+	141,
+	142,
+	143,
+	144,
+	145,
+	146,
+	147,
+	148,
+	149,
+	150,
+	151,
+	152,
+	153,
+	154,
+	155,
+	156,
+	157,
+	158,
+	159,
+	159,
+	160,
+	160,
+	161,
+	162,
+	163,
+	164,
+	165,
+	166,
+	167,
+	168,
+	169,
+	170,
+	171,
+	172,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	173,
+	174,
+	175,
+	176,
+	177,
+	178,
+	179,
+	180,
+	180,
+	180,
+	181,
+	182,
+	183,
+	184,
+	185,
+	186,
+	187,
+	188,
+	189,
+	190,
+	191,
+	192,
+	193,
+	194,
+	195,
+	196,
+	196,
+	197,
+	198,
+	199,
+	200,
+	201,
+	203,
+	204,
+	205,
+	206,
+	207,
+	208,
+	209,
+	210,
+	212,
+	213,
+	215,
+	217,
+	219,
+	221,
+	223,
+	224,
+	226,
+	228,
+	229,
+	230,
+	231,
+	232,
+	233,
+	234,
+	235,
+	236,
+	236,
+	237,
+	238,
+	239,
+	240,
+	241,
+	242,
+	246,
+	247,
+	247,
+	247,
+	248,
+	248,
+	250,
+	256,
+	262,
+	268,
+	274,
+	275,
+	276,
+	276,
+	277,
+	277,
+	283,
+	292,
+	293,
+	299,
+	301,
+	307,
+	309,
+	318,
+	319,
+	320,
+	320,
+	321,
+	322,
+	322,
+	322,
+	322,
+	328,
+	329,
+	329,
+	329,
+	329,
+	329,
+	333,
+	333,
+	335,
+	344,
+	345,
+	346,
+	347,
+	348,
+	349,
+	350,
+	351,
+	352,
+	353,
+	354,
+	355,
+	356,
+	357,
+	358,
+	359,
+	360,
+	361,
+	363,
+	364,
+	365,
+	366,
+	367,
+	368,
+	369,
+	370,
+	371,
+	372,
+	373,
+	374,
+	375,
+	376,
+	377,
+	378,
+	379,
+	380,
+	381,
+	382,
+	383,
+	384,
+	385,
+	386,
+	387,
+	387,
+	387,
+	387,
+	387,
+	387,
+	388,
+	389,
+	391,
+	393,
+	395,
+	397,
+	399,
+	401,
+	403,
+	405,
+	407,
+	409,
+	411,
+	413,
+	415,
+	417,
+	419,
+	421,
+	422,
+	423,
+	424,
+	425,
+	426,
+	427,
+	428,
+	429,
+	430,
+	431,
+	432,
+	433,
+	435,
+	439,
+	440,
+	441,
+	444,
+	445,
+	446,
+	447,
+	448,
+	449,
+	450,
+	451,
+	451,
+	451,
+	451,
+	451,
+	452,
+	453,
+	454,
+	455,
+	455,
+	455,
+	455,
+	455,
+	456,
+	456,
+	456,
+	456,
+	456,
+	457,
+	458,
+	459,
+	460,
+	461,
+	462,
+	463,
+	464,
+	465,
+	466,
+	467,
+	468,
+	469,
+	470,
+	471,
+	472,
+	473,
+	474,
+	475,
+	476,
+	477,
+	478,
+	479,
+	480,
+	481,
+	482,
+	483,
+	484,
+	485,
+	486,
+	487,
+	488,
+	489,
+	490,
+	491,
+	492,
+	493,
+	494,
+	495,
+	496,
+	497,
+	498,
+	499,
+	500,
+	501,
+	502,
+	503,
+	503,
+	504,
+	504,
+	504,
+	505,
+	506,
+	506,
+	507,
+	508,
+	510,
+	512,
+	513,
+	514,
+	515,
+	515,
+	516,
+	516,
+	517,
+	518,
+	519,
+	520,
+	521,
+	522,
+	523,
+	524,
+	525,
+	525,
+	525,
+	525,
+	525,
+	525,
+	525,
+	525,
+	526,
+	526,
+	528,
+	530,
+	531,
+	531,
+	533,
+	535,
+	536,
+	538,
+	540,
+	541,
+	542,
+	543,
+	545,
+	547,
+	548,
+	549,
+	550,
+	551,
+	552,
+	553,
+	553,
+	553,
+	553,
+	554,
+	555,
+	556,
+	556,
+	557,
+	558,
+	559,
+	560,
+	561,
+	562,
+	563,
+	564,
+	565,
+	566,
+	567,
+	568,
+	569,
+	570,
+	571,
+	572,
+	573,
+	574,
+	575,
+	576,
+	577,
+	578,
+	578,
+	579,
+	580,
+	581,
+	582,
+	583,
+	583,
+	583,
+	583,
+	584,
+	585,
+	585,
+	585,
+	585,
+	586,
+	587,
+	588,
+	589,
+	590,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	591,
+	592,
+	592,
+	592,
+	592,
+	592,
+	592,
+	593,
+	594,
+	594,
+	595,
+	596,
+	597,
+	599,
+	600,
+	601,
+	602,
+	603,
+	604,
+	605,
+	607,
+	609,
+	612,
+	615,
+	615,
+	615,
+	615,
+	615,
+	615,
+	616,
+	617,
+	618,
+	619,
+	619,
+	619,
+	619,
+	619,
+	621,
+	623,
+	625,
+	627,
+	628,
+	629,
+	630,
+	631,
+	632,
+	633,
+	634,
+	635,
+	636,
+	637,
+	638,
+	639,
+	640,
+	641,
+	642,
+	643,
+	643,
+	643,
+	643,
+	643,
+	644,
+	645,
+	646,
+	647,
+	648,
+	649,
+	650,
+	651,
+	652,
+	653,
+	654,
+	655,
+	656,
+	657,
+	658,
+	659,
+	659,
+	659,
+	660,
+	661,
+	661,
+	661,
+	661,
+	662,
+	663,
+	664,
+	665,
+	666,
+	667,
+	668,
+	669,
+	670,
+	671,
+	672,
+	673,
+	674,
+	675,
+	676,
+	677,
+	678,
+	679,
+	680,
+	681,
+	682,
+	683,
+	684,
+	685,
+	686,
+	687,
+	688,
+	689,
+	690,
+	691,
+	693,
+	697,
+	699,
+	701,
+	702,
+	703,
+	704,
+	705,
+	706,
+	707,
+	708,
+	709,
+	709,
+	709,
+	709,
+	709,
+	710,
+	711,
+	712,
+	713,
+	713,
+	713,
+	714,
+	715,
+	715,
+	715,
+	716,
+	716,
+	716,
+	716,
+	717,
+	717,
+	717,
+	719,
+	721,
+	723,
+	725,
+	727,
+	729,
+	731,
+	733,
+	734,
+	735,
+	736,
+	737,
+	738,
+	739,
+	740,
+	741,
+	742,
+	743,
+	744,
+	745,
+	746,
+	747,
+	748,
+	749,
+	750,
+	751,
+	752,
+	753,
+	754,
+	755,
+	756,
+	757,
+	758,
+	759,
+	760,
+	761,
+	762,
+	763,
+	764,
+	765,
+	766,
+	767,
+	768,
+	769,
+	770,
+	771,
+	772,
+	773,
+	774,
+	775,
+	776,
+	777,
+	777,
+	777,
+	777,
+	777,
+	777,
+	778,
+	779,
+	780,
+	781,
+	782,
+	783,
+	784,
+	785,
+	786,
+	787,
+	788,
+	789,
+	790,
+	791,
+	792,
+	793,
+	794,
+	795,
+	796,
+	797,
+	798,
+	799,
+	800,
+	801,
+	801,
+	801,
+	802,
+	803,
+	804,
+	805,
+	806,
+	807,
+	808,
+	809,
+	810,
+	811,
+	812,
+	813,
+	814,
+	815,
+	816,
+	817,
+	818,
+	819,
+	820,
+	821,
+	822,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	823,
+	824,
+	825,
+	826,
+	827,
+	828,
+	829,
+	830,
+	831,
+	832,
+	833,
+	834,
+	835,
+	836,
+	837,
+	838,
+	839,
+	839,
+	839,
+	839,
+	839,
+	840,
+	841,
+	842,
+	843,
+	844,
+	845,
+	846,
+	847,
+	848,
+	849,
+	850,
+	851,
+	852,
+	853,
+	854,
+	855,
+	855,
+	855,
+	855,
+	855,
+	856,
+	857,
+	858,
+	859,
+	860,
+	861,
+	862,
+	863,
+	864,
+	865,
+	866,
+	867,
+	868,
+	869,
+	870,
+	871,
+	871,
+	871,
+	871,
+	871,
+	871,
+	872,
+	873,
+	874,
+	875,
+	876,
+	877,
+	878,
+	879,
+	880,
+	881,
+	882,
+	883,
+	884,
+	885,
+	886,
+	887,
+	888,
+	888,
+	888,
+	889,
+	890,
+	890,
+	890,
+	890,
+	890,
+	891,
+	892,
+	892,
+	892,
+	892,
+	892,
+	892,
+	893,
+	894,
+	894,
+	894,
+	894,
+	894,
+	895,
+	895,
+	895,
+	895,
+	896,
+	897,
+	898,
+	899,
+	899,
+	900,
+	901,
+	902,
+	903,
+	904,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905,
+	905
 };
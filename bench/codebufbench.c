@@ -0,0 +1,102 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Measures code emission throughput into a CodeBuffer, in megabytes of machine code per second
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../codebuf.h"
+
+#define FUNCTION_COUNT 200000
+
+
+static double GetTime(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + ((double)ts.tv_nsec / 1000000000.0);
+}
+
+
+// Emits the example function from the readme, which returns the sum of the integers in [b, b + a)
+static void EmitFunction(CodeBuffer* buf)
+{
+	X86_DECLARE_JUMP_LABEL(loop);
+	CODEBUF_EMIT64_R(buf, push, REG_RBP);
+	CODEBUF_EMIT64_RR(buf, mov_64, REG_RBP, REG_RSP);
+	CODEBUF_EMIT64_RI(buf, sub_64, REG_RSP, 0x8);
+	CODEBUF_EMIT64_MR(buf, mov_32, X86_MEM(REG_RBP, -0x8), REG_EDI);
+	CODEBUF_EMIT64_MR(buf, mov_32, X86_MEM(REG_RBP, -0x4), REG_ESI);
+	CODEBUF_EMIT64_RR(buf, xor_32, REG_EAX, REG_EAX);
+	CODEBUF_EMIT64_RM(buf, mov_32, REG_ECX, X86_MEM(REG_RBP, -0x8));
+	CODEBUF_EMIT64_RM(buf, mov_32, REG_EDX, X86_MEM(REG_RBP, -0x4));
+	CODEBUF_MARK_JUMP_LABEL_64(buf, loop);
+	CODEBUF_EMIT64_RR(buf, add_32, REG_EAX, REG_EDX);
+	CODEBUF_EMIT64_R(buf, inc_32, REG_EDX);
+	CODEBUF_EMIT64_R(buf, dec_32, REG_ECX);
+	CODEBUF_EMIT64_T(buf, jnz, loop);
+	CODEBUF_EMIT64_RR(buf, mov_64, REG_RSP, REG_RBP);
+	CODEBUF_EMIT64_R(buf, pop, REG_RBP);
+	CODEBUF_EMIT64(buf, retn);
+}
+
+
+int main(void)
+{
+	CodeBuffer buf;
+	uint32_t (*func)(uint32_t count, uint32_t start);
+	double start, elapsed;
+	size_t i, last = 0;
+
+	if (!InitCodeBuffer(&buf, 0, 0))
+	{
+		fprintf(stderr, "Unable to create code buffer\n");
+		return 1;
+	}
+
+	start = GetTime();
+	for (i = 0; i < FUNCTION_COUNT; i++)
+	{
+		last = buf.offset;
+		EmitFunction(&buf);
+	}
+	func = (uint32_t (*)(uint32_t, uint32_t))FinalizeCodeBuffer(&buf);
+	elapsed = GetTime() - start;
+
+	if (!func)
+	{
+		fprintf(stderr, "Code buffer overflow\n");
+		return 1;
+	}
+
+	// Run the last emitted copy to make sure the executable view is correct
+	func = (uint32_t (*)(uint32_t, uint32_t))((uint8_t*)func + last);
+	if (func(10, 1) != 55)
+	{
+		fprintf(stderr, "Generated code returned incorrect result\n");
+		return 1;
+	}
+
+	printf("codebuf: %s mapping, %lu bytes in %.3f ms, %.1f MB/s\n", buf.dualMapped ? "dual" : "single",
+		(unsigned long)buf.offset, elapsed * 1000.0, ((double)buf.offset / (1024.0 * 1024.0)) / elapsed);
+	FreeCodeBuffer(&buf);
+	return 0;
+}
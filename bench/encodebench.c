@@ -0,0 +1,295 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Measures EncodeInstruction64 throughput over random bytes from a fixed seed, and over any 64-bit code files
+// given on the command line.  Each re-encoded instruction is checked to decode back to the same instruction,
+// RelocateInstructions64 is checked against a set of vectors, and the benchmark exits with an error if any of
+// them differ.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../asmx86.h"
+#include "../relocx86.h"
+
+#define RANDOM_SEED 1
+#define RANDOM_LENGTH (4 * 1024 * 1024)
+#define BATCH_SIZE 4096
+#define MAX_REPORTED_FAILURES 16
+
+
+typedef struct RelocVector
+{
+	const char* name;
+	uint64_t srcAddr;
+	uint8_t src[16];
+	size_t srcLength;
+	size_t minLength;
+	uint64_t destAddr;
+	RelocResult result;
+	uint8_t dest[32];
+	size_t destLength;
+} RelocVector;
+
+
+#define FAR_DEST 0x7f0000000000ULL
+
+static const RelocVector relocVectors[] =
+{
+	// JRCXZ and LOOP only have 8-bit forms, so a far target is reached by branching over a short jump
+	{"jrcxz far", 0x400000, {0xe3, 0x10}, 2, 2, FAR_DEST, RELOC_OK,
+		{0xe3, 0x02, 0xeb, 0x0e, 0xff, 0x25, 0, 0, 0, 0, 0x12, 0x00, 0x40, 0, 0, 0, 0, 0}, 18},
+	{"jrcxz near", 0x400000, {0xe3, 0x10}, 2, 2, 0x400100, RELOC_OK,
+		{0xe3, 0x02, 0xeb, 0x05, 0xe9, 0x09, 0xff, 0xff, 0xff}, 9},
+	{"loop far", 0x400000, {0xe2, 0x20}, 2, 2, FAR_DEST, RELOC_OK,
+		{0xe2, 0x02, 0xeb, 0x0e, 0xff, 0x25, 0, 0, 0, 0, 0x22, 0x00, 0x40, 0, 0, 0, 0, 0}, 18},
+	{"jcc far", 0x400000, {0x75, 0x30}, 2, 2, FAR_DEST, RELOC_OK,
+		{0x74, 0x0e, 0xff, 0x25, 0, 0, 0, 0, 0x32, 0x00, 0x40, 0, 0, 0, 0, 0}, 16},
+
+	// Branches to instructions inside the relocated range go to the relocated copy
+	{"in range", 0x400000, {0x74, 0x01, 0x90, 0xe2, 0xfb, 0xc3}, 6, 6, FAR_DEST, RELOC_OK,
+		{0x74, 0x01, 0x90, 0xe2, 0xfb, 0xc3}, 6},
+
+	// RIP-relative displacements are rewritten in place, including when an immediate follows them
+	{"cmp near", 0x400000, {0x80, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x05}, 7, 7, 0x500000, RELOC_OK,
+		{0x80, 0x3d, 0x00, 0x10, 0xf0, 0xff, 0x05}, 7},
+
+	// A RIP-relative LEA that is out of range becomes a move of the address
+	{"lea far", 0x400000, {0x48, 0x8d, 0x05, 0x00, 0x10, 0x00, 0x00}, 7, 5, FAR_DEST, RELOC_OK,
+		{0xb8, 0x07, 0x10, 0x40, 0x00}, 5},
+	{"lea far 64-bit", 0x7f1234560000ULL, {0x4c, 0x8d, 0x3d, 0x00, 0x10, 0x00, 0x00}, 7, 5, 0x400000, RELOC_OK,
+		{0x49, 0xbf, 0x07, 0x10, 0x56, 0x34, 0x12, 0x7f, 0x00, 0x00}, 10},
+	{"mov far", 0x400000, {0x48, 0x8b, 0x05, 0x00, 0x10, 0x00, 0x00}, 7, 5, FAR_DEST, RELOC_OUT_OF_RANGE, {0}, 0},
+
+	// The jump targets the middle of the MOV
+	{"branch into instruction", 0x400000, {0xeb, 0x01, 0xb8, 0x01, 0x00, 0x00, 0x00}, 7, 7, FAR_DEST,
+		RELOC_INVALID_BRANCH_TARGET, {0}, 0}
+};
+
+
+static size_t failures = 0;
+
+
+static double GetTime(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + ((double)ts.tv_nsec / 1000000000.0);
+}
+
+
+static uint64_t Random(uint64_t* state)
+{
+	// xorshift64*
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545f4914f6cdd1dULL;
+}
+
+
+static uint8_t* ReadFile(const char* path, size_t* len)
+{
+	FILE* fp = fopen(path, "rb");
+	uint8_t* data;
+	long size;
+
+	if (!fp)
+		return NULL;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	data = (uint8_t*)malloc((size_t)size + 16);
+	if (data && (fread(data, 1, (size_t)size, fp) != (size_t)size))
+	{
+		free(data);
+		data = NULL;
+	}
+	fclose(fp);
+	*len = (size_t)size;
+	return data;
+}
+
+
+static bool IsSameOperand(const InstructionOperand* a, const InstructionOperand* b)
+{
+	if (a->operand != b->operand)
+		return false;
+	if ((a->operand == NONE) || (a->operand > MEM))
+		return true;
+	if (a->size != b->size)
+		return false;
+	if (a->relative != b->relative)
+		return false;
+
+	// A 16-bit immediate is zero extended when decoded, but the 8-bit form of the same value is sign extended
+	if (a->operand == IMM)
+		return (a->relative || (a->size >= 8)) ? (a->immediate == b->immediate) :
+			((((uint64_t)a->immediate ^ (uint64_t)b->immediate) & ((1ULL << (a->size * 8)) - 1)) == 0);
+	if (a->immediate != b->immediate)
+		return false;
+	if ((a->components[0] != b->components[0]) || (a->components[1] != b->components[1]) ||
+		(a->segment != b->segment))
+		return false;
+
+	// The scale of a SIB byte without an index has no effect
+	return (a->components[1] == NONE) || (a->scale == b->scale);
+}
+
+
+// Compares what an instruction does, redundant prefixes can be dropped when it is re-encoded
+static bool IsSameInstruction(const Instruction* a, const Instruction* b)
+{
+	const uint32_t flags = X86_FLAG_LOCK | X86_FLAG_ANY_REP | X86_FLAG_ZEROING | X86_FLAG_SAE;
+	size_t i;
+
+	if ((a->operation != b->operation) || ((a->flags & flags) != (b->flags & flags)))
+		return false;
+	for (i = 0; i < 4; i++)
+	{
+		if (!IsSameOperand(&a->operands[i], &b->operands[i]))
+			return false;
+	}
+	return true;
+}
+
+
+static void ReportFailure(const char* check, const uint8_t* code, size_t len, uint64_t addr)
+{
+	size_t i;
+	if (failures++ >= MAX_REPORTED_FAILURES)
+		return;
+	fprintf(stderr, "%s failed at 0x%llx:", check, (unsigned long long)addr);
+	for (i = 0; i < len; i++)
+		fprintf(stderr, " %02x", code[i]);
+	fprintf(stderr, "\n");
+}
+
+
+// Decodes the code in batches, times re-encoding each batch, then checks that each instruction that could be
+// re-encoded decodes back to the same instruction at the same address
+static void BenchEncode(const char* name, const uint8_t* data, size_t len)
+{
+	static Instruction instrs[BATCH_SIZE];
+	static size_t offsets[BATCH_SIZE];
+	static uint8_t code[BATCH_SIZE][16];
+	static size_t codeLen[BATCH_SIZE];
+	Instruction decoded;
+	size_t offset = 0, count, total = 0, encoded = 0, i;
+	double start, elapsed = 0;
+
+	while (offset < len)
+	{
+		for (count = 0; (count < BATCH_SIZE) && (offset < len); )
+		{
+			if (!Disassemble64(&data[offset], offset, len - offset, &instrs[count]))
+			{
+				offset++;
+				continue;
+			}
+			offsets[count] = offset;
+			offset += instrs[count++].length;
+		}
+
+		start = GetTime();
+		for (i = 0; i < count; i++)
+			codeLen[i] = EncodeInstruction64(&instrs[i], offsets[i], code[i]);
+		elapsed += GetTime() - start;
+
+		for (i = 0; i < count; i++)
+		{
+			if (codeLen[i] == 0)
+				continue;
+			encoded++;
+			if ((!Disassemble64(code[i], offsets[i], codeLen[i], &decoded)) || (decoded.length != codeLen[i]) ||
+				(!IsSameInstruction(&instrs[i], &decoded)))
+				ReportFailure("EncodeInstruction64 round trip", &data[offsets[i]], instrs[i].length, offsets[i]);
+		}
+		total += count;
+	}
+
+	printf("encode %s: %lu of %lu instructions re-encoded in %.3f ms, %.1f ns per instruction\n", name,
+		(unsigned long)encoded, (unsigned long)total, elapsed * 1000.0,
+		total ? ((elapsed * 1000000000.0) / (double)total) : 0.0);
+}
+
+
+static void CheckRelocation(void)
+{
+	const RelocVector* vector;
+	uint8_t dest[64];
+	RelocInfo info;
+	RelocResult result;
+	size_t i;
+
+	for (i = 0; i < (sizeof(relocVectors) / sizeof(RelocVector)); i++)
+	{
+		vector = &relocVectors[i];
+		result = RelocateInstructions64(vector->src, vector->srcAddr, vector->srcLength, vector->minLength, dest,
+			vector->destAddr, sizeof(dest), &info);
+		if ((result != vector->result) || ((result == RELOC_OK) && ((info.destLength != vector->destLength) ||
+			(memcmp(dest, vector->dest, vector->destLength) != 0))))
+		{
+			fprintf(stderr, "RelocateInstructions64 vector \"%s\" failed with result %d\n", vector->name, (int)result);
+			failures++;
+		}
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	uint8_t* data;
+	uint64_t state = RANDOM_SEED;
+	size_t len, i;
+	int arg;
+
+	data = (uint8_t*)malloc(RANDOM_LENGTH);
+	if (!data)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (i = 0; i < RANDOM_LENGTH; i++)
+		data[i] = (uint8_t)(Random(&state) >> 56);
+	BenchEncode("random", data, RANDOM_LENGTH);
+	free(data);
+
+	for (arg = 1; arg < argc; arg++)
+	{
+		data = ReadFile(argv[arg], &len);
+		if (!data)
+		{
+			fprintf(stderr, "Unable to read %s\n", argv[arg]);
+			return 1;
+		}
+		BenchEncode(argv[arg], data, len);
+		free(data);
+	}
+
+	CheckRelocation();
+	if (failures)
+	{
+		fprintf(stderr, "%lu checks failed\n", (unsigned long)failures);
+		return 1;
+	}
+	return 0;
+}
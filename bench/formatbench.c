@@ -0,0 +1,206 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Measures code emission throughput into a CodeBuffer, in megabytes of machine code per second
+// Measures text disassembly throughput, in instructions per second.  The input is a file of 64-bit code,
+// by default this executable, which is decoded linearly with invalid bytes skipped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../asmx86.h"
+
+#define FORMAT "%8a  %30b  %7i %o"
+#define PASSES 10
+#define LISTING_SIZE (1024 * 1024)
+
+
+static double GetTime(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + ((double)ts.tv_nsec / 1000000000.0);
+}
+
+
+static uint8_t* ReadFile(const char* path, size_t* len)
+{
+	FILE* fp = fopen(path, "rb");
+	uint8_t* data;
+	long size;
+
+	if (!fp)
+		return NULL;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	data = (uint8_t*)malloc((size_t)size + 16);
+	if ((!data) || (fread(data, 1, (size_t)size, fp) != (size_t)size))
+	{
+		fclose(fp);
+		free(data);
+		return NULL;
+	}
+	fclose(fp);
+	*len = (size_t)size;
+	return data;
+}
+
+
+static void Report(const char* name, size_t count, size_t textLen, double elapsed)
+{
+	printf("%s: %lu instructions in %.3f ms, %.1f M instructions/s, %.1f MB/s of text\n", name,
+		(unsigned long)count, elapsed * 1000.0, ((double)count / 1000000.0) / elapsed,
+		((double)textLen / (1024.0 * 1024.0)) / elapsed);
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* path = (argc > 1) ? argv[1] : argv[0];
+	uint8_t* data;
+	size_t len, offset, count = 0, textLen, i, pass, next, used, lines;
+	size_t* offsets;
+	Instruction* instrs;
+	char text[2048];
+	char* listing;
+	uint32_t* lineOffsets;
+	FormatTemplate tmpl;
+	double start;
+
+	data = ReadFile(path, &len);
+	if (!data)
+	{
+		fprintf(stderr, "Unable to read %s\n", path);
+		return 1;
+	}
+
+	offsets = (size_t*)malloc(len * sizeof(size_t));
+	instrs = (Instruction*)malloc(len * sizeof(Instruction));
+	listing = (char*)malloc(LISTING_SIZE);
+	lineOffsets = (uint32_t*)malloc((len + 1) * sizeof(uint32_t));
+	if ((!offsets) || (!instrs) || (!listing) || (!lineOffsets))
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (offset = 0; offset < len; )
+	{
+		if (Disassemble64(&data[offset], offset, len - offset, &instrs[count]))
+		{
+			offsets[count++] = offset;
+			offset += instrs[count - 1].length;
+		}
+		else
+			offset++;
+	}
+
+	// Decoding and formatting together, as done by a listing
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			Instruction instr;
+			textLen += DisassembleToString64(text, sizeof(text), FORMAT, &data[offsets[i]], offsets[i],
+				len - offsets[i], &instr);
+		}
+	}
+	Report("DisassembleToString64", count * PASSES, textLen, GetTime() - start);
+
+	// Formatting of already decoded instructions
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		for (i = 0; i < count; i++)
+			textLen += FormatInstructionString(text, sizeof(text), FORMAT, &data[offsets[i]], offsets[i], &instrs[i]);
+	}
+	Report("FormatInstructionString", count * PASSES, textLen, GetTime() - start);
+
+	// Formatting with a compiled format string
+	CompileFormat(FORMAT, &tmpl);
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		for (i = 0; i < count; i++)
+			textLen += FormatInstructionCompiled(text, sizeof(text), &tmpl, &data[offsets[i]], offsets[i], &instrs[i]);
+	}
+	Report("FormatInstructionCompiled", count * PASSES, textLen, GetTime() - start);
+
+	// Mnemonic and operands only, which has a specialized formatter
+	CompileFormat("%i %o", &tmpl);
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		for (i = 0; i < count; i++)
+			textLen += FormatInstructionCompiled(text, sizeof(text), &tmpl, &data[offsets[i]], offsets[i], &instrs[i]);
+	}
+	Report("FormatInstructionCompiled \"%i %o\"", count * PASSES, textLen, GetTime() - start);
+
+	// Listing of each run of consecutive instructions into one large buffer, which is emptied when full
+	CompileFormat(FORMAT, &tmpl);
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		used = 0;
+		for (i = 0; i < count; )
+		{
+			for (next = i + 1; (next < count) && (offsets[next] == (offsets[next - 1] + instrs[next - 1].length)); next++)
+				;
+			while (i < next)
+			{
+				lines = FormatInstructionsBatch(&listing[used], LISTING_SIZE - used, &tmpl, &data[offsets[i]],
+					offsets[i], &instrs[i], next - i, lineOffsets);
+				used += lineOffsets[lines];
+				i += lines;
+				if (i < next)
+				{
+					textLen += used;
+					used = 0;
+				}
+			}
+		}
+		textLen += used;
+	}
+	Report("FormatInstructionsBatch", count * PASSES, textLen, GetTime() - start);
+
+	// One JSON record per instruction
+	textLen = 0;
+	start = GetTime();
+	for (pass = 0; pass < PASSES; pass++)
+	{
+		for (i = 0; i < count; i++)
+			textLen += FormatInstructionJson(text, sizeof(text), &data[offsets[i]], offsets[i], &instrs[i]);
+	}
+	Report("FormatInstructionJson", count * PASSES, textLen, GetTime() - start);
+
+	free(lineOffsets);
+	free(listing);
+	free(instrs);
+	free(offsets);
+	free(data);
+	return 0;
+}
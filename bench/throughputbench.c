@@ -0,0 +1,563 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Measures decode, format and encode throughput over corpora generated from a seed, and over any files given
+// on the command line.  Each benchmark is run several times and the fastest run is reported, in text or as
+// JSON with -j.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "../asmx86.h"
+
+#define DEFAULT_SEED 1
+#define DEFAULT_COUNT 1000000
+#define DEFAULT_RUNS 5
+#define MAX_CORPORA 16
+#define MAX_RESULTS 128
+#define LISTING_SIZE (1024 * 1024)
+#define FORMAT "%8a  %30b  %7i %o"
+
+
+typedef struct Corpus
+{
+	const char* name;
+	uint8_t* data;
+	size_t len;
+	int modes[3];
+	size_t modeCount;
+} Corpus;
+
+
+typedef struct Result
+{
+	const char* benchmark;
+	const char* corpus;
+	int mode;
+	size_t instructions;
+	size_t bytes;
+	double seconds;
+	uint64_t cycles;
+} Result;
+
+
+typedef struct Timer
+{
+	double time;
+	uint64_t cycles;
+} Timer;
+
+
+static Result results[MAX_RESULTS];
+static size_t resultCount = 0;
+static size_t runs = DEFAULT_RUNS;
+static volatile size_t sink;
+
+
+static void StartTimer(Timer* timer)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	timer->time = (double)ts.tv_sec + ((double)ts.tv_nsec / 1000000000.0);
+#if defined(__x86_64__) || defined(__i386__)
+	timer->cycles = __rdtsc();
+#else
+	timer->cycles = 0;
+#endif
+}
+
+
+// Keeps the fastest run of a benchmark
+static void StopTimer(const Timer* timer, Result* result)
+{
+	Timer end;
+	StartTimer(&end);
+	if ((result->seconds == 0) || ((end.time - timer->time) < result->seconds))
+	{
+		result->seconds = end.time - timer->time;
+		result->cycles = end.cycles - timer->cycles;
+	}
+}
+
+
+static Result* AddResult(const char* benchmark, const Corpus* corpus, int mode)
+{
+	Result* result;
+	if (resultCount >= MAX_RESULTS)
+	{
+		fprintf(stderr, "Too many results\n");
+		exit(1);
+	}
+	result = &results[resultCount++];
+	memset(result, 0, sizeof(Result));
+	result->benchmark = benchmark;
+	result->corpus = corpus ? corpus->name : "generated";
+	result->mode = mode;
+	return result;
+}
+
+
+static uint64_t Random(uint64_t* state)
+{
+	// xorshift64*
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545f4914f6cdd1dULL;
+}
+
+
+// Emits a mix of integer, memory, branch and vector instructions in 64-bit mode
+static size_t Generate64(uint8_t* out, size_t count, uint64_t seed)
+{
+	static const OperandType regs[] = {REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RBP, REG_RSI, REG_RDI, REG_R8,
+		REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15};
+	static const OperandType regs32[] = {REG_EAX, REG_ECX, REG_EDX, REG_EBX, REG_EBP, REG_ESI, REG_EDI, REG_R8D,
+		REG_R9D, REG_R10D, REG_R11D, REG_R12D, REG_R13D, REG_R14D, REG_R15D};
+	static const OperandType xmms[] = {REG_XMM0, REG_XMM1, REG_XMM2, REG_XMM3, REG_XMM4, REG_XMM5, REG_XMM6,
+		REG_XMM7, REG_XMM8, REG_XMM9, REG_XMM10, REG_XMM11, REG_XMM12, REG_XMM13, REG_XMM14, REG_XMM15};
+	uint64_t state = seed | 1;
+	uint8_t* start = out;
+	uint64_t r;
+	OperandType a, b, c, x, y;
+	int32_t disp, imm;
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		r = Random(&state);
+		a = regs[(r >> 8) % 15];
+		b = regs[(r >> 12) % 15];
+		c = regs32[(r >> 16) % 15];
+		x = xmms[(r >> 20) & 15];
+		y = xmms[(r >> 24) & 15];
+		disp = (int32_t)((r >> 28) & 0xff) * (((r >> 36) & 1) ? 0x101 : 8);
+		imm = (int32_t)((r >> 37) & 0x7ff) - 0x400;
+
+		switch (r % 20)
+		{
+		case 0: out += X86_EMIT64_RR(out, mov_64, a, b); break;
+		case 1: out += X86_EMIT64_RM(out, mov_64, a, X86_MEM(b, disp)); break;
+		case 2: out += X86_EMIT64_MR(out, mov_64, X86_MEM(a, disp), b); break;
+		case 3: out += X86_EMIT64_RI(out, mov_32, c, imm); break;
+		case 4: out += X86_EMIT64_RR(out, add_64, a, b); break;
+		case 5: out += X86_EMIT64_RI(out, sub_64, a, imm); break;
+		case 6: out += X86_EMIT64_RR(out, xor_32, c, c); break;
+		case 7: out += X86_EMIT64_RM(out, cmp_64, a, X86_MEM_INDEX(b, REG_RCX, 8, disp)); break;
+		case 8: out += X86_EMIT64_RM(out, lea_64, a, X86_MEM_INDEX(b, REG_RDX, 4, disp)); break;
+		case 9: out += X86_EMIT64_R(out, push, a); break;
+		case 10: out += X86_EMIT64_R(out, pop, b); break;
+		case 11: out += X86_EMIT64_RR(out, test_32, c, c); break;
+		case 12: out += X86_EMIT64_P(out, jne, out - (disp & 0x7f)); break;
+		case 13: out += X86_EMIT64_P(out, je, out + (disp * 16)); break;
+		case 14: out += X86_EMIT64_P(out, calln, out + (disp * 64)); break;
+		case 15: out += X86_EMIT64_RR(out, imul_64, a, b); break;
+		case 16: out += X86_EMIT64_RR(out, movaps, x, y); break;
+		case 17: out += X86_EMIT64_RM(out, paddd, x, X86_MEM(a, disp)); break;
+		case 18: out += X86_EMIT64_RRR(out, vaddps, x, y, xmms[(r >> 40) & 15]); break;
+		default: out += X86_EMIT64(out, retn); break;
+		}
+	}
+	return (size_t)(out - start);
+}
+
+
+// Emits a mix of integer and memory instructions in 32-bit mode
+static size_t Generate32(uint8_t* out, size_t count, uint64_t seed)
+{
+	static const OperandType regs[] = {REG_EAX, REG_ECX, REG_EDX, REG_EBX, REG_EBP, REG_ESI, REG_EDI};
+	uint64_t state = seed | 1;
+	uint8_t* start = out;
+	uint64_t r;
+	OperandType a, b;
+	int32_t disp, imm;
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		r = Random(&state);
+		a = regs[(r >> 8) % 7];
+		b = regs[(r >> 12) % 7];
+		disp = (int32_t)((r >> 28) & 0xff) * (((r >> 36) & 1) ? 0x101 : 4);
+		imm = (int32_t)((r >> 37) & 0x7ff) - 0x400;
+
+		switch (r % 12)
+		{
+		case 0: out += X86_EMIT32_RR(out, mov_32, a, b); break;
+		case 1: out += X86_EMIT32_RM(out, mov_32, a, X86_MEM(b, disp)); break;
+		case 2: out += X86_EMIT32_MR(out, mov_32, X86_MEM(a, disp), b); break;
+		case 3: out += X86_EMIT32_RI(out, mov_32, a, imm); break;
+		case 4: out += X86_EMIT32_RR(out, add_32, a, b); break;
+		case 5: out += X86_EMIT32_RI(out, sub_32, a, imm); break;
+		case 6: out += X86_EMIT32_RM(out, lea_32, a, X86_MEM_INDEX(b, REG_ECX, 4, disp)); break;
+		case 7: out += X86_EMIT32_R(out, push, a); break;
+		case 8: out += X86_EMIT32_R(out, pop, b); break;
+		case 9: out += X86_EMIT32_P(out, jne, out - (disp & 0x7f)); break;
+		case 10: out += X86_EMIT32_P(out, calln, out + (disp * 64)); break;
+		default: out += X86_EMIT32(out, retn); break;
+		}
+	}
+	return (size_t)(out - start);
+}
+
+
+static bool Disassemble(int mode, const uint8_t* opcode, uint64_t addr, size_t maxLen, Instruction* instr)
+{
+	if (mode == 16)
+		return Disassemble16(opcode, addr, maxLen, instr);
+	if (mode == 32)
+		return Disassemble32(opcode, addr, maxLen, instr);
+	return Disassemble64(opcode, addr, maxLen, instr);
+}
+
+
+// Decodes the corpus as a linear sweep, skipping a byte at a time over invalid instructions
+static void BenchDecode(const Corpus* corpus, int mode)
+{
+	Result* result = AddResult("decode", corpus, mode);
+	Instruction instr;
+	size_t offset, count, checksum, run;
+	Timer timer;
+
+	for (run = 0; run < runs; run++)
+	{
+		count = 0;
+		checksum = 0;
+		StartTimer(&timer);
+		for (offset = 0; offset < corpus->len; count++)
+		{
+			if (Disassemble(mode, &corpus->data[offset], offset, corpus->len - offset, &instr))
+			{
+				checksum += instr.operation;
+				offset += instr.length;
+			}
+			else
+				offset++;
+		}
+		StopTimer(&timer, result);
+		sink = checksum;
+		result->instructions = count;
+	}
+	result->bytes = corpus->len;
+}
+
+
+static void BenchDisassembleToString(const Corpus* corpus)
+{
+	Result* result = AddResult("DisassembleToString64", corpus, 64);
+	Instruction instr;
+	char text[512];
+	size_t offset, count, len, textLen, run;
+	Timer timer;
+
+	for (run = 0; run < runs; run++)
+	{
+		count = 0;
+		textLen = 0;
+		StartTimer(&timer);
+		for (offset = 0; offset < corpus->len; count++)
+		{
+			len = DisassembleToString64(text, sizeof(text), FORMAT, &corpus->data[offset], offset,
+				corpus->len - offset, &instr);
+			textLen += len;
+			offset += (len != 0) ? instr.length : 1;
+		}
+		StopTimer(&timer, result);
+		sink = textLen;
+		result->instructions = count;
+	}
+	result->bytes = corpus->len;
+}
+
+
+// Decodes the corpus once, then times formatting of each run of consecutive instructions into a listing,
+// and re-encoding each instruction
+static void BenchDecoded(const Corpus* corpus)
+{
+	Result* batch = AddResult("FormatInstructionsBatch", corpus, 64);
+	Result* encode = AddResult("EncodeInstruction64", corpus, 64);
+	Instruction* instrs = (Instruction*)malloc(corpus->len * sizeof(Instruction));
+	size_t* offsets = (size_t*)malloc(corpus->len * sizeof(size_t));
+	uint32_t* lineOffsets = (uint32_t*)malloc((corpus->len + 1) * sizeof(uint32_t));
+	char* listing = (char*)malloc(LISTING_SIZE);
+	uint8_t code[16];
+	size_t offset, count = 0, i, next, used, lines, textLen, run;
+	FormatTemplate tmpl;
+	Timer timer;
+
+	if ((!instrs) || (!offsets) || (!lineOffsets) || (!listing))
+	{
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	}
+	for (offset = 0; offset < corpus->len; )
+	{
+		if (Disassemble64(&corpus->data[offset], offset, corpus->len - offset, &instrs[count]))
+		{
+			offsets[count++] = offset;
+			offset += instrs[count - 1].length;
+		}
+		else
+			offset++;
+	}
+
+	CompileFormat(FORMAT, &tmpl);
+	for (run = 0; run < runs; run++)
+	{
+		textLen = 0;
+		used = 0;
+		StartTimer(&timer);
+		for (i = 0; i < count; )
+		{
+			for (next = i + 1; (next < count) && (offsets[next] == (offsets[next - 1] + instrs[next - 1].length));
+				next++)
+				;
+			while (i < next)
+			{
+				lines = FormatInstructionsBatch(&listing[used], LISTING_SIZE - used, &tmpl,
+					&corpus->data[offsets[i]], offsets[i], &instrs[i], next - i, lineOffsets);
+				used += lineOffsets[lines];
+				i += lines;
+				if (i < next)
+				{
+					textLen += used;
+					used = 0;
+				}
+			}
+		}
+		StopTimer(&timer, batch);
+		sink = textLen + used;
+	}
+	batch->instructions = count;
+	batch->bytes = corpus->len;
+
+	for (run = 0; run < runs; run++)
+	{
+		textLen = 0;
+		StartTimer(&timer);
+		for (i = 0; i < count; i++)
+			textLen += EncodeInstruction64(&instrs[i], offsets[i], code);
+		StopTimer(&timer, encode);
+		sink = textLen;
+	}
+	encode->instructions = count;
+	encode->bytes = corpus->len;
+
+	free(listing);
+	free(lineOffsets);
+	free(offsets);
+	free(instrs);
+}
+
+
+static void BenchEmit(size_t count, uint64_t seed, uint8_t* out, const char* name,
+	size_t (*generate)(uint8_t* out, size_t count, uint64_t seed), int mode)
+{
+	Result* result = AddResult(name, NULL, mode);
+	size_t len = 0, run;
+	Timer timer;
+
+	for (run = 0; run < runs; run++)
+	{
+		StartTimer(&timer);
+		len = generate(out, count, seed);
+		StopTimer(&timer, result);
+	}
+	result->instructions = count;
+	result->bytes = len;
+}
+
+
+static uint8_t* ReadFile(const char* path, size_t* len)
+{
+	FILE* fp = fopen(path, "rb");
+	uint8_t* data;
+	long size;
+
+	if (!fp)
+		return NULL;
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	data = (uint8_t*)malloc((size_t)size + 16);
+	if ((!data) || (fread(data, 1, (size_t)size, fp) != (size_t)size))
+	{
+		fclose(fp);
+		free(data);
+		return NULL;
+	}
+	fclose(fp);
+	*len = (size_t)size;
+	return data;
+}
+
+
+static void ReportText(void)
+{
+	const Result* result;
+	size_t i;
+
+	for (i = 0; i < resultCount; i++)
+	{
+		result = &results[i];
+		printf("%-24s %-12s %2d-bit: %9lu instructions, %7.2f ns/instruction, %7.2f M instructions/s, "
+			"%7.1f cycles/instruction\n", result->benchmark, result->corpus, result->mode,
+			(unsigned long)result->instructions, (result->seconds * 1000000000.0) / (double)result->instructions,
+			((double)result->instructions / 1000000.0) / result->seconds,
+			(double)result->cycles / (double)result->instructions);
+	}
+}
+
+
+static void ReportJson(uint64_t seed, size_t count)
+{
+	const Result* result;
+	size_t i;
+
+	printf("{\"seed\":%llu,\"count\":%lu,\"runs\":%lu,\"results\":[", (unsigned long long)seed,
+		(unsigned long)count, (unsigned long)runs);
+	for (i = 0; i < resultCount; i++)
+	{
+		result = &results[i];
+		printf("%s\n{\"benchmark\":\"%s\",\"corpus\":\"%s\",\"mode\":%d,\"instructions\":%lu,\"bytes\":%lu,"
+			"\"seconds\":%.9f,\"ns_per_instruction\":%.3f,\"instructions_per_second\":%.0f,"
+			"\"cycles_per_instruction\":%.2f}", (i == 0) ? "" : ",", result->benchmark, result->corpus,
+			result->mode, (unsigned long)result->instructions, (unsigned long)result->bytes, result->seconds,
+			(result->seconds * 1000000000.0) / (double)result->instructions,
+			(double)result->instructions / result->seconds, (double)result->cycles / (double)result->instructions);
+	}
+	printf("\n]}\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+	static const int allModes[3] = {64, 32, 16};
+	Corpus corpora[MAX_CORPORA];
+	size_t corpusCount = 0, count = DEFAULT_COUNT, i, j;
+	uint64_t seed = DEFAULT_SEED, state;
+	bool json = false;
+	int opt, fileMode = 64;
+	Corpus* corpus;
+
+	while ((opt = getopt(argc, argv, "js:n:r:m:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'j':
+			json = true;
+			break;
+		case 's':
+			seed = strtoull(optarg, NULL, 0);
+			break;
+		case 'n':
+			count = (size_t)strtoull(optarg, NULL, 0);
+			break;
+		case 'r':
+			runs = (size_t)strtoull(optarg, NULL, 0);
+			break;
+		case 'm':
+			fileMode = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-j] [-s seed] [-n instructions] [-r runs] [-m mode] [file...]\n", argv[0]);
+			return 1;
+		}
+	}
+	if ((count == 0) || (runs == 0) || ((fileMode != 16) && (fileMode != 32) && (fileMode != 64)) ||
+		((argc - optind) > (MAX_CORPORA - 3)))
+	{
+		fprintf(stderr, "Invalid arguments\n");
+		return 1;
+	}
+
+	// Generated code is at most 15 bytes per instruction, the random corpus is four bytes per instruction
+	for (i = 0; i < 3; i++)
+	{
+		corpus = &corpora[corpusCount++];
+		corpus->data = (uint8_t*)malloc((count * 15) + 16);
+		if (!corpus->data)
+		{
+			fprintf(stderr, "Out of memory\n");
+			return 1;
+		}
+	}
+	corpora[0].name = "generated64";
+	corpora[0].modes[0] = 64;
+	corpora[0].modeCount = 1;
+	corpora[1].name = "generated32";
+	corpora[1].modes[0] = 32;
+	corpora[1].modes[1] = 16;
+	corpora[1].modeCount = 2;
+	corpora[2].name = "random";
+	memcpy(corpora[2].modes, allModes, sizeof(allModes));
+	corpora[2].modeCount = 3;
+
+	// Timing emission also produces the generated corpora
+	BenchEmit(count, seed, corpora[0].data, "emit", Generate64, 64);
+	corpora[0].len = results[resultCount - 1].bytes;
+	BenchEmit(count, seed, corpora[1].data, "emit", Generate32, 32);
+	corpora[1].len = results[resultCount - 1].bytes;
+	state = seed | 1;
+	corpora[2].len = count * 4;
+	for (i = 0; i < corpora[2].len; i++)
+		corpora[2].data[i] = (uint8_t)(Random(&state) >> 56);
+
+	for (; optind < argc; optind++)
+	{
+		corpus = &corpora[corpusCount];
+		corpus->name = argv[optind];
+		corpus->data = ReadFile(argv[optind], &corpus->len);
+		if (!corpus->data)
+		{
+			fprintf(stderr, "Unable to read %s\n", argv[optind]);
+			return 1;
+		}
+		corpus->modes[0] = fileMode;
+		corpus->modeCount = 1;
+		corpusCount++;
+	}
+
+	for (i = 0; i < corpusCount; i++)
+	{
+		corpus = &corpora[i];
+		for (j = 0; j < corpus->modeCount; j++)
+			BenchDecode(corpus, corpus->modes[j]);
+		if (corpus->modes[0] == 64)
+		{
+			BenchDisassembleToString(corpus);
+			BenchDecoded(corpus);
+		}
+	}
+
+	if (json)
+		ReportJson(seed, count);
+	else
+		ReportText();
+
+	for (i = 0; i < corpusCount; i++)
+		free(corpora[i].data);
+	return 0;
+}
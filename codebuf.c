@@ -0,0 +1,181 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // memfd_create
+#endif
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "codebuf.h"
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	static size_t RoundToPage(size_t size)
+	{
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		return (size + pageSize - 1) & ~(pageSize - 1);
+	}
+
+
+	static uint8_t* ReserveRange(size_t size)
+	{
+		// Reserve address space only, pages are mapped in as the buffer grows so that pointers into
+		// the buffer (including unresolved jump labels) never move
+		void* result = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (result == MAP_FAILED)
+			return NULL;
+		return (uint8_t*)result;
+	}
+
+
+	bool InitCodeBuffer(CodeBuffer* buf, size_t reserveSize, size_t chunkSize)
+	{
+		memset(buf, 0, sizeof(CodeBuffer));
+		buf->fd = -1;
+		if (reserveSize == 0)
+			reserveSize = CODEBUF_DEFAULT_RESERVE;
+		if (chunkSize == 0)
+			chunkSize = CODEBUF_DEFAULT_CHUNK;
+		buf->reserved = RoundToPage(reserveSize);
+		buf->chunkSize = RoundToPage(chunkSize);
+
+#ifdef __linux__
+		// Preferred mode: one memfd mapped twice, writable view for emitting and executable view for
+		// running, so no page is ever writable and executable at the same address
+		buf->fd = memfd_create("asmx86-codebuf", MFD_CLOEXEC);
+		if (buf->fd >= 0)
+		{
+			buf->writeBase = ReserveRange(buf->reserved);
+			buf->execBase = ReserveRange(buf->reserved);
+			if (buf->writeBase && buf->execBase)
+			{
+				buf->dualMapped = true;
+				return true;
+			}
+
+			// Either reservation may have succeeded, mark the buffer dual mapped so that both are released
+			buf->dualMapped = true;
+			FreeCodeBuffer(buf);
+			buf->fd = -1;
+			buf->reserved = RoundToPage(reserveSize);
+			buf->chunkSize = RoundToPage(chunkSize);
+		}
+#endif
+
+		// Fallback mode: a single mapping whose permissions are flipped to executable at finalize time
+		buf->writeBase = ReserveRange(buf->reserved);
+		if (!buf->writeBase)
+			return false;
+		buf->execBase = buf->writeBase;
+		buf->dualMapped = false;
+		return true;
+	}
+
+
+	void FreeCodeBuffer(CodeBuffer* buf)
+	{
+		if (buf->writeBase)
+			munmap(buf->writeBase, buf->reserved);
+		if (buf->dualMapped && buf->execBase)
+			munmap(buf->execBase, buf->reserved);
+		if (buf->fd >= 0)
+			close(buf->fd);
+		memset(buf, 0, sizeof(CodeBuffer));
+		buf->fd = -1;
+	}
+
+
+	uint8_t* GrowCodeBuffer(CodeBuffer* buf, size_t length)
+	{
+		size_t newCommitted = buf->committed;
+		while ((buf->offset + length) > newCommitted)
+			newCommitted += buf->chunkSize;
+		if (newCommitted > buf->reserved)
+		{
+			// Out of reserved space.  The instruction is written to a scratch area and discarded, and
+			// the failure is reported by FinalizeCodeBuffer.
+			buf->failed = true;
+			return buf->overflow;
+		}
+
+		if (buf->dualMapped)
+		{
+			size_t size = newCommitted - buf->committed;
+			if (ftruncate(buf->fd, (off_t)newCommitted) < 0)
+				goto fail;
+			if (mmap(buf->writeBase + buf->committed, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+				buf->fd, (off_t)buf->committed) == MAP_FAILED)
+				goto fail;
+			if (mmap(buf->execBase + buf->committed, size, PROT_READ | PROT_EXEC, MAP_SHARED | MAP_FIXED,
+				buf->fd, (off_t)buf->committed) == MAP_FAILED)
+				goto fail;
+		}
+		else
+		{
+			if (mprotect(buf->writeBase + buf->committed, newCommitted - buf->committed, PROT_READ | PROT_WRITE) < 0)
+				goto fail;
+		}
+
+		buf->committed = newCommitted;
+		return buf->writeBase + buf->offset;
+
+	fail:
+		buf->failed = true;
+		return buf->overflow;
+	}
+
+
+	void* FinalizeCodeBuffer(CodeBuffer* buf)
+	{
+		uint8_t* start = buf->execBase + buf->finalized;
+		if (buf->failed)
+			return NULL;
+
+		if (!buf->dualMapped)
+		{
+			// Flip every page written since the last finalize to executable in a single call.  Emission
+			// resumes on the next page so that code which is now executable is never writable.
+			size_t pageStart = buf->finalized & ~((size_t)sysconf(_SC_PAGESIZE) - 1);
+			size_t pageEnd = RoundToPage(buf->offset);
+			if ((pageEnd > pageStart) && (mprotect(buf->writeBase + pageStart, pageEnd - pageStart,
+				PROT_READ | PROT_EXEC) < 0))
+			{
+				buf->failed = true;
+				return NULL;
+			}
+			buf->offset = pageEnd;
+		}
+
+		// A single instruction cache synchronization for everything emitted since the last finalize (this
+		// is free on x86, where instruction fetch is coherent with stores through any mapping)
+#ifdef __GNUC__
+		__builtin___clear_cache((char*)start, (char*)(buf->execBase + buf->offset));
+#endif
+		buf->finalized = buf->offset;
+		return start;
+	}
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __CODEBUF_H__
+#define __CODEBUF_H__
+
+#include "asmx86.h"
+
+#define CODEBUF_DEFAULT_RESERVE		(256 * 1024 * 1024)
+#define CODEBUF_DEFAULT_CHUNK		(1024 * 1024)
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	// Executable code buffer for use with the DYNALLOC and ALTEXEC code generation APIs.  The address
+	// range is reserved up front and committed in chunks, so emitted code never moves.  On Linux the
+	// buffer is backed by a memfd that is mapped twice: code is written through the read/write view and
+	// executed through the read/execute view.  Elsewhere a single mapping is used and its permissions
+	// are changed in one batch by FinalizeCodeBuffer.
+	struct CodeBuffer
+	{
+		uint8_t* writeBase;
+		uint8_t* execBase;
+		size_t reserved;
+		size_t committed;
+		size_t offset;
+		size_t finalized;
+		size_t chunkSize;
+		int fd;
+		bool dualMapped;
+		bool failed;
+		uint8_t overflow[32]; // Larger than any instruction or forward jump reference
+	};
+#ifndef __cplusplus
+	typedef struct CodeBuffer CodeBuffer;
+#endif
+
+
+#ifdef __cplusplus
+	extern "C"
+	{
+#endif
+		bool InitCodeBuffer(CodeBuffer* buf, size_t reserveSize, size_t chunkSize);
+		void FreeCodeBuffer(CodeBuffer* buf);
+		uint8_t* GrowCodeBuffer(CodeBuffer* buf, size_t length);
+		void* FinalizeCodeBuffer(CodeBuffer* buf);
+#ifdef __cplusplus
+	}
+#endif
+
+
+	// Callbacks for the DYNALLOC and ALTEXEC APIs.  These are inline so that the common case is a single
+	// comparison against the committed size.
+	static __inline uint8_t* AllocCodeBufferSpace(CodeBuffer* buf, size_t length)
+	{
+		if ((buf->offset + length) <= buf->committed)
+			return buf->writeBase + buf->offset;
+		return GrowCodeBuffer(buf, length);
+	}
+
+	static __inline void AdvanceCodeBuffer(CodeBuffer* buf, size_t length)
+	{
+		if (!buf->failed)
+			buf->offset += length;
+	}
+
+	static __inline const void* TranslateCodeBufferPointer(const void* ptr, void* param)
+	{
+		CodeBuffer* buf = (CodeBuffer*)param;
+		return buf->execBase + ((const uint8_t*)ptr - buf->writeBase);
+	}
+
+	// Address at which the next emitted instruction will execute, used for marking jump labels
+	static __inline uint8_t* GetCodeBufferExecPointer(CodeBuffer* buf)
+	{
+		return buf->execBase + buf->offset;
+	}
+#ifdef __cplusplus
+}
+#endif
+
+
+#define CODEBUF_MARK_JUMP_LABEL_32(buf, n) X86_ALTEXEC_MARK_JUMP_LABEL_32(GetCodeBufferExecPointer(buf), TranslateCodeBufferPointer, buf, n)
+#define CODEBUF_MARK_JUMP_LABEL_64(buf, n) X86_ALTEXEC_MARK_JUMP_LABEL_64(GetCodeBufferExecPointer(buf), TranslateCodeBufferPointer, buf, n)
+
+#define CODEBUF_EMIT32(buf, op) X86_DYNALLOC_ALTEXEC_EMIT32(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op)
+#define CODEBUF_EMIT32_R(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT32_R(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT32_M(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT32_M(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a))
+#define CODEBUF_EMIT32_I(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT32_I(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT32_II(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_II(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT32_P(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT32_P(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT32_T(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT32_T(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT32_RR(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_RR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT32_RM(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_RM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, X86_MEM_PARAM(b))
+#define CODEBUF_EMIT32_MR(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_MR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT32_RI(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_RI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT32_MI(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_MI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT32_RRR(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_RRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c)
+#define CODEBUF_EMIT32_RRI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_RRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c)
+#define CODEBUF_EMIT32_RMI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_RMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, X86_MEM_PARAM(b), c)
+#define CODEBUF_EMIT32_MRR(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_MRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT32_MRI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_MRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT32_RRM(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_RRM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, X86_MEM_PARAM(c))
+#define CODEBUF_EMIT32_RRRI(buf, op, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT32_RRRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c, d)
+#define CODEBUF_EMIT32_RRMI(buf, op, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT32_RRMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, X86_MEM_PARAM(c), d)
+#define CODEBUF_EMIT32_SEG(buf, op, seg) X86_DYNALLOC_ALTEXEC_EMIT32_SEG(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg)
+#define CODEBUF_EMIT32_SEG_M(buf, op, seg, a) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_M(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a))
+#define CODEBUF_EMIT32_SEG_RM(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, X86_MEM_PARAM(b))
+#define CODEBUF_EMIT32_SEG_MR(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT32_SEG_MI(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT32_SEG_RMI(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, X86_MEM_PARAM(b), c)
+#define CODEBUF_EMIT32_SEG_MRR(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT32_SEG_MRI(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT32_SEG_RRM(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RRM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, b, X86_MEM_PARAM(c))
+#define CODEBUF_EMIT32_SEG_RRMI(buf, op, seg, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RRMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, b, X86_MEM_PARAM(c), d)
+
+#define CODEBUF_EMIT64(buf, op) X86_DYNALLOC_ALTEXEC_EMIT64(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op)
+#define CODEBUF_EMIT64_R(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT64_R(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT64_M(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT64_M(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a))
+#define CODEBUF_EMIT64_I(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT64_I(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT64_II(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_II(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT64_P(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT64_P(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT64_T(buf, op, a) X86_DYNALLOC_ALTEXEC_EMIT64_T(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a)
+#define CODEBUF_EMIT64_RR(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_RR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT64_RM(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_RM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, X86_MEM_PARAM(b))
+#define CODEBUF_EMIT64_MR(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_MR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT64_RI(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_RI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b)
+#define CODEBUF_EMIT64_MI(buf, op, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_MI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT64_RRR(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_RRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c)
+#define CODEBUF_EMIT64_RRI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_RRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c)
+#define CODEBUF_EMIT64_RMI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_RMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, X86_MEM_PARAM(b), c)
+#define CODEBUF_EMIT64_MRR(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_MRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT64_MRI(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_MRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT64_RRM(buf, op, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_RRM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, X86_MEM_PARAM(c))
+#define CODEBUF_EMIT64_RRRI(buf, op, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT64_RRRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, c, d)
+#define CODEBUF_EMIT64_RRMI(buf, op, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT64_RRMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, a, b, X86_MEM_PARAM(c), d)
+#define CODEBUF_EMIT64_SEG(buf, op, seg) X86_DYNALLOC_ALTEXEC_EMIT64_SEG(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg)
+#define CODEBUF_EMIT64_SEG_M(buf, op, seg, a) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_M(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a))
+#define CODEBUF_EMIT64_SEG_RM(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, X86_MEM_PARAM(b))
+#define CODEBUF_EMIT64_SEG_MR(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT64_SEG_MI(buf, op, seg, a, b) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b)
+#define CODEBUF_EMIT64_SEG_RMI(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, X86_MEM_PARAM(b), c)
+#define CODEBUF_EMIT64_SEG_MRR(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MRR(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT64_SEG_MRI(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MRI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, X86_MEM_PARAM(a), b, c)
+#define CODEBUF_EMIT64_SEG_RRM(buf, op, seg, a, b, c) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RRM(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, b, X86_MEM_PARAM(c))
+#define CODEBUF_EMIT64_SEG_RRMI(buf, op, seg, a, b, c, d) X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RRMI(buf, AllocCodeBufferSpace, AdvanceCodeBuffer, TranslateCodeBufferPointer, buf, op, seg, a, b, X86_MEM_PARAM(c), d)
+
+#endif
@@ -192,6 +192,7 @@ namespace asmx86
 #define __DEF_INSTR_1(n, t, ta) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, ta(a))
 #define __DEF_INSTR_2(n, t, ta, tb) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, ta(a), tb(b))
 #define __DEF_INSTR_3(n, t, ta, tb, tc) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, ta(a), tb(b), tc(c))
+#define __DEF_INSTR_4(n, t, ta, tb, tc, td) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, ta(a), tb(b), tc(c), td(d))
 #define __DEF_INSTR_0_ARG(n, t, arg) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, arg)
 #define __DEF_INSTR_1_ARG(n, t, ta, arg) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, arg, ta(a))
 #define __DEF_INSTR_2_ARG(n, t, ta, tb, arg) static __inline size_t __alwaysinline __NAME(n, t) (__CONTEXT_PARAMS, arg, ta(a), tb(b))
@@ -234,6 +235,19 @@ namespace asmx86
 #define __REX_RM(n) (((n) & 8) ? 1 : 0)
 #define __REX_OPCODE(n) (((n) & 8) ? 1 : 0)
 
+// VEX prefix macros, an encoding is the opcode map, implied prefix and W bit combined with the L bit
+// from __VEX_L.  The two byte C5 form is chosen automatically when possible, see __vex_prefix function.
+#define __VEX_PP_NONE 0
+#define __VEX_PP_66 1
+#define __VEX_PP_F3 2
+#define __VEX_PP_F2 3
+#define __VEX_256 4
+#define __VEX_W 0x80
+#define __VEX_0F 0x100
+#define __VEX_0F38 0x200
+#define __VEX_0F3A 0x300
+#define __VEX_L(r) ((((r) >= REG_YMM0) && ((r) <= REG_YMM15)) ? __VEX_256 : 0)
+
 
 	// Memory operand constructors
 #ifdef __GNUC__
@@ -339,6 +353,22 @@ namespace asmx86
 		return (uint8_t)(r - REG_XMM0);
 	}
 
+	static __inline uint8_t __alwaysinline __vec_32bit(OperandType r  __REG_DEBUG_PARAM_DECL)
+	{
+		__CGX86_ASSERT(((r >= REG_XMM0) && (r <= REG_XMM7)) || ((r >= REG_YMM0) && (r <= REG_YMM7)), "Bad XMM or YMM register");
+		if (r >= REG_YMM0)
+			return (uint8_t)(r - REG_YMM0);
+		return (uint8_t)(r - REG_XMM0);
+	}
+
+	static __inline uint8_t __alwaysinline __vec_64bit(OperandType r  __REG_DEBUG_PARAM_DECL)
+	{
+		__CGX86_ASSERT(((r >= REG_XMM0) && (r <= REG_XMM15)) || ((r >= REG_YMM0) && (r <= REG_YMM15)), "Bad XMM or YMM register");
+		if (r >= REG_YMM0)
+			return (uint8_t)(r - REG_YMM0);
+		return (uint8_t)(r - REG_XMM0);
+	}
+
 
 	// Prefix routines
 	static __inline void __alwaysinline __segprefix(uint8_t* buf, int wr, OperandType s)
@@ -357,6 +387,20 @@ namespace asmx86
 			__WRITE_BUF_8(0, 0x65);
 	}
 
+	static __inline size_t __alwaysinline __vex_prefix(uint8_t* buf, int wr, uint16_t vex, uint8_t rex, uint8_t vvvv)
+	{
+		// The REX bits and the extra register (vvvv) are stored inverted.  The two byte form can only be
+		// used for the 0F map when W, X and B are all clear.
+		if (((vex & 0x300) == __VEX_0F) && (!(vex & __VEX_W)) && (!(rex & 3)))
+		{
+			__WRITE_BUF_8_8(0, 0xc5, ((rex & 4) ? 0 : 0x80) | ((~vvvv & 15) << 3) | (vex & 7));
+			return 2;
+		}
+		__WRITE_BUF_8_8(0, 0xc4, ((~rex & 7) << 5) | (vex >> 8));
+		__WRITE_BUF_8(2, (vex & 0x87) | ((~vvvv & 15) << 3));
+		return 3;
+	}
+
 
 	// Executable pointer translation helpers
 #define __EXEC_OFFSET(n) __translate_to_exec(__CONTEXT_OFFSET(n))
@@ -730,6 +774,9 @@ namespace asmx86
 #ifdef __xmmreg
 #undef __xmmreg
 #endif
+#ifdef __vecreg
+#undef __vecreg
+#endif
 #ifdef __onebyte_opreg
 #undef __onebyte_opreg
 #endif
@@ -753,6 +800,7 @@ namespace asmx86
 #define __reg16(r) __reg16_32bit(r __REG_DEBUG_PARAMS)
 #define __reg32(r) __reg32_32bit(r __REG_DEBUG_PARAMS)
 #define __xmmreg(r) __xmm_32bit(r __REG_DEBUG_PARAMS)
+#define __vecreg(r) __vec_32bit(r __REG_DEBUG_PARAMS)
 #define __onebyte_opreg __onebyte_opreg_32bit
 #define __onebyte_opreg_imm8 __onebyte_opreg_imm8_32bit
 #define __onebyte_opreg_imm32 __onebyte_opreg_imm32_32bit
@@ -765,6 +813,7 @@ namespace asmx86
 #define __reg32(r) __reg32_64bit(r __REG_DEBUG_PARAMS)
 #define __reg64(r) __reg64_64bit(r __REG_DEBUG_PARAMS)
 #define __xmmreg(r) __xmm_64bit(r __REG_DEBUG_PARAMS)
+#define __vecreg(r) __vec_64bit(r __REG_DEBUG_PARAMS)
 #define __onebyte_opreg __onebyte_opreg_64bit
 #define __onebyte_opreg_imm8 __onebyte_opreg_imm8_64bit
 #define __onebyte_opreg_imm32 __onebyte_opreg_imm32_64bit
@@ -814,6 +863,9 @@ namespace asmx86
 #define X86_EMIT32_RMI(buf, op, a, b, c) __NAME32(op, rmi) (__EMIT_CONTEXT(buf), a, X86_MEM_PARAM(b), c)
 #define X86_EMIT32_MRR(buf, op, a, b, c) __NAME32(op, mrr) (__EMIT_CONTEXT(buf), X86_MEM_PARAM(a), b, c)
 #define X86_EMIT32_MRI(buf, op, a, b, c) __NAME32(op, mri) (__EMIT_CONTEXT(buf), X86_MEM_PARAM(a), b, c)
+#define X86_EMIT32_RRM(buf, op, a, b, c) __NAME32(op, rrm) (__EMIT_CONTEXT(buf), a, b, X86_MEM_PARAM(c))
+#define X86_EMIT32_RRRI(buf, op, a, b, c, d) __NAME32(op, rrri) (__EMIT_CONTEXT(buf), a, b, c, d)
+#define X86_EMIT32_RRMI(buf, op, a, b, c, d) __NAME32(op, rrmi) (__EMIT_CONTEXT(buf), a, b, X86_MEM_PARAM(c), d)
 #define X86_EMIT32_SEG(buf, op, seg) __SEGPREFIX(buf, 1, seg, __PREFIX32(op) (__EMIT_CONTEXT_OFFSET(buf, 1)))
 #define X86_EMIT32_SEG_M(buf, op, seg, a) __SEGPREFIX(buf, 1, seg, __NAME32(op, m) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a)))
 #define X86_EMIT32_SEG_RM(buf, op, seg, a, b) __SEGPREFIX(buf, 1, seg, __NAME32(op, rm) (__EMIT_CONTEXT_OFFSET(buf, 1), a, X86_MEM_PARAM(b)))
@@ -822,6 +874,8 @@ namespace asmx86
 #define X86_EMIT32_SEG_RMI(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, rmi) (__EMIT_CONTEXT_OFFSET(buf, 1), a, X86_MEM_PARAM(b), c))
 #define X86_EMIT32_SEG_MRR(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, mrr) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a), b, c))
 #define X86_EMIT32_SEG_MRI(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, mri) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a), b, c))
+#define X86_EMIT32_SEG_RRM(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, rrm) (__EMIT_CONTEXT_OFFSET(buf, 1), a, b, X86_MEM_PARAM(c)))
+#define X86_EMIT32_SEG_RRMI(buf, op, seg, a, b, c, d) __SEGPREFIX(buf, 1, seg, __NAME32(op, rrmi) (__EMIT_CONTEXT_OFFSET(buf, 1), a, b, X86_MEM_PARAM(c), d))
 
 #define X86_ALTEXEC_EMIT32(buf, xlat, param, op) __PREFIX32(op) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param))
 #define X86_ALTEXEC_EMIT32_R(buf, xlat, param, op, a) __NAME32(op, r) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a)
@@ -840,6 +894,9 @@ namespace asmx86
 #define X86_ALTEXEC_EMIT32_RMI(buf, xlat, param, op, a, b, c) __NAME32(op, rmi) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, X86_MEM_PARAM(b), c)
 #define X86_ALTEXEC_EMIT32_MRR(buf, xlat, param, op, a, b, c) __NAME32(op, mrr) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), X86_MEM_PARAM(a), b, c)
 #define X86_ALTEXEC_EMIT32_MRI(buf, xlat, param, op, a, b, c) __NAME32(op, mri) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), X86_MEM_PARAM(a), b, c)
+#define X86_ALTEXEC_EMIT32_RRM(buf, xlat, param, op, a, b, c) __NAME32(op, rrm) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, X86_MEM_PARAM(c))
+#define X86_ALTEXEC_EMIT32_RRRI(buf, xlat, param, op, a, b, c, d) __NAME32(op, rrri) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, c, d)
+#define X86_ALTEXEC_EMIT32_RRMI(buf, xlat, param, op, a, b, c, d) __NAME32(op, rrmi) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, X86_MEM_PARAM(c), d)
 #define X86_ALTEXEC_EMIT32_SEG(buf, xlat, param, op, seg) __SEGPREFIX(buf, 1, seg, __PREFIX32(op) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1)))
 #define X86_ALTEXEC_EMIT32_SEG_M(buf, xlat, param, op, seg, a) __SEGPREFIX(buf, 1, seg, __NAME32(op, m) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a)))
 #define X86_ALTEXEC_EMIT32_SEG_RM(buf, xlat, param, op, seg, a, b) __SEGPREFIX(buf, 1, seg, __NAME32(op, rm) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, X86_MEM_PARAM(b)))
@@ -848,6 +905,8 @@ namespace asmx86
 #define X86_ALTEXEC_EMIT32_SEG_RMI(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, rmi) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, X86_MEM_PARAM(b), c))
 #define X86_ALTEXEC_EMIT32_SEG_MRR(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, mrr) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a), b, c))
 #define X86_ALTEXEC_EMIT32_SEG_MRI(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, mri) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a), b, c))
+#define X86_ALTEXEC_EMIT32_SEG_RRM(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME32(op, rrm) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, b, X86_MEM_PARAM(c)))
+#define X86_ALTEXEC_EMIT32_SEG_RRMI(buf, xlat, param, op, seg, a, b, c, d) __SEGPREFIX(buf, 1, seg, __NAME32(op, rrmi) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, b, X86_MEM_PARAM(c), d))
 
 #define X86_LENGTH32(op) __PREFIX32(op) (__LENGTH_CONTEXT)
 #define X86_LENGTH32_R(op, a) __NAME32(op, r) (__LENGTH_CONTEXT, a)
@@ -866,6 +925,9 @@ namespace asmx86
 #define X86_LENGTH32_RMI(op, a, b, c) __NAME32(op, rmi) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b), c)
 #define X86_LENGTH32_MRR(op, a, b, c) __NAME32(op, mrr) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c)
 #define X86_LENGTH32_MRI(op, a, b, c) __NAME32(op, mri) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c)
+#define X86_LENGTH32_RRM(op, a, b, c) __NAME32(op, rrm) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c))
+#define X86_LENGTH32_RRRI(op, a, b, c, d) __NAME32(op, rrri) (__LENGTH_CONTEXT, a, b, c, d)
+#define X86_LENGTH32_RRMI(op, a, b, c, d) __NAME32(op, rrmi) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c), d)
 #define X86_LENGTH32_SEG(op, seg) __SEGPREFIX(0, 0, seg, __PREFIX32(op) (__LENGTH_CONTEXT))
 #define X86_LENGTH32_SEG_M(op, seg, a) __SEGPREFIX(0, 0, seg, __NAME32(op, m) (__LENGTH_CONTEXT, X86_MEM_PARAM(a)))
 #define X86_LENGTH32_SEG_RM(op, seg, a, b) __SEGPREFIX(0, 0, seg, __NAME32(op, rm) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b)))
@@ -874,6 +936,8 @@ namespace asmx86
 #define X86_LENGTH32_SEG_RMI(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME32(op, rmi) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b), c))
 #define X86_LENGTH32_SEG_MRR(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME32(op, mrr) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c))
 #define X86_LENGTH32_SEG_MRI(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME32(op, mri) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c))
+#define X86_LENGTH32_SEG_RRM(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME32(op, rrm) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c)))
+#define X86_LENGTH32_SEG_RRMI(op, seg, a, b, c, d) __SEGPREFIX(0, 0, seg, __NAME32(op, rrmi) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c), d))
 
 #define X86_DYNALLOC_EMIT32(buf, alloc, adv, op) adv(buf, X86_EMIT32(alloc(buf, X86_LENGTH32(op)), op))
 #define X86_DYNALLOC_EMIT32_R(buf, alloc, adv, op, a) adv(buf, X86_EMIT32_R(alloc(buf, X86_LENGTH32_R(op, a)), op, a))
@@ -892,6 +956,9 @@ namespace asmx86
 #define X86_DYNALLOC_EMIT32_RMI(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT32_RMI(alloc(buf, X86_LENGTH32_RMI(op, a, X86_MEM_PARAM(b), c)), op, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_EMIT32_MRR(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT32_MRR(alloc(buf, X86_LENGTH32_MRR(op, X86_MEM_PARAM(a), b, c)), op, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_EMIT32_MRI(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT32_MRI(alloc(buf, X86_LENGTH32_MRI(op, X86_MEM_PARAM(a), b, c)), op, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_EMIT32_RRM(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT32_RRM(alloc(buf, X86_LENGTH32_RRM(op, a, b, X86_MEM_PARAM(c))), op, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_EMIT32_RRRI(buf, alloc, adv, op, a, b, c, d) adv(buf, X86_EMIT32_RRRI(alloc(buf, X86_LENGTH32_RRRI(op, a, b, c, d)), op, a, b, c, d))
+#define X86_DYNALLOC_EMIT32_RRMI(buf, alloc, adv, op, a, b, c, d) adv(buf, X86_EMIT32_RRMI(alloc(buf, X86_LENGTH32_RRMI(op, a, b, X86_MEM_PARAM(c), d)), op, a, b, X86_MEM_PARAM(c), d))
 #define X86_DYNALLOC_EMIT32_SEG(buf, alloc, adv, op, seg) adv(buf, X86_EMIT32_SEG(alloc(buf, X86_LENGTH32_SEG(op, seg)), op, seg))
 #define X86_DYNALLOC_EMIT32_SEG_M(buf, alloc, adv, op, seg, a) adv(buf, X86_EMIT32_SEG_M(alloc(buf, X86_LENGTH32_SEG_M(op, seg, X86_MEM_PARAM(a))), op, seg, X86_MEM_PARAM(a)))
 #define X86_DYNALLOC_EMIT32_SEG_RM(buf, alloc, adv, op, seg, a, b) adv(buf, X86_EMIT32_SEG_RM(alloc(buf, X86_LENGTH32_SEG_RM(op, seg, a, X86_MEM_PARAM(b))), op, seg, a, X86_MEM_PARAM(b)))
@@ -900,6 +967,8 @@ namespace asmx86
 #define X86_DYNALLOC_EMIT32_SEG_RMI(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT32_SEG_RMI(alloc(buf, X86_LENGTH32_SEG_RMI(op, seg, a, X86_MEM_PARAM(b), c)), op, seg, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_EMIT32_SEG_MRR(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT32_SEG_MRR(alloc(buf, X86_LENGTH32_SEG_MRR(op, seg, X86_MEM_PARAM(a), b, c)), op, seg, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_EMIT32_SEG_MRI(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT32_SEG_MRI(alloc(buf, X86_LENGTH32_SEG_MRI(op, seg, X86_MEM_PARAM(a), b, c)), op, seg, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_EMIT32_SEG_RRM(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT32_SEG_RRM(alloc(buf, X86_LENGTH32_SEG_RRM(op, seg, a, b, X86_MEM_PARAM(c))), op, seg, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_EMIT32_SEG_RRMI(buf, alloc, adv, op, seg, a, b, c, d) adv(buf, X86_EMIT32_SEG_RRMI(alloc(buf, X86_LENGTH32_SEG_RRMI(op, seg, a, b, X86_MEM_PARAM(c), d)), op, seg, a, b, X86_MEM_PARAM(c), d))
 
 #define X86_DYNALLOC_ALTEXEC_EMIT32(buf, alloc, adv, xlat, param, op) adv(buf, X86_ALTEXEC_EMIT32(alloc(buf, X86_LENGTH32(op)), xlat, param, op))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_R(buf, alloc, adv, xlat, param, op, a) adv(buf, X86_ALTEXEC_EMIT32_R(alloc(buf, X86_LENGTH32_R(op, a)), xlat, param, op, a))
@@ -918,6 +987,9 @@ namespace asmx86
 #define X86_DYNALLOC_ALTEXEC_EMIT32_RMI(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_RMI(alloc(buf, X86_LENGTH32_RMI(op, a, X86_MEM_PARAM(b), c)), xlat, param, op, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_MRR(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_MRR(alloc(buf, X86_LENGTH32_MRR(op, X86_MEM_PARAM(a), b, c)), xlat, param, op, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_MRI(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_MRI(alloc(buf, X86_LENGTH32_MRI(op, X86_MEM_PARAM(a), b, c)), xlat, param, op, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_ALTEXEC_EMIT32_RRM(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_RRM(alloc(buf, X86_LENGTH32_RRM(op, a, b, X86_MEM_PARAM(c))), xlat, param, op, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_ALTEXEC_EMIT32_RRRI(buf, alloc, adv, xlat, param, op, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT32_RRRI(alloc(buf, X86_LENGTH32_RRRI(op, a, b, c, d)), xlat, param, op, a, b, c, d))
+#define X86_DYNALLOC_ALTEXEC_EMIT32_RRMI(buf, alloc, adv, xlat, param, op, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT32_RRMI(alloc(buf, X86_LENGTH32_RRMI(op, a, b, X86_MEM_PARAM(c), d)), xlat, param, op, a, b, X86_MEM_PARAM(c), d))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG(buf, alloc, adv, xlat, param, op, seg) adv(buf, X86_ALTEXEC_EMIT32_SEG(alloc(buf, X86_LENGTH32_SEG(op, seg)), xlat, param, op, seg))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_M(buf, alloc, adv, xlat, param, op, seg, a) adv(buf, X86_ALTEXEC_EMIT32_SEG_M(alloc(buf, X86_LENGTH32_SEG_M(op, seg, X86_MEM_PARAM(a))), xlat, param, op, seg, X86_MEM_PARAM(a)))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RM(buf, alloc, adv, xlat, param, op, seg, a, b) adv(buf, X86_ALTEXEC_EMIT32_SEG_RM(alloc(buf, X86_LENGTH32_SEG_RM(op, seg, a, X86_MEM_PARAM(b))), xlat, param, op, seg, a, X86_MEM_PARAM(b)))
@@ -926,6 +998,8 @@ namespace asmx86
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RMI(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_SEG_RMI(alloc(buf, X86_LENGTH32_SEG_RMI(op, seg, a, X86_MEM_PARAM(b), c)), xlat, param, op, seg, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MRR(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_SEG_MRR(alloc(buf, X86_LENGTH32_SEG_MRR(op, seg, X86_MEM_PARAM(a), b, c)), xlat, param, op, seg, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_MRI(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_SEG_MRI(alloc(buf, X86_LENGTH32_SEG_MRI(op, seg, X86_MEM_PARAM(a), b, c)), xlat, param, op, seg, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RRM(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT32_SEG_RRM(alloc(buf, X86_LENGTH32_SEG_RRM(op, seg, a, b, X86_MEM_PARAM(c))), xlat, param, op, seg, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_ALTEXEC_EMIT32_SEG_RRMI(buf, alloc, adv, xlat, param, op, seg, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT32_SEG_RRMI(alloc(buf, X86_LENGTH32_SEG_RRMI(op, seg, a, b, X86_MEM_PARAM(c), d)), xlat, param, op, seg, a, b, X86_MEM_PARAM(c), d))
 
 #else // __CODEGENX86_64BIT
 
@@ -946,6 +1020,9 @@ namespace asmx86
 #define X86_EMIT64_RMI(buf, op, a, b, c) __NAME64(op, rmi) (__EMIT_CONTEXT(buf), a, X86_MEM_PARAM(b), c)
 #define X86_EMIT64_MRR(buf, op, a, b, c) __NAME64(op, mrr) (__EMIT_CONTEXT(buf), X86_MEM_PARAM(a), b, c)
 #define X86_EMIT64_MRI(buf, op, a, b, c) __NAME64(op, mri) (__EMIT_CONTEXT(buf), X86_MEM_PARAM(a), b, c)
+#define X86_EMIT64_RRM(buf, op, a, b, c) __NAME64(op, rrm) (__EMIT_CONTEXT(buf), a, b, X86_MEM_PARAM(c))
+#define X86_EMIT64_RRRI(buf, op, a, b, c, d) __NAME64(op, rrri) (__EMIT_CONTEXT(buf), a, b, c, d)
+#define X86_EMIT64_RRMI(buf, op, a, b, c, d) __NAME64(op, rrmi) (__EMIT_CONTEXT(buf), a, b, X86_MEM_PARAM(c), d)
 #define X86_EMIT64_SEG(buf, op, seg) __SEGPREFIX(buf, 1, seg, __PREFIX64(op) (__EMIT_CONTEXT_OFFSET(buf, 1)))
 #define X86_EMIT64_SEG_M(buf, op, seg, a) __SEGPREFIX(buf, 1, seg, __NAME64(op, m) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a)))
 #define X86_EMIT64_SEG_RM(buf, op, seg, a, b) __SEGPREFIX(buf, 1, seg, __NAME64(op, rm) (__EMIT_CONTEXT_OFFSET(buf, 1), a, X86_MEM_PARAM(b)))
@@ -954,6 +1031,8 @@ namespace asmx86
 #define X86_EMIT64_SEG_RMI(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, rmi) (__EMIT_CONTEXT_OFFSET(buf, 1), a, X86_MEM_PARAM(b), c))
 #define X86_EMIT64_SEG_MRR(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, mrr) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a), b, c))
 #define X86_EMIT64_SEG_MRI(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, mri) (__EMIT_CONTEXT_OFFSET(buf, 1), X86_MEM_PARAM(a), b, c))
+#define X86_EMIT64_SEG_RRM(buf, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, rrm) (__EMIT_CONTEXT_OFFSET(buf, 1), a, b, X86_MEM_PARAM(c)))
+#define X86_EMIT64_SEG_RRMI(buf, op, seg, a, b, c, d) __SEGPREFIX(buf, 1, seg, __NAME64(op, rrmi) (__EMIT_CONTEXT_OFFSET(buf, 1), a, b, X86_MEM_PARAM(c), d))
 
 #define X86_ALTEXEC_EMIT64(buf, xlat, param, op) __PREFIX64(op) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param))
 #define X86_ALTEXEC_EMIT64_R(buf, xlat, param, op, a) __NAME64(op, r) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a)
@@ -972,6 +1051,9 @@ namespace asmx86
 #define X86_ALTEXEC_EMIT64_RMI(buf, xlat, param, op, a, b, c) __NAME64(op, rmi) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, X86_MEM_PARAM(b), c)
 #define X86_ALTEXEC_EMIT64_MRR(buf, xlat, param, op, a, b, c) __NAME64(op, mrr) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), X86_MEM_PARAM(a), b, c)
 #define X86_ALTEXEC_EMIT64_MRI(buf, xlat, param, op, a, b, c) __NAME64(op, mri) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), X86_MEM_PARAM(a), b, c)
+#define X86_ALTEXEC_EMIT64_RRM(buf, xlat, param, op, a, b, c) __NAME64(op, rrm) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, X86_MEM_PARAM(c))
+#define X86_ALTEXEC_EMIT64_RRRI(buf, xlat, param, op, a, b, c, d) __NAME64(op, rrri) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, c, d)
+#define X86_ALTEXEC_EMIT64_RRMI(buf, xlat, param, op, a, b, c, d) __NAME64(op, rrmi) (__EMIT_ALTEXEC_CONTEXT(buf, xlat, param), a, b, X86_MEM_PARAM(c), d)
 #define X86_ALTEXEC_EMIT64_SEG(buf, xlat, param, op, seg) __SEGPREFIX(buf, 1, seg, __PREFIX64(op) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1)))
 #define X86_ALTEXEC_EMIT64_SEG_M(buf, xlat, param, op, seg, a) __SEGPREFIX(buf, 1, seg, __NAME64(op, m) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a)))
 #define X86_ALTEXEC_EMIT64_SEG_RM(buf, xlat, param, op, seg, a, b) __SEGPREFIX(buf, 1, seg, __NAME64(op, rm) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, X86_MEM_PARAM(b)))
@@ -980,6 +1062,8 @@ namespace asmx86
 #define X86_ALTEXEC_EMIT64_SEG_RMI(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, rmi) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, X86_MEM_PARAM(b), c))
 #define X86_ALTEXEC_EMIT64_SEG_MRR(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, mrr) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a), b, c))
 #define X86_ALTEXEC_EMIT64_SEG_MRI(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, mri) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), X86_MEM_PARAM(a), b, c))
+#define X86_ALTEXEC_EMIT64_SEG_RRM(buf, xlat, param, op, seg, a, b, c) __SEGPREFIX(buf, 1, seg, __NAME64(op, rrm) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, b, X86_MEM_PARAM(c)))
+#define X86_ALTEXEC_EMIT64_SEG_RRMI(buf, xlat, param, op, seg, a, b, c, d) __SEGPREFIX(buf, 1, seg, __NAME64(op, rrmi) (__EMIT_ALTEXEC_CONTEXT_OFFSET(buf, xlat, param, 1), a, b, X86_MEM_PARAM(c), d))
 
 #define X86_LENGTH64(op) __PREFIX64(op) (__LENGTH_CONTEXT)
 #define X86_LENGTH64_R(op, a) __NAME64(op, r) (__LENGTH_CONTEXT, a)
@@ -998,6 +1082,9 @@ namespace asmx86
 #define X86_LENGTH64_RMI(op, a, b, c) __NAME64(op, rmi) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b), c)
 #define X86_LENGTH64_MRR(op, a, b, c) __NAME64(op, mrr) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c)
 #define X86_LENGTH64_MRI(op, a, b, c) __NAME64(op, mri) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c)
+#define X86_LENGTH64_RRM(op, a, b, c) __NAME64(op, rrm) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c))
+#define X86_LENGTH64_RRRI(op, a, b, c, d) __NAME64(op, rrri) (__LENGTH_CONTEXT, a, b, c, d)
+#define X86_LENGTH64_RRMI(op, a, b, c, d) __NAME64(op, rrmi) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c), d)
 #define X86_LENGTH64_SEG(op, seg) __SEGPREFIX(0, 0, seg, __PREFIX64(op) (__LENGTH_CONTEXT))
 #define X86_LENGTH64_SEG_M(op, seg, a) __SEGPREFIX(0, 0, seg, __NAME64(op, m) (__LENGTH_CONTEXT, X86_MEM_PARAM(a)))
 #define X86_LENGTH64_SEG_RM(op, seg, a, b) __SEGPREFIX(0, 0, seg, __NAME64(op, rm) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b)))
@@ -1006,6 +1093,8 @@ namespace asmx86
 #define X86_LENGTH64_SEG_RMI(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME64(op, rmi) (__LENGTH_CONTEXT, a, X86_MEM_PARAM(b), c))
 #define X86_LENGTH64_SEG_MRR(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME64(op, mrr) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c))
 #define X86_LENGTH64_SEG_MRI(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME64(op, mri) (__LENGTH_CONTEXT, X86_MEM_PARAM(a), b, c))
+#define X86_LENGTH64_SEG_RRM(op, seg, a, b, c) __SEGPREFIX(0, 0, seg, __NAME64(op, rrm) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c)))
+#define X86_LENGTH64_SEG_RRMI(op, seg, a, b, c, d) __SEGPREFIX(0, 0, seg, __NAME64(op, rrmi) (__LENGTH_CONTEXT, a, b, X86_MEM_PARAM(c), d))
 
 #define X86_DYNALLOC_EMIT64(buf, alloc, adv, op) adv(buf, X86_EMIT64(alloc(buf, X86_LENGTH64(op)), op))
 #define X86_DYNALLOC_EMIT64_R(buf, alloc, adv, op, a) adv(buf, X86_EMIT64_R(alloc(buf, X86_LENGTH64_R(op, a)), op, a))
@@ -1024,6 +1113,9 @@ namespace asmx86
 #define X86_DYNALLOC_EMIT64_RMI(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT64_RMI(alloc(buf, X86_LENGTH64_RMI(op, a, X86_MEM_PARAM(b), c)), op, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_EMIT64_MRR(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT64_MRR(alloc(buf, X86_LENGTH64_MRR(op, X86_MEM_PARAM(a), b, c)), op, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_EMIT64_MRI(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT64_MRI(alloc(buf, X86_LENGTH64_MRI(op, X86_MEM_PARAM(a), b, c)), op, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_EMIT64_RRM(buf, alloc, adv, op, a, b, c) adv(buf, X86_EMIT64_RRM(alloc(buf, X86_LENGTH64_RRM(op, a, b, X86_MEM_PARAM(c))), op, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_EMIT64_RRRI(buf, alloc, adv, op, a, b, c, d) adv(buf, X86_EMIT64_RRRI(alloc(buf, X86_LENGTH64_RRRI(op, a, b, c, d)), op, a, b, c, d))
+#define X86_DYNALLOC_EMIT64_RRMI(buf, alloc, adv, op, a, b, c, d) adv(buf, X86_EMIT64_RRMI(alloc(buf, X86_LENGTH64_RRMI(op, a, b, X86_MEM_PARAM(c), d)), op, a, b, X86_MEM_PARAM(c), d))
 #define X86_DYNALLOC_EMIT64_SEG(buf, alloc, adv, op, seg) adv(buf, X86_EMIT64_SEG(alloc(buf, X86_LENGTH64_SEG(op, seg)), op, seg))
 #define X86_DYNALLOC_EMIT64_SEG_M(buf, alloc, adv, op, seg, a) adv(buf, X86_EMIT64_SEG_M(alloc(buf, X86_LENGTH64_SEG_M(op, seg, X86_MEM_PARAM(a))), op, seg, X86_MEM_PARAM(a)))
 #define X86_DYNALLOC_EMIT64_SEG_RM(buf, alloc, adv, op, seg, a, b) adv(buf, X86_EMIT64_SEG_RM(alloc(buf, X86_LENGTH64_SEG_RM(op, seg, a, X86_MEM_PARAM(b))), op, seg, a, X86_MEM_PARAM(b)))
@@ -1032,6 +1124,8 @@ namespace asmx86
 #define X86_DYNALLOC_EMIT64_SEG_RMI(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT64_SEG_RMI(alloc(buf, X86_LENGTH64_SEG_RMI(op, seg, a, X86_MEM_PARAM(b), c)), op, seg, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_EMIT64_SEG_MRR(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT64_SEG_MRR(alloc(buf, X86_LENGTH64_SEG_MRR(op, seg, X86_MEM_PARAM(a), b, c)), op, seg, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_EMIT64_SEG_MRI(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT64_SEG_MRI(alloc(buf, X86_LENGTH64_SEG_MRI(op, seg, X86_MEM_PARAM(a), b, c)), op, seg, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_EMIT64_SEG_RRM(buf, alloc, adv, op, seg, a, b, c) adv(buf, X86_EMIT64_SEG_RRM(alloc(buf, X86_LENGTH64_SEG_RRM(op, seg, a, b, X86_MEM_PARAM(c))), op, seg, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_EMIT64_SEG_RRMI(buf, alloc, adv, op, seg, a, b, c, d) adv(buf, X86_EMIT64_SEG_RRMI(alloc(buf, X86_LENGTH64_SEG_RRMI(op, seg, a, b, X86_MEM_PARAM(c), d)), op, seg, a, b, X86_MEM_PARAM(c), d))
 
 #define X86_DYNALLOC_ALTEXEC_EMIT64(buf, alloc, adv, xlat, param, op) adv(buf, X86_ALTEXEC_EMIT64(alloc(buf, X86_LENGTH64(op)), xlat, param, op))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_R(buf, alloc, adv, xlat, param, op, a) adv(buf, X86_ALTEXEC_EMIT64_R(alloc(buf, X86_LENGTH64_R(op, a)), xlat, param, op, a))
@@ -1050,6 +1144,9 @@ namespace asmx86
 #define X86_DYNALLOC_ALTEXEC_EMIT64_RMI(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_RMI(alloc(buf, X86_LENGTH64_RMI(op, a, X86_MEM_PARAM(b), c)), xlat, param, op, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_MRR(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_MRR(alloc(buf, X86_LENGTH64_MRR(op, X86_MEM_PARAM(a), b, c)), xlat, param, op, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_MRI(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_MRI(alloc(buf, X86_LENGTH64_MRI(op, X86_MEM_PARAM(a), b, c)), xlat, param, op, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_ALTEXEC_EMIT64_RRM(buf, alloc, adv, xlat, param, op, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_RRM(alloc(buf, X86_LENGTH64_RRM(op, a, b, X86_MEM_PARAM(c))), xlat, param, op, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_ALTEXEC_EMIT64_RRRI(buf, alloc, adv, xlat, param, op, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT64_RRRI(alloc(buf, X86_LENGTH64_RRRI(op, a, b, c, d)), xlat, param, op, a, b, c, d))
+#define X86_DYNALLOC_ALTEXEC_EMIT64_RRMI(buf, alloc, adv, xlat, param, op, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT64_RRMI(alloc(buf, X86_LENGTH64_RRMI(op, a, b, X86_MEM_PARAM(c), d)), xlat, param, op, a, b, X86_MEM_PARAM(c), d))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG(buf, alloc, adv, xlat, param, op, seg) adv(buf, X86_ALTEXEC_EMIT64_SEG(alloc(buf, X86_LENGTH64_SEG(op, seg)), xlat, param, op, seg))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_M(buf, alloc, adv, xlat, param, op, seg, a) adv(buf, X86_ALTEXEC_EMIT64_SEG_M(alloc(buf, X86_LENGTH64_SEG_M(op, seg, X86_MEM_PARAM(a))), xlat, param, op, seg, X86_MEM_PARAM(a)))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RM(buf, alloc, adv, xlat, param, op, seg, a, b) adv(buf, X86_ALTEXEC_EMIT64_SEG_RM(alloc(buf, X86_LENGTH64_SEG_RM(op, seg, a, X86_MEM_PARAM(b))), xlat, param, op, seg, a, X86_MEM_PARAM(b)))
@@ -1058,6 +1155,8 @@ namespace asmx86
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RMI(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_SEG_RMI(alloc(buf, X86_LENGTH64_SEG_RMI(op, seg, a, X86_MEM_PARAM(b), c)), xlat, param, op, seg, a, X86_MEM_PARAM(b), c))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MRR(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_SEG_MRR(alloc(buf, X86_LENGTH64_SEG_MRR(op, seg, X86_MEM_PARAM(a), b, c)), xlat, param, op, seg, X86_MEM_PARAM(a), b, c))
 #define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_MRI(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_SEG_MRI(alloc(buf, X86_LENGTH64_SEG_MRI(op, seg, X86_MEM_PARAM(a), b, c)), xlat, param, op, seg, X86_MEM_PARAM(a), b, c))
+#define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RRM(buf, alloc, adv, xlat, param, op, seg, a, b, c) adv(buf, X86_ALTEXEC_EMIT64_SEG_RRM(alloc(buf, X86_LENGTH64_SEG_RRM(op, seg, a, b, X86_MEM_PARAM(c))), xlat, param, op, seg, a, b, X86_MEM_PARAM(c)))
+#define X86_DYNALLOC_ALTEXEC_EMIT64_SEG_RRMI(buf, alloc, adv, xlat, param, op, seg, a, b, c, d) adv(buf, X86_ALTEXEC_EMIT64_SEG_RRMI(alloc(buf, X86_LENGTH64_SEG_RRMI(op, seg, a, b, X86_MEM_PARAM(c), d)), xlat, param, op, seg, a, b, X86_MEM_PARAM(c), d))
 
 #endif
 
@@ -2141,6 +2240,37 @@ namespace asmx86
 		return ofs + 1;
 	}
 
+	static __inline size_t __alwaysinline __MODRM(reg_vex) (__CONTEXT_PARAMS, uint16_t vex, uint8_t op, uint8_t a, uint8_t v, uint8_t b)
+	{
+		size_t ofs;
+		__TRANSLATE_UNUSED
+		__NO_ASSERT
+		ofs = __vex_prefix(buf, wr, vex, __MODRM(reg_get_rex) (a, b), v);
+		__WRITE_BUF_8_8(ofs, op, 0xc0 | ((a & 7) << 3) | (b & 7));
+		return ofs + 2;
+	}
+
+	static __inline size_t __alwaysinline __MODRM(mem_vex) (__CONTEXT_PARAMS, uint16_t vex, uint8_t op, uint8_t reg, uint8_t v, __MEM_PARAM(m), uint8_t immsz)
+	{
+		size_t ofs = __vex_prefix(buf, wr, vex, __MODRM(mem_get_rex) (reg, __MEMOP(m)), v);
+		__WRITE_BUF_8(ofs, op);
+		return __MODRM(emit) (__CONTEXT_OFFSET(ofs + 1), reg, __MEMOP(m), immsz) + ofs + 1;
+	}
+
+	static __inline size_t __alwaysinline __MODRM(reg_vex_imm8) (__CONTEXT_PARAMS, uint16_t vex, uint8_t op, uint8_t a, uint8_t v, uint8_t b, int8_t imm)
+	{
+		size_t ofs = __MODRM(reg_vex) (__CONTEXT, vex, op, a, v, b);
+		__WRITE_BUF_8(ofs, imm);
+		return ofs + 1;
+	}
+
+	static __inline size_t __alwaysinline __MODRM(mem_vex_imm8) (__CONTEXT_PARAMS, uint16_t vex, uint8_t op, uint8_t reg, uint8_t v, __MEM_PARAM(m), int8_t imm)
+	{
+		size_t ofs = __MODRM(mem_vex) (__CONTEXT, vex, op, reg, v, __MEMOP(m), 1);
+		__WRITE_BUF_8(ofs, imm);
+		return ofs + 1;
+	}
+
 #ifdef __CODEGENX86_64BIT
 	static __inline size_t __alwaysinline __MODRM(reg_onebyte64) (__CONTEXT_PARAMS, uint8_t op, uint8_t a, uint8_t b)
 	{
@@ -3696,6 +3826,982 @@ namespace asmx86
 	__DEF_INSTR_3(roundsd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0b, __xmmreg(a), __MEMOP(b), c); }
 
 
+	// Packed floating point SSE instructions
+	__DEF_INSTR_2(movaps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x28, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movaps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x28, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movaps, mr, __MEM, __REG) { return __MODRM(mem_twobyte) (__CONTEXT, 0x29, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movups, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x10, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movups, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x10, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movups, mr, __MEM, __REG) { return __MODRM(mem_twobyte) (__CONTEXT, 0x11, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movapd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x28, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movapd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x28, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movapd, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x29, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movupd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x10, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movupd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x10, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movupd, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x11, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movntps, mr, __MEM, __REG) { return __MODRM(mem_twobyte) (__CONTEXT, 0x2b, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movntpd, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x2b, __xmmreg(b), __MEMOP(a), 0); }
+
+	__DEF_INSTR_2(addps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x58, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(addps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x58, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(mulps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x59, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(mulps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x59, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(subps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5c, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(subps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5c, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(minps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5d, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(minps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5d, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(divps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5e, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(divps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(maxps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5f, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(maxps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5f, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(sqrtps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x51, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(sqrtps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x51, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(rsqrtps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x52, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(rsqrtps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x52, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(rcpps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x53, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(rcpps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x53, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(addpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x58, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(addpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x58, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(mulpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x59, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(mulpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x59, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(subpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5c, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(subpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5c, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(minpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5d, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(minpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5d, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(divpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5e, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(divpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(maxpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5f, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(maxpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5f, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(sqrtpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x51, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(sqrtpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x51, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(andps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x54, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(andps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x54, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(andnps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x55, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(andnps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x55, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(orps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x56, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(orps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x56, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(xorps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x57, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(xorps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x57, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(andpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x54, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(andpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x54, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(andnpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x55, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(andnpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x55, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(orpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x56, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(orpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x56, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(xorpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x57, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(xorpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x57, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_3(cmpps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8) (__CONTEXT, 0xc2, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(cmpps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8) (__CONTEXT, 0xc2, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(cmppd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc2, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(cmppd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc2, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(shufps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8) (__CONTEXT, 0xc6, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(shufps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8) (__CONTEXT, 0xc6, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(shufpd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc6, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(shufpd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc6, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_2(unpcklps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x14, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(unpcklps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x14, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(unpckhps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x15, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(unpckhps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x15, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(unpcklpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x14, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(unpcklpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x14, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(unpckhpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x15, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(unpckhpd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x15, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(cvtdq2ps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtdq2ps, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvtps2dq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtps2dq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvttps2dq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf3, 0x5b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvttps2dq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf3, 0x5b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvtps2pd, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x5a, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtps2pd, rm, __REG, __MEM) { return __MODRM(mem_twobyte) (__CONTEXT, 0x5a, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvtpd2ps, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x5a, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtpd2ps, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x5a, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvtdq2pd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf3, 0xe6, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtdq2pd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf3, 0xe6, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvtpd2dq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf2, 0xe6, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvtpd2dq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf2, 0xe6, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(cvttpd2dq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe6, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(cvttpd2dq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe6, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(movmskps, rr, __REG, __REG) { return __MODRM(reg_twobyte) (__CONTEXT, 0x50, __reg32(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movmskpd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x50, __reg32(a), __xmmreg(b)); }
+
+
+	// Packed integer SSE instructions
+	__DEF_INSTR_2(movdqa, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6f, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movdqa, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6f, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movdqa, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x7f, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movdqu, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf3, 0x6f, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(movdqu, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf3, 0x6f, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movdqu, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf3, 0x7f, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movntdq, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe7, __xmmreg(b), __MEMOP(a), 0); }
+	__DEF_INSTR_2(movd, rr, __REG, __REG)
+	{
+		if ((a >= REG_XMM0) && (a <= REG_XMM15))
+			return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6e, __xmmreg(a), __reg32(b));
+		return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x7e, __xmmreg(b), __reg32(a));
+	}
+	__DEF_INSTR_2(movd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movd, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x7e, __xmmreg(b), __MEMOP(a), 0); }
+#ifdef __CODEGENX86_32BIT
+	__DEF_INSTR_2(movq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf3, 0x7e, __xmmreg(a), __xmmreg(b)); }
+#else
+	__DEF_INSTR_2(movq, rr, __REG, __REG)
+	{
+		if ((a >= REG_RAX) && (a <= REG_R15))
+			return __MODRM(reg_twobyte64_prefix) (__CONTEXT, 0x66, 0x7e, __xmmreg(b), __reg64(a));
+		if ((b >= REG_RAX) && (b <= REG_R15))
+			return __MODRM(reg_twobyte64_prefix) (__CONTEXT, 0x66, 0x6e, __xmmreg(a), __reg64(b));
+		return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0xf3, 0x7e, __xmmreg(a), __xmmreg(b));
+	}
+#endif
+	__DEF_INSTR_2(movq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0xf3, 0x7e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(movq, mr, __MEM, __REG) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd6, __xmmreg(b), __MEMOP(a), 0); }
+
+	__DEF_INSTR_2(paddb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xfc, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xfc, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xfd, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xfd, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xfe, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xfe, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd4, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd4, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf8, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf8, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf9, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf9, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xfa, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xfa, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xfb, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xfb, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddsb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xec, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddsb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xec, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddsw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xed, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddsw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xed, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddusb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xdc, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddusb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xdc, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(paddusw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xdd, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(paddusw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xdd, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubsb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe8, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubsb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe8, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubsw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe9, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubsw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe9, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubusb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd8, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubusb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd8, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psubusw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd9, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psubusw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd9, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(pmullw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd5, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmullw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd5, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmulhw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe5, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmulhw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe5, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmulhuw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe4, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmulhuw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe4, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmuludq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf4, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmuludq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf4, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaddwd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf5, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaddwd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf5, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psadbw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf6, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psadbw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf6, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pavgb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe0, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pavgb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe0, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pavgw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe3, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pavgw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe3, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminub, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xda, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminub, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xda, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxub, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xde, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxub, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xde, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminsw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xea, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminsw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xea, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxsw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xee, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxsw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xee, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(pand, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xdb, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pand, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xdb, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pandn, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xdf, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pandn, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xdf, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(por, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xeb, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(por, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xeb, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pxor, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xef, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pxor, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xef, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(pcmpeqb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x74, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpeqb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x74, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpeqw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x75, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpeqw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x75, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpeqd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x76, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpeqd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x76, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpgtb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x64, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpgtb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x64, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpgtw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x65, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpgtw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x65, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpgtd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x66, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpgtd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x66, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovmskb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd7, __reg32(a), __xmmreg(b)); }
+
+	__DEF_INSTR_2(packsswb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x63, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(packsswb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x63, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(packssdw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(packssdw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(packuswb, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x67, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(packuswb, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x67, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpcklbw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x60, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpcklbw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x60, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpcklwd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x61, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpcklwd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x61, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpckldq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x62, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpckldq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x62, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpcklqdq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6c, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpcklqdq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6c, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpckhbw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x68, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpckhbw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x68, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpckhwd, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x69, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpckhwd, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x69, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpckhdq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6a, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpckhdq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6a, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(punpckhqdq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0x6d, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(punpckhqdq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0x6d, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_3(pshufd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x70, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(pshufd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x70, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pshuflw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0xf2, 0x70, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(pshuflw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0xf2, 0x70, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pshufhw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0xf3, 0x70, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(pshufhw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0xf3, 0x70, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pextrw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc5, __reg32(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(pinsrw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc4, __xmmreg(a), __reg32(b), c); }
+	__DEF_INSTR_3(pinsrw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0xc4, __xmmreg(a), __MEMOP(b), c); }
+
+	__DEF_INSTR_2(psrlw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd1, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psrlw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd1, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psrld, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd2, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psrld, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd2, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psrlq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xd3, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psrlq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xd3, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psraw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe1, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psraw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe1, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psrad, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xe2, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psrad, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xe2, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psllw, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf1, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psllw, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf1, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pslld, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf2, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pslld, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf2, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psllq, rr, __REG, __REG) { return __MODRM(reg_twobyte_prefix) (__CONTEXT, 0x66, 0xf3, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psllq, rm, __REG, __MEM) { return __MODRM(mem_twobyte_prefix) (__CONTEXT, 0x66, 0xf3, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psrlw, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x71, 2, __xmmreg(a), b); }
+	__DEF_INSTR_2(psraw, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x71, 4, __xmmreg(a), b); }
+	__DEF_INSTR_2(psllw, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x71, 6, __xmmreg(a), b); }
+	__DEF_INSTR_2(psrld, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x72, 2, __xmmreg(a), b); }
+	__DEF_INSTR_2(psrad, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x72, 4, __xmmreg(a), b); }
+	__DEF_INSTR_2(pslld, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x72, 6, __xmmreg(a), b); }
+	__DEF_INSTR_2(psrlq, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x73, 2, __xmmreg(a), b); }
+	__DEF_INSTR_2(psrldq, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x73, 3, __xmmreg(a), b); }
+	__DEF_INSTR_2(psllq, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x73, 6, __xmmreg(a), b); }
+	__DEF_INSTR_2(pslldq, ri, __REG, __IMM8) { return __MODRM(reg_twobyte_imm8_prefix) (__CONTEXT, 0x66, 0x73, 7, __xmmreg(a), b); }
+
+
+	// SSSE3 instructions
+	__DEF_INSTR_2(pshufb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x00, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pshufb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x00, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phaddw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x01, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phaddw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x01, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phaddd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x02, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phaddd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x02, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phaddsw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x03, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phaddsw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x03, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaddubsw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x04, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaddubsw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x04, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phsubw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x05, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phsubw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x05, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phsubd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x06, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phsubd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x06, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phsubsw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x07, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phsubsw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x07, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psignb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x08, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psignb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x08, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psignw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x09, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psignw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x09, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(psignd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x0a, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(psignd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x0a, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmulhrsw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x0b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmulhrsw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x0b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pabsb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1c, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pabsb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1c, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pabsw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1d, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pabsw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1d, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pabsd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1e, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pabsd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x1e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_3(palignr, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0f, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(palignr, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0f, __xmmreg(a), __MEMOP(b), c); }
+
+
+	// SSE4 instructions
+	__DEF_INSTR_2(pblendvb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x10, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pblendvb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x10, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(blendvps, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x14, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(blendvps, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x14, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(blendvpd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x15, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(blendvpd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x15, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(ptest, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x17, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(ptest, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x17, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(pmovsxbw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x20, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxbw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x20, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovsxbd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x21, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxbd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x21, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovsxbq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x22, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxbq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x22, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovsxwd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x23, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxwd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x23, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovsxwq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x24, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxwq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x24, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovsxdq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x25, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovsxdq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x25, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxbw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x30, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxbw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x30, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxbd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x31, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxbd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x31, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxbq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x32, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxbq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x32, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxwd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x33, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxwd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x33, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxwq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x34, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxwq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x34, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmovzxdq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x35, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmovzxdq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x35, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(pmuldq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x28, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmuldq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x28, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpeqq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x29, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpeqq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x29, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(packusdw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x2b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(packusdw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x2b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pcmpgtq, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x37, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pcmpgtq, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x37, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminsb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x38, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminsb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x38, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminsd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x39, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminsd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x39, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminuw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3a, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminuw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3a, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pminud, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3b, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pminud, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3b, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxsb, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3c, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxsb, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3c, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxsd, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3d, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxsd, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3d, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxuw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3e, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxuw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3e, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmaxud, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3f, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmaxud, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x3f, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(pmulld, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x40, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(pmulld, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x40, __xmmreg(a), __MEMOP(b), 0); }
+	__DEF_INSTR_2(phminposuw, rr, __REG, __REG) { return __MODRM(reg_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x41, __xmmreg(a), __xmmreg(b)); }
+	__DEF_INSTR_2(phminposuw, rm, __REG, __MEM) { return __MODRM(mem_threebyte_prefix) (__CONTEXT, 0x66, 0x38, 0x41, __xmmreg(a), __MEMOP(b), 0); }
+
+	__DEF_INSTR_3(roundps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x08, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(roundps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x08, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(roundpd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x09, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(roundpd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x09, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(roundss, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0a, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(roundss, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0a, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(blendps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0c, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(blendps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0c, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(blendpd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0d, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(blendpd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0d, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pblendw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0e, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(pblendw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x0e, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(insertps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x21, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(insertps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x21, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(dpps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x40, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(dpps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x40, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(dppd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x41, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(dppd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x41, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(mpsadbw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x42, __xmmreg(a), __xmmreg(b), c); }
+	__DEF_INSTR_3(mpsadbw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x42, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pextrb, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x14, __xmmreg(b), __reg32(a), c); }
+	__DEF_INSTR_3(pextrd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x16, __xmmreg(b), __reg32(a), c); }
+	__DEF_INSTR_3(pextrd, mri, __MEM, __REG, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x16, __xmmreg(b), __MEMOP(a), c); }
+	__DEF_INSTR_3(pinsrb, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x20, __xmmreg(a), __reg32(b), c); }
+	__DEF_INSTR_3(pinsrb, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x20, __xmmreg(a), __MEMOP(b), c); }
+	__DEF_INSTR_3(pinsrd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x22, __xmmreg(a), __reg32(b), c); }
+	__DEF_INSTR_3(pinsrd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_threebyte_imm8_prefix) (__CONTEXT, 0x66, 0x3a, 0x22, __xmmreg(a), __MEMOP(b), c); }
+
+
+	// AVX instructions, the vector length is selected by the destination register (XMM or YMM)
+	__DEF_INSTR_2(vmovaps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x28, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovaps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x28, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovaps, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(b), 0x29, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovups, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x10, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovups, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x10, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovups, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(b), 0x11, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovapd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x28, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovapd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x28, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovapd, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0x29, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovupd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x10, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovupd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x10, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovupd, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0x11, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovntps, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(b), 0x2b, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovntpd, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0x2b, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_3(vmovss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3, 0x10, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_2(vmovss, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3, 0x10, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovss, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3, 0x11, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_3(vmovsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2, 0x10, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_2(vmovsd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2, 0x10, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovsd, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2, 0x11, __vecreg(b), 0, __MEMOP(a), 0); }
+
+	__DEF_INSTR_3(vaddps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vaddps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmulps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmulps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsubps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsubps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vminps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vminps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vdivps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vdivps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmaxps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmaxps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vaddpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vaddpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmulpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmulpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsubpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsubpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vminpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vminpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vdivpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vdivpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmaxpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmaxpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vaddss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vaddss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmulss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmulss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsubss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsubss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vminss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vminss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vdivss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vdivss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmaxss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmaxss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vaddsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vaddsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x58, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmulsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmulsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x59, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsubsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsubsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vminsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vminsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vdivsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vdivsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vmaxsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vmaxsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x5f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsqrtss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x51, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsqrtss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x51, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vsqrtsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x51, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vsqrtsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x51, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_2(vsqrtps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x51, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vsqrtps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x51, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vsqrtpd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x51, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vsqrtpd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x51, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vrsqrtps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x52, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vrsqrtps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x52, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vrcpps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x53, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vrcpps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x53, __vecreg(a), 0, __MEMOP(b), 0); }
+
+	__DEF_INSTR_3(vandps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x54, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vandps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x54, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vandnps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x55, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vandnps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x55, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vorps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x56, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vorps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x56, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vxorps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x57, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vxorps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x57, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vunpcklps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x14, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vunpcklps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x14, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vunpckhps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x15, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vunpckhps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x15, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vandpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x54, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vandpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x54, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vandnpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x55, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vandnpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x55, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vorpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x56, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vorpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x56, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vxorpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x57, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vxorpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x57, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vunpcklpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x14, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vunpcklpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x14, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vunpckhpd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x15, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vunpckhpd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x15, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+
+	__DEF_INSTR_4(vcmpps, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vcmpps, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vcmppd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vcmppd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vcmpss, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vcmpss, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vcmpsd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vcmpsd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0xc2, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vshufps, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0xc6, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vshufps, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0xc6, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vshufpd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xc6, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vshufpd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xc6, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vblendps, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0c, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vblendps, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0c, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vblendpd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0d, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vblendpd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0d, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vdpps, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x40, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vdpps, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x40, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_3(vroundps, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x08, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vroundps, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x08, __vecreg(a), 0, __MEMOP(b), c); }
+	__DEF_INSTR_3(vroundpd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x09, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vroundpd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x09, __vecreg(a), 0, __MEMOP(b), c); }
+	__DEF_INSTR_4(vroundss, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0a, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vroundss, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0a, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vroundsd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0b, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vroundsd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0b, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+
+	__DEF_INSTR_2(vcvtdq2ps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5b, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vcvtdq2ps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(a), 0x5b, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vcvtps2dq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5b, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vcvtps2dq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x5b, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vcvttps2dq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5b, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vcvttps2dq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x5b, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovmskps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_NONE | __VEX_L(b), 0x50, __reg32(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovmskpd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0x50, __reg32(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vtestps, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0e, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vtestps, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0e, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vtestpd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0f, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vtestpd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0f, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vptest, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x17, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vptest, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x17, __vecreg(a), 0, __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(vbroadcastss, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x18, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vbroadcastss, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x18, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vbroadcastsd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x19, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vbroadcastsd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x19, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vbroadcastf128, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_256, 0x1a, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_4(vinsertf128, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x18, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vinsertf128, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x18, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vperm2f128, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x06, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vperm2f128, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x06, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_3(vextractf128, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_256, 0x19, __vecreg(b), 0, __vecreg(a), c); }
+	__DEF_INSTR_3(vextractf128, mri, __MEM, __REG, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_256, 0x19, __vecreg(b), 0, __MEMOP(a), c); }
+	__DEF_INSTR_0(vzeroupper)
+	{
+		__TRANSLATE_UNUSED
+		__NO_ASSERT
+		__WRITE_BUF_8_8(0, 0xc5, 0xf8);
+		__WRITE_BUF_8(2, 0x77);
+		return 3;
+	}
+
+	__DEF_INSTR_0(vzeroall)
+	{
+		__TRANSLATE_UNUSED
+		__NO_ASSERT
+		__WRITE_BUF_8_8(0, 0xc5, 0xfc);
+		__WRITE_BUF_8(2, 0x77);
+		return 3;
+	}
+
+
+	// AVX and AVX2 integer instructions
+	__DEF_INSTR_2(vmovdqa, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6f, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovdqa, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6f, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovdqa, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0x7f, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovdqu, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x6f, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vmovdqu, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x6f, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vmovdqu, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(b), 0x7f, __vecreg(b), 0, __MEMOP(a), 0); }
+	__DEF_INSTR_2(vmovntdq, mr, __MEM, __REG) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0xe7, __vecreg(b), 0, __MEMOP(a), 0); }
+
+	__DEF_INSTR_3(vpaddb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfc, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfc, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfd, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfd, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfe, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfe, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd4, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd4, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfa, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfa, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfb, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xfb, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddsb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xec, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddsb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xec, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xed, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xed, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddusb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdc, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddusb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdc, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpaddusw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdd, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpaddusw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdd, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubsb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubsb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubusb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubusb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsubusw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsubusw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmullw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd5, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmullw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd5, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmulhw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe5, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmulhw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe5, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmulhuw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe4, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmulhuw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe4, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmuludq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf4, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmuludq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf4, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaddwd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf5, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaddwd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf5, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsadbw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf6, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsadbw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf6, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpavgb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe0, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpavgb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe0, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpavgw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe3, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpavgw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe3, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminub, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xda, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminub, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xda, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxub, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xde, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxub, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xde, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xea, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xea, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xee, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xee, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+
+	__DEF_INSTR_3(vpand, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdb, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpand, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdb, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpandn, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdf, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpandn, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xdf, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpor, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xeb, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpor, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xeb, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpxor, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xef, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpxor, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xef, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpeqb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x74, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpeqb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x74, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpeqw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x75, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpeqw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x75, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpeqd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x76, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpeqd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x76, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpgtb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x64, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpgtb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x64, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpgtw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x65, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpgtw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x65, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpgtd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x66, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpgtd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x66, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_2(vpmovmskb, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(b), 0xd7, __reg32(a), 0, __vecreg(b)); }
+
+	__DEF_INSTR_3(vpacksswb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x63, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpacksswb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x63, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpackssdw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpackssdw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpackuswb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x67, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpackuswb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x67, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpcklbw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x60, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpcklbw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x60, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpcklwd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x61, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpcklwd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x61, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpckldq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x62, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpckldq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x62, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpcklqdq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpcklqdq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpckhbw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x68, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpckhbw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x68, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpckhwd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x69, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpckhwd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x69, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpckhdq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6a, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpckhdq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6a, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpunpckhqdq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpunpckhqdq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x6d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+
+	__DEF_INSTR_3(vpshufd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x70, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vpshufd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x70, __vecreg(a), 0, __MEMOP(b), c); }
+	__DEF_INSTR_3(vpshuflw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x70, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vpshuflw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F2 | __VEX_L(a), 0x70, __vecreg(a), 0, __MEMOP(b), c); }
+	__DEF_INSTR_3(vpshufhw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x70, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vpshufhw, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_F3 | __VEX_L(a), 0x70, __vecreg(a), 0, __MEMOP(b), c); }
+
+	__DEF_INSTR_3(vpsrlw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd1, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrlw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd1, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsrld, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd2, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrld, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd2, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsrlq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd3, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrlq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xd3, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsraw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe1, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsraw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe1, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsrad, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe2, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrad, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xe2, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsllw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf1, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsllw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf1, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpslld, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf2, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpslld, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf2, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsllq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf3, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsllq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0xf3, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsrlw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x71, 2, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsraw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x71, 4, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsllw, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x71, 6, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsrld, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x72, 2, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsrad, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x72, 4, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpslld, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x72, 6, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsrlq, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x73, 2, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsrldq, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x73, 3, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsllq, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x73, 6, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpslldq, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F | __VEX_PP_66 | __VEX_L(a), 0x73, 7, __vecreg(a), __vecreg(b), c); }
+	__DEF_INSTR_3(vpsrlvd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x45, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrlvd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x45, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsrlvq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x45, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsrlvq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x45, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsravd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x46, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsravd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x46, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsllvd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x47, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsllvd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x47, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsllvq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x47, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsllvq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x47, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+
+	__DEF_INSTR_3(vpshufb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x00, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpshufb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x00, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphaddw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x01, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphaddw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x01, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphaddd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x02, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphaddd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x02, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphaddsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x03, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphaddsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x03, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaddubsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x04, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaddubsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x04, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphsubw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x05, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphsubw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x05, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphsubd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x06, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphsubd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x06, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vphsubsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x07, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vphsubsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x07, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsignb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x08, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsignb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x08, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsignw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x09, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsignw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x09, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpsignd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0a, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpsignd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0a, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmulhrsw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmulhrsw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x0b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmuldq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x28, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmuldq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x28, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpeqq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x29, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpeqq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x29, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpackusdw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x2b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpackusdw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x2b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpcmpgtq, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x37, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpcmpgtq, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x37, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminsb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x38, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminsb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x38, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x39, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x39, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminuw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3a, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminuw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3a, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpminud, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpminud, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxsb, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxsb, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxsd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxsd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxuw, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxuw, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmaxud, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmaxud, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x3f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpmulld, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x40, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpmulld, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x40, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_2(vpabsb, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1c, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpabsb, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1c, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpabsw, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1d, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpabsw, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1d, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpabsd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1e, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpabsd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x1e, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_4(vpalignr, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0f, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vpalignr, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0f, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vpblendw, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0e, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vpblendw, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x0e, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vpblendd, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x02, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vpblendd, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x02, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+
+	__DEF_INSTR_2(vpmovsxbw, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x20, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxbw, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x20, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovsxbd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x21, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxbd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x21, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovsxbq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x22, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxbq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x22, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovsxwd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x23, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxwd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x23, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovsxwq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x24, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxwq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x24, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovsxdq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x25, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovsxdq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x25, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxbw, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x30, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxbw, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x30, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxbd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x31, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxbd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x31, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxbq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x32, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxbq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x32, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxwd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x33, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxwd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x33, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxwq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x34, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxwq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x34, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpmovzxdq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x35, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpmovzxdq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x35, __vecreg(a), 0, __MEMOP(b), 0); }
+
+	__DEF_INSTR_2(vpbroadcastb, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x78, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpbroadcastb, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x78, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpbroadcastw, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x79, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpbroadcastw, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x79, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpbroadcastd, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x58, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpbroadcastd, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x58, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vpbroadcastq, rr, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x59, __vecreg(a), 0, __vecreg(b)); }
+	__DEF_INSTR_2(vpbroadcastq, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x59, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_2(vbroadcasti128, rm, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_256, 0x5a, __vecreg(a), 0, __MEMOP(b), 0); }
+	__DEF_INSTR_4(vinserti128, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x38, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vinserti128, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x38, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_4(vperm2i128, rrri, __REG, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x46, __vecreg(a), __vecreg(b), __vecreg(c), d); }
+	__DEF_INSTR_4(vperm2i128, rrmi, __REG, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_L(a), 0x46, __vecreg(a), __vecreg(b), __MEMOP(c), d); }
+	__DEF_INSTR_3(vextracti128, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_256, 0x39, __vecreg(b), 0, __vecreg(a), c); }
+	__DEF_INSTR_3(vextracti128, mri, __MEM, __REG, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_256, 0x39, __vecreg(b), 0, __MEMOP(a), c); }
+	__DEF_INSTR_3(vpermd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x36, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpermd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x36, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpermps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x16, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vpermps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x16, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vpermq, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x00, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vpermq, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x00, __vecreg(a), 0, __MEMOP(b), c); }
+	__DEF_INSTR_3(vpermpd, rri, __REG, __REG, __IMM8) { return __MODRM(reg_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x01, __vecreg(a), 0, __vecreg(b), c); }
+	__DEF_INSTR_3(vpermpd, rmi, __REG, __MEM, __IMM8) { return __MODRM(mem_vex_imm8) (__CONTEXT, __VEX_0F3A | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x01, __vecreg(a), 0, __MEMOP(b), c); }
+
+
+	// FMA3 instructions
+	__DEF_INSTR_3(vfmadd132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x98, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x98, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x98, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x98, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd132ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x99, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd132ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x99, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd132sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x99, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd132sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x99, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd213ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd213ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd213sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd213sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb8, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb8, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd231ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd231ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmadd231sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb9, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmadd231sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb9, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9a, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9a, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9a, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9a, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub132ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub132ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub132sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9b, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub132sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9b, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xaa, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xaa, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xaa, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xaa, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub213ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xab, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub213ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xab, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub213sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xab, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub213sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xab, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xba, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xba, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xba, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xba, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub231ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbb, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub231ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbb, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsub231sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbb, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsub231sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbb, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9c, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9c, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd132ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd132ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd132sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9d, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd132sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9d, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xac, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xac, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xac, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xac, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd213ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xad, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd213ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xad, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd213sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xad, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd213sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xad, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbc, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbc, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbc, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbc, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd231ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbd, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd231ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbd, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmadd231sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbd, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmadd231sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbd, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9e, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9e, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub132ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub132ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x9f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub132sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9f, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub132sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x9f, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xae, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xae, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xae, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xae, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub213ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xaf, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub213ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xaf, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub213sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xaf, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub213sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xaf, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbe, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbe, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbe, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbe, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub231ss, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbf, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub231ss, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xbf, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfnmsub231sd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbf, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfnmsub231sd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xbf, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x96, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x96, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x96, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x96, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa6, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa6, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa6, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa6, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb6, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb6, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmaddsub231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb6, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmaddsub231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb6, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd132ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x97, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd132ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0x97, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd132pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x97, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd132pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0x97, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd213ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa7, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd213ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xa7, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd213pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa7, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd213pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xa7, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd231ps, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb7, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd231ps, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_L(a), 0xb7, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+	__DEF_INSTR_3(vfmsubadd231pd, rrr, __REG, __REG, __REG) { return __MODRM(reg_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb7, __vecreg(a), __vecreg(b), __vecreg(c)); }
+	__DEF_INSTR_3(vfmsubadd231pd, rrm, __REG, __REG, __MEM) { return __MODRM(mem_vex) (__CONTEXT, __VEX_0F38 | __VEX_PP_66 | __VEX_W | __VEX_L(a), 0xb7, __vecreg(a), __vecreg(b), __MEMOP(c), 0); }
+
+
 	// Misc instructions
 #ifdef __CODEGENX86_32BIT
 	__ONEBYTE_INSTR(daa, 0x27)
@@ -0,0 +1,975 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <asm/prctl.h>
+#include <cpuid.h>
+#include "dbtx86.h"
+
+#define DBT_MAX_BLOCK_INSTRUCTIONS	64
+#define DBT_RECORD_CHUNK_SIZE		(1024 * 1024)
+#define DBT_RED_ZONE				128
+#define DBT_NO_ADDRESS				(~(uint64_t)0)
+
+// Result of an exit that continues execution at its target
+#define DBT_CONTINUE				0xff
+
+// Kinds of hook sites
+#define DBT_SITE_BLOCK				0
+#define DBT_SITE_INSTRUCTION		1
+
+// Absolute moves of AL and RAX, the only loads and stores that don't need a free base register
+#define DBT_LOAD_AL					0xa0
+#define DBT_LOAD_RAX				0xa1
+#define DBT_STORE_AL				0xa2
+#define DBT_STORE_RAX				0xa3
+
+// State components saved with XSAVE: x87, SSE, AVX and AVX-512
+#define DBT_XSAVE_COMPONENTS		0xe7
+
+#define DBT_GPR(n)					((OperandType)(REG_RAX + (n)))
+#define DBT_REG_OFFSET(n)			((int32_t)(offsetof(DbtState, regs) + (X86_REGFILE_GPR(n) * 8)))
+#define DBT_STATE_OFFSET(field)		((int32_t)offsetof(DbtState, field))
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	struct DbtRecordChunk
+	{
+		struct DbtRecordChunk* next;
+		size_t used;
+		uint64_t data[(DBT_RECORD_CHUNK_SIZE / 8) - 2];
+	};
+#ifndef __cplusplus
+	typedef struct DbtRecordChunk DbtRecordChunk;
+#endif
+
+
+	// Exit from a translated block, passed to the exit stub in RAX.  The target must be the first member.
+	// Exits that continue at their target are patched into a direct jump to the target block when chaining.
+	struct DbtExit
+	{
+		uint64_t target;
+		uint8_t* patch;
+		uint8_t result;
+		uint8_t interrupt;
+	};
+#ifndef __cplusplus
+	typedef struct DbtExit DbtExit;
+#endif
+
+
+	// Call to the hooks from translated code, passed to the hook stub in RAX
+	struct DbtSite
+	{
+		uint64_t addr;
+		uint8_t kind;
+		Instruction instr;
+	};
+#ifndef __cplusplus
+	typedef struct DbtSite DbtSite;
+#endif
+
+
+	// Records are allocated while guest code is suspended at an arbitrary point, possibly inside the guest's
+	// own malloc, so they are kept out of the heap
+	static void* AllocRecord(DbtState* state, size_t size)
+	{
+		DbtRecordChunk* chunk = state->records;
+		void* result;
+		size = (size + 7) & ~(size_t)7;
+		if ((!chunk) || ((chunk->used + size) > sizeof(chunk->data)))
+		{
+			chunk = (DbtRecordChunk*)mmap(NULL, sizeof(DbtRecordChunk), PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (chunk == MAP_FAILED)
+				return NULL;
+			chunk->next = state->records;
+			chunk->used = 0;
+			state->records = chunk;
+		}
+		result = (uint8_t*)chunk->data + chunk->used;
+		chunk->used += size;
+		return result;
+	}
+
+
+	static void FreeRecords(DbtState* state)
+	{
+		while (state->records)
+		{
+			DbtRecordChunk* next = state->records->next;
+			munmap(state->records, sizeof(DbtRecordChunk));
+			state->records = next;
+		}
+	}
+
+
+	static size_t HashAddress(uint64_t addr)
+	{
+		return (size_t)((addr * 0x9e3779b97f4a7c15ULL) >> 32);
+	}
+
+
+	static const uint8_t* LookupBlock(DbtState* state, uint64_t addr)
+	{
+		size_t i = HashAddress(addr) & state->blockMask;
+		while (state->blocks[i].code)
+		{
+			if (state->blocks[i].addr == addr)
+				return state->blocks[i].code;
+			i = (i + 1) & state->blockMask;
+		}
+		return NULL;
+	}
+
+
+	static void AddBlock(DbtState* state, uint64_t addr, const uint8_t* code)
+	{
+		size_t i = HashAddress(addr) & state->blockMask;
+		while (state->blocks[i].code)
+			i = (i + 1) & state->blockMask;
+		state->blocks[i].addr = addr;
+		state->blocks[i].code = code;
+		state->blockCount++;
+		state->translatedBlocks++;
+	}
+
+
+	// The indirect branch table is looked up by the indirect stub, using the low bits of the address
+	static void AddIndirectTarget(DbtState* state, uint64_t addr, const uint8_t* code)
+	{
+		size_t i = (size_t)addr & state->blockMask;
+		state->indirectAddr[i] = addr;
+		state->indirectCode[i] = code;
+	}
+
+
+	static uint8_t* EmitBytes(DbtState* state, const uint8_t* data, size_t len)
+	{
+		uint8_t* dest = AllocCodeBufferSpace(&state->code, len);
+		memcpy(dest, data, len);
+		AdvanceCodeBuffer(&state->code, len);
+		return dest;
+	}
+
+
+	static void EmitAbsoluteMove(DbtState* state, uint8_t op, const void* ptr)
+	{
+		uint8_t code[10];
+		size_t len = 0;
+		uint64_t addr = (uint64_t)(size_t)ptr;
+		if (op & 1)
+			code[len++] = 0x48;
+		code[len++] = op;
+		memcpy(&code[len], &addr, 8);
+		EmitBytes(state, code, len + 8);
+	}
+
+
+	// Restores the host stack and returns from the entry stub, reg holds the state
+	static void EmitLeave(DbtState* state, OperandType reg)
+	{
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RSP, X86_MEM(reg, DBT_STATE_OFFSET(hostStack)));
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, 8));
+		CODEBUF_EMIT64_R(&state->code, pop, REG_R15);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_R14);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_R13);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_R12);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RBP);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RBX);
+		CODEBUF_EMIT64(&state->code, retn);
+	}
+
+
+	// Stores the general purpose registers other than RAX and RSP into the state pointed to by RAX
+	static void EmitSaveRegisters(DbtState* state)
+	{
+		size_t i;
+		for (i = 1; i < 16; i++)
+		{
+			if (i != 4)
+				CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, DBT_REG_OFFSET(i)), DBT_GPR(i));
+		}
+	}
+
+
+	// Called from the hook stub with the guest state saved
+	static bool HandleHookSite(DbtState* state)
+	{
+		const DbtSite* site = (const DbtSite*)state->lastSite;
+		MemAccess accesses[4];
+		size_t i, count;
+		bool ok = true;
+
+		if (site->kind == DBT_SITE_BLOCK)
+			ok = state->blockHook(state, site->addr, state->hookContext);
+		else
+		{
+			if (state->instructionHook)
+				ok = state->instructionHook(state, &site->instr, state->hookContext);
+			if (ok && state->memoryHook)
+			{
+				count = GetMemoryAccesses(&site->instr, accesses);
+				for (i = 0; ok && (i < count); i++)
+				{
+					ok = state->memoryHook(state, &site->instr, ComputeEffectiveAddress(&accesses[i].operand,
+						state->regs), accesses[i].operand.size, accesses[i].access, state->hookContext);
+				}
+			}
+		}
+
+		if (!ok)
+		{
+			state->rip = site->addr;
+			state->stopped = true;
+		}
+		return ok;
+	}
+
+
+	// Saves or restores the x87, SSE and AVX state of the guest, clobbering RAX, RCX and RDX
+	static void EmitVectorStateAccess(DbtState* state, bool restore)
+	{
+		uint8_t code[4] = {0x48, 0x0f, 0xae, 0};
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RCX, (int64_t)(size_t)state->vectorState);
+		if (state->xsave)
+		{
+			CODEBUF_EMIT64_RI(&state->code, mov_32, REG_EAX, DBT_XSAVE_COMPONENTS);
+			CODEBUF_EMIT64_RR(&state->code, xor_32, REG_EDX, REG_EDX);
+			code[3] = restore ? 0x29 : 0x21; // xrstor64/xsave64 [rcx]
+		}
+		else
+			code[3] = restore ? 0x09 : 0x01; // fxrstor64/fxsave64 [rcx]
+		EmitBytes(state, code, 4);
+	}
+
+
+	static bool EmitStubs(DbtState* state)
+	{
+		X86_DECLARE_JUMP_LABEL(miss);
+		X86_DECLARE_JUMP_LABEL(stop);
+		size_t i;
+
+		// Entry from C, called with the state in RDI and the translated code in RSI.  Flags are loaded while
+		// still on the host stack, then the branch to the translated code is made with a return from the
+		// guest stack, below the red zone.
+		state->enter = (void (*)(DbtState*, const uint8_t*))GetCodeBufferExecPointer(&state->code);
+		CODEBUF_EMIT64_R(&state->code, push, REG_RBX);
+		CODEBUF_EMIT64_R(&state->code, push, REG_RBP);
+		CODEBUF_EMIT64_R(&state->code, push, REG_R12);
+		CODEBUF_EMIT64_R(&state->code, push, REG_R13);
+		CODEBUF_EMIT64_R(&state->code, push, REG_R14);
+		CODEBUF_EMIT64_R(&state->code, push, REG_R15);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -8));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RDI, DBT_STATE_OFFSET(hostStack)), REG_RSP);
+		EmitVectorStateAccess(state, true);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM(REG_RDI, DBT_REG_OFFSET(4)));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, -DBT_RED_ZONE - 8), REG_RSI);
+		CODEBUF_EMIT64_M(&state->code, push, X86_MEM(REG_RDI, DBT_STATE_OFFSET(rflags)));
+		CODEBUF_EMIT64(&state->code, popfq);
+		for (i = 1; i < 16; i++)
+		{
+			if ((i != 4) && (i != 7))
+				CODEBUF_EMIT64_RM(&state->code, mov_64, DBT_GPR(i), X86_MEM(REG_RDI, DBT_REG_OFFSET(i)));
+		}
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RAX, -DBT_RED_ZONE - 8));
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM(REG_RDI, DBT_REG_OFFSET(0)));
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RDI, X86_MEM(REG_RDI, DBT_REG_OFFSET(7)));
+		CODEBUF_EMIT64_I(&state->code, retn, DBT_RED_ZONE);
+
+		// Exit from a block, with the exit in RAX and the guest RAX pushed below the red zone.  Falls
+		// through to the save stub.
+		state->exitStub = GetCodeBufferExecPointer(&state->code);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->lastExit);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM(REG_RAX, 0));
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->rip);
+
+		// Saves the guest state and returns to C
+		state->saveStub = GetCodeBufferExecPointer(&state->code);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)state);
+		EmitSaveRegisters(state);
+		CODEBUF_EMIT64_M(&state->code, pop, X86_MEM(REG_RAX, DBT_REG_OFFSET(0)));
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RCX, X86_MEM(REG_RSP, DBT_RED_ZONE));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, DBT_REG_OFFSET(4)), REG_RCX);
+		CODEBUF_EMIT64(&state->code, pushfq);
+		CODEBUF_EMIT64_M(&state->code, pop, X86_MEM(REG_RAX, DBT_STATE_OFFSET(rflags)));
+		CODEBUF_EMIT64(&state->code, cld);
+		EmitVectorStateAccess(state, false);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)state);
+		EmitLeave(state, REG_RAX);
+
+		// Exit to an indirect branch target that is not in the indirect branch table, with the target in
+		// RAX and the guest RAX in the first scratch slot
+		state->indirectExitStub = GetCodeBufferExecPointer(&state->code);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->rip);
+		CODEBUF_EMIT64_RI(&state->code, mov_32, REG_EAX, 0);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->lastExit);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[0]);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -DBT_RED_ZONE));
+		CODEBUF_EMIT64_R(&state->code, push, REG_RAX);
+		CODEBUF_EMIT64_P(&state->code, jmpn, state->saveStub);
+
+		// Indirect branch, with the target in RAX and the guest RAX in the first scratch slot.  Targets that
+		// have been translated are looked up without leaving the translated code.
+		state->indirectStub = GetCodeBufferExecPointer(&state->code);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -DBT_RED_ZONE));
+		CODEBUF_EMIT64(&state->code, pushfq);
+		CODEBUF_EMIT64_R(&state->code, push, REG_RCX);
+		CODEBUF_EMIT64_R(&state->code, push, REG_RDX);
+		CODEBUF_EMIT64_RR(&state->code, mov_32, REG_ECX, REG_EAX);
+		CODEBUF_EMIT64_RI(&state->code, and_32, REG_ECX, (int32_t)state->blockMask);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RDX, (int64_t)(size_t)state->indirectAddr);
+		CODEBUF_EMIT64_RM(&state->code, cmp_64, REG_RAX, X86_MEM_INDEX(REG_RDX, REG_RCX, 8, 0));
+		CODEBUF_EMIT64_T(&state->code, jne, miss);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RDX, (int64_t)(size_t)state->indirectCode);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM_INDEX(REG_RDX, REG_RCX, 8, 0));
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RDX);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RCX);
+		CODEBUF_EMIT64(&state->code, popfq);
+		CODEBUF_EMIT64_R(&state->code, push, REG_RAX);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[0]);
+		CODEBUF_EMIT64_I(&state->code, retn, DBT_RED_ZONE);
+		CODEBUF_MARK_JUMP_LABEL_64(&state->code, miss);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RDX);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RCX);
+		CODEBUF_EMIT64(&state->code, popfq);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, DBT_RED_ZONE));
+		CODEBUF_EMIT64_P(&state->code, jmpn, state->indirectExitStub);
+
+		// Call to the hooks, with the site in RAX and the guest RAX pushed below the red zone.  The guest
+		// state is saved so that the hooks can inspect and modify it, and is reloaded afterwards.
+		state->hookStub = GetCodeBufferExecPointer(&state->code);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->lastSite);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)state);
+		EmitSaveRegisters(state);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RCX, X86_MEM(REG_RSP, 8));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, DBT_REG_OFFSET(0)), REG_RCX);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RCX, X86_MEM(REG_RSP, DBT_RED_ZONE + 16));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, DBT_REG_OFFSET(4)), REG_RCX);
+		CODEBUF_EMIT64(&state->code, pushfq);
+		CODEBUF_EMIT64_M(&state->code, pop, X86_MEM(REG_RAX, DBT_STATE_OFFSET(rflags)));
+		CODEBUF_EMIT64(&state->code, cld);
+		EmitVectorStateAccess(state, false);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)state);
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RAX, DBT_STATE_OFFSET(hookStack)), REG_RSP);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RSP, X86_MEM(REG_RAX, DBT_STATE_OFFSET(hostStack)));
+		CODEBUF_EMIT64_RR(&state->code, mov_64, REG_RDI, REG_RAX);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)HandleHookSite);
+		CODEBUF_EMIT64_R(&state->code, calln, REG_RAX);
+		CODEBUF_EMIT64_RR(&state->code, test_8, REG_AL, REG_AL);
+		CODEBUF_EMIT64_T(&state->code, jz, stop);
+		EmitVectorStateAccess(state, true);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RCX, (int64_t)(size_t)state);
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RSP, X86_MEM(REG_RCX, DBT_STATE_OFFSET(hookStack)));
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM(REG_RCX, DBT_REG_OFFSET(0)));
+		CODEBUF_EMIT64_MR(&state->code, mov_64, X86_MEM(REG_RSP, 8), REG_RAX);
+		CODEBUF_EMIT64_M(&state->code, push, X86_MEM(REG_RCX, DBT_STATE_OFFSET(rflags)));
+		CODEBUF_EMIT64(&state->code, popfq);
+		for (i = 2; i < 16; i++)
+		{
+			if (i != 4)
+				CODEBUF_EMIT64_RM(&state->code, mov_64, DBT_GPR(i), X86_MEM(REG_RCX, DBT_REG_OFFSET(i)));
+		}
+		CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RCX, X86_MEM(REG_RCX, DBT_REG_OFFSET(1)));
+		CODEBUF_EMIT64(&state->code, retn);
+		CODEBUF_MARK_JUMP_LABEL_64(&state->code, stop);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RCX, (int64_t)(size_t)state);
+		EmitLeave(state, REG_RCX);
+
+		return !state->code.failed;
+	}
+
+
+	static bool EmitExit(DbtState* state, uint64_t target, uint8_t result, uint8_t interrupt)
+	{
+		DbtExit* exitInfo = (DbtExit*)AllocRecord(state, sizeof(DbtExit));
+		if (!exitInfo)
+			return false;
+		exitInfo->target = target;
+		exitInfo->patch = (result == DBT_CONTINUE) ? (state->code.writeBase + state->code.offset) : NULL;
+		exitInfo->result = result;
+		exitInfo->interrupt = interrupt;
+
+		// The first instruction is at least five bytes so that it can be replaced by a jump when chaining
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -DBT_RED_ZONE));
+		CODEBUF_EMIT64_R(&state->code, push, REG_RAX);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)exitInfo);
+		CODEBUF_EMIT64_P(&state->code, jmpn, state->exitStub);
+		return true;
+	}
+
+
+	static void ChainExit(DbtState* state, DbtExit* exitInfo, const uint8_t* code)
+	{
+		const uint8_t* exec = (const uint8_t*)TranslateCodeBufferPointer(exitInfo->patch, &state->code);
+		int32_t diff = (int32_t)(code - (exec + 5));
+		exitInfo->patch[0] = 0xe9;
+		memcpy(&exitInfo->patch[1], &diff, 4);
+		exitInfo->patch = NULL;
+	}
+
+
+	static bool EmitHookSite(DbtState* state, uint64_t addr, uint8_t kind, const Instruction* instr)
+	{
+		DbtSite* site = (DbtSite*)AllocRecord(state, sizeof(DbtSite));
+		if (!site)
+			return false;
+		site->addr = addr;
+		site->kind = kind;
+		if (instr)
+			site->instr = *instr;
+
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -DBT_RED_ZONE));
+		CODEBUF_EMIT64_R(&state->code, push, REG_RAX);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, (int64_t)(size_t)site);
+		CODEBUF_EMIT64_P(&state->code, calln, state->hookStub);
+		CODEBUF_EMIT64_R(&state->code, pop, REG_RAX);
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, DBT_RED_ZONE));
+		return true;
+	}
+
+
+	// Increments the 8-bit coverage counter of a block without modifying the flags
+	static void EmitCoverageCounter(DbtState* state, uint64_t addr)
+	{
+		uint8_t* counter = &state->coverage[(size_t)(addr ^ (addr >> 16)) & state->coverageMask];
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[0]);
+		EmitAbsoluteMove(state, DBT_LOAD_AL, counter);
+		CODEBUF_EMIT64_RM(&state->code, lea_32, REG_EAX, X86_MEM(REG_RAX, 1));
+		EmitAbsoluteMove(state, DBT_STORE_AL, counter);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[0]);
+	}
+
+
+	// Pushes a 64-bit guest address without modifying the flags
+	static void EmitPushAddress(DbtState* state, uint64_t addr)
+	{
+		CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, -8));
+		CODEBUF_EMIT64_MI(&state->code, mov_32, X86_MEM(REG_RSP, 0), (int32_t)addr);
+		CODEBUF_EMIT64_MI(&state->code, mov_32, X86_MEM(REG_RSP, 4), (int32_t)(addr >> 32));
+	}
+
+
+	static bool IsLegacyPrefix(uint8_t byte)
+	{
+		switch (byte)
+		{
+		case 0x26: case 0x2e: case 0x36: case 0x3e: case 0x64: case 0x65:
+		case 0x66: case 0x67: case 0xf0: case 0xf2: case 0xf3:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+
+	static size_t GetPrefixLength(const uint8_t* opcode, size_t len)
+	{
+		size_t i = 0;
+		while ((i < len) && IsLegacyPrefix(opcode[i]))
+			i++;
+		return i;
+	}
+
+
+	// Copies an instruction with a RIP-relative operand.  If the target is out of range of the translated
+	// code, the operand is rewritten to use a free register holding the target.
+	static bool EmitRelocatedInstruction(DbtState* state, const uint8_t* opcode, const Instruction* instr,
+		int operand)
+	{
+		static const uint8_t scratchRegs[] = {8, 9, 10, 11, 14, 15};
+		uint8_t code[17];
+		uint64_t target = (uint64_t)instr->operands[operand].immediate;
+		uint64_t read, written;
+		int64_t diff;
+		int32_t disp;
+		size_t dispOffset = instr->ripRelOffset;
+		size_t prefixLen, len, i;
+		OperandType reg = NONE;
+
+		diff = (int64_t)(target - (uint64_t)(size_t)(GetCodeBufferExecPointer(&state->code) + instr->length));
+		if ((diff >= -0x80000000LL) && (diff <= 0x7fffffffLL))
+		{
+			disp = (int32_t)diff;
+			memcpy(code, opcode, instr->length);
+			memcpy(&code[dispOffset], &disp, 4);
+			EmitBytes(state, code, instr->length);
+			return true;
+		}
+
+		GetRegisterAccess(instr, &read, &written);
+		for (i = 0; i < sizeof(scratchRegs); i++)
+		{
+			if (!((read | written) & GetRegisterMask(DBT_GPR(scratchRegs[i]))))
+			{
+				reg = DBT_GPR(scratchRegs[i]);
+				break;
+			}
+		}
+		prefixLen = GetPrefixLength(opcode, instr->length);
+		if ((reg == NONE) || (prefixLen >= instr->length))
+			return false;
+		if ((opcode[prefixLen] == 0xc4) || (opcode[prefixLen] == 0xc5) || (opcode[prefixLen] == 0x62))
+			return false;
+
+		// Set REX.B, adding a REX prefix if there isn't one, and replace [rip+disp32] with [reg+disp32]
+		memcpy(code, opcode, prefixLen);
+		len = prefixLen;
+		if ((opcode[prefixLen] & 0xf0) == 0x40)
+			code[len++] = opcode[prefixLen] | 1;
+		else
+		{
+			code[len++] = 0x41;
+			dispOffset++;
+		}
+		i = ((opcode[prefixLen] & 0xf0) == 0x40) ? (prefixLen + 1) : prefixLen;
+		memcpy(&code[len], &opcode[i], instr->length - i);
+		len += instr->length - i;
+		code[dispOffset - 1] = 0x80 | (code[dispOffset - 1] & 0x38) | (uint8_t)((reg - REG_RAX) & 7);
+		memset(&code[dispOffset], 0, 4);
+
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[0]);
+		CODEBUF_EMIT64_RR(&state->code, mov_64, REG_RAX, reg);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[1]);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[0]);
+		CODEBUF_EMIT64_RI(&state->code, mov_64, reg, (int64_t)target);
+		EmitBytes(state, code, len);
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[0]);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[1]);
+		CODEBUF_EMIT64_RR(&state->code, mov_64, reg, REG_RAX);
+		EmitAbsoluteMove(state, DBT_LOAD_RAX, &state->scratch[0]);
+		return true;
+	}
+
+
+	// Loads the target of an indirect JMP or CALL into RAX, before RAX is modified
+	static bool EmitLoadBranchTarget(DbtState* state, const uint8_t* opcode, const Instruction* instr)
+	{
+		const InstructionOperand* operand = &instr->operands[0];
+		uint8_t code[16];
+		size_t prefixLen, len, i;
+		uint8_t rex = 0x48;
+
+		if (operand->operand != MEM)
+		{
+			if ((operand->operand < REG_RAX) || (operand->operand > REG_R15))
+				return false;
+			CODEBUF_EMIT64_RR(&state->code, mov_64, REG_RAX, operand->operand);
+			return true;
+		}
+		if (operand->relative)
+		{
+			CODEBUF_EMIT64_RI(&state->code, mov_64, REG_RAX, operand->immediate);
+			CODEBUF_EMIT64_RM(&state->code, mov_64, REG_RAX, X86_MEM(REG_RAX, 0));
+			return true;
+		}
+		if (operand->size != 8)
+			return false;
+
+		// Reuse the ModRM encoding of the branch for mov rax, [mem], keeping segment and address size prefixes
+		prefixLen = GetPrefixLength(opcode, instr->length);
+		len = 0;
+		for (i = 0; i < prefixLen; i++)
+		{
+			if ((opcode[i] != 0x66) && (opcode[i] != 0xf0) && (opcode[i] != 0xf2) && (opcode[i] != 0xf3))
+				code[len++] = opcode[i];
+		}
+		if ((prefixLen < instr->length) && ((opcode[prefixLen] & 0xf0) == 0x40))
+			rex |= opcode[prefixLen++] & 3;
+		if (((prefixLen + 2) > instr->length) || (opcode[prefixLen] != 0xff))
+			return false;
+		code[len++] = rex;
+		code[len++] = 0x8b;
+		code[len++] = opcode[prefixLen + 1] & 0xc7;
+		memcpy(&code[len], &opcode[prefixLen + 2], instr->length - (prefixLen + 2));
+		len += instr->length - (prefixLen + 2);
+		EmitBytes(state, code, len);
+		return true;
+	}
+
+
+	static bool EmitIndirectBranch(DbtState* state, const uint8_t* opcode, const Instruction* instr, bool call,
+		uint64_t next)
+	{
+		EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[0]);
+		if (!EmitLoadBranchTarget(state, opcode, instr))
+			return false;
+		if (call)
+			EmitPushAddress(state, next);
+		CODEBUF_EMIT64_P(&state->code, jmpn, state->indirectStub);
+		return true;
+	}
+
+
+	static bool EmitConditionalBranch(DbtState* state, uint8_t cond, uint64_t target, uint64_t next)
+	{
+		uint8_t code[6] = {0x0f, (uint8_t)(0x80 + cond), 0, 0, 0, 0};
+		uint8_t* patch = EmitBytes(state, code, 6) + 2;
+		size_t start = state->code.offset;
+		int32_t diff;
+
+		if (!EmitExit(state, next, DBT_CONTINUE, 0))
+			return false;
+		diff = (int32_t)(state->code.offset - start);
+		memcpy(patch, &diff, 4);
+		return EmitExit(state, target, DBT_CONTINUE, 0);
+	}
+
+
+	// LOOP and JCXZ only have 8-bit displacements, so they branch over a jump to the not taken exit
+	static bool EmitCountBranch(DbtState* state, const uint8_t* opcode, const Instruction* instr, uint64_t target,
+		uint64_t next)
+	{
+		uint8_t code[16];
+		uint8_t* patch;
+		size_t start;
+
+		memcpy(code, opcode, instr->length - 1);
+		code[instr->length - 1] = 2;
+		EmitBytes(state, code, instr->length);
+		code[0] = 0xeb;
+		code[1] = 0;
+		patch = EmitBytes(state, code, 2) + 1;
+		start = state->code.offset;
+
+		if (!EmitExit(state, target, DBT_CONTINUE, 0))
+			return false;
+		*patch = (uint8_t)(state->code.offset - start);
+		return EmitExit(state, next, DBT_CONTINUE, 0);
+	}
+
+
+	// Translates an instruction, returns false if it can't be translated.  Sets end when the instruction
+	// ends the block.
+	static bool TranslateInstruction(DbtState* state, const uint8_t* opcode, uint64_t addr, const Instruction* instr,
+		bool* end)
+	{
+		uint64_t next = addr + instr->length;
+		uint64_t target = (uint64_t)instr->operands[0].immediate;
+		int operand;
+
+		switch (instr->operation)
+		{
+		case JMP:
+			*end = true;
+			if (instr->operands[0].operand == IMM)
+				return EmitExit(state, target, DBT_CONTINUE, 0);
+			return EmitIndirectBranch(state, opcode, instr, false, next);
+
+		case CALL:
+			*end = true;
+			if (instr->operands[0].operand == IMM)
+			{
+				EmitPushAddress(state, next);
+				return EmitExit(state, target, DBT_CONTINUE, 0);
+			}
+			return EmitIndirectBranch(state, opcode, instr, true, next);
+
+		case RETN:
+			*end = true;
+			if (instr->flags & X86_FLAG_OPSIZE)
+				return false;
+			EmitAbsoluteMove(state, DBT_STORE_RAX, &state->scratch[0]);
+			CODEBUF_EMIT64_R(&state->code, pop, REG_RAX);
+			if (instr->operands[0].operand == IMM)
+				CODEBUF_EMIT64_RM(&state->code, lea_64, REG_RSP, X86_MEM(REG_RSP, (int32_t)target));
+			CODEBUF_EMIT64_P(&state->code, jmpn, state->indirectStub);
+			return true;
+
+		case JO: case JNO: case JB: case JAE: case JE: case JNE: case JBE: case JA:
+		case JS: case JNS: case JPE: case JPO: case JL: case JGE: case JLE: case JG:
+			*end = true;
+			return EmitConditionalBranch(state, (uint8_t)(instr->operation - JO), target, next);
+
+		case JCXZ: case JECXZ: case JRCXZ:
+		case LOOP: case LOOPE: case LOOPNE:
+			*end = true;
+			return EmitCountBranch(state, opcode, instr, target, next);
+
+		case INT3:
+			*end = true;
+			return EmitExit(state, next, DBT_BREAKPOINT, 0);
+
+		case INT:
+		case INT1:
+			*end = true;
+			return EmitExit(state, next, DBT_INTERRUPT, (instr->operation == INT1) ? 1 : (uint8_t)target);
+
+		case HLT:
+			*end = true;
+			return EmitExit(state, next, DBT_HALT, 0);
+
+		case UD2:
+			*end = true;
+			return EmitExit(state, addr, DBT_INVALID_INSTRUCTION, 0);
+
+		case CALLF: case JMPF: case RETF: case IRET:
+		case SYSRET: case SYSENTER: case SYSEXIT:
+			return false;
+
+		default:
+			if (IsPrivilegedInstruction(instr))
+				return false;
+			operand = GetRipRelativeOperand(instr);
+			if (operand >= 0)
+				return EmitRelocatedInstruction(state, opcode, instr, operand);
+			EmitBytes(state, opcode, instr->length);
+			return true;
+		}
+	}
+
+
+	static const uint8_t* TranslateBlock(DbtState* state, uint64_t addr)
+	{
+		const uint8_t* code = GetCodeBufferExecPointer(&state->code);
+		const uint8_t* opcode;
+		uint64_t start = addr;
+		Instruction instr;
+		MemAccess accesses[4];
+		size_t count = 0;
+		bool ok = true;
+		bool end = false;
+
+		if (state->coverage)
+			EmitCoverageCounter(state, addr);
+		if (state->blockHook)
+			ok = EmitHookSite(state, addr, DBT_SITE_BLOCK, NULL);
+
+		while (ok && !end)
+		{
+			if ((count >= DBT_MAX_BLOCK_INSTRUCTIONS) || ((count != 0) && (addr == state->exitAddress)))
+			{
+				ok = EmitExit(state, addr, DBT_CONTINUE, 0);
+				break;
+			}
+
+			opcode = (const uint8_t*)(size_t)addr;
+			if (!Disassemble64(opcode, addr, 15, &instr))
+			{
+				ok = EmitExit(state, addr, DBT_INVALID_INSTRUCTION, 0);
+				break;
+			}
+
+			if (state->instructionHook || (state->memoryHook && (GetMemoryAccesses(&instr, accesses) != 0)))
+			{
+				if (!EmitHookSite(state, addr, DBT_SITE_INSTRUCTION, &instr))
+					return NULL;
+			}
+
+			if (!TranslateInstruction(state, opcode, addr, &instr, &end))
+			{
+				// Leave the instruction to the caller
+				ok = EmitExit(state, addr, DBT_UNSUPPORTED_INSTRUCTION, 0);
+				break;
+			}
+
+			addr += instr.length;
+			count++;
+		}
+
+		if ((!ok) || state->code.failed)
+			return NULL;
+		AddBlock(state, start, code);
+		return code;
+	}
+
+
+	static void ResetIndirectTable(DbtState* state)
+	{
+		size_t i;
+		for (i = 0; i <= state->blockMask; i++)
+		{
+			state->indirectAddr[i] = DBT_NO_ADDRESS;
+			state->indirectCode[i] = NULL;
+		}
+	}
+
+
+	// The guest's x87, SSE and AVX registers are live in the host registers while translated code runs, and are
+	// saved while C code runs.  XSAVE is used when the OS has enabled it, as C code can modify the upper halves
+	// of the AVX registers.
+	static bool InitVectorState(DbtState* state)
+	{
+		unsigned int eax, ebx, ecx, edx;
+		uint16_t fcw = 0x37f;
+		uint32_t mxcsr = 0x1f80;
+
+		state->vectorStateSize = 512;
+		__cpuid(1, eax, ebx, ecx, edx);
+		state->xsave = (ecx & bit_OSXSAVE) != 0;
+		if (state->xsave)
+		{
+			__cpuid_count(0xd, 0, eax, ebx, ecx, edx);
+			state->vectorStateSize = ebx;
+		}
+
+		state->vectorState = (uint8_t*)mmap(NULL, state->vectorStateSize, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (state->vectorState == MAP_FAILED)
+		{
+			state->vectorState = NULL;
+			return false;
+		}
+
+		// Start with the default control words, the rest of the state is in its initial configuration
+		memcpy(&state->vectorState[0], &fcw, 2);
+		memcpy(&state->vectorState[24], &mxcsr, 4);
+		return true;
+	}
+
+
+	bool InitTranslator(DbtState* state, size_t blockCacheSize, size_t codeSize)
+	{
+		memset(state, 0, sizeof(DbtState));
+		if ((blockCacheSize < 2) || (blockCacheSize & (blockCacheSize - 1)) || (blockCacheSize > 0x80000000))
+			return false;
+		if (!InitCodeBuffer(&state->code, codeSize, 0))
+			return false;
+
+		if (!InitVectorState(state))
+		{
+			FreeCodeBuffer(&state->code);
+			return false;
+		}
+
+		state->blocks = (DbtBlock*)calloc(blockCacheSize, sizeof(DbtBlock));
+		state->indirectAddr = (uint64_t*)malloc(blockCacheSize * sizeof(uint64_t));
+		state->indirectCode = (const uint8_t**)malloc(blockCacheSize * sizeof(const uint8_t*));
+		state->blockMask = blockCacheSize - 1;
+		if ((!state->code.dualMapped) || (!state->blocks) || (!state->indirectAddr) || (!state->indirectCode))
+		{
+			FreeTranslator(state);
+			return false;
+		}
+		ResetIndirectTable(state);
+
+		state->rflags = 0x202;
+		state->exitAddress = DBT_NO_ADDRESS;
+		state->chaining = true;
+		syscall(SYS_arch_prctl, ARCH_GET_FS, &state->regs[X86_REGFILE_SEGMENT_BASE(SEG_FS)]);
+		syscall(SYS_arch_prctl, ARCH_GET_GS, &state->regs[X86_REGFILE_SEGMENT_BASE(SEG_GS)]);
+
+		if (!EmitStubs(state))
+		{
+			FreeTranslator(state);
+			return false;
+		}
+		state->codeStart = state->code.offset;
+		return true;
+	}
+
+
+	void FreeTranslator(DbtState* state)
+	{
+		FreeRecords(state);
+		free(state->blocks);
+		free(state->indirectAddr);
+		free((void*)state->indirectCode);
+		if (state->vectorState)
+			munmap(state->vectorState, state->vectorStateSize);
+		FreeCodeBuffer(&state->code);
+		state->blocks = NULL;
+		state->indirectAddr = NULL;
+		state->indirectCode = NULL;
+		state->vectorState = NULL;
+	}
+
+
+	void FlushTranslator(DbtState* state)
+	{
+		memset(state->blocks, 0, (state->blockMask + 1) * sizeof(DbtBlock));
+		state->blockCount = 0;
+		ResetIndirectTable(state);
+		FreeRecords(state);
+		state->code.offset = state->codeStart;
+		state->code.failed = false;
+		state->lastExit = NULL;
+		state->lastSite = NULL;
+	}
+
+
+	DbtResult RunTranslator(DbtState* state)
+	{
+		const uint8_t* code;
+		DbtExit* exitInfo;
+
+		for (;;)
+		{
+			if (state->rip == state->exitAddress)
+			{
+				state->lastExit = NULL;
+				return DBT_EXIT;
+			}
+
+			code = LookupBlock(state, state->rip);
+			if (!code)
+			{
+				if ((state->blockCount * 2) > state->blockMask)
+					FlushTranslator(state);
+				code = TranslateBlock(state, state->rip);
+				if (!code)
+				{
+					// Out of code space, start over with an empty cache
+					FlushTranslator(state);
+					code = TranslateBlock(state, state->rip);
+					if (!code)
+						return DBT_OUT_OF_MEMORY;
+				}
+			}
+
+			// Link the exit that was taken to the block, or remember the target of an indirect branch
+			exitInfo = (DbtExit*)state->lastExit;
+			if (exitInfo)
+			{
+				if (state->chaining && exitInfo->patch)
+					ChainExit(state, exitInfo, code);
+			}
+			else
+				AddIndirectTarget(state, state->rip, code);
+
+			state->lastExit = NULL;
+			state->enter(state, code);
+
+			if (state->stopped)
+			{
+				state->stopped = false;
+				return DBT_STOPPED;
+			}
+			exitInfo = (DbtExit*)state->lastExit;
+			if (exitInfo && (exitInfo->result != DBT_CONTINUE))
+			{
+				state->interrupt = exitInfo->interrupt;
+				state->lastExit = NULL;
+				return (DbtResult)exitInfo->result;
+			}
+		}
+	}
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef __DBTX86_H__
+#define __DBTX86_H__
+
+#include "codebuf.h"
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	enum DbtResult
+	{
+		DBT_EXIT = 0, // Control reached exitAddress
+		DBT_STOPPED, // A hook returned false
+		DBT_INVALID_INSTRUCTION,
+		DBT_UNSUPPORTED_INSTRUCTION, // Far transfers and privileged instructions
+		DBT_BREAKPOINT,
+		DBT_INTERRUPT, // See interrupt
+		DBT_HALT,
+		DBT_OUT_OF_MEMORY
+	};
+#ifndef __cplusplus
+	typedef enum DbtResult DbtResult;
+#endif
+
+
+	struct DbtState;
+
+	// Hooks are called before the block or instruction executes and can modify the registers, except for
+	// rsp and rip.  Returning false stops execution with rip at the block or instruction.
+	typedef bool (*DbtBlockHook)(struct DbtState* state, uint64_t addr, void* context);
+	typedef bool (*DbtInstructionHook)(struct DbtState* state, const Instruction* instr, void* context);
+	typedef bool (*DbtMemoryHook)(struct DbtState* state, const Instruction* instr, uint64_t addr, uint16_t size,
+		uint8_t access, void* context);
+
+
+	struct DbtBlock
+	{
+		uint64_t addr;
+		const uint8_t* code;
+	};
+#ifndef __cplusplus
+	typedef struct DbtBlock DbtBlock;
+#endif
+
+
+	// Translator for 64-bit user mode code running in the same process, on a Linux x86-64 host.  Guest code
+	// is translated one basic block at a time into a code buffer and runs with the guest registers in the
+	// host registers, on the guest stack.  The registers and segment bases use the X86_REGFILE_* layout,
+	// so memory operands can be resolved with ComputeEffectiveAddress.  The state must not be moved after
+	// InitTranslator, as its address is part of the translated code.
+	struct DbtState
+	{
+		uint64_t regs[X86_REGFILE_SIZE];
+		uint64_t rip;
+		uint64_t rflags;
+
+		// Execution stops when control reaches this address, normally the return address of the guest
+		// function being called
+		uint64_t exitAddress;
+
+		// Instrumentation.  These are part of the translated code, so call FlushTranslator after changing them.
+		DbtBlockHook blockHook;
+		DbtInstructionHook instructionHook;
+		DbtMemoryHook memoryHook;
+		void* hookContext;
+		uint8_t* coverage; // Incremented on entry to each block, indexed by block address
+		size_t coverageMask;
+		bool chaining; // Link the exits of blocks directly to their targets
+
+		uint8_t interrupt;
+		uint64_t translatedBlocks;
+
+		// Internal state
+		CodeBuffer code;
+		size_t codeStart;
+		DbtBlock* blocks;
+		size_t blockMask;
+		size_t blockCount;
+		uint64_t* indirectAddr;
+		const uint8_t** indirectCode;
+		struct DbtRecordChunk* records;
+		void (*enter)(struct DbtState* state, const uint8_t* code);
+		const uint8_t* exitStub;
+		const uint8_t* saveStub;
+		const uint8_t* indirectStub;
+		const uint8_t* indirectExitStub;
+		const uint8_t* hookStub;
+		uint8_t* vectorState;
+		size_t vectorStateSize;
+		bool xsave;
+		uint64_t hostStack;
+		uint64_t hookStack;
+		uint64_t scratch[2];
+		void* lastExit;
+		void* lastSite;
+		bool stopped;
+	};
+#ifndef __cplusplus
+	typedef struct DbtState DbtState;
+#endif
+
+
+#ifdef __cplusplus
+	extern "C"
+	{
+#endif
+		// The block cache size must be a power of two, pass zero for codeSize to use the code buffer default
+		bool InitTranslator(DbtState* state, size_t blockCacheSize, size_t codeSize);
+		void FreeTranslator(DbtState* state);
+		void FlushTranslator(DbtState* state);
+
+		DbtResult RunTranslator(DbtState* state);
+#ifdef __cplusplus
+	}
+}
+#endif
+
+#endif
@@ -0,0 +1,1676 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <stddef.h>
+#include <string.h>
+#include "emux86.h"
+
+
+// Kinds of lazily evaluated flag state
+#define EMU_FLAGS_NONE		0 // Flags are in rflags
+#define EMU_FLAGS_ADD		1 // flagCarry is the carry in
+#define EMU_FLAGS_SUB		2 // flagCarry is the borrow in
+#define EMU_FLAGS_INC		3 // flagCarry is the preserved CF
+#define EMU_FLAGS_DEC		4 // flagCarry is the preserved CF
+#define EMU_FLAGS_RESULT	5 // flagCarry and flagOverflow are CF and OF, AF is clear
+
+// Flags that can be changed by POPF in user mode
+#define EMU_POPF_MASK		(X86_EFLAG_STATUS | X86_EFLAG_TF | X86_EFLAG_DF | X86_EFLAG_AC | 0x200000)
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	static uint64_t SizeMask(uint16_t size)
+	{
+		if (size >= 8)
+			return ~(uint64_t)0;
+		return ((uint64_t)1 << (size * 8)) - 1;
+	}
+
+
+	static uint64_t SignBit(uint16_t size)
+	{
+		return (uint64_t)1 << ((size * 8) - 1);
+	}
+
+
+	static uint64_t SignExtend(uint64_t value, uint16_t size)
+	{
+		uint64_t sign;
+		if (size >= 8)
+			return value;
+		sign = SignBit(size);
+		value &= SizeMask(size);
+		return (value ^ sign) - sign;
+	}
+
+
+	static bool GetParity(uint64_t value)
+	{
+		value &= 0xff;
+		value ^= value >> 4;
+		return ((0x6996 >> (value & 0xf)) & 1) == 0;
+	}
+
+
+	static OperandType GetSizedRegister(uint16_t size, OperandType reg8, OperandType reg16, OperandType reg32,
+		OperandType reg64)
+	{
+		if (size == 8)
+			return reg64;
+		if (size == 4)
+			return reg32;
+		if (size == 2)
+			return reg16;
+		return reg8;
+	}
+
+
+	static void SetFlags(EmuState* state, uint8_t op, uint16_t size, uint64_t dest, uint64_t source,
+		uint64_t result, bool carry, bool overflow)
+	{
+		state->flagOp = op;
+		state->flagSize = (uint8_t)size;
+		state->flagDest = dest;
+		state->flagSource = source;
+		state->flagResult = result;
+		state->flagCarry = carry ? 1 : 0;
+		state->flagOverflow = overflow ? 1 : 0;
+	}
+
+
+	static bool GetCarryFlag(const EmuState* state)
+	{
+		uint64_t mask = SizeMask(state->flagSize);
+		uint64_t dest = state->flagDest & mask;
+		switch (state->flagOp)
+		{
+		case EMU_FLAGS_ADD:
+			return ((state->flagResult & mask) < dest) ||
+				(state->flagCarry && ((state->flagResult & mask) == dest));
+		case EMU_FLAGS_SUB:
+			return (dest < (state->flagSource & mask)) ||
+				(state->flagCarry && (dest == (state->flagSource & mask)));
+		case EMU_FLAGS_INC:
+		case EMU_FLAGS_DEC:
+		case EMU_FLAGS_RESULT:
+			return state->flagCarry != 0;
+		default:
+			return (state->rflags & X86_EFLAG_CF) != 0;
+		}
+	}
+
+
+	static bool GetZeroFlag(const EmuState* state)
+	{
+		if (state->flagOp == EMU_FLAGS_NONE)
+			return (state->rflags & X86_EFLAG_ZF) != 0;
+		return (state->flagResult & SizeMask(state->flagSize)) == 0;
+	}
+
+
+	static bool GetSignFlag(const EmuState* state)
+	{
+		if (state->flagOp == EMU_FLAGS_NONE)
+			return (state->rflags & X86_EFLAG_SF) != 0;
+		return (state->flagResult & SignBit(state->flagSize)) != 0;
+	}
+
+
+	static bool GetOverflowFlag(const EmuState* state)
+	{
+		uint64_t sign = SignBit(state->flagSize);
+		switch (state->flagOp)
+		{
+		case EMU_FLAGS_ADD:
+		case EMU_FLAGS_INC:
+			return ((state->flagDest ^ state->flagResult) & (state->flagSource ^ state->flagResult) & sign) != 0;
+		case EMU_FLAGS_SUB:
+		case EMU_FLAGS_DEC:
+			return ((state->flagDest ^ state->flagSource) & (state->flagDest ^ state->flagResult) & sign) != 0;
+		case EMU_FLAGS_RESULT:
+			return state->flagOverflow != 0;
+		default:
+			return (state->rflags & X86_EFLAG_OF) != 0;
+		}
+	}
+
+
+	static bool GetParityFlag(const EmuState* state)
+	{
+		if (state->flagOp == EMU_FLAGS_NONE)
+			return (state->rflags & X86_EFLAG_PF) != 0;
+		return GetParity(state->flagResult);
+	}
+
+
+	static bool GetAuxCarryFlag(const EmuState* state)
+	{
+		switch (state->flagOp)
+		{
+		case EMU_FLAGS_NONE:
+			return (state->rflags & X86_EFLAG_AF) != 0;
+		case EMU_FLAGS_RESULT:
+			return false;
+		default:
+			return ((state->flagDest ^ state->flagSource ^ state->flagResult) & 0x10) != 0;
+		}
+	}
+
+
+	static void MaterializeFlags(EmuState* state)
+	{
+		uint64_t flags;
+		if (state->flagOp == EMU_FLAGS_NONE)
+			return;
+
+		flags = state->rflags & ~(uint64_t)X86_EFLAG_STATUS;
+		if (GetCarryFlag(state))
+			flags |= X86_EFLAG_CF;
+		if (GetParityFlag(state))
+			flags |= X86_EFLAG_PF;
+		if (GetAuxCarryFlag(state))
+			flags |= X86_EFLAG_AF;
+		if (GetZeroFlag(state))
+			flags |= X86_EFLAG_ZF;
+		if (GetSignFlag(state))
+			flags |= X86_EFLAG_SF;
+		if (GetOverflowFlag(state))
+			flags |= X86_EFLAG_OF;
+		state->rflags = flags;
+		state->flagOp = EMU_FLAGS_NONE;
+	}
+
+
+	static void SetFlagBit(EmuState* state, uint64_t flag, bool value)
+	{
+		MaterializeFlags(state);
+		if (value)
+			state->rflags |= flag;
+		else
+			state->rflags &= ~flag;
+	}
+
+
+	// Condition codes are in the order of the Jcc, SETcc and CMOVcc operations
+	static bool EvaluateCondition(const EmuState* state, uint8_t cond)
+	{
+		bool result;
+		switch (cond >> 1)
+		{
+		case 0:
+			result = GetOverflowFlag(state);
+			break;
+		case 1:
+			result = GetCarryFlag(state);
+			break;
+		case 2:
+			result = GetZeroFlag(state);
+			break;
+		case 3:
+			result = GetCarryFlag(state) || GetZeroFlag(state);
+			break;
+		case 4:
+			result = GetSignFlag(state);
+			break;
+		case 5:
+			result = GetParityFlag(state);
+			break;
+		case 6:
+			result = GetSignFlag(state) != GetOverflowFlag(state);
+			break;
+		default:
+			result = GetZeroFlag(state) || (GetSignFlag(state) != GetOverflowFlag(state));
+			break;
+		}
+		return (cond & 1) ? !result : result;
+	}
+
+
+	static bool IsGeneralRegister(OperandType reg)
+	{
+		uint16_t base = asmx86RegisterInfo[reg].base;
+		return (base >= REG_RAX) && (base <= REG_R15);
+	}
+
+
+	static uint64_t ReadRegister(const EmuState* state, OperandType reg)
+	{
+		const RegisterInfo* info = &asmx86RegisterInfo[reg];
+		uint64_t value = state->regs[X86_REGFILE_GPR(info->base - REG_RAX)] >> (info->offset * 8);
+		return value & SizeMask(info->width);
+	}
+
+
+	static void WriteRegister(EmuState* state, OperandType reg, uint64_t value)
+	{
+		const RegisterInfo* info = &asmx86RegisterInfo[reg];
+		uint64_t* dest = &state->regs[X86_REGFILE_GPR(info->base - REG_RAX)];
+		uint64_t mask;
+
+		// 32-bit writes clear the upper half of the register, smaller writes merge into it
+		if (info->width >= 4)
+		{
+			*dest = value & SizeMask(info->width);
+			return;
+		}
+		mask = SizeMask(info->width) << (info->offset * 8);
+		*dest = (*dest & ~mask) | ((value << (info->offset * 8)) & mask);
+	}
+
+
+	static uint64_t TruncateAddress(const EmuState* state, uint64_t addr)
+	{
+		if (state->mode == 64)
+			return addr;
+		return addr & 0xffffffff;
+	}
+
+
+	static EmuResult ReadMemory(EmuState* state, uint64_t addr, uint16_t size, uint64_t* value)
+	{
+		uint8_t data[8];
+		uint16_t i;
+
+		if (!state->memory.read(state->memory.context, addr, data, size))
+		{
+			state->faultAddress = addr;
+			return EMU_MEMORY_FAULT;
+		}
+
+		*value = 0;
+		for (i = 0; i < size; i++)
+			*value |= (uint64_t)data[i] << (i * 8);
+		return EMU_OK;
+	}
+
+
+	static EmuResult WriteMemory(EmuState* state, uint64_t addr, uint16_t size, uint64_t value)
+	{
+		uint8_t data[8];
+		uint16_t i;
+
+		for (i = 0; i < size; i++)
+			data[i] = (uint8_t)(value >> (i * 8));
+		if (!state->memory.write(state->memory.context, addr, data, size))
+		{
+			state->faultAddress = addr;
+			return EMU_MEMORY_FAULT;
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ReadOperand(EmuState* state, const InstructionOperand* operand, uint64_t* value)
+	{
+		switch (operand->operand)
+		{
+		case NONE:
+			return EMU_UNSUPPORTED_INSTRUCTION;
+		case IMM:
+			*value = (uint64_t)operand->immediate & SizeMask(operand->size);
+			return EMU_OK;
+		case MEM:
+			if (operand->size > 8)
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			return ReadMemory(state, TruncateAddress(state, ComputeEffectiveAddress(operand, state->regs)),
+				operand->size, value);
+		default:
+			if (!IsGeneralRegister(operand->operand))
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			*value = ReadRegister(state, operand->operand);
+			return EMU_OK;
+		}
+	}
+
+
+	static EmuResult WriteOperand(EmuState* state, const InstructionOperand* operand, uint64_t value)
+	{
+		switch (operand->operand)
+		{
+		case NONE:
+		case IMM:
+			return EMU_UNSUPPORTED_INSTRUCTION;
+		case MEM:
+			if (operand->size > 8)
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			return WriteMemory(state, TruncateAddress(state, ComputeEffectiveAddress(operand, state->regs)),
+				operand->size, value);
+		default:
+			if (!IsGeneralRegister(operand->operand))
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			WriteRegister(state, operand->operand, value);
+			return EMU_OK;
+		}
+	}
+
+
+	static uint64_t GetStackPointer(const EmuState* state)
+	{
+		return TruncateAddress(state, state->regs[X86_REGFILE_GPR(4)]);
+	}
+
+
+	static void SetStackPointer(EmuState* state, uint64_t value)
+	{
+		state->regs[X86_REGFILE_GPR(4)] = TruncateAddress(state, value);
+	}
+
+
+	static uint64_t GetStackAddress(const EmuState* state, uint64_t sp)
+	{
+		return TruncateAddress(state, sp + state->regs[X86_REGFILE_SEGMENT_BASE(SEG_SS)]);
+	}
+
+
+	static EmuResult Push(EmuState* state, uint64_t value, uint16_t size)
+	{
+		uint64_t sp = TruncateAddress(state, GetStackPointer(state) - size);
+		EmuResult result = WriteMemory(state, GetStackAddress(state, sp), size, value);
+		if (result != EMU_OK)
+			return result;
+		SetStackPointer(state, sp);
+		return EMU_OK;
+	}
+
+
+	static EmuResult Pop(EmuState* state, uint64_t* value, uint16_t size)
+	{
+		uint64_t sp = GetStackPointer(state);
+		EmuResult result = ReadMemory(state, GetStackAddress(state, sp), size, value);
+		if (result != EMU_OK)
+			return result;
+		SetStackPointer(state, sp + size);
+		return EMU_OK;
+	}
+
+
+	static uint16_t GetStackOperandSize(const EmuState* state, const Instruction* instr)
+	{
+		if (instr->flags & X86_FLAG_OPSIZE)
+			return 2;
+		return state->mode / 8;
+	}
+
+
+	// Counter register of string operations, LOOP and JCXZ, which is sized by the address size
+	static OperandType GetCountRegister(const EmuState* state, const Instruction* instr)
+	{
+		if (state->mode == 64)
+			return (instr->flags & X86_FLAG_ADDRSIZE) ? REG_ECX : REG_RCX;
+		return (instr->flags & X86_FLAG_ADDRSIZE) ? REG_CX : REG_ECX;
+	}
+
+
+	static void SetInstructionPointer(EmuState* state, uint64_t value)
+	{
+		state->rip = TruncateAddress(state, value);
+	}
+
+
+	static uint64_t MultiplyUnsigned64(uint64_t a, uint64_t b, uint64_t* high)
+	{
+		uint64_t lowLow = (a & 0xffffffff) * (b & 0xffffffff);
+		uint64_t lowHigh = (a & 0xffffffff) * (b >> 32);
+		uint64_t highLow = (a >> 32) * (b & 0xffffffff);
+		uint64_t highHigh = (a >> 32) * (b >> 32);
+		uint64_t middle = (lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff);
+		*high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+		return (middle << 32) | (lowLow & 0xffffffff);
+	}
+
+
+	static uint64_t MultiplySigned64(uint64_t a, uint64_t b, uint64_t* high)
+	{
+		uint64_t low = MultiplyUnsigned64(a, b, high);
+		if (a & SignBit(8))
+			*high -= b;
+		if (b & SignBit(8))
+			*high -= a;
+		return low;
+	}
+
+
+	// Divides high:low by the divisor, fails if the quotient does not fit in 64 bits
+	static bool DivideUnsigned128(uint64_t high, uint64_t low, uint64_t divisor, uint64_t* quotient,
+		uint64_t* remainder)
+	{
+		uint64_t result = 0;
+		uint64_t top;
+		int i;
+
+		if ((divisor == 0) || (high >= divisor))
+			return false;
+
+		for (i = 0; i < 64; i++)
+		{
+			top = high >> 63;
+			high = (high << 1) | (low >> 63);
+			low <<= 1;
+			result <<= 1;
+			if (top || (high >= divisor))
+			{
+				high -= divisor;
+				result |= 1;
+			}
+		}
+
+		*quotient = result;
+		*remainder = high;
+		return true;
+	}
+
+
+	static EmuResult ExecuteArithmetic(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t a, b, result;
+		bool carry = false;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &a);
+		if (status != EMU_OK)
+			return status;
+		status = ReadOperand(state, &instr->operands[1], &b);
+		if (status != EMU_OK)
+			return status;
+		b &= SizeMask(size);
+
+		switch (instr->operation)
+		{
+		case ADC:
+			carry = GetCarryFlag(state);
+			result = a + b + (carry ? 1 : 0);
+			break;
+		case ADD:
+			result = a + b;
+			break;
+		case SBB:
+			carry = GetCarryFlag(state);
+			result = a - b - (carry ? 1 : 0);
+			break;
+		case SUB:
+		case CMP:
+			result = a - b;
+			break;
+		case AND:
+		case TEST:
+			result = a & b;
+			break;
+		case OR:
+			result = a | b;
+			break;
+		default:
+			result = a ^ b;
+			break;
+		}
+		result &= SizeMask(size);
+
+		if ((instr->operation != CMP) && (instr->operation != TEST))
+		{
+			status = WriteOperand(state, &instr->operands[0], result);
+			if (status != EMU_OK)
+				return status;
+		}
+
+		switch (instr->operation)
+		{
+		case ADD:
+		case ADC:
+			SetFlags(state, EMU_FLAGS_ADD, size, a, b, result, carry, false);
+			break;
+		case SUB:
+		case SBB:
+		case CMP:
+			SetFlags(state, EMU_FLAGS_SUB, size, a, b, result, carry, false);
+			break;
+		default:
+			SetFlags(state, EMU_FLAGS_RESULT, size, a, b, result, false, false);
+			break;
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteUnary(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t a, result;
+		bool carry;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &a);
+		if (status != EMU_OK)
+			return status;
+
+		switch (instr->operation)
+		{
+		case INC:
+			result = a + 1;
+			break;
+		case DEC:
+			result = a - 1;
+			break;
+		case NEG:
+			result = 0 - a;
+			break;
+		default:
+			result = ~a;
+			break;
+		}
+		result &= SizeMask(size);
+
+		status = WriteOperand(state, &instr->operands[0], result);
+		if (status != EMU_OK)
+			return status;
+
+		switch (instr->operation)
+		{
+		case INC:
+			carry = GetCarryFlag(state);
+			SetFlags(state, EMU_FLAGS_INC, size, a, 1, result, carry, false);
+			break;
+		case DEC:
+			carry = GetCarryFlag(state);
+			SetFlags(state, EMU_FLAGS_DEC, size, a, 1, result, carry, false);
+			break;
+		case NEG:
+			SetFlags(state, EMU_FLAGS_SUB, size, 0, a, result, false, false);
+			break;
+		default:
+			break;
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteShift(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint16_t bits = size * 8;
+		uint64_t mask = SizeMask(size);
+		uint64_t sign = SignBit(size);
+		uint64_t a, count, result;
+		bool carry = false, overflow = false;
+		uint64_t i, rotate;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &a);
+		if (status != EMU_OK)
+			return status;
+		status = ReadOperand(state, &instr->operands[1], &count);
+		if (status != EMU_OK)
+			return status;
+
+		// A count of zero leaves the flags unchanged, but the destination is still written
+		count &= (size == 8) ? 0x3f : 0x1f;
+		if (count == 0)
+			return WriteOperand(state, &instr->operands[0], a);
+
+		switch (instr->operation)
+		{
+		case SHL:
+			result = (a << count) & mask;
+			carry = (count <= bits) && (((a >> (bits - count)) & 1) != 0);
+			overflow = ((result & sign) != 0) != carry;
+			break;
+		case SHR:
+			result = a >> count;
+			carry = (count <= bits) && (((a >> (count - 1)) & 1) != 0);
+			overflow = (a & sign) != 0;
+			break;
+		case SAR:
+			result = (uint64_t)((int64_t)SignExtend(a, size) >> count) & mask;
+			carry = (((int64_t)SignExtend(a, size) >> (count - 1)) & 1) != 0;
+			break;
+		case ROL:
+		case ROR:
+			rotate = count % bits;
+			result = a;
+			if (rotate != 0)
+			{
+				if (instr->operation == ROL)
+					result = ((a << rotate) | (a >> (bits - rotate))) & mask;
+				else
+					result = ((a >> rotate) | (a << (bits - rotate))) & mask;
+			}
+			if (instr->operation == ROL)
+			{
+				carry = (result & 1) != 0;
+				overflow = ((result & sign) != 0) != carry;
+			}
+			else
+			{
+				carry = (result & sign) != 0;
+				overflow = carry != (((result << 1) & sign) != 0);
+			}
+			break;
+		default:
+			// RCL and RCR rotate through the carry flag, one bit at a time
+			carry = GetCarryFlag(state);
+			result = a;
+			if (instr->operation == RCL)
+			{
+				for (i = 0; i < (count % (bits + 1)); i++)
+				{
+					bool out = (result & sign) != 0;
+					result = ((result << 1) | (carry ? 1 : 0)) & mask;
+					carry = out;
+				}
+				overflow = ((result & sign) != 0) != carry;
+			}
+			else
+			{
+				overflow = ((a & sign) != 0) != carry;
+				for (i = 0; i < (count % (bits + 1)); i++)
+				{
+					bool out = (result & 1) != 0;
+					result = (result >> 1) | (carry ? sign : 0);
+					carry = out;
+				}
+			}
+			break;
+		}
+
+		status = WriteOperand(state, &instr->operands[0], result);
+		if (status != EMU_OK)
+			return status;
+
+		// Rotates only change CF and OF
+		if ((instr->operation == SHL) || (instr->operation == SHR) || (instr->operation == SAR))
+		{
+			SetFlags(state, EMU_FLAGS_RESULT, size, a, count, result, carry, overflow);
+		}
+		else
+		{
+			SetFlagBit(state, X86_EFLAG_CF, carry);
+			SetFlagBit(state, X86_EFLAG_OF, overflow);
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteDoubleShift(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint16_t bits = size * 8;
+		uint64_t mask = SizeMask(size);
+		uint64_t a, b, count, value, result;
+		bool carry;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &a);
+		if (status != EMU_OK)
+			return status;
+		status = ReadOperand(state, &instr->operands[1], &b);
+		if (status != EMU_OK)
+			return status;
+		status = ReadOperand(state, &instr->operands[2], &count);
+		if (status != EMU_OK)
+			return status;
+
+		count &= (size == 8) ? 0x3f : 0x1f;
+		if (count == 0)
+			return WriteOperand(state, &instr->operands[0], a);
+
+		if (size == 8)
+		{
+			if (instr->operation == SHLD)
+			{
+				result = (a << count) | (b >> (64 - count));
+				carry = ((a >> (64 - count)) & 1) != 0;
+			}
+			else
+			{
+				result = (a >> count) | (b << (64 - count));
+				carry = ((a >> (count - 1)) & 1) != 0;
+			}
+		}
+		else if (instr->operation == SHLD)
+		{
+			value = (a << bits) | b;
+			if (count <= bits)
+				result = (value >> (bits - count)) & mask;
+			else
+				result = (value << (count - bits)) & mask;
+			carry = ((value >> ((bits * 2) - count)) & 1) != 0;
+		}
+		else
+		{
+			value = (b << bits) | a;
+			result = (value >> count) & mask;
+			carry = ((value >> (count - 1)) & 1) != 0;
+		}
+
+		status = WriteOperand(state, &instr->operands[0], result);
+		if (status != EMU_OK)
+			return status;
+		SetFlags(state, EMU_FLAGS_RESULT, size, a, count, result, carry, ((a ^ result) & SignBit(size)) != 0);
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteMultiply(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t mask = SizeMask(size);
+		uint64_t a, b, low, high;
+		bool overflow;
+		EmuResult status;
+
+		if ((instr->operation == IMUL) && (instr->operands[1].operand != NONE))
+		{
+			// Two and three operand forms only keep the low half of the product
+			if (instr->operands[2].operand != NONE)
+			{
+				status = ReadOperand(state, &instr->operands[1], &a);
+				if (status != EMU_OK)
+					return status;
+				status = ReadOperand(state, &instr->operands[2], &b);
+			}
+			else
+			{
+				status = ReadOperand(state, &instr->operands[0], &a);
+				if (status != EMU_OK)
+					return status;
+				status = ReadOperand(state, &instr->operands[1], &b);
+			}
+			if (status != EMU_OK)
+				return status;
+
+			if (size == 8)
+			{
+				low = MultiplySigned64(a, b, &high);
+				overflow = high != ((low & SignBit(8)) ? ~(uint64_t)0 : 0);
+			}
+			else
+			{
+				high = (uint64_t)((int64_t)SignExtend(a, size) * (int64_t)SignExtend(b & mask, size));
+				low = high & mask;
+				overflow = SignExtend(low, size) != high;
+			}
+
+			status = WriteOperand(state, &instr->operands[0], low);
+			if (status != EMU_OK)
+				return status;
+			SetFlags(state, EMU_FLAGS_RESULT, size, a, b, low, overflow, overflow);
+			return EMU_OK;
+		}
+
+		status = ReadOperand(state, &instr->operands[0], &b);
+		if (status != EMU_OK)
+			return status;
+		a = ReadRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX));
+
+		if (size == 8)
+		{
+			if (instr->operation == MUL)
+			{
+				low = MultiplyUnsigned64(a, b, &high);
+				overflow = high != 0;
+			}
+			else
+			{
+				low = MultiplySigned64(a, b, &high);
+				overflow = high != ((low & SignBit(8)) ? ~(uint64_t)0 : 0);
+			}
+		}
+		else
+		{
+			if (instr->operation == MUL)
+			{
+				low = a * b;
+				overflow = (low >> (size * 8)) != 0;
+			}
+			else
+			{
+				low = (uint64_t)((int64_t)SignExtend(a, size) * (int64_t)SignExtend(b, size));
+				overflow = SignExtend(low & mask, size) != low;
+			}
+			high = low >> (size * 8);
+			low &= mask;
+		}
+
+		if (size == 1)
+		{
+			WriteRegister(state, REG_AX, (low | (high << 8)) & 0xffff);
+		}
+		else
+		{
+			WriteRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX), low);
+			WriteRegister(state, GetSizedRegister(size, REG_DL, REG_DX, REG_EDX, REG_RDX), high & mask);
+		}
+		SetFlags(state, EMU_FLAGS_RESULT, size, a, b, low, overflow, overflow);
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteDivide(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t mask = SizeMask(size);
+		uint64_t divisor, low, high, quotient, remainder;
+		bool negative;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &divisor);
+		if (status != EMU_OK)
+			return status;
+		if (divisor == 0)
+			return EMU_DIVIDE_ERROR;
+
+		if (size == 1)
+		{
+			low = ReadRegister(state, REG_AX);
+			high = 0;
+		}
+		else
+		{
+			low = ReadRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX));
+			high = ReadRegister(state, GetSizedRegister(size, REG_DL, REG_DX, REG_EDX, REG_RDX));
+		}
+
+		if (size == 8)
+		{
+			if (instr->operation == DIV)
+			{
+				if (!DivideUnsigned128(high, low, divisor, &quotient, &remainder))
+					return EMU_DIVIDE_ERROR;
+			}
+			else
+			{
+				// Divide the magnitudes, then check that the signed quotient is in range
+				bool dividendNegative = (high & SignBit(8)) != 0;
+				bool divisorNegative = (divisor & SignBit(8)) != 0;
+				if (dividendNegative)
+				{
+					low = ~low + 1;
+					high = ~high + ((low == 0) ? 1 : 0);
+				}
+				if (divisorNegative)
+					divisor = 0 - divisor;
+				if (!DivideUnsigned128(high, low, divisor, &quotient, &remainder))
+					return EMU_DIVIDE_ERROR;
+				negative = dividendNegative != divisorNegative;
+				if (quotient > (negative ? SignBit(8) : (SignBit(8) - 1)))
+					return EMU_DIVIDE_ERROR;
+				if (negative)
+					quotient = 0 - quotient;
+				if (dividendNegative)
+					remainder = 0 - remainder;
+			}
+		}
+		else
+		{
+			uint64_t dividend = (size == 1) ? low : ((high << (size * 8)) | low);
+			if (instr->operation == DIV)
+			{
+				quotient = dividend / divisor;
+				remainder = dividend % divisor;
+				if (quotient > mask)
+					return EMU_DIVIDE_ERROR;
+			}
+			else
+			{
+				int64_t signedDividend = (int64_t)SignExtend(dividend, size * 2);
+				int64_t signedDivisor = (int64_t)SignExtend(divisor, size);
+				int64_t signedQuotient;
+				if ((signedDivisor == -1) && (signedDividend == (int64_t)SignBit(8)))
+					return EMU_DIVIDE_ERROR;
+				signedQuotient = signedDividend / signedDivisor;
+				if ((signedQuotient < -(int64_t)SignBit(size)) || (signedQuotient > (int64_t)(SignBit(size) - 1)))
+					return EMU_DIVIDE_ERROR;
+				quotient = (uint64_t)signedQuotient & mask;
+				remainder = (uint64_t)(signedDividend % signedDivisor) & mask;
+			}
+		}
+
+		if (size == 1)
+		{
+			WriteRegister(state, REG_AX, (quotient & 0xff) | ((remainder & 0xff) << 8));
+		}
+		else
+		{
+			WriteRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX), quotient & mask);
+			WriteRegister(state, GetSizedRegister(size, REG_DL, REG_DX, REG_EDX, REG_RDX), remainder & mask);
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteBitTest(EmuState* state, const Instruction* instr)
+	{
+		InstructionOperand operand = instr->operands[0];
+		uint16_t size = operand.size;
+		int64_t bits = size * 8;
+		uint64_t a, offset;
+		bool carry;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[1], &offset);
+		if (status != EMU_OK)
+			return status;
+
+		// A register bit offset can address memory outside of the operand
+		if ((operand.operand == MEM) && (instr->operands[1].operand != IMM))
+		{
+			int64_t signedOffset = (int64_t)SignExtend(offset, instr->operands[1].size);
+			if (signedOffset < 0)
+				signedOffset -= bits - 1;
+			operand.immediate += (signedOffset / bits) * size;
+		}
+		offset &= bits - 1;
+
+		status = ReadOperand(state, &operand, &a);
+		if (status != EMU_OK)
+			return status;
+		carry = ((a >> offset) & 1) != 0;
+
+		if (instr->operation != BT)
+		{
+			if (instr->operation == BTS)
+				a |= (uint64_t)1 << offset;
+			else if (instr->operation == BTR)
+				a &= ~((uint64_t)1 << offset);
+			else
+				a ^= (uint64_t)1 << offset;
+			status = WriteOperand(state, &operand, a);
+			if (status != EMU_OK)
+				return status;
+		}
+
+		SetFlagBit(state, X86_EFLAG_CF, carry);
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteBitScan(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint16_t bits = size * 8;
+		uint64_t a, result = 0;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[1], &a);
+		if (status != EMU_OK)
+			return status;
+
+		switch (instr->operation)
+		{
+		case BSF:
+			if (a == 0)
+				break;
+			while (((a >> result) & 1) == 0)
+				result++;
+			break;
+		case BSR:
+			if (a == 0)
+				break;
+			result = bits - 1;
+			while (((a >> result) & 1) == 0)
+				result--;
+			break;
+		case TZCNT:
+			while ((result < bits) && (((a >> result) & 1) == 0))
+				result++;
+			break;
+		case LZCNT:
+			while ((result < bits) && (((a >> (bits - 1 - result)) & 1) == 0))
+				result++;
+			break;
+		default:
+			for (; a != 0; a &= a - 1)
+				result++;
+			break;
+		}
+
+		// BSF and BSR leave the destination unchanged when the source is zero
+		if ((a != 0) || ((instr->operation != BSF) && (instr->operation != BSR)))
+		{
+			status = WriteOperand(state, &instr->operands[0], result);
+			if (status != EMU_OK)
+				return status;
+		}
+
+		if (instr->operation == POPCNT)
+		{
+			MaterializeFlags(state);
+			state->rflags &= ~(uint64_t)X86_EFLAG_STATUS;
+			if (result == 0)
+				state->rflags |= X86_EFLAG_ZF;
+		}
+		else if ((instr->operation == TZCNT) || (instr->operation == LZCNT))
+		{
+			// CF is set for a zero source, where the count is the operand size, and ZF for a zero count
+			SetFlagBit(state, X86_EFLAG_CF, a == 0);
+			SetFlagBit(state, X86_EFLAG_ZF, result == 0);
+		}
+		else
+		{
+			SetFlagBit(state, X86_EFLAG_ZF, a == 0);
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteExchange(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t a, b, result, accumulator;
+		OperandType accumulatorReg;
+		EmuResult status;
+
+		status = ReadOperand(state, &instr->operands[0], &a);
+		if (status != EMU_OK)
+			return status;
+		status = ReadOperand(state, &instr->operands[1], &b);
+		if (status != EMU_OK)
+			return status;
+
+		switch (instr->operation)
+		{
+		case XCHG:
+			// Write memory first so that a fault leaves the registers unchanged
+			if (instr->operands[0].operand == MEM)
+			{
+				status = WriteOperand(state, &instr->operands[0], b);
+				if (status != EMU_OK)
+					return status;
+				return WriteOperand(state, &instr->operands[1], a);
+			}
+			status = WriteOperand(state, &instr->operands[1], a);
+			if (status != EMU_OK)
+				return status;
+			return WriteOperand(state, &instr->operands[0], b);
+
+		case XADD:
+			result = (a + b) & SizeMask(size);
+			if (instr->operands[0].operand == MEM)
+			{
+				status = WriteOperand(state, &instr->operands[0], result);
+				if (status != EMU_OK)
+					return status;
+				WriteOperand(state, &instr->operands[1], a);
+			}
+			else
+			{
+				WriteOperand(state, &instr->operands[1], a);
+				WriteOperand(state, &instr->operands[0], result);
+			}
+			SetFlags(state, EMU_FLAGS_ADD, size, a, b, result, false, false);
+			return EMU_OK;
+
+		default:
+			accumulatorReg = GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX);
+			accumulator = ReadRegister(state, accumulatorReg);
+			if (accumulator == a)
+			{
+				status = WriteOperand(state, &instr->operands[0], b);
+				if (status != EMU_OK)
+					return status;
+			}
+			else
+			{
+				WriteRegister(state, accumulatorReg, a);
+			}
+			SetFlags(state, EMU_FLAGS_SUB, size, accumulator, a, (accumulator - a) & SizeMask(size), false, false);
+			return EMU_OK;
+		}
+	}
+
+
+	static bool IsStringCompare(InstructionOperation op)
+	{
+		return ((op >= CMPSB) && (op <= CMPSQ)) || ((op >= SCASB) && (op <= SCASQ));
+	}
+
+
+	static EmuResult ExecuteStringElement(EmuState* state, const Instruction* instr)
+	{
+		uint16_t size = instr->operands[0].size;
+		uint64_t a, b;
+		uint64_t step = (state->rflags & X86_EFLAG_DF) ? (0 - (uint64_t)size) : size;
+		OperandType index;
+		EmuResult status;
+		size_t i;
+
+		status = ReadOperand(state, &instr->operands[1], &b);
+		if (status != EMU_OK)
+			return status;
+
+		if (IsStringCompare(instr->operation))
+		{
+			status = ReadOperand(state, &instr->operands[0], &a);
+			if (status != EMU_OK)
+				return status;
+			SetFlags(state, EMU_FLAGS_SUB, size, a, b, (a - b) & SizeMask(size), false, false);
+		}
+		else
+		{
+			status = WriteOperand(state, &instr->operands[0], b);
+			if (status != EMU_OK)
+				return status;
+		}
+
+		// Advance the index register of each memory operand
+		for (i = 0; i < 2; i++)
+		{
+			if (instr->operands[i].operand != MEM)
+				continue;
+			index = instr->operands[i].components[0];
+			WriteRegister(state, index, ReadRegister(state, index) + step);
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteString(EmuState* state, const Instruction* instr)
+	{
+		OperandType counter;
+		uint64_t count;
+		EmuResult status;
+
+		// MOVSD and CMPSD are also SSE operations
+		if ((instr->operands[0].operand != MEM) && (instr->operands[1].operand != MEM))
+			return EMU_UNSUPPORTED_INSTRUCTION;
+
+		if (!(instr->flags & X86_FLAG_ANY_REP))
+			return ExecuteStringElement(state, instr);
+
+		// Registers are updated after each element, so a fault can be restarted
+		counter = GetCountRegister(state, instr);
+		for (count = ReadRegister(state, counter); count != 0; count--)
+		{
+			status = ExecuteStringElement(state, instr);
+			if (status != EMU_OK)
+				return status;
+			WriteRegister(state, counter, count - 1);
+
+			if (IsStringCompare(instr->operation))
+			{
+				if ((instr->flags & X86_FLAG_REPNE) ? GetZeroFlag(state) : !GetZeroFlag(state))
+					break;
+			}
+		}
+		return EMU_OK;
+	}
+
+
+	static EmuResult ExecuteInstruction(EmuState* state, const Instruction* instr)
+	{
+		uint64_t next = state->rip + instr->length;
+		uint16_t size = instr->operands[0].size;
+		InstructionOperand operand;
+		uint64_t a, b, sp;
+		EmuResult status = EMU_OK;
+
+		switch (instr->operation)
+		{
+		case ADD:
+		case ADC:
+		case SUB:
+		case SBB:
+		case CMP:
+		case AND:
+		case OR:
+		case XOR:
+		case TEST:
+			status = ExecuteArithmetic(state, instr);
+			break;
+
+		case INC:
+		case DEC:
+		case NEG:
+		case NOT:
+			status = ExecuteUnary(state, instr);
+			break;
+
+		case SHL:
+		case SHR:
+		case SAR:
+		case ROL:
+		case ROR:
+		case RCL:
+		case RCR:
+			status = ExecuteShift(state, instr);
+			break;
+
+		case SHLD:
+		case SHRD:
+			status = ExecuteDoubleShift(state, instr);
+			break;
+
+		case MUL:
+		case IMUL:
+			status = ExecuteMultiply(state, instr);
+			break;
+
+		case DIV:
+		case IDIV:
+			status = ExecuteDivide(state, instr);
+			break;
+
+		case BT:
+		case BTS:
+		case BTR:
+		case BTC:
+			status = ExecuteBitTest(state, instr);
+			break;
+
+		case BSF:
+		case BSR:
+		case TZCNT:
+		case LZCNT:
+		case POPCNT:
+			status = ExecuteBitScan(state, instr);
+			break;
+
+		case XCHG:
+		case XADD:
+		case CMPXCHG:
+			status = ExecuteExchange(state, instr);
+			break;
+
+		case MOV:
+		case MOVNTI:
+		case XLAT:
+		case MOVZX:
+			status = ReadOperand(state, &instr->operands[1], &a);
+			if (status == EMU_OK)
+				status = WriteOperand(state, &instr->operands[0], a);
+			break;
+
+		case MOVSX:
+		case MOVSXD:
+			status = ReadOperand(state, &instr->operands[1], &a);
+			if (status == EMU_OK)
+				status = WriteOperand(state, &instr->operands[0], SignExtend(a, instr->operands[1].size));
+			break;
+
+		case BSWAP:
+			a = ReadRegister(state, instr->operands[0].operand);
+			for (b = 0; size != 0; size--, a >>= 8)
+				b = (b << 8) | (a & 0xff);
+			status = WriteOperand(state, &instr->operands[0], b);
+			break;
+
+		case LEA:
+			// The segment base is not part of the effective address
+			operand = instr->operands[1];
+			operand.segment = SEG_DEFAULT;
+			status = WriteOperand(state, &instr->operands[0], ComputeEffectiveAddress(&operand, state->regs));
+			break;
+
+		case CBW:
+		case CWDE:
+		case CDQE:
+			size = 2 << (instr->operation - CBW);
+			a = ReadRegister(state, GetSizedRegister(size / 2, REG_AL, REG_AX, REG_EAX, REG_RAX));
+			WriteRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX), SignExtend(a, size / 2));
+			break;
+
+		case CWD:
+		case CDQ:
+		case CQO:
+			size = 2 << (instr->operation - CWD);
+			a = ReadRegister(state, GetSizedRegister(size, REG_AL, REG_AX, REG_EAX, REG_RAX));
+			WriteRegister(state, GetSizedRegister(size, REG_DL, REG_DX, REG_EDX, REG_RDX),
+				(a & SignBit(size)) ? ~(uint64_t)0 : 0);
+			break;
+
+		case CMOVO: case CMOVNO: case CMOVB: case CMOVAE: case CMOVE: case CMOVNE: case CMOVBE: case CMOVA:
+		case CMOVS: case CMOVNS: case CMOVPE: case CMOVPO: case CMOVL: case CMOVGE: case CMOVLE: case CMOVG:
+			// The destination is always written, which clears the upper half of 32-bit registers
+			status = ReadOperand(state, &instr->operands[1], &b);
+			if (status != EMU_OK)
+				break;
+			status = ReadOperand(state, &instr->operands[0], &a);
+			if (status != EMU_OK)
+				break;
+			status = WriteOperand(state, &instr->operands[0],
+				EvaluateCondition(state, (uint8_t)(instr->operation - CMOVO)) ? b : a);
+			break;
+
+		case SETO: case SETNO: case SETB: case SETAE: case SETE: case SETNE: case SETBE: case SETA:
+		case SETS: case SETNS: case SETPE: case SETPO: case SETL: case SETGE: case SETLE: case SETG:
+			status = WriteOperand(state, &instr->operands[0],
+				EvaluateCondition(state, (uint8_t)(instr->operation - SETO)) ? 1 : 0);
+			break;
+
+		case JO: case JNO: case JB: case JAE: case JE: case JNE: case JBE: case JA:
+		case JS: case JNS: case JPE: case JPO: case JL: case JGE: case JLE: case JG:
+			if (EvaluateCondition(state, (uint8_t)(instr->operation - JO)))
+				next = (uint64_t)instr->operands[0].immediate;
+			break;
+
+		case JCXZ:
+		case JECXZ:
+		case JRCXZ:
+			if (ReadRegister(state, GetCountRegister(state, instr)) == 0)
+				next = (uint64_t)instr->operands[0].immediate;
+			break;
+
+		case LOOP:
+		case LOOPE:
+		case LOOPNE:
+			a = ReadRegister(state, GetCountRegister(state, instr)) - 1;
+			WriteRegister(state, GetCountRegister(state, instr), a);
+			if ((a != 0) && ((instr->operation == LOOP) || ((instr->operation == LOOPE) == GetZeroFlag(state))))
+				next = (uint64_t)instr->operands[0].immediate;
+			break;
+
+		case JMP:
+			status = ReadOperand(state, &instr->operands[0], &next);
+			break;
+
+		case CALL:
+			status = ReadOperand(state, &instr->operands[0], &a);
+			if (status != EMU_OK)
+				break;
+			status = Push(state, next, size);
+			next = a;
+			break;
+
+		case RETN:
+			status = Pop(state, &next, GetStackOperandSize(state, instr));
+			if ((status == EMU_OK) && (instr->operands[0].operand == IMM))
+				SetStackPointer(state, GetStackPointer(state) + (uint64_t)instr->operands[0].immediate);
+			break;
+
+		case PUSH:
+			status = ReadOperand(state, &instr->operands[0], &a);
+			if (status == EMU_OK)
+				status = Push(state, a, size);
+			break;
+
+		case POP:
+			// The stack pointer is incremented before the destination is written
+			sp = GetStackPointer(state);
+			status = Pop(state, &a, size);
+			if (status != EMU_OK)
+				break;
+			status = WriteOperand(state, &instr->operands[0], a);
+			if (status != EMU_OK)
+				SetStackPointer(state, sp);
+			break;
+
+		case ENTER:
+			if ((instr->operands[1].immediate & 0x1f) != 0)
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			size = GetStackOperandSize(state, instr);
+			sp = GetStackPointer(state);
+			status = Push(state, ReadRegister(state, GetSizedRegister(size, REG_BPL, REG_BP, REG_EBP, REG_RBP)), size);
+			if (status != EMU_OK)
+				break;
+			WriteRegister(state, GetSizedRegister(size, REG_BPL, REG_BP, REG_EBP, REG_RBP), sp - size);
+			SetStackPointer(state, sp - size - (uint64_t)instr->operands[0].immediate);
+			break;
+
+		case LEAVE:
+			size = GetStackOperandSize(state, instr);
+			sp = GetStackPointer(state);
+			SetStackPointer(state, ReadRegister(state, (state->mode == 64) ? REG_RBP : REG_EBP));
+			status = Pop(state, &a, size);
+			if (status != EMU_OK)
+			{
+				SetStackPointer(state, sp);
+				break;
+			}
+			WriteRegister(state, GetSizedRegister(size, REG_BPL, REG_BP, REG_EBP, REG_RBP), a);
+			break;
+
+		case PUSHF:
+		case PUSHFD:
+		case PUSHFQ:
+			// VM and RF are never pushed
+			status = Push(state, GetEmulatorFlags(state) & 0xfcffff, 2 << (instr->operation - PUSHF));
+			break;
+
+		case POPF:
+		case POPFD:
+		case POPFQ:
+			size = 2 << (instr->operation - POPF);
+			status = Pop(state, &a, size);
+			if (status != EMU_OK)
+				break;
+			MaterializeFlags(state);
+			b = EMU_POPF_MASK & SizeMask(size);
+			state->rflags = (state->rflags & ~b) | (a & b);
+			break;
+
+		case LAHF:
+			WriteRegister(state, REG_AH, (GetEmulatorFlags(state) & 0xd5) | 2);
+			break;
+
+		case SAHF:
+			MaterializeFlags(state);
+			state->rflags = (state->rflags & ~(uint64_t)0xd5) | (ReadRegister(state, REG_AH) & 0xd5);
+			break;
+
+		case CLC:
+		case STC:
+			SetFlagBit(state, X86_EFLAG_CF, instr->operation == STC);
+			break;
+
+		case CMC:
+			SetFlagBit(state, X86_EFLAG_CF, !GetCarryFlag(state));
+			break;
+
+		case CLD:
+		case STD:
+			SetFlagBit(state, X86_EFLAG_DF, instr->operation == STD);
+			break;
+
+		case MOVSB: case MOVSW: case MOVSD: case MOVSQ:
+		case CMPSB: case CMPSW: case CMPSD: case CMPSQ:
+		case STOSB: case STOSW: case STOSD: case STOSQ:
+		case LODSB: case LODSW: case LODSD: case LODSQ:
+		case SCASB: case SCASW: case SCASD: case SCASQ:
+			status = ExecuteString(state, instr);
+			break;
+
+		case NOP:
+		case MMXNOP:
+		case PAUSE:
+		case LFENCE:
+		case MFENCE:
+		case SFENCE:
+		case PREFETCH:
+		case PREFETCHW:
+		case PREFETCHNTA:
+		case PREFETCHT0:
+		case PREFETCHT1:
+		case PREFETCHT2:
+			break;
+
+		case SYSCALL:
+			if (state->mode != 64)
+				return EMU_UNSUPPORTED_INSTRUCTION;
+			state->regs[X86_REGFILE_GPR(1)] = next;
+			state->regs[X86_REGFILE_GPR(11)] = GetEmulatorFlags(state);
+			status = EMU_SYSCALL;
+			break;
+
+		case INT3:
+			status = EMU_BREAKPOINT;
+			break;
+
+		case INT:
+		case INT1:
+			state->interrupt = (instr->operation == INT1) ? 1 : (uint8_t)instr->operands[0].immediate;
+			status = EMU_INTERRUPT;
+			break;
+
+		case INTO:
+			if (GetOverflowFlag(state))
+			{
+				state->interrupt = 4;
+				status = EMU_INTERRUPT;
+			}
+			break;
+
+		case HLT:
+			status = EMU_HALT;
+			break;
+
+		case UD2:
+			return EMU_INVALID_INSTRUCTION;
+
+		default:
+			return EMU_UNSUPPORTED_INSTRUCTION;
+		}
+
+		// Faulting instructions are restarted at the same address, traps continue with the next instruction
+		if ((status == EMU_OK) || (status == EMU_SYSCALL) || (status == EMU_BREAKPOINT) ||
+			(status == EMU_INTERRUPT) || (status == EMU_HALT))
+		{
+			SetInstructionPointer(state, next);
+			state->instructionCount++;
+		}
+		return status;
+	}
+
+
+	static EmuResult DecodeInstruction(EmuState* state, const Instruction** out)
+	{
+		EmuDecodeCacheEntry* entry = NULL;
+		Instruction* instr = &state->decoded;
+		uint8_t opcode[15];
+		size_t len;
+		bool valid;
+
+		if (state->cache)
+		{
+			entry = &state->cache[state->rip & state->cacheMask];
+			if (entry->valid && (entry->addr == state->rip))
+			{
+				*out = &entry->instr;
+				return EMU_OK;
+			}
+			entry->valid = false;
+			instr = &entry->instr;
+		}
+
+		// Fetch as many bytes as are readable, up to the maximum instruction length
+		for (len = sizeof(opcode); len > 0; len--)
+		{
+			if (state->memory.read(state->memory.context, state->rip, opcode, len))
+				break;
+		}
+		if (len == 0)
+		{
+			state->faultAddress = state->rip;
+			return EMU_MEMORY_FAULT;
+		}
+
+		if (state->mode == 64)
+			valid = Disassemble64(opcode, state->rip, len, instr);
+		else
+			valid = Disassemble32(opcode, state->rip, len, instr);
+		*out = instr;
+		if (!valid)
+		{
+			if (instr->flags & X86_FLAG_INSUFFICIENT_LENGTH)
+			{
+				state->faultAddress = state->rip + len;
+				return EMU_MEMORY_FAULT;
+			}
+			return EMU_INVALID_INSTRUCTION;
+		}
+
+		if (entry)
+		{
+			entry->addr = state->rip;
+			entry->valid = true;
+		}
+		return EMU_OK;
+	}
+
+
+	void InitEmulator(EmuState* state, uint8_t mode, const EmuMemory* memory, EmuDecodeCacheEntry* cache,
+		size_t cacheSize)
+	{
+		memset(state, 0, sizeof(EmuState));
+		state->mode = mode;
+		state->rflags = X86_EFLAG_IF | 2;
+		state->flagOp = EMU_FLAGS_NONE;
+		state->memory = *memory;
+		if (cache && cacheSize)
+		{
+			state->cache = cache;
+			state->cacheMask = cacheSize - 1;
+			FlushEmulatorDecodeCache(state);
+		}
+	}
+
+
+	void FlushEmulatorDecodeCache(EmuState* state)
+	{
+		size_t i;
+		if (!state->cache)
+			return;
+		for (i = 0; i <= state->cacheMask; i++)
+			state->cache[i].valid = false;
+	}
+
+
+	uint64_t GetEmulatorFlags(EmuState* state)
+	{
+		MaterializeFlags(state);
+		return state->rflags;
+	}
+
+
+	void SetEmulatorFlags(EmuState* state, uint64_t flags)
+	{
+		state->rflags = flags | 2;
+		state->flagOp = EMU_FLAGS_NONE;
+	}
+
+
+	EmuResult StepEmulator(EmuState* state)
+	{
+		const Instruction* instr = NULL;
+		EmuResult result = DecodeInstruction(state, &instr);
+		state->instr = instr;
+		if (result != EMU_OK)
+			return result;
+		return ExecuteInstruction(state, instr);
+	}
+
+
+	EmuResult RunEmulator(EmuState* state, uint64_t maxInstructions)
+	{
+		EmuResult result;
+		uint64_t i;
+
+		for (i = 0; i < maxInstructions; i++)
+		{
+			result = StepEmulator(state);
+			if (result != EMU_OK)
+				return result;
+		}
+		return EMU_INSTRUCTION_LIMIT;
+	}
+#ifdef __cplusplus
+}
+#endif
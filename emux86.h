@@ -0,0 +1,124 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __EMUX86_H__
+#define __EMUX86_H__
+
+#include "asmx86.h"
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	enum EmuResult
+	{
+		EMU_OK = 0,
+		EMU_INVALID_INSTRUCTION,
+		EMU_UNSUPPORTED_INSTRUCTION, // Valid, but not implemented by the interpreter
+		EMU_MEMORY_FAULT, // See faultAddress
+		EMU_DIVIDE_ERROR,
+		EMU_SYSCALL,
+		EMU_BREAKPOINT,
+		EMU_INTERRUPT, // See interrupt
+		EMU_HALT,
+		EMU_INSTRUCTION_LIMIT
+	};
+#ifndef __cplusplus
+	typedef enum EmuResult EmuResult;
+#endif
+
+
+	// Guest memory.  Each callback returns false if any part of the range is not accessible.  Instruction
+	// bytes are fetched with the read callback.
+	struct EmuMemory
+	{
+		void* context;
+		bool (*read)(void* context, uint64_t addr, void* data, size_t len);
+		bool (*write)(void* context, uint64_t addr, const void* data, size_t len);
+	};
+#ifndef __cplusplus
+	typedef struct EmuMemory EmuMemory;
+#endif
+
+
+	struct EmuDecodeCacheEntry
+	{
+		uint64_t addr;
+		bool valid;
+		Instruction instr;
+	};
+#ifndef __cplusplus
+	typedef struct EmuDecodeCacheEntry EmuDecodeCacheEntry;
+#endif
+
+
+	// Processor state of the interpreter.  The general purpose registers and segment bases use the
+	// X86_REGFILE_* layout, so memory operands can be resolved with ComputeEffectiveAddress.  The status
+	// flags are computed lazily from the last flag setting operation, use GetEmulatorFlags and
+	// SetEmulatorFlags to access the flags register.
+	struct EmuState
+	{
+		uint64_t regs[X86_REGFILE_SIZE];
+		uint64_t rip;
+		uint64_t rflags;
+		uint8_t mode; // 32 or 64
+
+		// Last flag setting operation, the flags are only materialized into rflags when needed
+		uint8_t flagOp;
+		uint8_t flagSize;
+		uint8_t flagCarry, flagOverflow;
+		uint64_t flagDest, flagSource, flagResult;
+
+		EmuMemory memory;
+		EmuDecodeCacheEntry* cache;
+		size_t cacheMask;
+		Instruction decoded; // Used when there is no decode cache
+
+		const Instruction* instr; // Most recently executed or faulting instruction
+		uint64_t faultAddress;
+		uint8_t interrupt;
+		uint64_t instructionCount;
+	};
+#ifndef __cplusplus
+	typedef struct EmuState EmuState;
+#endif
+
+
+#ifdef __cplusplus
+	extern "C"
+	{
+#endif
+		// The decode cache is optional and provided by the caller, cacheSize must be a power of two
+		void InitEmulator(EmuState* state, uint8_t mode, const EmuMemory* memory, EmuDecodeCacheEntry* cache,
+			size_t cacheSize);
+		void FlushEmulatorDecodeCache(EmuState* state);
+
+		uint64_t GetEmulatorFlags(EmuState* state);
+		void SetEmulatorFlags(EmuState* state, uint64_t flags);
+
+		EmuResult StepEmulator(EmuState* state);
+		EmuResult RunEmulator(EmuState* state, uint64_t maxInstructions);
+#ifdef __cplusplus
+	}
+}
+#endif
+
+#endif
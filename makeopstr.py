@@ -1,7 +1,8 @@
+import os
 import sys
 
 if len(sys.argv) < 2:
-	print "Usage: %s <header-file> [<output-file>]"
+	print("Usage: %s <header-file> [<output-file>]" % sys.argv[0])
 	sys.exit(1)
 
 hdr = open(sys.argv[1], "r")
@@ -40,16 +41,450 @@ if len(sys.argv) > 2:
 else:
 	out = sys.stdout
 
-out.write("static const char* operationString[] = {\n")
-for i in xrange(0, len(operation_list)):
+# Names of operations and operands, packed into one string blob with an offset and length for each name,
+# so that the tables need no relocations.  Names that are contained in a name already in the blob share
+# its characters.  The blob is padded so that the formatter can copy the maximum length of a name at once
+# and then advance by the actual length.
+max_name_len = 16
+blob = ""
+
+def add_strings(strings):
+	global blob
+	offsets = []
+	for text in sorted(set(strings), key=lambda name: (-len(name), name)):
+		if len(text) > max_name_len:
+			print("%s is longer than %d characters" % (text, max_name_len))
+			sys.exit(1)
+		if blob.find(text) < 0:
+			blob += text
+	for text in strings:
+		offsets.append(blob.find(text))
+	return offsets
+
+def write_offset_table(name, strings, offsets):
+	out.write("static const uint16_t %sOffset[] = {\n" % name)
+	for i in range(0, len(strings)):
+		if i > 0:
+			out.write(",\n")
+		out.write("\t%d" % offsets[i])
+	out.write("\n};\n")
+	out.write("static const uint8_t %sLength[] = {\n" % name)
+	for i in range(0, len(strings)):
+		if i > 0:
+			out.write(",\n")
+		out.write("\t%d" % len(strings[i]))
+	out.write("\n};\n")
+
+operation_offsets = add_strings(operation_list)
+operand_offsets = add_strings(operand_list)
+if len(blob) > 0xffff:
+	print("String blob is too large")
+	sys.exit(1)
+
+out.write("#define STRING_MAX_LENGTH %d\n" % max_name_len)
+out.write("static const char stringBlob[] =\n")
+for i in range(0, len(blob), 96):
+	out.write('\t"%s"\n' % blob[i:i + 96])
+out.write('\t"%s";\n' % ("\\0" * max_name_len))
+write_offset_table("operationString", operation_list, operation_offsets)
+write_offset_table("operandString", operand_list, operand_offsets)
+
+
+# Bitmask of the canonical register for each operand type, see X86_REGMASK_* in the header
+gpr_names = ["ax", "cx", "dx", "bx", "sp", "bp", "si", "di"]
+
+def register_bit(name):
+	if len(name) == 0:
+		return None
+	if name in ["al", "cl", "dl", "bl"]:
+		return ["al", "cl", "dl", "bl"].index(name)
+	if name in ["ah", "ch", "dh", "bh"]:
+		return ["ah", "ch", "dh", "bh"].index(name)
+	if name in ["spl", "bpl", "sil", "dil"]:
+		return ["spl", "bpl", "sil", "dil"].index(name) + 4
+	if name in gpr_names:
+		return gpr_names.index(name)
+	if (len(name) == 3) and (name[0] in "er") and (name[1:] in gpr_names):
+		return gpr_names.index(name[1:])
+	if (name[0] == "r") and name[1:].rstrip("bwd").isdigit():
+		return int(name[1:].rstrip("bwd"))
+	for prefix in ["xmm", "ymm", "zmm"]:
+		if name.startswith(prefix) and name[len(prefix):].isdigit():
+			return 16 + int(name[len(prefix):])
+	if (name == "x87") or ((name.startswith("st") or name.startswith("mm")) and name[2:].isdigit()):
+		return 48
+	if name == "flags":
+		return 49
+	if (name[0] == "k") and name[1:].isdigit():
+		return 56 + int(name[1:])
+	return None
+
+def register_mask(name):
+	bit = register_bit(name)
+	if bit is None:
+		return 0
+	return 1 << bit
+
+out.write("static const uint64_t operandRegisterMask[] = {\n")
+for i in range(0, len(operand_list)):
 	if i > 0:
 		out.write(",\n")
-	out.write('\t"%s"' % operation_list[i])
+	out.write("\t0x%xULL" % register_mask(operand_list[i]))
 out.write("\n};\n")
 
-out.write("static const char* operandString[] = {\n")
-for i in xrange(0, len(operand_list)):
+# Full register, byte offset and width of each register, see RegisterBase and friends in the header
+def register_info(name):
+	if (len(name) == 0) or (name in ["none", "imm", "mem"]):
+		return (0, 0, 0)
+	if name in ["ah", "ch", "dh", "bh"]:
+		return ("r" + ["ax", "cx", "dx", "bx"][["ah", "ch", "dh", "bh"].index(name)], 1, 1)
+	bit = register_bit(name)
+	if (bit is not None) and (bit < 16):
+		full = ("r" + gpr_names[bit]) if bit < 8 else ("r%d" % bit)
+		if name in ["al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil"] or name.endswith("b"):
+			return (full, 0, 1)
+		if (name in gpr_names) or name.endswith("w"):
+			return (full, 0, 2)
+		if name.startswith("e") or name.endswith("d"):
+			return (full, 0, 4)
+		return (full, 0, 8)
+	for prefix, width in [("xmm", 16), ("ymm", 32), ("zmm", 64)]:
+		if name.startswith(prefix) and name[len(prefix):].isdigit():
+			return ("zmm" + name[len(prefix):], 0, width)
+	if name.startswith("st"):
+		return (name, 0, 10)
+	if name in ["es", "cs", "ss", "ds", "fs", "gs"]:
+		return (name, 0, 2)
+	if name.startswith("tr"):
+		return (name, 0, 4)
+	return (name, 0, 8)
+
+out.write("const RegisterInfo asmx86RegisterInfo[] = {\n")
+for i in range(0, len(operand_list)):
+	if i > 0:
+		out.write(",\n")
+	base, offset, width = register_info(operand_list[i])
+	if base != 0:
+		base = operand_list.index(base)
+	out.write("\t{%d, %d, %d}" % (base, offset, width))
+out.write("\n};\n")
+
+# Tables of per-operation properties are generated from description files next to the header.  Each line of
+# these files lists operations at the end, optionally with suffixes that select alternate entries for
+# specific instruction forms.
+spec_dir = os.path.dirname(sys.argv[1])
+form_codes = {"1": 1, "3": 2, "8": 4, "v": 8, "m": 16}
+operation_upper = [name.upper() for name in operation_list]
+operation_upper[0] = "INVALID"
+
+def read_spec(name, field_count, parse):
+	forms = {}
+	default = None
+	for line in open(os.path.join(spec_dir, name), "r"):
+		fields = line.split("#")[0].split()
+		if len(fields) == 0:
+			continue
+		prefix = []
+		while (len(fields) > 0) and (fields[0] in ["count", "sized", "extend"]):
+			prefix.append(fields[0])
+			fields = fields[1:]
+		entry = parse(prefix, fields[0:field_count])
+		for op in fields[field_count:]:
+			if op == "*":
+				default = entry
+				continue
+			parts = op.split(":")
+			if parts[0] not in operation_upper:
+				raise ValueError("unknown operation '%s' in %s" % (parts[0], name))
+			form = 0
+			for part in parts[1:]:
+				form |= form_codes[part]
+			forms.setdefault(parts[0], []).append((form, entry))
+	return (forms, default)
+
+# Each operation has a base entry followed by a chain of alternates, most specific first.  Identical
+# entries are shared, and entry zero is all zeros for INVALID.
+def build_table(name, forms, default, empty):
+	table = [empty + (0, 0)]
+	table_index = {table[0]: 0}
+	def add_entry(entry, form, alternate):
+		key = entry + (form, alternate)
+		if key not in table_index:
+			table_index[key] = len(table)
+			table.append(key)
+		return table_index[key]
+
+	index = [0]
+	for op in operation_upper[1:]:
+		entries = forms.get(op, [(0, default)])
+		base = [entry for form, entry in entries if form == 0]
+		if len(base) != 1:
+			raise ValueError("operation '%s' needs exactly one entry without a form in %s" % (op, name))
+		alternates = sorted([(form, entry) for form, entry in entries if form != 0],
+			key=lambda x: bin(x[0]).count("1"))
+		alternate = 0
+		for form, entry in alternates:
+			alternate = add_entry(entry, form, alternate)
+		index.append(add_entry(base[0], 0, alternate))
+
+	if len(table) > 256:
+		raise ValueError("too many entries in %s" % name)
+	return (table, index)
+
+def write_table(type_name, table_name, table, fmt):
+	out.write("static const %s %s[] = {\n" % (type_name, table_name))
+	for i in range(0, len(table)):
+		if i > 0:
+			out.write(",\n")
+		out.write("\t" + fmt(table[i]))
+	out.write("\n};\n")
+
+# Operand and implicit register access
+access_codes = {"-": 0, "r": 1, "w": 2, "x": 3, "p": 4}
+
+def implicit_mask(text):
+	result = 0
+	writes_mask = False
+	if text == "-":
+		return (0, False)
+	for name in text.split(","):
+		if name == "mask":
+			writes_mask = True
+			continue
+		bit = register_bit(name)
+		if bit is None:
+			raise ValueError("unknown register '%s' in regaccess.txt" % name)
+		result |= 1 << bit
+	return (result, writes_mask)
+
+def parse_access(prefix, fields):
+	operands = 0
+	for i in range(0, len(fields[0])):
+		operands |= access_codes[fields[0][i]] << (i * 3)
+	read, read_mask = implicit_mask(fields[1])
+	written, writes_mask = implicit_mask(fields[2])
+	return (operands, 1 if (read_mask or writes_mask) else 0, read, written)
+
+forms, default = read_spec("regaccess.txt", 3, parse_access)
+table, index = build_table("regaccess.txt", forms, default, (0, 0, 0, 0))
+write_table("RegisterAccessEntry", "registerAccessTable", table,
+	lambda e: "{0x%x, %d, %d, %d, 0x%xULL, 0x%xULL}" % (e[0], e[4], e[5], e[1], e[2], e[3]))
+write_table("uint8_t", "registerAccessIndex", index, lambda i: "%d" % i)
+
+# Flag effects
+flag_bits = {"cf": 0x1, "pf": 0x4, "af": 0x10, "zf": 0x40, "sf": 0x80, "tf": 0x100, "if": 0x200, "df": 0x400,
+	"of": 0x800, "ac": 0x40000, "status": 0x8d5}
+
+def flag_mask(text):
+	result = 0
+	if text == "-":
+		return 0
+	for name in text.split(","):
+		result |= flag_bits[name]
+	return result
+
+def parse_flags(prefix, fields):
+	return tuple([flag_mask(field) for field in fields]) + (1 if "count" in prefix else 0,)
+
+forms, default = read_spec("flagaccess.txt", 5, parse_flags)
+table, index = build_table("flagaccess.txt", forms, default, (0, 0, 0, 0, 0, 0))
+write_table("FlagEffectsEntry", "flagEffectsTable", table,
+	lambda e: "{0x%x, 0x%x, 0x%x, 0x%x, 0x%x, %d, %d, %d}" % (e[0], e[1], e[2], e[3], e[4], e[6], e[7], e[5]))
+write_table("uint8_t", "flagEffectsIndex", index, lambda i: "%d" % i)
+
+# Operation attributes, see X86_ATTR_* in the header.  Attributes from every line listing an operation are
+# combined, so there are no alternate entries.
+attribute_bits = {"branch": 0x1, "conditional": 0x2, "call": 0x4, "return": 0x8, "read": 0x10, "write": 0x20,
+	"privileged": 0x40, "serializing": 0x80, "x87": 0x100, "mmx": 0x200, "sse": 0x400, "avx": 0x800,
+	"string": 0x1000}
+
+def parse_attributes(prefix, fields):
+	result = 0
+	for name in fields[0].split(","):
+		if name not in attribute_bits:
+			raise ValueError("unknown attribute '%s' in opattr.txt" % name)
+		result |= attribute_bits[name]
+	return result
+
+forms, default = read_spec("opattr.txt", 1, parse_attributes)
+attributes = [0] * len(operation_upper)
+for op, entries in forms.items():
+	for form, entry in entries:
+		if form != 0:
+			raise ValueError("operation '%s' has a form in opattr.txt" % op)
+		attributes[operation_upper.index(op)] |= entry
+
+out.write("const uint16_t asmx86OperationAttributes[] = {\n")
+for i in range(0, len(attributes)):
 	if i > 0:
 		out.write(",\n")
-	out.write('\t"%s"' % operand_list[i])
+	out.write("\t0x%x" % attributes[i])
 out.write("\n};\n")
+
+# Dense dispatch ids.  Each operation has a range of ids starting at its base, with the id at the base used for
+# shapes that are not listed.  Shapes are encoded as two bits for each of the first three operands, see
+# X86_DISPATCH_SHAPE in the header, and the shapes of a :v line also have X86_DISPATCH_VECTOR set.
+operand_kinds = {"i": 1, "m": 2, "r": 3}
+dispatch_vector = 0x40
+
+def parse_shapes(prefix, fields):
+	shapes = []
+	for shape in fields[0].split(","):
+		code = 0
+		if shape != "-":
+			if len(shape) > 3:
+				raise ValueError("shape '%s' has too many operands in dispatch.txt" % shape)
+			for i in range(0, len(shape)):
+				code |= operand_kinds[shape[i]] << (i * 2)
+		if code in shapes:
+			raise ValueError("shape '%s' is repeated in dispatch.txt" % shape)
+		shapes.append(code)
+	if "extend" in prefix:
+		return (tuple(shapes), 2)
+	return (tuple(shapes), 1 if "sized" in prefix else 0)
+
+# Operations without a :v line give shapes with X86_DISPATCH_VECTOR the ids of the same shapes without it
+forms, default = read_spec("dispatch.txt", 1, parse_shapes)
+shape_sets = [((), True)]
+dispatch_table = []
+next_id = 0
+for op in operation_upper:
+	entries = forms.get(op, [(0, ((), 0))])
+	base = [entry for form, entry in entries if form == 0]
+	vector = [entry for form, entry in entries if form == form_codes["v"]]
+	if (len(base) != 1) or (len(vector) > 1) or ((len(base) + len(vector)) != len(entries)):
+		raise ValueError("operation '%s' must be listed once without a form, and at most once with :v, in "
+			"dispatch.txt" % op)
+	shapes, sized = base[0]
+	if len(vector) > 0:
+		if vector[0][1] != sized:
+			raise ValueError("operation '%s' must be sized the same way with :v in dispatch.txt" % op)
+		shape_set = (shapes + tuple([code | dispatch_vector for code in vector[0][0]]), False)
+	else:
+		shape_set = (shapes, True)
+	if shape_set not in shape_sets:
+		shape_sets.append(shape_set)
+	dispatch_table.append((next_id, shape_sets.index(shape_set) * 128, sized))
+	next_id += (len(shape_set[0]) + 1) * [1, 4, 16][sized]
+if next_id > 0x10000:
+	raise ValueError("too many dispatch ids")
+
+shape_index = []
+for shapes, mirror in shape_sets:
+	index = [0] * 128
+	for i in range(0, len(shapes)):
+		index[shapes[i]] = i + 1
+		if mirror:
+			index[shapes[i] | dispatch_vector] = i + 1
+	shape_index += index
+
+out.write("#define DISPATCH_ID_COUNT %d\n" % next_id)
+write_table("DispatchEntry", "dispatchTable", dispatch_table, lambda e: "{%d, %d, %d}" % e)
+write_table("uint8_t", "dispatchShapeIndex", shape_index, lambda i: "%d" % i)
+
+# Instruction encodings, see EncodingEntry in asmx86.c.  Each operation has a range of entries in the table,
+# starting at its offset in the index.
+encoding_sizes = {"-": 0, "b": 1, "v": 2, "d": 3, "q": 4, "w": 5}
+encoding_operands = {"r": 1, "rm": 3, "m": 4, "o": 5, "x": 6, "xm": 8, "v": 9, "vr": 10, "a": 11, "cl": 12,
+	"1": 13, "ib": 14, "ub": 15, "iw": 16, "iz": 17, "iv": 18, "j8": 19, "j32": 20, "mo": 21, "s": 22}
+encoding_rm_register = {"r": 2, "x": 7} # Register operand placed in ModRM.rm
+encoding_maps = {"0f": 0x100, "0f38": 0x200, "0f3a": 0x300}
+encoding_pp = {"66": 1, "f3": 2, "f2": 3}
+
+def parse_encoding_operands(text, modrm, line):
+	if text == "-":
+		return ([], [])
+	kinds = []
+	sizes = []
+	for name in text.split(","):
+		size = 0
+		if (name not in encoding_operands) and name.rstrip("0123456789") in encoding_operands:
+			size = int(name[len(name.rstrip("0123456789")):]) // 8
+			name = name.rstrip("0123456789")
+		if name not in encoding_operands:
+			raise ValueError("unknown operand '%s' in encoding.txt: %s" % (name, line))
+		kinds.append(name)
+		sizes.append(size)
+
+	# Find the operand in ModRM.rm, which is the last register operand when there is no memory form
+	if modrm != 0:
+		rm = [i for i in range(0, len(kinds)) if kinds[i] in ["rm", "xm", "m"]]
+		registers = [i for i in range(0, len(kinds)) if kinds[i] in ["r", "x"]]
+		if (len(rm) == 0) and (len(registers) > 0):
+			rm = [registers[-1]]
+			kinds[registers[-1]] = kinds[registers[-1]] + "+rm"
+		if len(rm) != 1:
+			raise ValueError("encoding needs one operand in ModRM.rm in encoding.txt: %s" % line)
+		if (modrm == 1) != (len([k for k in kinds if k in ["r", "x"]]) == 1):
+			raise ValueError("encoding needs one operand in ModRM.reg with /r in encoding.txt: %s" % line)
+
+	codes = []
+	for name in kinds:
+		if name.endswith("+rm"):
+			codes.append(encoding_rm_register[name[:-3]])
+		else:
+			codes.append(encoding_operands[name])
+	return (codes, sizes)
+
+def parse_encoding(fields, line):
+	prefix = 0
+	vex = 0
+	modrm = 0
+	opcode = []
+	for i in range(0, len(fields)):
+		field = fields[i]
+		if field.startswith("vex."):
+			parts = field.split(".")[1:]
+			if parts[0] in ["128", "256"]:
+				vex |= 0x8 | (4 if parts[0] == "256" else 0) # Vector length is fixed
+				parts = parts[1:]
+			if parts[0] in encoding_pp:
+				vex |= encoding_pp[parts[0]]
+				parts = parts[1:]
+			vex |= encoding_maps[parts[0]]
+			if parts[1:] == ["w1"]:
+				vex |= 0x80
+			elif len(parts) != 1:
+				raise ValueError("invalid VEX encoding in encoding.txt: %s" % line)
+		elif field == "/r":
+			modrm = 1
+		elif field.startswith("/"):
+			modrm = 8 | int(field[1:])
+		elif (i == 0) and (field in ["66", "f2", "f3"]) and (len(fields) > 1):
+			prefix = int(field, 16)
+		else:
+			opcode.append(int(field, 16))
+	if (len(opcode) == 0) or (len(opcode) > 3):
+		raise ValueError("invalid opcode in encoding.txt: %s" % line)
+	return (prefix, vex, modrm, opcode)
+
+encodings = {}
+for line in open(os.path.join(spec_dir, "encoding.txt"), "r"):
+	line = line.split("#")[0].strip()
+	fields = line.split()
+	if len(fields) == 0:
+		continue
+	ops = [field for field in fields if field[0].isupper()]
+	encoding = fields[2:len(fields) - len(ops)]
+	if (fields[0] not in encoding_sizes) or (len(ops) == 0) or (len(encoding) == 0):
+		raise ValueError("invalid line in encoding.txt: %s" % line)
+	prefix, vex, modrm, opcode = parse_encoding(encoding, line)
+	kinds, sizes = parse_encoding_operands(fields[1], modrm, line)
+	entry = (tuple(kinds + [0] * (4 - len(kinds))), tuple(sizes + [0] * (4 - len(sizes))), encoding_sizes[fields[0]],
+		prefix, vex, modrm, tuple(opcode))
+	for op in ops:
+		if op not in operation_upper:
+			raise ValueError("unknown operation '%s' in encoding.txt" % op)
+		encodings.setdefault(op, []).append(entry)
+
+encoding_table = []
+encoding_index = []
+for op in operation_upper:
+	encoding_index.append(len(encoding_table))
+	encoding_table += encodings.get(op, [])
+encoding_index.append(len(encoding_table))
+
+write_table("EncodingEntry", "encodingTable", encoding_table,
+	lambda e: "{{%d, %d, %d, %d}, {%d, %d, %d, %d}, %d, 0x%x, 0x%x, 0x%x, %d, {%s}}" % (e[0] + e[1] + e[2:6] +
+	(len(e[6]), ", ".join(["0x%x" % b for b in e[6]]))))
+write_table("uint16_t", "encodingIndex", encoding_index, lambda i: "%d" % i)
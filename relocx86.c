@@ -0,0 +1,312 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+
+#include <stddef.h>
+#include <string.h>
+#include "relocx86.h"
+
+// Longest relocated form of an instruction, a fully prefixed LOOP branching over a 14 byte jump
+#define RELOC_MAX_LENGTH			32
+
+// Kinds of relocated instructions
+#define RELOC_COPY					0
+#define RELOC_DISPLACEMENT			1 // RIP-relative memory operand
+#define RELOC_ADDRESS				2 // LEA of a RIP-relative address
+#define RELOC_BRANCH				3
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	struct RelocEntry
+	{
+		Instruction instr;
+		uint64_t target;
+		uint8_t kind;
+		uint8_t length;
+	};
+#ifndef __cplusplus
+	typedef struct RelocEntry RelocEntry;
+#endif
+
+
+	struct RelocDest
+	{
+		const uint8_t* buf;
+		uint64_t addr;
+	};
+#ifndef __cplusplus
+	typedef struct RelocDest RelocDest;
+#endif
+
+
+	// Maps a pointer into the temporary buffer an instruction is emitted into to the address it will run at
+	static const void* TranslateToDest(const void* buf, void* param)
+	{
+		const RelocDest* dest = (const RelocDest*)param;
+		return (const void*)(size_t)(dest->addr + (uint64_t)((const uint8_t*)buf - dest->buf));
+	}
+
+
+	static bool IsRelativeBranch(const Instruction* instr)
+	{
+		if (instr->operands[0].operand != IMM)
+			return false;
+		switch (instr->operation)
+		{
+		case JMP: case CALL:
+		case JO: case JNO: case JB: case JAE: case JE: case JNE: case JBE: case JA:
+		case JS: case JNS: case JPE: case JPO: case JL: case JGE: case JLE: case JG:
+		case JCXZ: case JECXZ: case JRCXZ:
+		case LOOP: case LOOPE: case LOOPNE:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+
+	// Emits a branch whose displacement doesn't fit.  JMP and CALL use the far forms of the assembler, and
+	// conditional branches branch over a jump to the target.
+	static size_t EmitFarBranch(const uint8_t* opcode, const RelocEntry* entry, uint64_t addr, uint64_t target,
+		uint8_t* out)
+	{
+		RelocDest dest;
+		size_t len;
+
+		dest.buf = out;
+		dest.addr = addr;
+		switch (entry->instr.operation)
+		{
+		case JMP:
+			return X86_ALTEXEC_EMIT64_P(out, TranslateToDest, &dest, jmpn, (const void*)(size_t)target);
+		case CALL:
+			return X86_ALTEXEC_EMIT64_P(out, TranslateToDest, &dest, calln, (const void*)(size_t)target);
+		case JCXZ: case JECXZ: case JRCXZ:
+		case LOOP: case LOOPE: case LOOPNE:
+			// These only have 8-bit displacements, so keep the prefixes and branch over a jump to the next
+			// instruction
+			len = entry->length;
+			memcpy(out, opcode, len - 1);
+			out[len - 1] = 2;
+			out[len] = 0xeb;
+			len += 2;
+			break;
+		default:
+			out[0] = (uint8_t)((0x70 + (entry->instr.operation - JO)) ^ 1);
+			len = 2;
+			break;
+		}
+
+		out[len - 1] = (uint8_t)X86_ALTEXEC_EMIT64_P(&out[len], TranslateToDest, &dest, jmpn,
+			(const void*)(size_t)target);
+		return len + out[len - 1];
+	}
+
+
+	// Emits an instruction to run at addr, returns zero if a RIP-relative operand is out of range
+	static size_t EmitEntry(const uint8_t* opcode, const RelocEntry* entry, uint64_t addr, uint64_t target,
+		uint8_t* out)
+	{
+		Instruction branch;
+		OperandType reg;
+		int64_t diff;
+		int32_t disp;
+		size_t len;
+
+		switch (entry->kind)
+		{
+		case RELOC_BRANCH:
+			branch = entry->instr;
+			branch.operands[0].immediate = (int64_t)target;
+			len = EncodeInstruction64(&branch, addr, out);
+			if (len != 0)
+				return len;
+			return EmitFarBranch(opcode, entry, addr, target, out);
+
+		case RELOC_DISPLACEMENT:
+		case RELOC_ADDRESS:
+			diff = (int64_t)(target - (addr + entry->length));
+			if ((diff >= -0x80000000LL) && (diff <= 0x7fffffffLL))
+			{
+				disp = (int32_t)diff;
+				memcpy(out, opcode, entry->length);
+				memcpy(&out[entry->instr.ripRelOffset], &disp, 4);
+				return entry->length;
+			}
+			if (entry->kind != RELOC_ADDRESS)
+				return 0;
+
+			// The address itself is the result, so load it as an immediate.  Writing the 32-bit register
+			// zero extends, so that form is also used for 64-bit addresses that fit.
+			reg = entry->instr.operands[0].operand;
+			if (entry->instr.operands[0].size == 4)
+				return X86_EMIT64_RI(out, mov_32, reg, (int32_t)target);
+			if (target <= 0xffffffff)
+				return X86_EMIT64_RI(out, mov_32, (OperandType)(REG_EAX + (reg - REG_RAX)), (int32_t)target);
+			return X86_EMIT64_RI(out, mov_64, reg, (int64_t)target);
+
+		default:
+			memcpy(out, opcode, entry->length);
+			return entry->length;
+		}
+	}
+
+
+	static RelocResult DecodeEntries(const uint8_t* src, uint64_t srcAddr, size_t srcMaxLen, size_t minLength,
+		RelocEntry* entries, RelocInfo* info)
+	{
+		RelocEntry* entry;
+		size_t offset = 0;
+		int operand;
+
+		info->count = 0;
+		while (offset < minLength)
+		{
+			if (info->count >= RELOC_MAX_INSTRUCTIONS)
+				return RELOC_TOO_MANY_INSTRUCTIONS;
+			entry = &entries[info->count];
+			if (!Disassemble64(&src[offset], srcAddr + offset, srcMaxLen - offset, &entry->instr))
+				return RELOC_INVALID_INSTRUCTION;
+
+			entry->kind = RELOC_COPY;
+			entry->length = (uint8_t)entry->instr.length;
+			if (IsRelativeBranch(&entry->instr))
+			{
+				entry->kind = RELOC_BRANCH;
+				entry->target = (uint64_t)entry->instr.operands[0].immediate;
+			}
+			else if ((operand = GetRipRelativeOperand(&entry->instr)) >= 0)
+			{
+				entry->kind = RELOC_DISPLACEMENT;
+				entry->target = (uint64_t)entry->instr.operands[operand].immediate;
+				if ((entry->instr.operation == LEA) && (entry->instr.operands[0].size != 2))
+					entry->kind = RELOC_ADDRESS;
+			}
+
+			info->srcOffset[info->count++] = (uint16_t)offset;
+			offset += entry->length;
+		}
+		info->srcOffset[info->count] = (uint16_t)offset;
+		info->srcLength = offset;
+		return RELOC_OK;
+	}
+
+
+	// Branches into the relocated range are redirected to the relocated copy of their target
+	static bool GetEntryTarget(const RelocEntry* entry, uint64_t srcAddr, uint64_t destAddr, const RelocInfo* info,
+		uint64_t* target)
+	{
+		uint64_t offset = entry->target - srcAddr;
+		size_t i;
+
+		*target = entry->target;
+		if ((entry->kind != RELOC_BRANCH) || (offset >= info->srcLength))
+			return true;
+		for (i = 0; i < info->count; i++)
+		{
+			if (info->srcOffset[i] == offset)
+			{
+				*target = destAddr + info->destOffset[i];
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	RelocResult RelocateInstructions64(const uint8_t* src, uint64_t srcAddr, size_t srcMaxLen, size_t minLength,
+		uint8_t* dest, uint64_t destAddr, size_t destMaxLen, RelocInfo* info)
+	{
+		RelocEntry entries[RELOC_MAX_INSTRUCTIONS];
+		uint8_t code[RELOC_MAX_LENGTH];
+		uint8_t sizes[RELOC_MAX_INSTRUCTIONS];
+		uint64_t target;
+		size_t offset, len, i;
+		bool changed = true;
+		RelocResult result;
+
+		result = DecodeEntries(src, srcAddr, srcMaxLen, minLength, entries, info);
+		if (result != RELOC_OK)
+			return result;
+
+		// Start with the shortest forms and lengthen branches that don't reach until the layout is stable.
+		// Instructions never get shorter, so this terminates, and any that end up shorter than their slot
+		// are padded.
+		memset(sizes, 0, info->count);
+		memset(info->destOffset, 0, sizeof(info->destOffset));
+		while (changed)
+		{
+			changed = false;
+			offset = 0;
+			for (i = 0; i < info->count; i++)
+			{
+				info->destOffset[i] = (uint16_t)offset;
+				if (entries[i].kind == RELOC_COPY)
+					len = entries[i].length;
+				else
+				{
+					if (!GetEntryTarget(&entries[i], srcAddr, destAddr, info, &target))
+						return RELOC_INVALID_BRANCH_TARGET;
+					len = EmitEntry(&src[info->srcOffset[i]], &entries[i], destAddr + offset, target, code);
+					if (len == 0)
+						return RELOC_OUT_OF_RANGE;
+				}
+				if (len > sizes[i])
+				{
+					sizes[i] = (uint8_t)len;
+					changed = true;
+				}
+				offset += sizes[i];
+			}
+			info->destOffset[info->count] = (uint16_t)offset;
+			info->destLength = offset;
+		}
+
+		if (!dest)
+			return RELOC_OK;
+		if (info->destLength > destMaxLen)
+			return RELOC_INSUFFICIENT_SPACE;
+
+		for (i = 0; i < info->count; i++)
+		{
+			offset = info->destOffset[i];
+			GetEntryTarget(&entries[i], srcAddr, destAddr, info, &target);
+			len = EmitEntry(&src[info->srcOffset[i]], &entries[i], destAddr + offset, target, code);
+			memcpy(&dest[offset], code, len);
+			memset(&dest[offset + len], 0x90, sizes[i] - len);
+		}
+		return RELOC_OK;
+	}
+
+
+	size_t EmitJump64(uint8_t* out, uint64_t addr, uint64_t target)
+	{
+		RelocDest dest;
+		dest.buf = out;
+		dest.addr = addr;
+		return X86_ALTEXEC_EMIT64_P(out, TranslateToDest, &dest, jmpn, (const void*)(size_t)target);
+	}
+#ifdef __cplusplus
+}
+#endif
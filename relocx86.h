@@ -0,0 +1,81 @@
+// Copyright (c) 2006-2015, Rusty Wagner
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+// the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this list of conditions and the
+//      following disclaimer.
+//    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+//      the following disclaimer in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+// PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+
+#ifndef __RELOCX86_H__
+#define __RELOCX86_H__
+
+#include "asmx86.h"
+
+#define RELOC_MAX_INSTRUCTIONS		32
+
+
+#ifdef __cplusplus
+namespace asmx86
+{
+#endif
+	enum RelocResult
+	{
+		RELOC_OK = 0,
+		RELOC_INVALID_INSTRUCTION, // Could not be decoded, or ended before minLength
+		RELOC_INVALID_BRANCH_TARGET, // A branch into the middle of a relocated instruction
+		RELOC_OUT_OF_RANGE, // A RIP-relative operand can't reach its target from the destination
+		RELOC_TOO_MANY_INSTRUCTIONS,
+		RELOC_INSUFFICIENT_SPACE // See destLength for the required size
+	};
+#ifndef __cplusplus
+	typedef enum RelocResult RelocResult;
+#endif
+
+
+	// Layout of relocated code.  Entry i gives the offsets of instruction i in the source and destination,
+	// and the entry after the last instruction gives the total lengths, for mapping an instruction pointer
+	// inside the source range to the destination.
+	struct RelocInfo
+	{
+		size_t count;
+		size_t srcLength;
+		size_t destLength;
+		uint16_t srcOffset[RELOC_MAX_INSTRUCTIONS + 1];
+		uint16_t destOffset[RELOC_MAX_INSTRUCTIONS + 1];
+	};
+#ifndef __cplusplus
+	typedef struct RelocInfo RelocInfo;
+#endif
+
+
+#ifdef __cplusplus
+	extern "C"
+	{
+#endif
+		// Copies whole 64-bit instructions from src, covering at least minLength bytes, so that they run at
+		// destAddr.  Pass NULL for dest to compute the layout without writing any code.
+		RelocResult RelocateInstructions64(const uint8_t* src, uint64_t srcAddr, size_t srcMaxLen, size_t minLength,
+			uint8_t* dest, uint64_t destAddr, size_t destMaxLen, RelocInfo* info);
+
+		// Emits a jump to target from code running at addr, returns the length (5 or 14 bytes)
+		size_t EmitJump64(uint8_t* out, uint64_t addr, uint64_t target);
+#ifdef __cplusplus
+	}
+}
+#endif
+
+#endif